@@ -0,0 +1,90 @@
+/****************************************************************************
+ *
+ * Description: AES-128 block cipher.
+ *
+ ****************************************************************************/
+/**
+ * \file ZW_aes.h
+ * \brief AES-128 encryption (FIPS-197), the block cipher of S0 and S2.
+ *
+ * Both security layers only use the forward cipher: OFB, CTR and CBC-MAC
+ * never decrypt a block. A key is expanded once into an AES_KEY_SCHEDULE
+ * that is then used for any number of blocks.
+ *
+ * On x86 processors with the AES instructions (AES-NI) blocks are encrypted
+ * with them; otherwise a table based implementation is used. The choice is
+ * made at run time when a key is expanded, so the same binary runs on both.
+ *
+ * OFB and CBC-MAC chain every block to the previous one, so a single stream
+ * cannot keep the AES unit busy. AesEncryptBlocks() encrypts independent
+ * blocks, e.g. of different frames, interleaved.
+ */
+#ifndef _ZW_AES_H_
+#define _ZW_AES_H_
+
+/****************************************************************************/
+/*                              INCLUDE FILES                               */
+/****************************************************************************/
+#include <stdint.h>
+#include <ZW_typedefs.h>
+
+/****************************************************************************/
+/*                     EXPORTED TYPES and DEFINITIONS                       */
+/****************************************************************************/
+
+#define AES_BLOCK_LENGTH      16
+#define AES_KEY_LENGTH        16
+#define AES_ROUNDS            10
+
+/* Expanded key */
+typedef struct _AES_KEY_SCHEDULE_
+{
+  uint8_t roundKey[(AES_ROUNDS + 1) * AES_BLOCK_LENGTH];
+  uint8_t hw;                         /* Encrypt with AES-NI */
+} AES_KEY_SCHEDULE;
+
+/****************************************************************************/
+/*                           EXPORTED FUNCTIONS                             */
+/****************************************************************************/
+
+/**
+ * Expand a key.
+ *
+ * \param[in]  pKey      Key of AES_KEY_LENGTH bytes.
+ * \param[out] pSchedule Expanded key.
+ */
+void
+AesKeyExpand(
+  const uint8_t *pKey,
+  AES_KEY_SCHEDULE *pSchedule);
+
+/**
+ * Encrypt one block. \a pIn and \a pOut may be the same buffer.
+ */
+void
+AesEncryptBlock(
+  const AES_KEY_SCHEDULE *pSchedule,
+  const uint8_t *pIn,
+  uint8_t *pOut);
+
+/**
+ * Encrypt independent blocks, each under its own key.
+ *
+ * \param[in]  ppSchedules Key of each block.
+ * \param[in]  pIn         \a count blocks.
+ * \param[out] pOut        \a count blocks, may be \a pIn.
+ */
+void
+AesEncryptBlocks(
+  const AES_KEY_SCHEDULE *const *ppSchedules,
+  const uint8_t *pIn,
+  uint8_t *pOut,
+  uint32_t count);
+
+/**
+ * TRUE if blocks are encrypted with AES-NI.
+ */
+BOOL
+AesHardware(void);
+
+#endif /* _ZW_AES_H_ */
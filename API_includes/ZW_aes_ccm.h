@@ -0,0 +1,125 @@
+/****************************************************************************
+ *
+ * Description: AES-128 CCM authenticated encryption.
+ *
+ ****************************************************************************/
+/**
+ * \file ZW_aes_ccm.h
+ * \brief AES-128 CCM (NIST SP 800-38C, RFC 3610), the frame encryption of
+ *        Security 2.
+ *
+ * S2 uses a 13 byte nonce and an 8 byte tag; the additional data is built
+ * by the caller from the node IDs, home ID, message length, sequence number
+ * and unencrypted extensions. Other nonce and tag lengths of SP 800-38C are
+ * accepted. Additional data is limited to less than 0xFF00 bytes, the
+ * lengths that are encoded in two bytes.
+ *
+ * CCM is a CBC-MAC over the plaintext and a CTR encryption. The CBC-MAC
+ * chains every block to the previous one; the counter blocks do not depend
+ * on each other. CcmBatch() steps through several frames at once: each
+ * step encrypts the next CBC-MAC block and the next counter block of every
+ * frame in one AesEncryptBlocks() call, which interleaves them on AES-NI
+ * (see ZW_aes.h). CcmEncrypt() and CcmDecrypt() are batches of one frame.
+ */
+#ifndef _ZW_AES_CCM_H_
+#define _ZW_AES_CCM_H_
+
+/****************************************************************************/
+/*                              INCLUDE FILES                               */
+/****************************************************************************/
+#include <stdint.h>
+#include <ZW_typedefs.h>
+#include <ZW_aes.h>
+
+/****************************************************************************/
+/*                     EXPORTED TYPES and DEFINITIONS                       */
+/****************************************************************************/
+
+/* Parameters of Security 2 */
+#define S2_CCM_NONCE_LENGTH           13
+#define S2_CCM_TAG_LENGTH             8
+
+/* Limits of SP 800-38C */
+#define CCM_MIN_NONCE_LENGTH          7
+#define CCM_MAX_NONCE_LENGTH          13
+#define CCM_MIN_TAG_LENGTH            4
+#define CCM_MAX_TAG_LENGTH            16
+
+/* Largest additional data */
+#define CCM_MAX_AAD_LENGTH            0xFEFF
+
+typedef enum _E_CCM_STATUS_
+{
+  CCM_OK = 0,
+  CCM_INVALID,                        /* Bad nonce or tag length, or data too long */
+  CCM_AUTH_FAILED                     /* Tag does not match, no plaintext is output */
+} E_CCM_STATUS;
+
+/* One frame of CcmBatch() */
+typedef struct _CCM_JOB_
+{
+  const AES_KEY_SCHEDULE *pKey;
+  const uint8_t *pNonce;
+  const uint8_t *pAad;
+  const uint8_t *pIn;                 /* Plaintext, or ciphertext followed by the tag */
+  uint8_t  *pOut;                     /* Ciphertext followed by the tag, or plaintext; not overlapping pIn */
+  uint16_t aadLength;
+  uint16_t length;                    /* Bytes at pIn */
+  uint8_t  nonceLength;
+  uint8_t  tagLength;
+  uint8_t  decrypt;                   /* FALSE to encrypt */
+  uint8_t  status;                    /* Out: E_CCM_STATUS */
+} CCM_JOB;
+
+/****************************************************************************/
+/*                           EXPORTED FUNCTIONS                             */
+/****************************************************************************/
+
+/**
+ * Encrypt and authenticate.
+ *
+ * \param[out] pOut Ciphertext followed by the tag, \a length + \a tagLength bytes.
+ */
+E_CCM_STATUS
+CcmEncrypt(
+  const AES_KEY_SCHEDULE *pKey,
+  const uint8_t *pNonce,
+  uint8_t nonceLength,
+  const uint8_t *pAad,
+  uint16_t aadLength,
+  const uint8_t *pIn,
+  uint16_t length,
+  uint8_t *pOut,
+  uint8_t tagLength);
+
+/**
+ * Verify and decrypt.
+ *
+ * \param[in]  pIn    Ciphertext followed by the tag, \a length bytes.
+ * \param[out] pOut   Plaintext, \a length - \a tagLength bytes. Zeroed if
+ *                    the tag does not match.
+ */
+E_CCM_STATUS
+CcmDecrypt(
+  const AES_KEY_SCHEDULE *pKey,
+  const uint8_t *pNonce,
+  uint8_t nonceLength,
+  const uint8_t *pAad,
+  uint16_t aadLength,
+  const uint8_t *pIn,
+  uint16_t length,
+  uint8_t *pOut,
+  uint8_t tagLength);
+
+/**
+ * Encrypt or decrypt many frames. Frames may use different keys and
+ * directions.
+ *
+ * \return Frames with status CCM_OK.
+ */
+uint32_t
+CcmBatch(
+  CCM_JOB *pJobs,
+  uint32_t count);
+
+#endif /* _ZW_AES_CCM_H_ */
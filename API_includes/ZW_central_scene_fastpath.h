@@ -0,0 +1,174 @@
+/****************************************************************************
+ *
+ * Description: Direct dispatch of Central Scene notifications to scene
+ *              handlers.
+ *
+ ****************************************************************************/
+/**
+ * \file ZW_central_scene_fastpath.h
+ * \brief Central Scene fast path from the serial frame to the handlers.
+ *
+ * A button press should trigger its automation as soon as the frame is
+ * received. CentralSceneFastPathSerialFrame() is called with every complete
+ * frame from the Z-Wave module before it is queued for the generic command
+ * handling. It only looks for CENTRAL_SCENE_NOTIFICATION_V3 in
+ * FUNC_ID_APPLICATION_COMMAND_HANDLER(_BRIDGE) frames, possibly within
+ * Supervision Get and Multi Channel encapsulation. Matching handlers are then
+ * called directly.
+ *
+ * Bindings are resolved when they are made. Each node has a list of bindings
+ * in a caller-allocated pool, linked by index, so dispatching only walks that
+ * node's list and allocates nothing. Repeated notifications with the same
+ * sequence number, e.g. Supervision retransmissions, are dispatched once.
+ *
+ * The frame still takes the generic path afterwards, for the ACK, the
+ * Supervision Report and the value store. Frames the host decrypts are
+ * passed to CentralSceneFastPathCommand() once they are decrypted.
+ */
+#ifndef _ZW_CENTRAL_SCENE_FASTPATH_H_
+#define _ZW_CENTRAL_SCENE_FASTPATH_H_
+
+/****************************************************************************/
+/*                              INCLUDE FILES                               */
+/****************************************************************************/
+#include <stdint.h>
+#include <ZW_typedefs.h>
+
+/****************************************************************************/
+/*                     EXPORTED TYPES and DEFINITIONS                       */
+/****************************************************************************/
+
+/* Max node ID with bindings */
+#define CENTRAL_SCENE_MAX_NODES         232
+
+/* Binding index marking "none" */
+#define CENTRAL_SCENE_NO_BINDING        0xFFFF
+
+/* Wildcards of a binding */
+#define CENTRAL_SCENE_ANY_SCENE         0
+#define CENTRAL_SCENE_ANY_ENDPOINT      0xFF
+
+/* Convert a key attribute (CENTRAL_SCENE_NOTIFICATION_KEY_ATTRIBUTES_*) to a
+ * bit of a binding's key mask */
+#define CENTRAL_SCENE_KEY_BIT(attribute) (1u << (attribute))
+#define CENTRAL_SCENE_ALL_KEYS          0xFF
+
+typedef enum _E_CENTRAL_SCENE_RESULT_
+{
+  CENTRAL_SCENE_NOT_SCENE = 0,       /* Not a Central Scene Notification */
+  CENTRAL_SCENE_DISPATCHED,          /* At least one handler was called */
+  CENTRAL_SCENE_NO_HANDLER,          /* No binding matched */
+  CENTRAL_SCENE_DUPLICATE            /* Same sequence number as the previous one */
+} E_CENTRAL_SCENE_RESULT;
+
+/**
+ * Called from the receive path, keep it short.
+ *
+ * \param[in] keyAttributes CENTRAL_SCENE_NOTIFICATION_KEY_ATTRIBUTES_* value.
+ */
+typedef void (*CENTRAL_SCENE_HANDLER)(void *pUser, uint8_t nodeId, uint8_t endpoint, uint8_t sceneNumber,
+                                      uint8_t keyAttributes, BOOL slowRefresh);
+
+/* One binding of a handler to scenes of a node */
+typedef struct _CENTRAL_SCENE_BINDING_
+{
+  uint16_t next;                 /* Next binding of the node */
+  uint8_t  sceneNumber;          /* CENTRAL_SCENE_ANY_SCENE for all */
+  uint8_t  endpoint;             /* CENTRAL_SCENE_ANY_ENDPOINT for all */
+  uint8_t  keyMask;              /* CENTRAL_SCENE_KEY_BIT() of the key attributes wanted */
+  CENTRAL_SCENE_HANDLER pHandler;
+  void *pUser;
+} CENTRAL_SCENE_BINDING;
+
+/* Per node bindings and duplicate detection */
+typedef struct _CENTRAL_SCENE_NODE_
+{
+  uint16_t head;
+  BOOL     sequenceValid;
+  uint8_t  lastSequence;
+} CENTRAL_SCENE_NODE;
+
+/* Counters */
+typedef struct _CENTRAL_SCENE_STATS_
+{
+  uint32_t notifications;        /* Central Scene Notifications seen */
+  uint32_t dispatched;           /* Handler calls */
+  uint32_t duplicates;
+} CENTRAL_SCENE_STATS;
+
+/* Fast path instance */
+typedef struct _CENTRAL_SCENE_FAST_PATH_
+{
+  CENTRAL_SCENE_BINDING *pBindings;
+  uint16_t bindingCount;
+  uint16_t freeHead;
+  CENTRAL_SCENE_STATS stats;
+  CENTRAL_SCENE_NODE nodes[CENTRAL_SCENE_MAX_NODES + 1];
+} CENTRAL_SCENE_FAST_PATH;
+
+/****************************************************************************/
+/*                           EXPORTED FUNCTIONS                             */
+/****************************************************************************/
+
+/**
+ * Initialize the fast path with a caller allocated binding pool.
+ */
+void
+CentralSceneFastPathInit(
+  CENTRAL_SCENE_FAST_PATH *pFastPath,
+  CENTRAL_SCENE_BINDING *pBindings,
+  uint16_t bindingCount);
+
+/**
+ * Bind a handler to scenes of a node. Handlers of a node are called in the
+ * order they were bound.
+ *
+ * \param[in] endpoint    Endpoint, 0 for the root device or CENTRAL_SCENE_ANY_ENDPOINT.
+ * \param[in] sceneNumber Scene, or CENTRAL_SCENE_ANY_SCENE.
+ * \param[in] keyMask     CENTRAL_SCENE_KEY_BIT() of the key attributes wanted.
+ * \return FALSE if the pool is exhausted or the node ID is invalid.
+ */
+BOOL
+CentralSceneBind(
+  CENTRAL_SCENE_FAST_PATH *pFastPath,
+  uint8_t nodeId,
+  uint8_t endpoint,
+  uint8_t sceneNumber,
+  uint8_t keyMask,
+  CENTRAL_SCENE_HANDLER pHandler,
+  void *pUser);
+
+/**
+ * Remove all bindings of a node, e.g. when it is excluded.
+ */
+void
+CentralSceneUnbindNode(
+  CENTRAL_SCENE_FAST_PATH *pFastPath,
+  uint8_t nodeId);
+
+/**
+ * Dispatch a serial API frame received from the Z-Wave module.
+ *
+ * \param[in] pFrame  Complete frame starting with SOF, checksum included.
+ * \param[in] length  Bytes in \a pFrame.
+ */
+E_CENTRAL_SCENE_RESULT
+CentralSceneFastPathSerialFrame(
+  CENTRAL_SCENE_FAST_PATH *pFastPath,
+  const uint8_t *pFrame,
+  uint8_t length);
+
+/**
+ * Dispatch a received command, e.g. after the host decrypted it.
+ *
+ * \param[in] endpoint  Source endpoint, 0 if not Multi Channel encapsulated.
+ */
+E_CENTRAL_SCENE_RESULT
+CentralSceneFastPathCommand(
+  CENTRAL_SCENE_FAST_PATH *pFastPath,
+  uint8_t nodeId,
+  uint8_t endpoint,
+  const uint8_t *pCommand,
+  uint8_t length);
+
+#endif /* _ZW_CENTRAL_SCENE_FASTPATH_H_ */
@@ -0,0 +1,184 @@
+/****************************************************************************
+ *
+ * Description: Configuration Command Class parameter synchronization.
+ *
+ ****************************************************************************/
+/**
+ * \file ZW_config_sync.h
+ * \brief Diff based synchronization of configuration parameters.
+ *
+ * The caller keeps a table of CONFIG_SYNC_PARAM per node, sorted by parameter
+ * number, holding the size, the value last reported by the node (cached) and
+ * the value the node should have (desired).
+ *
+ * ConfigSyncPush() sends only parameters whose desired value differs from the
+ * cached one. Changed parameters with consecutive numbers and the same size
+ * are sent in one CONFIGURATION_BULK_SET_V4 frame, as many as fit the max
+ * payload size. A few unchanged parameters between two changed ones are sent
+ * along when that is cheaper than starting a new frame. ConfigSyncRefresh()
+ * reads unknown values the same way with CONFIGURATION_BULK_GET_V4.
+ *
+ * Nodes supporting Configuration CC version 1 only, and parameters reported
+ * with the No Bulk Support flag, fall back to CONFIGURATION_SET/GET of one
+ * parameter per frame.
+ */
+#ifndef _ZW_CONFIG_SYNC_H_
+#define _ZW_CONFIG_SYNC_H_
+
+/****************************************************************************/
+/*                              INCLUDE FILES                               */
+/****************************************************************************/
+#include <stdint.h>
+#include <ZW_typedefs.h>
+
+/****************************************************************************/
+/*                     EXPORTED TYPES and DEFINITIONS                       */
+/****************************************************************************/
+
+/* First Configuration CC version with the bulk commands */
+#define CONFIG_SYNC_BULK_MIN_VERSION       2
+
+/* Bulk Set header: command class, command, offset (2), count, properties */
+#define CONFIG_SYNC_BULK_SET_HEADER        6
+
+/* Bulk Get length: command class, command, offset (2), count */
+#define CONFIG_SYNC_BULK_GET_LENGTH        5
+
+/* Largest frame built: a bulk frame filling the largest max payload size */
+#define CONFIG_SYNC_MAX_FRAME_LENGTH       160
+
+/* Parameter flags */
+#define CONFIG_PARAM_FLAG_CACHED           0x01 /* cachedValue holds the node's value */
+#define CONFIG_PARAM_FLAG_DESIRED          0x02 /* desiredValue is set */
+#define CONFIG_PARAM_FLAG_READ_ONLY        0x04 /* Never written */
+#define CONFIG_PARAM_FLAG_NO_BULK          0x08 /* No Bulk Support in the Properties Report */
+#define CONFIG_PARAM_FLAG_PENDING          0x10 /* Bulk Set sent, waiting for the Bulk Report */
+
+/* One configuration parameter */
+typedef struct _CONFIG_SYNC_PARAM_
+{
+  uint16_t number;
+  uint8_t  size;                 /* 1, 2 or 4 bytes */
+  uint8_t  flags;                /* CONFIG_PARAM_FLAG_* */
+  uint32_t cachedValue;          /* Raw value, only the low size bytes are used */
+  uint32_t desiredValue;
+} CONFIG_SYNC_PARAM;
+
+/* Parameters of one node */
+typedef struct _CONFIG_SYNC_NODE_
+{
+  uint8_t  nodeId;
+  uint8_t  version;              /* Configuration CC version from the Version CC report */
+  uint8_t  maxPayload;           /* Max command length the node accepts in one frame */
+  uint16_t paramCount;
+  CONFIG_SYNC_PARAM *pParams;    /* Sorted by number */
+} CONFIG_SYNC_NODE;
+
+/* Frame counts of one push or refresh */
+typedef struct _CONFIG_SYNC_STATS_
+{
+  uint16_t bulkFrames;
+  uint16_t singleFrames;
+  uint16_t paramsChanged;        /* Parameters that had to be written or read */
+  uint16_t paramsBridged;        /* Unchanged parameters sent to join two bulk runs */
+  uint16_t paramsSkipped;        /* Parameters already in sync */
+  uint16_t paramsFailed;         /* Parameters above 255 on a node without bulk commands, never synchronized */
+} CONFIG_SYNC_STATS;
+
+/**
+ * Transmit one frame to a node. \a pFrame is only valid during the call.
+ * Return FALSE if the frame could not be queued; the sync stops and can be
+ * repeated later.
+ */
+typedef BOOL (*CONFIG_SYNC_SEND_FUNC)(void *pUser, uint8_t nodeId, const uint8_t *pFrame, uint8_t frameLength);
+
+/****************************************************************************/
+/*                           EXPORTED FUNCTIONS                             */
+/****************************************************************************/
+
+/**
+ * Initialize a node with a caller owned parameter table.
+ *
+ * \param[in] version    Configuration CC version of the node.
+ * \param[in] maxPayload Max command length, frames are split to fit.
+ * \param[in] pParams    Parameters sorted by number, number and size set.
+ */
+void
+ConfigSyncNodeInit(
+  CONFIG_SYNC_NODE *pNode,
+  uint8_t nodeId,
+  uint8_t version,
+  uint8_t maxPayload,
+  CONFIG_SYNC_PARAM *pParams,
+  uint16_t paramCount);
+
+/**
+ * Find a parameter by number, NULL if the node does not have it.
+ */
+CONFIG_SYNC_PARAM *
+ConfigSyncFind(
+  CONFIG_SYNC_NODE *pNode,
+  uint16_t number);
+
+/**
+ * Set the desired value of a parameter.
+ *
+ * \return FALSE if the node does not have the parameter or it is read-only.
+ */
+BOOL
+ConfigSyncSetDesired(
+  CONFIG_SYNC_NODE *pNode,
+  uint16_t number,
+  uint32_t value);
+
+/**
+ * Send all parameters whose desired value differs from the cached value.
+ *
+ * Bulk Sets request the handshake so the node confirms with a Bulk Report;
+ * their parameters are CONFIG_PARAM_FLAG_PENDING and not sent again until
+ * ConfigSyncReport() updates the cached value. If the report is lost,
+ * ConfigSyncInvalidate() and ConfigSyncRefresh() recover. Single Sets update
+ * the cached value when the frame is queued.
+ *
+ * \param[out] pStats Frame counts, may be NULL.
+ * \return FALSE if a frame could not be sent.
+ */
+BOOL
+ConfigSyncPush(
+  CONFIG_SYNC_NODE *pNode,
+  CONFIG_SYNC_SEND_FUNC pSend,
+  void *pUser,
+  CONFIG_SYNC_STATS *pStats);
+
+/**
+ * Request the values of all parameters without a cached value.
+ *
+ * \param[out] pStats Frame counts, may be NULL.
+ * \return FALSE if a frame could not be sent.
+ */
+BOOL
+ConfigSyncRefresh(
+  CONFIG_SYNC_NODE *pNode,
+  CONFIG_SYNC_SEND_FUNC pSend,
+  void *pUser,
+  CONFIG_SYNC_STATS *pStats);
+
+/**
+ * Update cached values from a CONFIGURATION_REPORT or CONFIGURATION_BULK_REPORT.
+ *
+ * \return TRUE if the frame was a configuration report.
+ */
+BOOL
+ConfigSyncReport(
+  CONFIG_SYNC_NODE *pNode,
+  const uint8_t *pFrame,
+  uint8_t frameLength);
+
+/**
+ * Forget all cached values, e.g. after a Default Reset.
+ */
+void
+ConfigSyncInvalidate(
+  CONFIG_SYNC_NODE *pNode);
+
+#endif /* _ZW_CONFIG_SYNC_H_ */
@@ -0,0 +1,55 @@
+/****************************************************************************
+ *
+ * Description: CRC16 (CRC-CCITT) calculation used by Z-Wave frames,
+ *              Transport Service segments and firmware images.
+ *
+ ****************************************************************************/
+/**
+ * \file ZW_crc.h
+ * \brief CRC-CCITT calculation.
+ *
+ * All CRC16 values used on the Z-Wave application layer (CRC16 encapsulation,
+ * Transport Service segments, Firmware Update Meta Data reports and the
+ * compressed firmware header) use the polynomial 0x1021 with the initial value
+ * CRC_INIT_VALUE. The result is transmitted MSB first.
+ */
+#ifndef _ZW_CRC_H_
+#define _ZW_CRC_H_
+
+/****************************************************************************/
+/*                              INCLUDE FILES                               */
+/****************************************************************************/
+#include <stdint.h>
+
+/****************************************************************************/
+/*                     EXPORTED TYPES and DEFINITIONS                       */
+/****************************************************************************/
+
+/* Initial value for a CRC16 calculation */
+#define CRC_INIT_VALUE    0x1D0F
+
+/* Polynomial used for the CRC16 calculation */
+#define CRC_POLY          0x1021
+
+/****************************************************************************/
+/*                           EXPORTED FUNCTIONS                             */
+/****************************************************************************/
+
+/**
+ * Continue a CRC16 calculation over a block of data.
+ *
+ * Start a new calculation by passing CRC_INIT_VALUE as \a crc. Feeding a block
+ * followed by its own big-endian CRC16 yields 0.
+ *
+ * \param[in] crc       CRC value of the preceding data.
+ * \param[in] pDataAddr Data to include in the calculation.
+ * \param[in] bDataLen  Number of bytes in \a pDataAddr.
+ * \return Updated CRC value.
+ */
+uint16_t
+ZW_CheckCrc16(
+  uint16_t crc,
+  const uint8_t *pDataAddr,
+  uint32_t bDataLen);
+
+#endif /* _ZW_CRC_H_ */
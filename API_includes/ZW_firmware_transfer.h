@@ -0,0 +1,181 @@
+/****************************************************************************
+ *
+ * Description: Firmware Update Meta Data transfer to a node.
+ *
+ ****************************************************************************/
+/**
+ * \file ZW_firmware_transfer.h
+ * \brief Pipelined COMMAND_CLASS_FIRMWARE_UPDATE_MD_V5 image transfer.
+ *
+ * FwTransferStart() offers an image to a node with
+ * FIRMWARE_UPDATE_MD_REQUEST_GET_V5. Once accepted, the node pulls the image
+ * with FIRMWARE_UPDATE_MD_GET_V5, each asking for a number of reports. All
+ * of them are sent back-to-back without waiting for the node in between.
+ *
+ * The fragment size is the max payload size minus the encapsulation overhead
+ * of the link (security, Multi Channel, ...) and the report header and
+ * checksum, capped by the Max Fragment Size of the node's Firmware Meta Data
+ * Report. If the node rejects it as invalid, the request is repeated with a
+ * smaller size. The checksum of every report is computed once for the whole
+ * image when the transfer starts, so answering a Get only copies data.
+ *
+ * The firmware image stays owned by the caller and must not change while a
+ * transfer is running.
+ */
+#ifndef _ZW_FIRMWARE_TRANSFER_H_
+#define _ZW_FIRMWARE_TRANSFER_H_
+
+/****************************************************************************/
+/*                              INCLUDE FILES                               */
+/****************************************************************************/
+#include <stdint.h>
+#include <ZW_typedefs.h>
+
+/****************************************************************************/
+/*                     EXPORTED TYPES and DEFINITIONS                       */
+/****************************************************************************/
+
+/* Report header (command class, command, report number) and checksum */
+#define FW_TRANSFER_REPORT_OVERHEAD      6
+
+/* Length of a FIRMWARE_UPDATE_MD_REQUEST_GET_V5 frame */
+#define FW_TRANSFER_REQUEST_GET_LENGTH   13
+
+/* Largest report built: a report filling the largest max payload size */
+#define FW_TRANSFER_MAX_FRAME_LENGTH     160
+
+/* Smallest fragment size offered after the node rejected larger ones */
+#define FW_TRANSFER_MIN_FRAGMENT         16
+
+/* Time without any frame from the node before the transfer is given up */
+#define FW_TRANSFER_TIMEOUT_MS           60000
+
+/* Report numbers are 15 bit */
+#define FW_TRANSFER_MAX_REPORTS          0x7FFF
+
+typedef enum _E_FW_TRANSFER_STATE_
+{
+  FW_TRANSFER_IDLE = 0,
+  FW_TRANSFER_REQUESTING,        /* Request Get sent, waiting for the Request Report */
+  FW_TRANSFER_SENDING,           /* Serving Gets from the node */
+  FW_TRANSFER_VERIFYING,         /* Last report sent, waiting for the Status Report */
+  FW_TRANSFER_DONE,
+  FW_TRANSFER_FAILED
+} E_FW_TRANSFER_STATE;
+
+/* Transfer counters */
+typedef struct _FW_TRANSFER_STATS_
+{
+  uint32_t startMs;
+  uint32_t doneMs;               /* Total OTA time is doneMs - startMs */
+  uint32_t bytesSent;            /* Image bytes including repeated reports */
+  uint16_t gets;                 /* FIRMWARE_UPDATE_MD_GET_V5 received */
+  uint16_t reports;              /* Reports sent */
+  uint16_t repeatedReports;      /* Reports sent more than once */
+  uint8_t  requestAttempts;      /* Request Gets sent */
+} FW_TRANSFER_STATS;
+
+/**
+ * Transmit a frame to the node with the encapsulation the overhead was
+ * given for. Return FALSE if it could not be queued.
+ */
+typedef BOOL (*FW_TRANSFER_SEND_FUNC)(void *pUser, uint8_t nodeId, const uint8_t *pFrame, uint8_t frameLength);
+
+/* Transfer to one node */
+typedef struct _FW_TRANSFER_
+{
+  uint8_t  nodeId;
+  uint8_t  state;                /* E_FW_TRANSFER_STATE */
+  uint8_t  status;               /* Request Report or Status Report status of the node */
+  uint8_t  firmwareTarget;
+  uint8_t  hardwareVersion;
+  uint8_t  activation;           /* Request delayed activation */
+  uint16_t manufacturerId;
+  uint16_t firmwareId;
+  uint16_t imageChecksum;        /* CRC16 of the whole image */
+  uint16_t fragmentSize;
+  uint16_t reportCount;
+  uint16_t highestSent;          /* Highest report number sent so far */
+  uint16_t waitTimeSec;          /* Wait time of a successful Status Report */
+  uint32_t lastActivityMs;
+  const uint8_t *pImage;
+  uint32_t imageLength;
+  uint16_t *pReportCrc;          /* Checksum per report, index report number - 1 */
+  FW_TRANSFER_SEND_FUNC pSend;
+  void *pUser;
+  FW_TRANSFER_STATS stats;
+} FW_TRANSFER;
+
+/****************************************************************************/
+/*                           EXPORTED FUNCTIONS                             */
+/****************************************************************************/
+
+/**
+ * Prepare a transfer. Nothing is sent before FwTransferStart().
+ *
+ * \param[in] pImage          Firmware image, owned by the caller.
+ * \param[in] activation      TRUE to request delayed activation.
+ */
+void
+FwTransferInit(
+  FW_TRANSFER *pTransfer,
+  uint8_t nodeId,
+  const uint8_t *pImage,
+  uint32_t imageLength,
+  uint16_t manufacturerId,
+  uint16_t firmwareId,
+  uint8_t firmwareTarget,
+  uint8_t hardwareVersion,
+  BOOL activation,
+  FW_TRANSFER_SEND_FUNC pSend,
+  void *pUser);
+
+/**
+ * Compute the fragment size and all report checksums and send the Request
+ * Get.
+ *
+ * \param[in] maxPayload      Max payload size of the link, e.g. from ZW_GetMaxPayloadSize().
+ * \param[in] overhead        Encapsulation overhead of the frames to the node.
+ * \param[in] maxFragmentSize Max Fragment Size from the node's Firmware Meta
+ *                            Data Report, 0 if unknown.
+ * \return FALSE if the image does not fit in 15 bit report numbers, memory
+ *         is short or the Request Get could not be sent.
+ */
+BOOL
+FwTransferStart(
+  FW_TRANSFER *pTransfer,
+  uint8_t maxPayload,
+  uint8_t overhead,
+  uint16_t maxFragmentSize,
+  uint32_t nowMs);
+
+/**
+ * Process a frame received from the node.
+ *
+ * \return TRUE if the frame was a Firmware Update Meta Data command for the
+ *         transfer.
+ */
+BOOL
+FwTransferFrame(
+  FW_TRANSFER *pTransfer,
+  const uint8_t *pFrame,
+  uint8_t frameLength,
+  uint32_t nowMs);
+
+/**
+ * Give up the transfer when the node stays silent. Call periodically.
+ */
+void
+FwTransferPoll(
+  FW_TRANSFER *pTransfer,
+  uint32_t nowMs);
+
+/**
+ * Release the report checksums and return to FW_TRANSFER_IDLE. Read the
+ * results first. The transfer can be started again.
+ */
+void
+FwTransferFree(
+  FW_TRANSFER *pTransfer);
+
+#endif /* _ZW_FIRMWARE_TRANSFER_H_ */
@@ -0,0 +1,210 @@
+/****************************************************************************
+ *
+ * Description: Persistent node interview cache.
+ *
+ ****************************************************************************/
+/**
+ * \file ZW_interview_cache.h
+ * \brief Memory mapped cache of node interview results.
+ *
+ * Interview results (NIF, Version CC, Manufacturer Specific, Multi Channel
+ * endpoints, Association Group Info, Configuration properties, ...) are kept
+ * as a list of records per device profile. A profile is keyed by the device
+ * identity, the fields of t_nvmDescriptor: manufacturer, product type,
+ * product, firmware ID, application version and protocol version. Nodes of
+ * the same model and firmware share one profile, so a newly included node of
+ * a known model needs no interview either.
+ *
+ * The cache is one file mapped read-write. Opening it only maps the file and
+ * checks the header; profiles are verified lazily by CRC on first use. The
+ * cached identity of a node is trusted until InterviewCacheValidate() is
+ * called with the identity the node currently reports, which costs a
+ * Manufacturer Specific Get and a Version Get instead of a full interview.
+ * Only when the identity differs, e.g. after a firmware update, does the
+ * node have to be interviewed again.
+ *
+ * Records are stored as: type (1 byte), endpoint (1 byte), length (2 bytes,
+ * host order) and length bytes of data, usually the received report.
+ */
+#ifndef _ZW_INTERVIEW_CACHE_H_
+#define _ZW_INTERVIEW_CACHE_H_
+
+/****************************************************************************/
+/*                              INCLUDE FILES                               */
+/****************************************************************************/
+#include <stdint.h>
+#include <ZW_typedefs.h>
+
+/****************************************************************************/
+/*                     EXPORTED TYPES and DEFINITIONS                       */
+/****************************************************************************/
+
+/* Max node ID with a cache entry */
+#define INTERVIEW_CACHE_MAX_NODES      232
+
+/* Length of a record header */
+#define INTERVIEW_RECORD_HEADER        4
+
+/* Device identity, same fields as t_nvmDescriptor */
+typedef struct _INTERVIEW_IDENTITY_
+{
+  uint16_t manufacturerId;
+  uint16_t firmwareId;
+  uint16_t productTypeId;
+  uint16_t productId;
+  uint16_t applicationVersion;
+  uint16_t zwaveProtocolVersion;
+} INTERVIEW_IDENTITY;
+
+/* Record types */
+typedef enum _E_INTERVIEW_RECORD_
+{
+  INTERVIEW_RECORD_NIF = 1,               /* Node Information Frame command classes */
+  INTERVIEW_RECORD_VERSION,               /* Version CC reports */
+  INTERVIEW_RECORD_MANUFACTURER_SPECIFIC, /* Manufacturer Specific and Device Specific reports */
+  INTERVIEW_RECORD_MULTI_CHANNEL,         /* Endpoint and capability reports */
+  INTERVIEW_RECORD_AGI,                   /* Association Group Info reports */
+  INTERVIEW_RECORD_CONFIGURATION,         /* Configuration properties/name/info reports */
+  INTERVIEW_RECORD_APPLICATION = 0x80     /* First type free for application use */
+} E_INTERVIEW_RECORD;
+
+typedef enum _E_INTERVIEW_CACHE_STATUS_
+{
+  INTERVIEW_CACHE_OK = 0,
+  INTERVIEW_CACHE_MISS,          /* Nothing cached for the node or identity */
+  INTERVIEW_CACHE_STALE,         /* Identity changed, the node must be interviewed */
+  INTERVIEW_CACHE_CORRUPT,       /* Profile failed verification and was dropped */
+  INTERVIEW_CACHE_INVALID,       /* Bad parameter */
+  INTERVIEW_CACHE_IO_ERROR,
+  INTERVIEW_CACHE_NO_MEMORY
+} E_INTERVIEW_CACHE_STATUS;
+
+typedef struct _INTERVIEW_CACHE_ INTERVIEW_CACHE;
+
+/****************************************************************************/
+/*                           EXPORTED FUNCTIONS                             */
+/****************************************************************************/
+
+/**
+ * Open or create a cache file. A file of another format version is
+ * discarded and recreated.
+ *
+ * \param[in]  pPath           File name.
+ * \param[in]  profileCapacity Profile slots when the file is created, rounded
+ *                             up to a power of two.
+ * \param[out] ppCache         Cache handle.
+ */
+E_INTERVIEW_CACHE_STATUS
+InterviewCacheOpen(
+  const char *pPath,
+  uint32_t profileCapacity,
+  INTERVIEW_CACHE **ppCache);
+
+/**
+ * Write the mapping to disk and close the cache.
+ */
+E_INTERVIEW_CACHE_STATUS
+InterviewCacheClose(
+  INTERVIEW_CACHE *pCache);
+
+/**
+ * Write the mapping to disk.
+ */
+E_INTERVIEW_CACHE_STATUS
+InterviewCacheSync(
+  INTERVIEW_CACHE *pCache);
+
+/**
+ * Get the cached interview of a node. The data stays valid until the next
+ * InterviewCacheStore() or until the cache is closed.
+ *
+ * \param[out] ppData    Records of the node's profile.
+ * \param[out] pLength   Length of the records.
+ * \param[out] pIdentity Identity the interview was stored for, may be NULL.
+ */
+E_INTERVIEW_CACHE_STATUS
+InterviewCacheGet(
+  INTERVIEW_CACHE *pCache,
+  uint8_t nodeId,
+  const uint8_t **ppData,
+  uint32_t *pLength,
+  INTERVIEW_IDENTITY *pIdentity);
+
+/**
+ * Get the cached interview of a device model, e.g. for a newly included node.
+ * On success the node is linked to the profile.
+ */
+E_INTERVIEW_CACHE_STATUS
+InterviewCacheAdopt(
+  INTERVIEW_CACHE *pCache,
+  uint8_t nodeId,
+  const INTERVIEW_IDENTITY *pIdentity,
+  const uint8_t **ppData,
+  uint32_t *pLength);
+
+/**
+ * Compare the identity a node reports now with the cached one.
+ *
+ * \return INTERVIEW_CACHE_OK if unchanged, INTERVIEW_CACHE_STALE if it
+ *         changed; the node entry is dropped in that case.
+ */
+E_INTERVIEW_CACHE_STATUS
+InterviewCacheValidate(
+  INTERVIEW_CACHE *pCache,
+  uint8_t nodeId,
+  const INTERVIEW_IDENTITY *pIdentity);
+
+/**
+ * Store the interview of a node, replacing the profile of its identity.
+ */
+E_INTERVIEW_CACHE_STATUS
+InterviewCacheStore(
+  INTERVIEW_CACHE *pCache,
+  uint8_t nodeId,
+  const INTERVIEW_IDENTITY *pIdentity,
+  const uint8_t *pData,
+  uint32_t length);
+
+/**
+ * Drop the entry of a node, e.g. when it is excluded. The profile is kept.
+ */
+void
+InterviewCacheRemoveNode(
+  INTERVIEW_CACHE *pCache,
+  uint8_t nodeId);
+
+/**
+ * Append a record to a buffer being built for InterviewCacheStore().
+ *
+ * \param[in,out] pLength Bytes used in \a pBuffer.
+ * \return FALSE if the record does not fit.
+ */
+BOOL
+InterviewRecordAppend(
+  uint8_t *pBuffer,
+  uint32_t capacity,
+  uint32_t *pLength,
+  uint8_t type,
+  uint8_t endpoint,
+  const uint8_t *pData,
+  uint16_t dataLength);
+
+/**
+ * Find the next record of a type and endpoint.
+ *
+ * \param[in,out] pOffset    Offset to search from; set past the record found.
+ * \param[out]    ppRecord   Record data.
+ * \param[out]    pRecordLength Length of the record data.
+ * \return FALSE if there is no further matching record.
+ */
+BOOL
+InterviewRecordFind(
+  const uint8_t *pData,
+  uint32_t length,
+  uint32_t *pOffset,
+  uint8_t type,
+  uint8_t endpoint,
+  const uint8_t **ppRecord,
+  uint16_t *pRecordLength);
+
+#endif /* _ZW_INTERVIEW_CACHE_H_ */
@@ -0,0 +1,234 @@
+/****************************************************************************
+ *
+ * Description: Parallel node interview scheduler.
+ *
+ ****************************************************************************/
+/**
+ * \file ZW_interview_scheduler.h
+ * \brief Interleaves the interview steps of many nodes on one radio.
+ *
+ * An interview is a sequence of steps, each one frame sent to the node and
+ * usually a report to wait for. The frames are built by the caller; the
+ * scheduler only decides which node sends its next step and when.
+ *
+ * The radio transmits one frame at a time, but most of a step is spent
+ * waiting for the node to answer. While one node prepares its report, the
+ * scheduler transmits the next step of another node, so up to maxOutstanding
+ * nodes wait for a report at once. Nodes take turns step by step.
+ *
+ * Listening nodes are scheduled as soon as they are added. Non-listening
+ * nodes are deferred until InterviewSchedWakeUp() reports their Wake Up
+ * Notification; an awake node goes before listening nodes because it only
+ * stays awake for a short time. When it has no step left, or it stops
+ * answering, it is sent WAKE_UP_NO_MORE_INFORMATION and waits for its next
+ * wake-up.
+ *
+ * Transmit airtime is budgeted from the TX timers of the protocol
+ * (ZW_GetTxTimer() summed over all channels): no frame is started while the
+ * airtime spent in the current window exceeds the budget.
+ */
+#ifndef _ZW_INTERVIEW_SCHEDULER_H_
+#define _ZW_INTERVIEW_SCHEDULER_H_
+
+/****************************************************************************/
+/*                              INCLUDE FILES                               */
+/****************************************************************************/
+#include <stdint.h>
+#include <ZW_typedefs.h>
+
+/****************************************************************************/
+/*                     EXPORTED TYPES and DEFINITIONS                       */
+/****************************************************************************/
+
+/* Max node ID that can be interviewed */
+#define INTERVIEW_SCHED_MAX_NODES        232
+
+/* Largest frame a step can send */
+#define INTERVIEW_SCHED_MAX_FRAME        64
+
+/* Time to wait for the report of a step before it is repeated */
+#define INTERVIEW_SCHED_TIMEOUT_MS       3000
+
+/* Repetitions of a step before the interview of a listening node is failed */
+#define INTERVIEW_SCHED_MAX_RETRIES      2
+
+typedef enum _E_INTERVIEW_NODE_STATE_
+{
+  INTERVIEW_NODE_IDLE = 0,
+  INTERVIEW_NODE_ASLEEP,         /* Non-listening, waiting for its wake-up */
+  INTERVIEW_NODE_READY,          /* Waiting for its turn to transmit */
+  INTERVIEW_NODE_TRANSMITTING,   /* Step frame handed to the protocol */
+  INTERVIEW_NODE_WAITING,        /* Waiting for the report of the step */
+  INTERVIEW_NODE_DONE,
+  INTERVIEW_NODE_FAILED
+} E_INTERVIEW_NODE_STATE;
+
+/* Interview state per node */
+typedef struct _INTERVIEW_SCHED_NODE_
+{
+  uint32_t startMs;              /* Time the first step was sent */
+  uint32_t lastActivityMs;
+  uint32_t doneMs;
+  uint16_t step;                 /* Step being executed, counted from 0 */
+  uint8_t  state;                /* E_INTERVIEW_NODE_STATE */
+  uint8_t  listening;
+  uint8_t  started;
+  uint8_t  expectReport;         /* Step waits for a report */
+  uint8_t  noMoreInfo;           /* Frame on the radio is WAKE_UP_NO_MORE_INFORMATION */
+  uint8_t  retries;
+  uint8_t  queued;
+  uint8_t  next;                 /* Ready queue link */
+} INTERVIEW_SCHED_NODE;
+
+/* Totals of a run */
+typedef struct _INTERVIEW_SCHED_STATS_
+{
+  uint32_t firstStartMs;
+  uint32_t lastDoneMs;           /* Total interview time is lastDoneMs - firstStartMs */
+  uint32_t frames;
+  uint32_t retries;
+  uint32_t budgetStalls;         /* Polls that could not transmit for lack of airtime */
+  uint16_t nodesDone;
+  uint16_t nodesFailed;
+} INTERVIEW_SCHED_STATS;
+
+/**
+ * Build the frame of a step of a node.
+ *
+ * \param[out] pFrame        Buffer of INTERVIEW_SCHED_MAX_FRAME bytes.
+ * \param[out] pFrameLength  Length of the frame.
+ * \param[out] pExpectReport Set to FALSE if the step is complete once the
+ *                           frame is acknowledged.
+ * \return FALSE if the node has no further step, i.e. its interview is done.
+ */
+typedef BOOL (*INTERVIEW_STEP_FUNC)(void *pUser, uint8_t nodeId, uint16_t step,
+                                    uint8_t *pFrame, uint8_t *pFrameLength, BOOL *pExpectReport);
+
+/**
+ * Transmit a frame. Return FALSE if it could not be queued; it is retried
+ * on the next poll. Completion is reported with InterviewSchedTxDone().
+ */
+typedef BOOL (*INTERVIEW_SEND_FUNC)(void *pUser, uint8_t nodeId, const uint8_t *pFrame, uint8_t frameLength);
+
+/**
+ * Return the airtime transmitted so far in ms, the sum of ZW_GetTxTimer()
+ * over all channels. Only differences are used, so it may wrap.
+ */
+typedef uint32_t (*INTERVIEW_TX_TIME_FUNC)(void *pUser);
+
+/**
+ * Notify that the interview of a node finished, \a success is FALSE if it
+ * was given up.
+ */
+typedef void (*INTERVIEW_DONE_FUNC)(void *pUser, uint8_t nodeId, BOOL success);
+
+/* Scheduler instance */
+typedef struct _INTERVIEW_SCHED_
+{
+  INTERVIEW_STEP_FUNC pStep;
+  INTERVIEW_SEND_FUNC pSend;
+  INTERVIEW_TX_TIME_FUNC pTxTime;
+  INTERVIEW_DONE_FUNC pDone;
+  void *pUser;
+  uint32_t airtimeBudgetMs;      /* Max airtime per window, 0 for no limit */
+  uint32_t airtimeWindowMs;
+  uint32_t windowStartMs;
+  uint32_t windowStartTxMs;
+  uint8_t  maxOutstanding;
+  uint8_t  outstanding;          /* Nodes in INTERVIEW_NODE_WAITING */
+  uint8_t  transmitting;         /* Node whose frame is on the radio, 0 if none */
+  uint8_t  awakeHead;            /* Ready queue of awake non-listening nodes */
+  uint8_t  awakeTail;
+  uint8_t  listeningHead;        /* Ready queue of listening nodes */
+  uint8_t  listeningTail;
+  INTERVIEW_SCHED_STATS stats;
+  INTERVIEW_SCHED_NODE nodes[INTERVIEW_SCHED_MAX_NODES + 1];
+} INTERVIEW_SCHED;
+
+/****************************************************************************/
+/*                           EXPORTED FUNCTIONS                             */
+/****************************************************************************/
+
+/**
+ * Initialize the scheduler.
+ *
+ * \param[in] maxOutstanding  Max nodes waiting for a report at a time.
+ * \param[in] airtimeBudgetMs Max airtime per window, 0 for no limit.
+ * \param[in] airtimeWindowMs Length of the budget window.
+ * \param[in] pTxTime         Airtime source, may be NULL if there is no budget.
+ */
+void
+InterviewSchedInit(
+  INTERVIEW_SCHED *pSched,
+  uint8_t maxOutstanding,
+  uint32_t airtimeBudgetMs,
+  uint32_t airtimeWindowMs,
+  INTERVIEW_STEP_FUNC pStep,
+  INTERVIEW_SEND_FUNC pSend,
+  INTERVIEW_TX_TIME_FUNC pTxTime,
+  INTERVIEW_DONE_FUNC pDone,
+  void *pUser);
+
+/**
+ * Add a node to interview. A non-listening node starts at its next wake-up.
+ *
+ * \return FALSE if the node is already being interviewed or the ID is invalid.
+ */
+BOOL
+InterviewSchedAdd(
+  INTERVIEW_SCHED *pSched,
+  uint8_t nodeId,
+  BOOL listening);
+
+/**
+ * Report a Wake Up Notification of a node.
+ *
+ * \return TRUE if the node has interview steps pending.
+ */
+BOOL
+InterviewSchedWakeUp(
+  INTERVIEW_SCHED *pSched,
+  uint8_t nodeId,
+  uint32_t nowMs);
+
+/**
+ * Report the transmit completion of the frame sent for a node.
+ *
+ * \param[in] acked FALSE if the node did not acknowledge the frame.
+ */
+void
+InterviewSchedTxDone(
+  INTERVIEW_SCHED *pSched,
+  uint8_t nodeId,
+  BOOL acked,
+  uint32_t nowMs);
+
+/**
+ * Report that the report expected for the current step of a node was
+ * received. The node moves on to its next step.
+ *
+ * \return TRUE if the node was waiting for a report.
+ */
+BOOL
+InterviewSchedReport(
+  INTERVIEW_SCHED *pSched,
+  uint8_t nodeId,
+  uint32_t nowMs);
+
+/**
+ * Start the next frame and handle timeouts. Call after every transmit
+ * completion and report, and periodically.
+ */
+void
+InterviewSchedPoll(
+  INTERVIEW_SCHED *pSched,
+  uint32_t nowMs);
+
+/**
+ * TRUE while any node has an interview in progress, asleep nodes included.
+ */
+BOOL
+InterviewSchedBusy(
+  const INTERVIEW_SCHED *pSched);
+
+#endif /* _ZW_INTERVIEW_SCHEDULER_H_ */
@@ -0,0 +1,217 @@
+/****************************************************************************
+ *
+ * Description: Disk backed Mailbox queues for sleeping nodes.
+ *
+ ****************************************************************************/
+/**
+ * \file ZW_mailbox_queue.h
+ * \brief Per node frame queues of a Mailbox service (COMMAND_CLASS_MAILBOX)
+ * kept in an append-only, memory mapped log.
+ *
+ * Frames for a sleeping node, e.g. received in MAILBOX_QUEUE Push mode, are
+ * appended to one log file. Each record links to the next record of the same
+ * node, so only the head, tail and counters of each node are kept in RAM.
+ * Tens of thousands of queued frames cost no more RAM than an empty queue,
+ * and the queues survive a restart. On open the log is scanned once. A torn
+ * record at the end is dropped and the links are rebuilt.
+ *
+ * When the node wakes up, MailboxQueueWakeUp() delivers at most a given
+ * number of frames from the head of its queue. Each frame costs one record
+ * access and no allocation. A delivered record is only marked in place.
+ *
+ * Delivered records are removed by compaction, which copies the queued
+ * records to a new log and then replaces the old one. MailboxQueueCompact()
+ * only takes the queue lock for MAILBOX_QUEUE_COMPACT_CHUNK records at a
+ * time, so it can run on a background thread, see
+ * MailboxQueueStartCompactor(), without stalling a wake-up for more than one
+ * chunk.
+ */
+#ifndef _ZW_MAILBOX_QUEUE_H_
+#define _ZW_MAILBOX_QUEUE_H_
+
+/****************************************************************************/
+/*                              INCLUDE FILES                               */
+/****************************************************************************/
+#include <stdint.h>
+#include <ZW_typedefs.h>
+
+/****************************************************************************/
+/*                     EXPORTED TYPES and DEFINITIONS                       */
+/****************************************************************************/
+
+/* Max node ID with a queue */
+#define MAILBOX_QUEUE_MAX_NODES         232
+
+/* Max length of a queued frame */
+#define MAILBOX_QUEUE_MAX_FRAME         255
+
+/* The log file grows in steps of this size */
+#define MAILBOX_QUEUE_GROW_BYTES        (1024UL * 1024)
+
+/* Records copied per lock hold during compaction */
+#define MAILBOX_QUEUE_COMPACT_CHUNK     256
+
+/* The background compactor runs when delivered records take more space
+ * than queued ones and at least this many bytes */
+#define MAILBOX_QUEUE_COMPACT_MIN_BYTES (256UL * 1024)
+
+typedef enum _E_MAILBOX_QUEUE_STATUS_
+{
+  MAILBOX_QUEUE_OK = 0,
+  MAILBOX_QUEUE_EMPTY,           /* Nothing queued for the node */
+  MAILBOX_QUEUE_FULL,            /* Log reached its max size, compaction may free space */
+  MAILBOX_QUEUE_INVALID,         /* Bad node ID or frame length */
+  MAILBOX_QUEUE_IO_ERROR,
+  MAILBOX_QUEUE_NO_MEMORY,
+  MAILBOX_QUEUE_BUSY             /* A compaction is already running */
+} E_MAILBOX_QUEUE_STATUS;
+
+/**
+ * Send a frame to a node that woke up. Called without the queue lock held.
+ *
+ * \return FALSE if the frame could not be sent. It stays queued and the
+ *         delivery stops.
+ */
+typedef BOOL (*MAILBOX_QUEUE_SEND_FUNC)(void *pUser, uint8_t nodeId, const uint8_t *pFrame, uint8_t length);
+
+/* Counters */
+typedef struct _MAILBOX_QUEUE_STATS_
+{
+  uint32_t queuedFrames;         /* Frames queued for all nodes */
+  uint64_t queuedBytes;          /* Log bytes of queued frames */
+  uint64_t garbageBytes;         /* Log bytes of delivered frames */
+  uint64_t fileBytes;            /* Size of the log file */
+  uint32_t compactions;
+} MAILBOX_QUEUE_STATS;
+
+typedef struct _MAILBOX_QUEUE_ MAILBOX_QUEUE;
+
+/****************************************************************************/
+/*                           EXPORTED FUNCTIONS                             */
+/****************************************************************************/
+
+/**
+ * Open or create a log file.
+ *
+ * \param[in]  pPath       File name. Compaction writes \a pPath with
+ *                         ".compact" appended and renames it.
+ * \param[in]  maxLogBytes Max size of the log file. This much address space
+ *                         is reserved for the mapping.
+ * \param[out] ppQueue     Queue handle.
+ * \return MAILBOX_QUEUE_FULL if an existing log is larger than
+ *         \a maxLogBytes. The file is not modified.
+ */
+E_MAILBOX_QUEUE_STATUS
+MailboxQueueOpen(
+  const char *pPath,
+  uint64_t maxLogBytes,
+  MAILBOX_QUEUE **ppQueue);
+
+/**
+ * Stop the compactor, write the log to disk and close it.
+ */
+E_MAILBOX_QUEUE_STATUS
+MailboxQueueClose(
+  MAILBOX_QUEUE *pQueue);
+
+/**
+ * Write the log to disk.
+ */
+E_MAILBOX_QUEUE_STATUS
+MailboxQueueSync(
+  MAILBOX_QUEUE *pQueue);
+
+/**
+ * Append a frame to the queue of a node.
+ *
+ * \param[in] timestamp Reception time in seconds, returned by MailboxQueueFront().
+ */
+E_MAILBOX_QUEUE_STATUS
+MailboxQueuePush(
+  MAILBOX_QUEUE *pQueue,
+  uint8_t nodeId,
+  const uint8_t *pFrame,
+  uint8_t length,
+  uint32_t timestamp);
+
+/**
+ * Copy the frame at the head of the queue of a node.
+ *
+ * \param[out] pFrame     Buffer of MAILBOX_QUEUE_MAX_FRAME bytes.
+ * \param[out] pLength    Length of the frame.
+ * \param[out] pTimestamp Timestamp passed to MailboxQueuePush(), may be NULL.
+ */
+E_MAILBOX_QUEUE_STATUS
+MailboxQueueFront(
+  MAILBOX_QUEUE *pQueue,
+  uint8_t nodeId,
+  uint8_t *pFrame,
+  uint8_t *pLength,
+  uint32_t *pTimestamp);
+
+/**
+ * Remove the frame at the head of the queue of a node, once it was sent.
+ */
+E_MAILBOX_QUEUE_STATUS
+MailboxQueuePop(
+  MAILBOX_QUEUE *pQueue,
+  uint8_t nodeId);
+
+/**
+ * Deliver queued frames to a node that woke up, oldest first.
+ *
+ * \param[in] maxFrames Max frames to deliver, bounding the time spent.
+ * \return Number of frames delivered.
+ */
+uint16_t
+MailboxQueueWakeUp(
+  MAILBOX_QUEUE *pQueue,
+  uint8_t nodeId,
+  uint16_t maxFrames,
+  MAILBOX_QUEUE_SEND_FUNC pSend,
+  void *pUser);
+
+/**
+ * Drop all frames queued for a node, e.g. when it is excluded or failing.
+ */
+void
+MailboxQueueDropNode(
+  MAILBOX_QUEUE *pQueue,
+  uint8_t nodeId);
+
+/**
+ * Number of frames queued for a node.
+ */
+uint32_t
+MailboxQueueCount(
+  MAILBOX_QUEUE *pQueue,
+  uint8_t nodeId);
+
+/**
+ * Rewrite the log without the delivered records. May be called from any
+ * thread. The new log is written to disk before it replaces the old one.
+ *
+ * \return MAILBOX_QUEUE_BUSY at once if a compaction is already running.
+ */
+E_MAILBOX_QUEUE_STATUS
+MailboxQueueCompact(
+  MAILBOX_QUEUE *pQueue);
+
+/**
+ * Start a thread compacting the log whenever delivered records take more
+ * space than queued ones, see MAILBOX_QUEUE_COMPACT_MIN_BYTES. It is stopped
+ * by MailboxQueueClose().
+ */
+E_MAILBOX_QUEUE_STATUS
+MailboxQueueStartCompactor(
+  MAILBOX_QUEUE *pQueue);
+
+/**
+ * Read the counters.
+ */
+void
+MailboxQueueGetStats(
+  MAILBOX_QUEUE *pQueue,
+  MAILBOX_QUEUE_STATS *pStats);
+
+#endif /* _ZW_MAILBOX_QUEUE_H_ */
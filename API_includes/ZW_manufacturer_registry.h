@@ -0,0 +1,53 @@
+/****************************************************************************
+ *
+ * Description: Compiled Z-Wave Manufacturer ID registry.
+ *
+ ****************************************************************************/
+/**
+ * \file ZW_manufacturer_registry.h
+ * \brief Manufacturer ID to name lookup.
+ *
+ * The registry is compiled from "Registries/Z-Wave Manufacturer ID List.xlsx"
+ * by tools/gen_manufacturer_registry.py into a read-only perfect hash table
+ * (ZW_manufacturer_registry_table.c). Names are interned in one string pool.
+ * A lookup hashes the ID, probes exactly one slot and compares the stored
+ * ID; nothing is parsed or allocated at run time.
+ */
+#ifndef _ZW_MANUFACTURER_REGISTRY_H_
+#define _ZW_MANUFACTURER_REGISTRY_H_
+
+/****************************************************************************/
+/*                              INCLUDE FILES                               */
+/****************************************************************************/
+#include <stdint.h>
+
+/****************************************************************************/
+/*                           EXPORTED FUNCTIONS                             */
+/****************************************************************************/
+
+/**
+ * Name of the manufacturer assigned \a manufacturerId.
+ *
+ * \param[in] manufacturerId Manufacturer ID of a Manufacturer Specific Report.
+ * \return UTF-8 name, or NULL if the ID is not assigned.
+ */
+const char *
+ManufacturerRegistryName(
+  uint16_t manufacturerId);
+
+/**
+ * Name the manufacturer was formerly known as.
+ *
+ * \return UTF-8 name, or NULL if the ID is not assigned or was never renamed.
+ */
+const char *
+ManufacturerRegistryFormerName(
+  uint16_t manufacturerId);
+
+/**
+ * Number of assigned Manufacturer IDs in the registry.
+ */
+uint16_t
+ManufacturerRegistryCount(void);
+
+#endif /* _ZW_MANUFACTURER_REGISTRY_H_ */
@@ -0,0 +1,162 @@
+/****************************************************************************
+ *
+ * Description: Compressed time-series store for Meter Reports.
+ *
+ ****************************************************************************/
+/**
+ * \file ZW_meter_store.h
+ * \brief Embedded, delta encoded time-series store for Meter Reports.
+ *
+ * Meter Reports (COMMAND_CLASS_METER_V5, versions 1 to 5) are stored per
+ * series, keyed by node, endpoint, meter type, scale and rate type. Points
+ * of a series are bit packed into blocks of at most METER_STORE_BLOCK_BYTES:
+ *
+ * - timestamps as delta-of-delta with variable length prefix codes, so a
+ *   meter reporting at a fixed interval costs one bit per timestamp;
+ * - raw meter values as zigzag encoded deltas from the previous value, so
+ *   an unchanged or slowly increasing counter costs a few bits.
+ *
+ * Full blocks are appended to a single file. Range queries map the file
+ * read-only and decode only the blocks of the series that overlap the
+ * requested range; the block list of every series is kept in memory and
+ * rebuilt from the block headers when the store is opened.
+ *
+ * The delta time and previous value fields of version 2+ reports are used to
+ * drop reports repeating the last stored reading and to recover the previous
+ * reading when reports were missed.
+ */
+#ifndef _ZW_METER_STORE_H_
+#define _ZW_METER_STORE_H_
+
+/****************************************************************************/
+/*                              INCLUDE FILES                               */
+/****************************************************************************/
+#include <stdint.h>
+#include <stddef.h>
+#include <ZW_typedefs.h>
+
+/****************************************************************************/
+/*                     EXPORTED TYPES and DEFINITIONS                       */
+/****************************************************************************/
+
+/* Max encoded payload of one block */
+#define METER_STORE_BLOCK_BYTES     1024
+
+/* Build a series key */
+#define METER_STORE_KEY(node, endpoint, meterType, scale, rateType) \
+  (((uint64_t)(node) << 40) | ((uint64_t)(endpoint) << 32) | ((uint64_t)(meterType) << 24) \
+   | ((uint64_t)(rateType) << 16) | (uint64_t)(scale))
+
+/* Scale field of a series key. Scale 7 with a Scale 2 byte maps to 8 + scale2 */
+#define METER_STORE_KEY_SCALE(key)  ((uint16_t)(key))
+
+typedef enum _E_METER_STORE_STATUS_
+{
+  METER_STORE_OK = 0,
+  METER_STORE_DUPLICATE,        /* Report repeats the last stored reading, not stored */
+  METER_STORE_OUT_OF_ORDER,     /* Timestamp older than the last point of the series */
+  METER_STORE_INVALID,          /* Not a valid Meter Report */
+  METER_STORE_IO_ERROR,
+  METER_STORE_NO_MEMORY
+} E_METER_STORE_STATUS;
+
+/**
+ * Receive one point of a range query.
+ *
+ * \param[in] timestamp Seconds, as passed when the point was stored.
+ * \param[in] rawValue  Meter value without precision applied.
+ * \param[in] precision Number of decimals of \a rawValue.
+ * \return FALSE to stop the query.
+ */
+typedef BOOL (*METER_STORE_VISIT_FUNC)(void *pUser, uint32_t timestamp, int32_t rawValue, uint8_t precision);
+
+typedef struct _METER_STORE_ METER_STORE;
+
+/****************************************************************************/
+/*                           EXPORTED FUNCTIONS                             */
+/****************************************************************************/
+
+/**
+ * Open or create a store file.
+ *
+ * A block left incomplete by a crash is truncated away.
+ *
+ * \param[in]  pPath   File name.
+ * \param[out] ppStore Store handle.
+ */
+E_METER_STORE_STATUS
+MeterStoreOpen(
+  const char *pPath,
+  METER_STORE **ppStore);
+
+/**
+ * Write all open blocks and close the store.
+ */
+E_METER_STORE_STATUS
+MeterStoreClose(
+  METER_STORE *pStore);
+
+/**
+ * Write all open blocks to the file. Points appended afterwards go to new blocks.
+ */
+E_METER_STORE_STATUS
+MeterStoreFlush(
+  METER_STORE *pStore);
+
+/**
+ * Store a received Meter Report.
+ *
+ * \param[in] nodeId      Source node.
+ * \param[in] endpoint    Source endpoint, 0 for the root device.
+ * \param[in] pFrame      Report starting with the command class byte.
+ * \param[in] frameLength Length of \a pFrame.
+ * \param[in] timestamp   Reception time in seconds.
+ */
+E_METER_STORE_STATUS
+MeterStoreAppendReport(
+  METER_STORE *pStore,
+  uint8_t nodeId,
+  uint8_t endpoint,
+  const uint8_t *pFrame,
+  uint8_t frameLength,
+  uint32_t timestamp);
+
+/**
+ * Store one point of a series.
+ */
+E_METER_STORE_STATUS
+MeterStoreAppend(
+  METER_STORE *pStore,
+  uint64_t key,
+  uint32_t timestamp,
+  int32_t rawValue,
+  uint8_t precision);
+
+/**
+ * Visit all points of a series with fromTimestamp <= timestamp <= toTimestamp
+ * in time order. Flushed blocks are read through a read-only file mapping.
+ */
+E_METER_STORE_STATUS
+MeterStoreQuery(
+  METER_STORE *pStore,
+  uint64_t key,
+  uint32_t fromTimestamp,
+  uint32_t toTimestamp,
+  METER_STORE_VISIT_FUNC pVisit,
+  void *pUser);
+
+/**
+ * Number of series in the store.
+ */
+uint32_t
+MeterStoreSeriesCount(
+  const METER_STORE *pStore);
+
+/**
+ * Size of the store file in bytes, excluding open blocks.
+ */
+uint64_t
+MeterStoreFileSize(
+  const METER_STORE *pStore);
+
+#endif /* _ZW_METER_STORE_H_ */
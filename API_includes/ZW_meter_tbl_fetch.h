@@ -0,0 +1,206 @@
+/****************************************************************************
+ *
+ * Description: Bulk historical data fetch pipeline for Meter Table Monitor.
+ *
+ ****************************************************************************/
+/**
+ * \file ZW_meter_tbl_fetch.h
+ * \brief Pipelined METER_TBL_HISTORICAL_DATA_GET_V2 fetching.
+ *
+ * A fetch job covers a time range and a set of datasets of one node. The
+ * job is split into requests asking for METER_TBL_FETCH_MAX_REPORTS reports,
+ * all requested datasets at once. When the node's capture interval is known,
+ * each request covers exactly the time that many reports span; otherwise the
+ * whole remaining range is requested and the next request continues after
+ * the last received timestamp when the node returned the maximum number of
+ * reports.
+ *
+ * At most one request is outstanding per node, while requests to different
+ * nodes are issued in parallel up to a global in-flight limit. Reports are
+ * decoded in place from the received frame straight into the columns of a
+ * METER_TBL_SINK; the sink callback is invoked when the columns are full or
+ * on MeterTblFetchFlush().
+ */
+#ifndef _ZW_METER_TBL_FETCH_H_
+#define _ZW_METER_TBL_FETCH_H_
+
+/****************************************************************************/
+/*                              INCLUDE FILES                               */
+/****************************************************************************/
+#include <stdint.h>
+#include <ZW_typedefs.h>
+
+/****************************************************************************/
+/*                     EXPORTED TYPES and DEFINITIONS                       */
+/****************************************************************************/
+
+/* Max node ID a job can be started for */
+#define METER_TBL_FETCH_MAX_NODES        232
+
+/* Largest Maximum Reports value of a Historical Data Get */
+#define METER_TBL_FETCH_MAX_REPORTS      255
+
+/* Length of a METER_TBL_HISTORICAL_DATA_GET_V2 frame */
+#define METER_TBL_FETCH_GET_LENGTH       20
+
+/* Time to wait for the next report before a request is repeated */
+#define METER_TBL_FETCH_TIMEOUT_MS       10000
+
+/* Repetitions of a request before the job is failed */
+#define METER_TBL_FETCH_MAX_RETRIES      3
+
+/* Caller owned output columns. All arrays hold capacity rows */
+typedef struct _METER_TBL_SINK_
+{
+  uint32_t *pTimestamp;          /* Seconds, meter local time converted with the job offset */
+  uint8_t  *pNodeId;
+  uint8_t  *pDataset;            /* Dataset bit number, 0..23 */
+  uint8_t  *pScale;
+  uint8_t  *pPrecision;
+  int32_t  *pValue;              /* Raw value, divide by 10^precision */
+  uint32_t capacity;
+  uint32_t count;                /* Rows currently held */
+  /**
+   * Called when the columns are full or on flush. The rows must be consumed
+   * before returning; count is reset afterwards.
+   */
+  void (*pFlush)(void *pUser, struct _METER_TBL_SINK_ *pSink);
+  void *pUser;
+} METER_TBL_SINK;
+
+typedef enum _E_METER_TBL_JOB_STATE_
+{
+  METER_TBL_JOB_IDLE = 0,
+  METER_TBL_JOB_PENDING,         /* Waiting to issue the next request */
+  METER_TBL_JOB_IN_FLIGHT,       /* Request outstanding */
+  METER_TBL_JOB_DONE,
+  METER_TBL_JOB_FAILED
+} E_METER_TBL_JOB_STATE;
+
+/* Fetch state per node */
+typedef struct _METER_TBL_JOB_
+{
+  uint32_t datasetMask;          /* 24 bit dataset bitmask */
+  uint32_t cursor;               /* Start of the next request, after the last record delivered */
+  uint32_t stop;                 /* End of the requested range, inclusive */
+  uint32_t requestStop;          /* End of the outstanding request */
+  uint32_t intervalSec;          /* Capture interval, 0 if unknown */
+  int32_t  utcOffsetSec;         /* Meter local time minus UTC */
+  uint32_t lastActivityMs;
+  uint32_t rows;                 /* Rows delivered for this job */
+  uint16_t reportsReceived;      /* Reports received for the outstanding request */
+  uint16_t next;                 /* Ready queue link */
+  uint8_t  state;                /* E_METER_TBL_JOB_STATE */
+  uint8_t  retries;
+  uint8_t  queued;
+} METER_TBL_JOB;
+
+/**
+ * Transmit a Historical Data Get to \a nodeId. Return FALSE if the frame
+ * could not be queued; it is retried on the next poll.
+ */
+typedef BOOL (*METER_TBL_SEND_FUNC)(void *pUser, uint8_t nodeId, const uint8_t *pFrame, uint8_t frameLength);
+
+/**
+ * Notify that a job finished, \a success is FALSE if it was given up.
+ */
+typedef void (*METER_TBL_DONE_FUNC)(void *pUser, uint8_t nodeId, BOOL success, uint32_t rows);
+
+/* Pipeline instance */
+typedef struct _METER_TBL_FETCH_
+{
+  METER_TBL_SINK *pSink;
+  METER_TBL_SEND_FUNC pSend;
+  METER_TBL_DONE_FUNC pDone;
+  void *pUser;
+  uint8_t maxInFlight;
+  uint8_t inFlight;
+  uint16_t readyHead;            /* Round robin queue of jobs waiting to issue */
+  uint16_t readyTail;
+  METER_TBL_JOB jobs[METER_TBL_FETCH_MAX_NODES + 1];
+} METER_TBL_FETCH;
+
+/****************************************************************************/
+/*                           EXPORTED FUNCTIONS                             */
+/****************************************************************************/
+
+/**
+ * Initialize the pipeline.
+ *
+ * \param[in] pSink       Output columns.
+ * \param[in] maxInFlight Max nodes with an outstanding request at a time.
+ */
+void
+MeterTblFetchInit(
+  METER_TBL_FETCH *pFetch,
+  METER_TBL_SINK *pSink,
+  uint8_t maxInFlight,
+  METER_TBL_SEND_FUNC pSend,
+  METER_TBL_DONE_FUNC pDone,
+  void *pUser);
+
+/**
+ * Start fetching historical data from a node.
+ *
+ * \param[in] datasetMask  Datasets to fetch, bit n is dataset n.
+ * \param[in] start        First second of the range, UTC.
+ * \param[in] stop         Last second of the range, UTC.
+ * \param[in] intervalSec  Capture interval of the meter, 0 if unknown.
+ * \param[in] utcOffsetSec Offset of the meter's local time from UTC.
+ * \return FALSE if a job is already running for the node or parameters are invalid.
+ */
+BOOL
+MeterTblFetchStart(
+  METER_TBL_FETCH *pFetch,
+  uint8_t nodeId,
+  uint32_t datasetMask,
+  uint32_t start,
+  uint32_t stop,
+  uint32_t intervalSec,
+  int32_t utcOffsetSec);
+
+/**
+ * Issue pending requests and handle timeouts. Call after every received
+ * report and periodically.
+ */
+void
+MeterTblFetchPoll(
+  METER_TBL_FETCH *pFetch,
+  uint32_t nowMs);
+
+/**
+ * Process a received frame.
+ *
+ * \return TRUE if the frame was a Historical Data Report for a running job.
+ */
+BOOL
+MeterTblFetchReport(
+  METER_TBL_FETCH *pFetch,
+  uint8_t nodeId,
+  const uint8_t *pFrame,
+  uint8_t frameLength,
+  uint32_t nowMs);
+
+/**
+ * Hand all rows held by the sink to its flush callback.
+ */
+void
+MeterTblFetchFlush(
+  METER_TBL_FETCH *pFetch);
+
+/**
+ * Build a METER_TBL_HISTORICAL_DATA_GET_V2 frame.
+ *
+ * \param[out] pFrame Buffer of METER_TBL_FETCH_GET_LENGTH bytes.
+ * \param[in]  start  First second, meter local time.
+ * \param[in]  stop   Last second, meter local time.
+ */
+void
+MeterTblFetchBuildGet(
+  uint8_t *pFrame,
+  uint8_t maximumReports,
+  uint32_t datasetMask,
+  uint32_t start,
+  uint32_t stop);
+
+#endif /* _ZW_METER_TBL_FETCH_H_ */
@@ -0,0 +1,199 @@
+/****************************************************************************
+ *
+ * Description: Wake-up queue batcher packing queued commands for sleeping
+ *              nodes into Multi Command encapsulation.
+ *
+ ****************************************************************************/
+/**
+ * \file ZW_multi_cmd_batcher.h
+ * \brief Multi Command batching of wake-up queues.
+ *
+ * Commands for non-listening nodes are queued until the node sends a Wake Up
+ * Notification. When the node wakes up, MultiCmdBatcherDrain() packs queued
+ * commands into ZW_MULTI_COMMAND_ENCAP_FRAME (COMMAND_CLASS_MULTI_CMD) frames
+ * filling up to the max payload size minus the security encapsulation
+ * overhead of the frame.
+ *
+ * A Multi Command frame is encrypted as one unit, so only commands queued with
+ * the same security key are packed together, and only if the node supports
+ * Multi Command at that key. Queue order is preserved: a batch is closed when
+ * the next command needs another key, does not fit, or must be sent alone
+ * (encapsulation command classes, Supervision Get and commands queued with
+ * MULTI_CMD_FLAG_STANDALONE).
+ *
+ * Every drain reports the frames, airtime and node awake time saved compared
+ * to sending each command on its own, using a simple link model.
+ */
+#ifndef _ZW_MULTI_CMD_BATCHER_H_
+#define _ZW_MULTI_CMD_BATCHER_H_
+
+/****************************************************************************/
+/*                              INCLUDE FILES                               */
+/****************************************************************************/
+#include <stdint.h>
+#include <ZW_typedefs.h>
+#include <ZW_security_api.h>
+
+/****************************************************************************/
+/*                     EXPORTED TYPES and DEFINITIONS                       */
+/****************************************************************************/
+
+/* Max node ID with a wake-up queue */
+#define MULTI_CMD_MAX_NODES            232
+
+/* Max length of one queued command, covers the largest max payload size */
+#define MULTI_CMD_MAX_COMMAND_LENGTH   160
+
+/* Number of security keys in enum SECURITY_KEY */
+#define MULTI_CMD_KEY_COUNT            (SECURITY_KEY_S0 + 1)
+
+/* Multi Command header: command class, command and number of commands */
+#define MULTI_CMD_HEADER_LENGTH        3
+
+/* Default security encapsulation overhead in bytes */
+#define MULTI_CMD_S0_OVERHEAD          20   /* Header, IV, properties, nonce ID and MAC */
+#define MULTI_CMD_S2_OVERHEAD          11   /* Header, sequence, extension flags and MAC */
+
+/* Queue entry flags */
+#define MULTI_CMD_FLAG_STANDALONE      0x01 /* Never pack this command with others */
+
+/* Queue entry index marking "none" */
+#define MULTI_CMD_NO_ENTRY             0xFFFF
+
+/* Convert enum SECURITY_KEY to a bit for BATCHER_NODE.multiCmdKeys */
+#define MULTI_CMD_KEY_BIT(key)         (1u << (key))
+
+/* One queued command */
+typedef struct _MULTI_CMD_ENTRY_
+{
+  uint16_t next;                 /* Queue link */
+  uint8_t  length;
+  uint8_t  securityKey;          /* enum SECURITY_KEY the command must be sent with */
+  uint8_t  flags;                /* MULTI_CMD_FLAG_* */
+  uint8_t  command[MULTI_CMD_MAX_COMMAND_LENGTH];
+} MULTI_CMD_ENTRY;
+
+/* Per node queue and capabilities */
+typedef struct _BATCHER_NODE_
+{
+  uint16_t head;
+  uint16_t tail;
+  uint16_t queued;
+  uint8_t  multiCmdKeys;         /* MULTI_CMD_KEY_BIT() of keys Multi Command is supported at */
+} BATCHER_NODE;
+
+/* Radio link model used to estimate savings */
+typedef struct _BATCHER_LINK_MODEL_
+{
+  uint32_t bitRate;              /* bits per second, e.g. 40000 or 100000 */
+  uint8_t  frameOverhead;        /* Preamble, start of frame, MAC header and checksum bytes */
+  uint8_t  ackLength;            /* Total bytes of the MAC acknowledgement frame */
+  uint16_t turnaroundUs;         /* Gap between frames incl. ACK turnaround and host latency */
+  uint8_t  s0NonceFrames;        /* Extra frames (Nonce Get/Report) per S0 encrypted frame */
+} BATCHER_LINK_MODEL;
+
+/* Result of one drain */
+typedef struct _BATCHER_REPORT_
+{
+  uint16_t commands;             /* Commands drained */
+  uint16_t frames;               /* Frames sent */
+  uint16_t framesSaved;          /* Frames avoided compared to one frame per command */
+  uint32_t airtimeUs;            /* Estimated airtime of the frames sent */
+  uint32_t airtimeSavedUs;       /* Estimated airtime avoided */
+  uint32_t awakeSavedUs;         /* Estimated node awake time avoided */
+} BATCHER_REPORT;
+
+/**
+ * Transmit one frame to a node. \a pFrame is only valid during the call. The
+ * frame must be sent with \a securityKey.
+ */
+typedef void (*MULTI_CMD_SEND_FUNC)(void *pUser, uint8_t nodeId, enum SECURITY_KEY securityKey,
+                                    const uint8_t *pFrame, uint8_t frameLength);
+
+/* Batcher instance */
+typedef struct _MULTI_CMD_BATCHER_
+{
+  MULTI_CMD_ENTRY *pEntries;
+  uint16_t entryCount;
+  uint16_t freeHead;
+  uint8_t  overhead[MULTI_CMD_KEY_COUNT];  /* Encapsulation overhead per key */
+  BATCHER_LINK_MODEL link;
+  BATCHER_REPORT total;                   /* Accumulated over all drains */
+  BATCHER_NODE nodes[MULTI_CMD_MAX_NODES + 1];
+} MULTI_CMD_BATCHER;
+
+/****************************************************************************/
+/*                           EXPORTED FUNCTIONS                             */
+/****************************************************************************/
+
+/**
+ * Initialize the batcher with a caller allocated entry pool. The overhead
+ * table defaults to MULTI_CMD_S0_OVERHEAD / MULTI_CMD_S2_OVERHEAD and the
+ * link model to 100 kbit/s.
+ *
+ * \param[out] pBatcher   Batcher instance.
+ * \param[in]  pEntries   Entry pool shared by all node queues.
+ * \param[in]  entryCount Number of entries in \a pEntries.
+ */
+void
+MultiCmdBatcherInit(
+  MULTI_CMD_BATCHER *pBatcher,
+  MULTI_CMD_ENTRY *pEntries,
+  uint16_t entryCount);
+
+/**
+ * Set the security keys a node supports COMMAND_CLASS_MULTI_CMD at.
+ *
+ * \param[in] keyMask Bitmask of MULTI_CMD_KEY_BIT(key). 0 disables batching.
+ */
+void
+MultiCmdBatcherSetNodeSupport(
+  MULTI_CMD_BATCHER *pBatcher,
+  uint8_t nodeId,
+  uint8_t keyMask);
+
+/**
+ * Queue a command for a sleeping node.
+ *
+ * \param[in] pCommand    Command starting with the command class byte.
+ * \param[in] length      Length of \a pCommand, max MULTI_CMD_MAX_COMMAND_LENGTH.
+ * \param[in] securityKey Key the command must be sent with.
+ * \param[in] flags       MULTI_CMD_FLAG_* options.
+ * \return TRUE if queued, FALSE if the pool is exhausted or parameters are invalid.
+ */
+BOOL
+MultiCmdBatcherEnqueue(
+  MULTI_CMD_BATCHER *pBatcher,
+  uint8_t nodeId,
+  const uint8_t *pCommand,
+  uint8_t length,
+  enum SECURITY_KEY securityKey,
+  uint8_t flags);
+
+/**
+ * Number of commands queued for a node.
+ */
+uint16_t
+MultiCmdBatcherQueued(
+  const MULTI_CMD_BATCHER *pBatcher,
+  uint8_t nodeId);
+
+/**
+ * Send all queued commands of a node that just woke up.
+ *
+ * \param[in]  maxPayloadSize Max payload size of the link, e.g. from ZW_GetMaxPayloadSize().
+ * \param[in]  pSend          Transmit function called once per frame, in order.
+ * \param[in]  pUser          Passed unmodified to \a pSend.
+ * \param[out] pReport        Optional, receives the savings of this drain.
+ * \return Number of frames sent.
+ */
+uint16_t
+MultiCmdBatcherDrain(
+  MULTI_CMD_BATCHER *pBatcher,
+  uint8_t nodeId,
+  uint8_t maxPayloadSize,
+  MULTI_CMD_SEND_FUNC pSend,
+  void *pUser,
+  BATCHER_REPORT *pReport);
+
+#endif /* _ZW_MULTI_CMD_BATCHER_H_ */
@@ -0,0 +1,117 @@
+/****************************************************************************
+ *
+ * Description: Compiled Notification type and event registry.
+ *
+ ****************************************************************************/
+/**
+ * \file ZW_notification_registry.h
+ * \brief Constant time decoding of Notification Reports.
+ *
+ * The assigned Notifications of "Registries/Notification Command Class, list
+ * of assigned Notifications.xlsx" are compiled by
+ * tools/gen_notification_registry.py into read-only tables
+ * (ZW_notification_registry_table.c): a 256 entry type index and a dense run
+ * of event entries per type, each referring to a parameter descriptor.
+ * Decoding a report is a handful of array reads; nothing is hashed or
+ * allocated, and all returned names point into the constant string pool.
+ */
+#ifndef _ZW_NOTIFICATION_REGISTRY_H_
+#define _ZW_NOTIFICATION_REGISTRY_H_
+
+/****************************************************************************/
+/*                              INCLUDE FILES                               */
+/****************************************************************************/
+#include <stdint.h>
+#include <ZW_typedefs.h>
+
+/****************************************************************************/
+/*                     EXPORTED TYPES and DEFINITIONS                       */
+/****************************************************************************/
+
+/* Event value meaning an unknown event/state for every type */
+#define NOTIFICATION_EVENT_UNKNOWN          0xFE
+
+/* Layout of the Event/State parameters of an event */
+typedef enum _E_NOTIFICATION_PARAM_KIND_
+{
+  NOTIFICATION_PARAM_NONE = 0,
+  NOTIFICATION_PARAM_IDLE_EVENT,        /* 1 byte, event of the state variable going idle */
+  NOTIFICATION_PARAM_COMMAND,           /* Encapsulated command, see commandClass/command */
+  NOTIFICATION_PARAM_USER_NOTIFICATION, /* User Notification Report of the User Credential CC */
+  NOTIFICATION_PARAM_CREDENTIAL_NOTIFICATION, /* Credential Notification Report of the User Credential CC */
+  NOTIFICATION_PARAM_CREDENTIAL,        /* User Unique Identifier, Credential Type, Credential Slot */
+  NOTIFICATION_PARAM_CREDENTIAL_LIST,   /* Count, then one credential per used credential */
+  NOTIFICATION_PARAM_USER_ID,           /* 2 bytes, User Code user identifier */
+  NOTIFICATION_PARAM_SIGNED,            /* 1 byte signed value */
+  NOTIFICATION_PARAM_PROPRIETARY,       /* Manufacturer specific bytes */
+  NOTIFICATION_PARAM_DURATION,          /* 3 bytes, hours, minutes and seconds */
+  NOTIFICATION_PARAM_BITMASK,           /* 1 byte bitmask */
+  NOTIFICATION_PARAM_IDENTIFIER,        /* 1 byte identifier, e.g. a schedule ID */
+  NOTIFICATION_PARAM_ENUM               /* 1 byte with assigned values */
+} E_NOTIFICATION_PARAM_KIND;
+
+typedef enum _E_NOTIFICATION_DECODE_STATUS_
+{
+  NOTIFICATION_DECODE_OK = 0,
+  NOTIFICATION_DECODE_UNKNOWN_TYPE,     /* Type not assigned, only raw fields are set */
+  NOTIFICATION_DECODE_UNKNOWN_EVENT,    /* Event not assigned for the type */
+  NOTIFICATION_DECODE_INVALID           /* Not a valid Notification Report */
+} E_NOTIFICATION_DECODE_STATUS;
+
+/* Decoded Notification Report. Names are NULL when not applicable */
+typedef struct _NOTIFICATION_DECODED_
+{
+  uint8_t notificationType;
+  uint8_t event;
+  uint8_t notificationStatus;
+  uint8_t requiredVersion;       /* Version introducing the event, 0 if unknown */
+  BOOL isState;                  /* Event sets a state variable */
+  BOOL hasSequence;
+  uint8_t sequenceNumber;
+  const char *pTypeName;
+  const char *pEventName;
+  const char *pStateVariable;
+
+  E_NOTIFICATION_PARAM_KIND paramKind;
+  const uint8_t *pParams;        /* Event/State parameters inside the frame */
+  uint8_t paramLength;
+  BOOL paramValid;               /* Parameters present and long enough for paramKind */
+  int32_t paramValue;            /* Scalar kinds; seconds for NOTIFICATION_PARAM_DURATION */
+  const char *pParamValueName;   /* Enum value name or idle event name */
+  uint8_t commandClass;          /* Expected command of NOTIFICATION_PARAM_COMMAND */
+  uint8_t command;
+} NOTIFICATION_DECODED;
+
+/****************************************************************************/
+/*                           EXPORTED FUNCTIONS                             */
+/****************************************************************************/
+
+/**
+ * Name of a Notification Type, NULL if not assigned.
+ */
+const char *
+NotificationRegistryTypeName(
+  uint8_t notificationType);
+
+/**
+ * Name of an event of a Notification Type, NULL if not assigned.
+ */
+const char *
+NotificationRegistryEventName(
+  uint8_t notificationType,
+  uint8_t event);
+
+/**
+ * Decode a NOTIFICATION_REPORT_V8 frame (versions 3 to 8).
+ *
+ * \param[in]  pFrame      Report starting with the command class byte.
+ * \param[in]  frameLength Length of \a pFrame.
+ * \param[out] pDecoded    Decoded report; valid unless NOTIFICATION_DECODE_INVALID is returned.
+ */
+E_NOTIFICATION_DECODE_STATUS
+NotificationRegistryDecode(
+  const uint8_t *pFrame,
+  uint8_t frameLength,
+  NOTIFICATION_DECODED *pDecoded);
+
+#endif /* _ZW_NOTIFICATION_REGISTRY_H_ */
@@ -0,0 +1,155 @@
+/****************************************************************************
+ *
+ * Description: Matching of an OTA firmware catalog against a fleet of nodes.
+ *
+ ****************************************************************************/
+/**
+ * \file ZW_ota_catalog.h
+ * \brief Indexed join of firmware images and node NVM descriptors.
+ *
+ * Each catalog image is described by its t_firmwareDescriptor and the product
+ * and application version it was released for. Each node of the fleet is
+ * described by its t_nvmDescriptor. An image fits a node when manufacturerID,
+ * firmwareID, productTypeID and productID all match.
+ *
+ * OtaCatalogIndexBuild() hashes the catalog on these four fields. While
+ * building, it checks the bank layout of every image and picks the newest
+ * valid image per product. Matching a node is then a single hash probe, so
+ * a fleet of any size is matched in time linear in its size.
+ *
+ * The bank layout follows ZW_firmware_bootloader_defs.h. No bank may be
+ * larger than MCU_BANK_SIZE. Bank n starts at FIRMWARE_BANKn_START in the
+ * image, so the image must reach the end of the last bank used and fit in
+ * FIRMWARE_MCU_SIZE.
+ */
+#ifndef _ZW_OTA_CATALOG_H_
+#define _ZW_OTA_CATALOG_H_
+
+/****************************************************************************/
+/*                              INCLUDE FILES                               */
+/****************************************************************************/
+#include <ZW_ota_compression_header.h>
+#include <stdint.h>
+#include <ZW_typedefs.h>
+#include <ZW_firmware_descriptor.h>
+#include <ZW_nvm_descriptor.h>
+
+/****************************************************************************/
+/*                     EXPORTED TYPES and DEFINITIONS                       */
+/****************************************************************************/
+
+/* No image, e.g. in OTA_CATALOG_MATCH.image */
+#define OTA_CATALOG_NO_IMAGE        0xFFFFFFFFUL
+
+typedef enum _E_OTA_LAYOUT_STATUS_
+{
+  OTA_LAYOUT_OK = 0,
+  OTA_LAYOUT_NO_COMMON,             /* wFirmWareCommonSize is 0 */
+  OTA_LAYOUT_BANK_OVERFLOW,         /* A bank is larger than MCU_BANK_SIZE */
+  OTA_LAYOUT_IMAGE_TRUNCATED,       /* Image ends before the last bank used */
+  OTA_LAYOUT_IMAGE_OVERFLOW         /* Image larger than FIRMWARE_MCU_SIZE */
+} E_OTA_LAYOUT_STATUS;
+
+typedef enum _E_OTA_MATCH_STATUS_
+{
+  OTA_MATCH_UPDATE = 0,             /* A newer image is available */
+  OTA_MATCH_UP_TO_DATE,             /* The newest image is not newer than the node */
+  OTA_MATCH_NO_IMAGE,               /* No image for the product */
+  OTA_MATCH_BAD_LAYOUT,             /* Images for the product all have invalid bank layouts */
+  OTA_MATCH_CONFLICT                /* Several images of the newest version with different checksums */
+} E_OTA_MATCH_STATUS;
+
+/* Image of the catalog */
+typedef struct _OTA_CATALOG_IMAGE_
+{
+  t_firmwareDescriptor descriptor;
+  uint16_t productTypeId;
+  uint16_t productId;
+  uint16_t applicationVersion;      /* Version the image updates to */
+  uint32_t imageLength;             /* Uncompressed length, 0 if unknown */
+} OTA_CATALOG_IMAGE;
+
+/* Newest image of a product */
+typedef struct _OTA_CATALOG_SLOT_
+{
+  uint64_t key;
+  uint32_t image;                   /* Index of the newest valid image, OTA_CATALOG_NO_IMAGE if none */
+  uint32_t badImage;                /* Newest image with an invalid layout, OTA_CATALOG_NO_IMAGE if none */
+  uint8_t  used;
+  uint8_t  conflict;                /* Another valid image of the same version differs */
+} OTA_CATALOG_SLOT;
+
+typedef struct _OTA_CATALOG_INDEX_
+{
+  const OTA_CATALOG_IMAGE *pImages; /* Owned by the caller */
+  uint32_t imageCount;
+  uint32_t mask;                    /* Slot count - 1 */
+  OTA_CATALOG_SLOT *pSlots;
+} OTA_CATALOG_INDEX;
+
+/* Result for one node */
+typedef struct _OTA_CATALOG_MATCH_
+{
+  uint32_t image;                   /* Image to send, or the offending image */
+  uint32_t badImage;                /* Image with an invalid layout newer than image, OTA_CATALOG_NO_IMAGE if none */
+  uint8_t  status;                  /* E_OTA_MATCH_STATUS */
+  uint8_t  layout;                  /* E_OTA_LAYOUT_STATUS of badImage */
+} OTA_CATALOG_MATCH;
+
+/****************************************************************************/
+/*                           EXPORTED FUNCTIONS                             */
+/****************************************************************************/
+
+/**
+ * Check the bank layout of an image.
+ */
+E_OTA_LAYOUT_STATUS
+OtaCatalogCheckLayout(
+  const OTA_CATALOG_IMAGE *pImage);
+
+/**
+ * Index a catalog. The images stay owned by the caller and must not change
+ * while the index is used.
+ *
+ * \return FALSE if memory is short.
+ */
+BOOL
+OtaCatalogIndexBuild(
+  OTA_CATALOG_INDEX *pIndex,
+  const OTA_CATALOG_IMAGE *pImages,
+  uint32_t imageCount);
+
+/**
+ * Release the index.
+ */
+void
+OtaCatalogIndexFree(
+  OTA_CATALOG_INDEX *pIndex);
+
+/**
+ * Find the image for one node.
+ *
+ * A newer image of the product with an invalid layout is reported in
+ * badImage and layout whatever the status, so a broken release does not go
+ * unnoticed behind an older valid image.
+ */
+E_OTA_MATCH_STATUS
+OtaCatalogMatch(
+  const OTA_CATALOG_INDEX *pIndex,
+  const t_nvmDescriptor *pNode,
+  OTA_CATALOG_MATCH *pMatch);
+
+/**
+ * Match a whole fleet.
+ *
+ * \param[out] pMatches  One result per node, in the order of \a pFleet.
+ * \return Number of nodes with OTA_MATCH_UPDATE.
+ */
+uint32_t
+OtaCatalogMatchFleet(
+  const OTA_CATALOG_INDEX *pIndex,
+  const t_nvmDescriptor *pFleet,
+  uint32_t fleetCount,
+  OTA_CATALOG_MATCH *pMatches);
+
+#endif /* _ZW_OTA_CATALOG_H_ */
@@ -0,0 +1,126 @@
+/****************************************************************************
+ *
+ * Description: FastLZ compressor for compressed OTA firmware images.
+ *
+ ****************************************************************************/
+/**
+ * \file ZW_ota_compressor.h
+ * \brief Host side builder of COMPRESSION_HEADER_TYPE_V1 firmware images.
+ *
+ * A compressed image is the packed t_compressedFirmwareHeader
+ * (COMPRESSED_FIRMWARE_HEADER_PACKED_LENGTH bytes, all fields big endian)
+ * followed by a FastLZ level 1 stream of the firmware image.
+ *
+ * The stream is a sequence of instructions:
+ * - 000LLLLL: L + 1 literal bytes follow.
+ * - LLLDDDDD dddddddd: match of L + 2 bytes (L 1..6), at distance
+ *   (D << 8 | d) + 1 back in the output.
+ * - 111DDDDD llllllll dddddddd: match of l + 9 bytes.
+ * The first instruction is always a literal run; its top three bits carry
+ * the level (0 for level 1).
+ *
+ * Two parsers produce the same format, so any FastLZ level 1 decompressor
+ * reads both:
+ * - OTA_COMPRESS_FAST is a greedy single-probe hash parser like the
+ *   reference FastLZ.
+ * - OTA_COMPRESS_HIGH searches hash chains over the whole 8 KB window and
+ *   picks the cheapest instruction sequence by dynamic programming. This
+ *   pays off on firmware, with its many short repeated code sequences,
+ *   constant tables and erased (0xFF) flash padding.
+ *
+ * compressedCrc16 is ZW_CheckCrc16() over the packed header with the
+ * compressedCrc16 field set to zero, followed by the compressed data.
+ * uncompressedCrc16 is ZW_CheckCrc16() over the uncompressed image.
+ */
+#ifndef _ZW_OTA_COMPRESSOR_H_
+#define _ZW_OTA_COMPRESSOR_H_
+
+/****************************************************************************/
+/*                              INCLUDE FILES                               */
+/****************************************************************************/
+#include <stdint.h>
+#include <ZW_typedefs.h>
+
+/****************************************************************************/
+/*                     EXPORTED TYPES and DEFINITIONS                       */
+/****************************************************************************/
+
+/* FastLZ level 1 limits */
+#define OTA_FASTLZ_MIN_MATCH           3
+#define OTA_FASTLZ_MAX_MATCH           264
+#define OTA_FASTLZ_MAX_DISTANCE        8192
+#define OTA_FASTLZ_MAX_LITERALS        32
+
+/* Offsets of the fields in the packed header */
+#define OTA_HEADER_OFFSET_TYPE             0
+#define OTA_HEADER_OFFSET_COMPRESSED_LENGTH 1
+#define OTA_HEADER_OFFSET_COMPRESSED_CRC   5
+#define OTA_HEADER_OFFSET_UNCOMPRESSED_CRC 7
+#define OTA_HEADER_OFFSET_SCRAMBLING_KEY   9
+#define OTA_HEADER_OFFSET_DESCRIPTOR_CRC   25
+
+/* Worst case size of the FastLZ stream of \a length bytes */
+#define OTA_FASTLZ_BOUND(length)       ((length) + (length) / OTA_FASTLZ_MAX_LITERALS + 1)
+
+typedef enum _E_OTA_COMPRESS_MODE_
+{
+  OTA_COMPRESS_FAST = 0,
+  OTA_COMPRESS_HIGH
+} E_OTA_COMPRESS_MODE;
+
+typedef enum _E_OTA_COMPRESS_STATUS_
+{
+  OTA_COMPRESS_OK = 0,
+  OTA_COMPRESS_BUFFER_TOO_SMALL,
+  OTA_COMPRESS_NO_MEMORY
+} E_OTA_COMPRESS_STATUS;
+
+/****************************************************************************/
+/*                           EXPORTED FUNCTIONS                             */
+/****************************************************************************/
+
+/**
+ * Output buffer size that always holds the compressed image of \a length
+ * bytes, header included.
+ */
+uint32_t
+OtaCompressBound(
+  uint32_t length);
+
+/**
+ * Compress into a bare FastLZ level 1 stream.
+ *
+ * \param[out] pOut        Buffer of at least OTA_FASTLZ_BOUND(length) bytes.
+ * \param[out] pOutLength  Length of the stream.
+ */
+E_OTA_COMPRESS_STATUS
+OtaFastLzCompress(
+  const uint8_t *pIn,
+  uint32_t length,
+  E_OTA_COMPRESS_MODE mode,
+  uint8_t *pOut,
+  uint32_t *pOutLength);
+
+/**
+ * Build a complete compressed firmware image.
+ *
+ * \param[in]  pScramblingKey             16 byte scrambling key of the
+ *                                        security keys in the image.
+ * \param[in]  firmwareDescriptorChecksum Checksum field of the image's
+ *                                        t_firmwareDescriptor.
+ * \param[out] pOut                       Output buffer.
+ * \param[in]  outCapacity                Size of \a pOut, OtaCompressBound() is always enough.
+ * \param[out] pOutLength                 Length of header and data.
+ */
+E_OTA_COMPRESS_STATUS
+OtaCompressImage(
+  const uint8_t *pImage,
+  uint32_t length,
+  const uint8_t *pScramblingKey,
+  uint16_t firmwareDescriptorChecksum,
+  E_OTA_COMPRESS_MODE mode,
+  uint8_t *pOut,
+  uint32_t outCapacity,
+  uint32_t *pOutLength);
+
+#endif /* _ZW_OTA_COMPRESSOR_H_ */
@@ -0,0 +1,186 @@
+/****************************************************************************
+ *
+ * Description: Streaming decompressor and verifier for compressed OTA
+ *              firmware images.
+ *
+ ****************************************************************************/
+/**
+ * \file ZW_ota_verifier.h
+ * \brief One pass check of COMPRESSION_HEADER_TYPE_V1 firmware images.
+ *
+ * The image is fed in chunks of any size, as read from a file or received.
+ * While it is decompressed, the verifier checks:
+ * - compressedCrc16 over the header and the compressed data, see
+ *   ZW_ota_compressor.h.
+ * - uncompressedCrc16 over the decompressed firmware.
+ * - Optionally, uncompressedCrc16 against the ApplicationImageCrcValue
+ *   expected for the release.
+ * - Optionally, firmwareDescriptorChecksum against the checksum of the
+ *   t_firmwareDescriptor in the decompressed firmware. The descriptor is
+ *   found like t_firmware does: firmwareDescriptorOffs is the big endian
+ *   WORD at offset 8 of the image.
+ *
+ * Memory is bounded by the FastLZ window. Only the last
+ * OTA_FASTLZ_MAX_DISTANCE bytes of output are kept. The decompressed firmware
+ * is passed to an optional sink, e.g. to write it to NVM.
+ *
+ * A verifier has no shared state, so any number of images can be checked at
+ * the same time on separate threads. OtaVerifyCatalog() does that for a
+ * whole release catalog.
+ */
+#ifndef _ZW_OTA_VERIFIER_H_
+#define _ZW_OTA_VERIFIER_H_
+
+/****************************************************************************/
+/*                              INCLUDE FILES                               */
+/****************************************************************************/
+#include <ZW_ota_compression_header.h>
+#include <stdint.h>
+#include <ZW_typedefs.h>
+#include <ZW_ota_compressor.h>
+
+/****************************************************************************/
+/*                     EXPORTED TYPES and DEFINITIONS                       */
+/****************************************************************************/
+
+/* Decompressed bytes kept for matches */
+#define OTA_VERIFY_WINDOW                     OTA_FASTLZ_MAX_DISTANCE
+
+/* Offset of firmwareDescriptorOffs in t_firmware */
+#define OTA_VERIFY_DESCRIPTOR_POINTER_OFFSET  8
+/* Offset of checksum in t_firmwareDescriptor */
+#define OTA_VERIFY_DESCRIPTOR_CHECKSUM_OFFSET 12
+
+/* Checks in addition to the CRCs of the header, see OTA_VERIFY_EXPECT */
+#define OTA_VERIFY_CHECK_APPLICATION_CRC      0x01
+#define OTA_VERIFY_CHECK_DESCRIPTOR           0x02
+
+typedef enum _E_OTA_VERIFY_STATUS_
+{
+  OTA_VERIFY_OK = 0,
+  OTA_VERIFY_IN_PROGRESS,
+  OTA_VERIFY_BAD_HEADER_TYPE,             /* Not COMPRESSION_HEADER_TYPE_V1 */
+  OTA_VERIFY_TRUNCATED,                   /* Ended before compressedLength bytes of data */
+  OTA_VERIFY_TRAILING_DATA,               /* More than compressedLength bytes of data */
+  OTA_VERIFY_CORRUPT,                     /* Invalid FastLZ level 1 stream */
+  OTA_VERIFY_TOO_LARGE,                   /* Firmware longer than maxImageLength */
+  OTA_VERIFY_COMPRESSED_CRC_MISMATCH,
+  OTA_VERIFY_IMAGE_CRC_MISMATCH,          /* Firmware does not match uncompressedCrc16 */
+  OTA_VERIFY_APPLICATION_CRC_MISMATCH,    /* uncompressedCrc16 is not the expected one */
+  OTA_VERIFY_DESCRIPTOR_MISSING,          /* Firmware too short to hold the descriptor */
+  OTA_VERIFY_DESCRIPTOR_CHECKSUM_MISMATCH,
+  OTA_VERIFY_ABORTED                      /* The sink returned FALSE */
+} E_OTA_VERIFY_STATUS;
+
+/* What the image must match */
+typedef struct _OTA_VERIFY_EXPECT_
+{
+  uint32_t maxImageLength;       /* Longest firmware accepted, 0 for no limit */
+  uint16_t applicationImageCrc;  /* ApplicationImageCrcValue of the release */
+  uint8_t  checks;               /* OTA_VERIFY_CHECK_x */
+} OTA_VERIFY_EXPECT;
+
+/**
+ * Receive the next piece of decompressed firmware, starting at \a offset.
+ * Return FALSE to stop the verification.
+ */
+typedef BOOL (*OTA_VERIFY_SINK_FUNC)(void *pUser, uint32_t offset, const uint8_t *pData, uint32_t length);
+
+/* State of one verification */
+typedef struct _OTA_VERIFY_
+{
+  uint8_t  status;               /* E_OTA_VERIFY_STATUS */
+  uint8_t  headerCount;          /* Header bytes received */
+  uint8_t  instructionCount;     /* Bytes of a split instruction received */
+  uint8_t  literalsLeft;         /* Bytes left of the current literal run */
+  BOOL     firstInstruction;
+  uint8_t  header[COMPRESSED_FIRMWARE_HEADER_PACKED_LENGTH];
+  uint8_t  instruction[3];
+  uint16_t compressedCrc;        /* Running compressedCrc16 */
+  uint16_t imageCrc;             /* Running CRC16 of the flushed firmware */
+  uint16_t descriptorOffset;     /* firmwareDescriptorOffs of the firmware */
+  uint16_t descriptorChecksum;   /* Checksum of the firmware's descriptor */
+  uint32_t compressedLength;     /* From the header */
+  uint32_t dataCount;            /* Compressed data bytes received */
+  uint32_t imageLength;          /* Firmware bytes decompressed */
+  uint32_t flushedLength;        /* Firmware bytes passed to CRC and sink */
+  uint32_t windowPos;            /* Next write position in window */
+  OTA_VERIFY_EXPECT expect;
+  OTA_VERIFY_SINK_FUNC pSink;
+  void *pUser;
+  uint8_t  window[OTA_VERIFY_WINDOW];
+} OTA_VERIFY;
+
+/* One image of a catalog */
+typedef struct _OTA_VERIFY_JOB_
+{
+  const uint8_t *pImage;         /* Header and compressed data */
+  uint32_t length;
+  OTA_VERIFY_EXPECT expect;
+  uint8_t  status;               /* Result, E_OTA_VERIFY_STATUS */
+  uint32_t imageLength;          /* Result, decompressed firmware length */
+} OTA_VERIFY_JOB;
+
+/****************************************************************************/
+/*                           EXPORTED FUNCTIONS                             */
+/****************************************************************************/
+
+/**
+ * Start a verification.
+ *
+ * \param[in] pExpect  Checks to make, NULL for the header CRCs only.
+ * \param[in] pSink    Receiver of the firmware, may be NULL.
+ */
+void
+OtaVerifyInit(
+  OTA_VERIFY *pVerify,
+  const OTA_VERIFY_EXPECT *pExpect,
+  OTA_VERIFY_SINK_FUNC pSink,
+  void *pUser);
+
+/**
+ * Feed the next chunk of the compressed image.
+ *
+ * \return OTA_VERIFY_IN_PROGRESS, or the error found. Errors are final.
+ */
+E_OTA_VERIFY_STATUS
+OtaVerifyData(
+  OTA_VERIFY *pVerify,
+  const uint8_t *pData,
+  uint32_t length);
+
+/**
+ * End of the image. Complete the checks.
+ *
+ * \return OTA_VERIFY_OK if the image passed all checks.
+ */
+E_OTA_VERIFY_STATUS
+OtaVerifyFinish(
+  OTA_VERIFY *pVerify);
+
+/**
+ * Verify a complete image in memory.
+ *
+ * \param[out] pImageLength  Decompressed firmware length, may be NULL.
+ */
+E_OTA_VERIFY_STATUS
+OtaVerifyImage(
+  const uint8_t *pImage,
+  uint32_t length,
+  const OTA_VERIFY_EXPECT *pExpect,
+  uint32_t *pImageLength);
+
+/**
+ * Verify all images of a catalog on parallel threads and fill in their
+ * results.
+ *
+ * \param[in] threads  Threads to use, 0 for one per online CPU.
+ * \return Number of images that failed.
+ */
+uint32_t
+OtaVerifyCatalog(
+  OTA_VERIFY_JOB *pJobs,
+  uint32_t jobCount,
+  uint8_t threads);
+
+#endif /* _ZW_OTA_VERIFIER_H_ */
@@ -0,0 +1,224 @@
+/****************************************************************************
+ *
+ * Description: SmartStart provisioning list indexed by DSK and home ID.
+ *
+ ****************************************************************************/
+/**
+ * \file ZW_provisioning_store.h
+ * \brief Memory mapped SmartStart provisioning list.
+ *
+ * Each entry holds the DSK of a node and its COMMAND_CLASS_NODE_PROVISIONING
+ * metadata TLVs. The list is one file mapped read-write. It contains the
+ * entries and two open addressing indexes, one keyed by the DSK and one by
+ * the SmartStart NWI home ID derived from the DSK. Opening the file only maps
+ * it, and nothing is rebuilt.
+ *
+ * A SmartStart inclusion request (UPDATE_STATE_NODE_INFO_SMARTSTART_HOMEID_
+ * RECEIVED) carries only the home ID, LEARN_INFO_SMARTSTART.homeID.
+ * ProvisioningStoreFindHomeId() looks it up in constant expected time, however
+ * many entries the list holds. Two DSKs can map to the same home ID, so it
+ * iterates over all entries with that home ID.
+ *
+ * TLVs are stored as received: type byte (type << 1 | critical flag),
+ * length, value.
+ */
+#ifndef _ZW_PROVISIONING_STORE_H_
+#define _ZW_PROVISIONING_STORE_H_
+
+/****************************************************************************/
+/*                              INCLUDE FILES                               */
+/****************************************************************************/
+#include <stdint.h>
+#include <ZW_typedefs.h>
+
+/****************************************************************************/
+/*                     EXPORTED TYPES and DEFINITIONS                       */
+/****************************************************************************/
+
+/* Length of a DSK, SECURITY_KEY_S2_PUBLIC_DSK_LENGTH */
+#define PROVISIONING_DSK_LENGTH               16
+
+/* Max bytes of metadata TLVs of an entry */
+#define PROVISIONING_STORE_MAX_TLV            192
+
+/* Metadata TLV types (Node Provisioning CC) */
+#define PROVISIONING_TLV_PRODUCT_TYPE         0x00
+#define PROVISIONING_TLV_PRODUCT_ID           0x01
+#define PROVISIONING_TLV_MAX_INCLUSION_REQUEST_INTERVAL 0x02
+#define PROVISIONING_TLV_UUID16               0x03
+#define PROVISIONING_TLV_SUPPORTED_PROTOCOLS  0x04
+#define PROVISIONING_TLV_NAME                 0x32
+#define PROVISIONING_TLV_LOCATION             0x33
+#define PROVISIONING_TLV_SMARTSTART_STATUS    0x34
+#define PROVISIONING_TLV_ADVANCED_JOINING     0x35
+#define PROVISIONING_TLV_BOOTSTRAPPING_MODE   0x36
+#define PROVISIONING_TLV_NETWORK_STATUS       0x37
+
+/* Type byte of a TLV */
+#define PROVISIONING_TLV_TYPE(typeByte)       ((uint8_t)((typeByte) >> 1))
+#define PROVISIONING_TLV_CRITICAL(typeByte)   ((typeByte) & 0x01)
+
+/* Values of the SmartStart Inclusion Setting (status) TLV */
+#define PROVISIONING_STATUS_PENDING           0x00
+#define PROVISIONING_STATUS_PASSIVE           0x02
+#define PROVISIONING_STATUS_IGNORED           0x03
+
+typedef enum _E_PROVISIONING_STORE_STATUS_
+{
+  PROVISIONING_STORE_OK = 0,
+  PROVISIONING_STORE_NOT_FOUND,
+  PROVISIONING_STORE_INVALID,          /* Bad DSK length or malformed TLVs */
+  PROVISIONING_STORE_IO_ERROR,
+  PROVISIONING_STORE_NO_MEMORY,
+  PROVISIONING_STORE_DAMAGED           /* File of another format version or damaged, left as it is */
+} E_PROVISIONING_STORE_STATUS;
+
+/* One provisioning list entry */
+typedef struct _PROVISIONING_ENTRY_
+{
+  uint8_t  dsk[PROVISIONING_DSK_LENGTH];
+  uint8_t  homeId[4];                  /* NWI home ID derived from the DSK */
+  uint16_t tlvLength;
+  uint8_t  tlv[PROVISIONING_STORE_MAX_TLV];
+} PROVISIONING_ENTRY;
+
+typedef struct _PROVISIONING_STORE_ PROVISIONING_STORE;
+
+/****************************************************************************/
+/*                           EXPORTED FUNCTIONS                             */
+/****************************************************************************/
+
+/**
+ * Open or create a provisioning list file.
+ *
+ * \param[in]  pPath    File name.
+ * \param[in]  capacity Expected number of entries. The file grows as needed.
+ * \param[out] ppStore  Store handle.
+ * \return PROVISIONING_STORE_DAMAGED if the file exists but is not a valid
+ *         provisioning list of this version. The file is not modified.
+ */
+E_PROVISIONING_STORE_STATUS
+ProvisioningStoreOpen(
+  const char *pPath,
+  uint32_t capacity,
+  PROVISIONING_STORE **ppStore);
+
+/**
+ * Write the file to disk.
+ */
+E_PROVISIONING_STORE_STATUS
+ProvisioningStoreSync(
+  PROVISIONING_STORE *pStore);
+
+/**
+ * Write the file to disk and close it.
+ */
+E_PROVISIONING_STORE_STATUS
+ProvisioningStoreClose(
+  PROVISIONING_STORE *pStore);
+
+/**
+ * Derive the SmartStart NWI home ID from a DSK: bytes 9 to 12 of the DSK,
+ * with the two most significant bits set and the least significant bit
+ * cleared.
+ */
+void
+ProvisioningStoreHomeIdFromDsk(
+  const uint8_t *pDsk,
+  uint8_t *pHomeId);
+
+/**
+ * Add an entry or replace the TLVs of an existing one.
+ */
+E_PROVISIONING_STORE_STATUS
+ProvisioningStoreSet(
+  PROVISIONING_STORE *pStore,
+  const uint8_t *pDsk,
+  const uint8_t *pTlv,
+  uint16_t tlvLength);
+
+/**
+ * Remove an entry.
+ */
+E_PROVISIONING_STORE_STATUS
+ProvisioningStoreDelete(
+  PROVISIONING_STORE *pStore,
+  const uint8_t *pDsk);
+
+/**
+ * Look up an entry by DSK.
+ *
+ * \return Entry in the mapping, valid until the store is next modified, or
+ *         NULL.
+ */
+const PROVISIONING_ENTRY *
+ProvisioningStoreFindDsk(
+  const PROVISIONING_STORE *pStore,
+  const uint8_t *pDsk);
+
+/**
+ * Iterate over the entries with a home ID, e.g. LEARN_INFO_SMARTSTART.homeID.
+ *
+ * \param[in,out] pCursor Set to 0 before the first call.
+ * \return Next matching entry, valid until the store is next modified, or
+ *         NULL when there are no more.
+ */
+const PROVISIONING_ENTRY *
+ProvisioningStoreFindHomeId(
+  const PROVISIONING_STORE *pStore,
+  const uint8_t *pHomeId,
+  uint32_t *pCursor);
+
+/**
+ * Iterate over all entries, e.g. for Node Provisioning List Iteration Get.
+ *
+ * \param[in,out] pCursor Set to 0 before the first call.
+ */
+const PROVISIONING_ENTRY *
+ProvisioningStoreNext(
+  const PROVISIONING_STORE *pStore,
+  uint32_t *pCursor);
+
+/**
+ * Number of entries.
+ */
+uint32_t
+ProvisioningStoreCount(
+  const PROVISIONING_STORE *pStore);
+
+/**
+ * Find a metadata TLV of an entry.
+ *
+ * \param[in]  type    TLV type without the critical flag.
+ * \param[out] pLength Length of the value.
+ * \return Value of the TLV, or NULL if the entry has none.
+ */
+const uint8_t *
+ProvisioningEntryFindTlv(
+  const PROVISIONING_ENTRY *pEntry,
+  uint8_t type,
+  uint8_t *pLength);
+
+/**
+ * Apply a NODE_PROVISION_SET or NODE_PROVISION_DELETE command.
+ */
+E_PROVISIONING_STORE_STATUS
+ProvisioningStoreHandleCommand(
+  PROVISIONING_STORE *pStore,
+  const uint8_t *pCmd,
+  uint8_t length);
+
+/**
+ * Build a NODE_PROVISION_REPORT for an entry.
+ *
+ * \param[in]  pEntry Entry to report, NULL for a report without DSK.
+ * \param[out] pOut   Buffer of 4 + PROVISIONING_DSK_LENGTH + PROVISIONING_STORE_MAX_TLV bytes.
+ * \return Length of the report.
+ */
+uint16_t
+ProvisioningStoreBuildReport(
+  const PROVISIONING_ENTRY *pEntry,
+  uint8_t seqNo,
+  uint8_t *pOut);
+
+#endif /* _ZW_PROVISIONING_STORE_H_ */
@@ -0,0 +1,184 @@
+/****************************************************************************
+ *
+ * Description: Security S0 frame encryption and authentication.
+ *
+ ****************************************************************************/
+/**
+ * \file ZW_s0_engine.h
+ * \brief Encrypts and decrypts SECURITY_MESSAGE_ENCAPSULATION frames
+ *        (SDS10865, Z-Wave Application Security Layer S0).
+ *
+ * An S0 frame is:
+ *
+ *   COMMAND_CLASS_SECURITY, SECURITY_MESSAGE_ENCAPSULATION(_NONCE_GET),
+ *   sender nonce (8), encrypted payload, receiver nonce identifier (1),
+ *   MAC (8)
+ *
+ * The payload is the properties byte (sequence counter, sequenced and
+ * second frame bits) followed by the command. With IV = sender nonce |
+ * receiver nonce, it is encrypted with AES-128 OFB under the encryption key.
+ * The MAC is the first 8 bytes of an AES-128 CBC-MAC under the
+ * authentication key over IV, command, source node, destination node,
+ * payload length and encrypted payload, zero padded to whole blocks.
+ * Both keys are derived from the network key: the encryption key is the
+ * network key encrypting 16 bytes of 0xAA, the authentication key 16 bytes
+ * of 0x55.
+ *
+ * S0EngineKeys() keeps the expanded keys of the last S0_ENGINE_KEY_CACHE
+ * network keys, so a key is derived and expanded once, not per frame.
+ *
+ * Nonces are not handled here: the caller looks up its receiver nonce by
+ * S0_RECEIVER_NONCE_ID() and retires it. S0DecryptBatch() decrypts and
+ * verifies many received frames in one call; the AES blocks of different
+ * frames, and of the OFB and CBC-MAC of one frame, are encrypted
+ * interleaved (see ZW_aes.h).
+ */
+#ifndef _ZW_S0_ENGINE_H_
+#define _ZW_S0_ENGINE_H_
+
+/****************************************************************************/
+/*                              INCLUDE FILES                               */
+/****************************************************************************/
+#include <stdint.h>
+#include <ZW_typedefs.h>
+#include <ZW_aes.h>
+
+/****************************************************************************/
+/*                     EXPORTED TYPES and DEFINITIONS                       */
+/****************************************************************************/
+
+#define S0_NONCE_LENGTH               8
+#define S0_MAC_LENGTH                 8
+
+/* Bytes of a frame besides the encrypted payload */
+#define S0_OVERHEAD                   (2 + S0_NONCE_LENGTH + 1 + S0_MAC_LENGTH)
+
+/* Largest payload, properties byte included, whose frame length fits a byte */
+#define S0_MAX_PAYLOAD                (255 - S0_OVERHEAD)
+
+/* Network keys whose expanded keys are kept */
+#define S0_ENGINE_KEY_CACHE           4
+
+/* Receiver nonce identifier of a received frame of \a length bytes */
+#define S0_RECEIVER_NONCE_ID(pFrame, length) ((pFrame)[(length) - S0_MAC_LENGTH - 1])
+
+typedef enum _E_S0_STATUS_
+{
+  S0_OK = 0,
+  S0_INVALID,                         /* Not an S0 frame, or too short or long */
+  S0_BAD_NONCE,                       /* Receiver nonce identifier does not match the nonce */
+  S0_BAD_MAC                          /* Authentication failed */
+} E_S0_STATUS;
+
+/* Expanded keys of a network key */
+typedef struct _S0_KEYS_
+{
+  AES_KEY_SCHEDULE encryption;
+  AES_KEY_SCHEDULE authentication;
+  uint8_t  networkKey[AES_KEY_LENGTH];
+  uint32_t lastUse;
+  uint8_t  valid;
+} S0_KEYS;
+
+/* Key cache */
+typedef struct _S0_ENGINE_
+{
+  uint32_t useCount;
+  S0_KEYS  keys[S0_ENGINE_KEY_CACHE];
+} S0_ENGINE;
+
+/* A received frame to decrypt with S0DecryptBatch() */
+typedef struct _S0_BATCH_FRAME_
+{
+  const S0_KEYS *pKeys;
+  const uint8_t *pFrame;
+  const uint8_t *pReceiverNonce;      /* Nonce sent to the source, S0_NONCE_LENGTH bytes */
+  uint8_t *pPayload;                  /* Out: decrypted payload, S0_MAX_PAYLOAD bytes */
+  uint8_t  frameLength;
+  uint8_t  sourceNode;
+  uint8_t  destinationNode;
+  uint8_t  payloadLength;             /* Out, 0 unless status is S0_OK */
+  uint8_t  status;                    /* Out: E_S0_STATUS */
+} S0_BATCH_FRAME;
+
+/****************************************************************************/
+/*                           EXPORTED FUNCTIONS                             */
+/****************************************************************************/
+
+/**
+ * Initialize an empty key cache.
+ */
+void
+S0EngineInit(
+  S0_ENGINE *pEngine);
+
+/**
+ * Get the expanded keys of a network key, deriving them if not cached.
+ *
+ * \return Keys, valid until S0_ENGINE_KEY_CACHE other network keys have been
+ *         looked up.
+ */
+const S0_KEYS *
+S0EngineKeys(
+  S0_ENGINE *pEngine,
+  const uint8_t *pNetworkKey);
+
+/**
+ * Derive and expand the keys of a network key without the cache.
+ */
+void
+S0KeysDerive(
+  const uint8_t *pNetworkKey,
+  S0_KEYS *pKeys);
+
+/**
+ * Encrypt a payload into an S0 frame.
+ *
+ * \param[in]  command     SECURITY_MESSAGE_ENCAPSULATION or
+ *                         SECURITY_MESSAGE_ENCAPSULATION_NONCE_GET.
+ * \param[in]  pPayload    Properties byte followed by the command.
+ * \param[out] pFrame      Buffer of \a payloadLength + S0_OVERHEAD bytes.
+ * \return Frame length, 0 if the payload is empty or too long.
+ */
+uint8_t
+S0Encrypt(
+  const S0_KEYS *pKeys,
+  uint8_t command,
+  uint8_t sourceNode,
+  uint8_t destinationNode,
+  const uint8_t *pSenderNonce,
+  const uint8_t *pReceiverNonce,
+  const uint8_t *pPayload,
+  uint8_t payloadLength,
+  uint8_t *pFrame);
+
+/**
+ * Verify and decrypt a received S0 frame.
+ *
+ * \param[in]  pReceiverNonce  Nonce sent to \a sourceNode, identified by
+ *                             S0_RECEIVER_NONCE_ID().
+ * \param[out] pPayload        Buffer of S0_MAX_PAYLOAD bytes.
+ * \param[out] pPayloadLength  Payload length, 0 on failure.
+ */
+E_S0_STATUS
+S0Decrypt(
+  const S0_KEYS *pKeys,
+  uint8_t sourceNode,
+  uint8_t destinationNode,
+  const uint8_t *pReceiverNonce,
+  const uint8_t *pFrame,
+  uint8_t frameLength,
+  uint8_t *pPayload,
+  uint8_t *pPayloadLength);
+
+/**
+ * Verify and decrypt many received frames. Frames may use different keys.
+ *
+ * \return Frames with status S0_OK.
+ */
+uint32_t
+S0DecryptBatch(
+  S0_BATCH_FRAME *pFrames,
+  uint32_t count);
+
+#endif /* _ZW_S0_ENGINE_H_ */
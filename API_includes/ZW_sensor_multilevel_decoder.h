@@ -0,0 +1,108 @@
+/****************************************************************************
+ *
+ * Description: Batch decoder for Sensor Multilevel Reports.
+ *
+ ****************************************************************************/
+/**
+ * \file ZW_sensor_multilevel_decoder.h
+ * \brief Batch decoding of Sensor Multilevel Reports into columns.
+ *
+ * A SENSOR_MULTILEVEL_REPORT (all versions of COMMAND_CLASS_SENSOR_MULTILEVEL)
+ * carries the sensor type, a level byte packing precision, scale and size,
+ * and a 1, 2 or 4 byte big-endian two's complement value.
+ *
+ * The batch decoder reads fixed stride SENSOR_ML_RECORD entries, so every
+ * value can be loaded as one 32 bit big-endian word and sign extended with a
+ * single arithmetic shift selected from a table by the size field. The scale
+ * by 10^-precision is a table lookup as well. Malformed reports are dropped
+ * by advancing the output index by the validity flag instead of branching,
+ * keeping the loop free of data dependent branches.
+ */
+#ifndef _ZW_SENSOR_MULTILEVEL_DECODER_H_
+#define _ZW_SENSOR_MULTILEVEL_DECODER_H_
+
+/****************************************************************************/
+/*                              INCLUDE FILES                               */
+/****************************************************************************/
+#include <stdint.h>
+#include <ZW_typedefs.h>
+
+/****************************************************************************/
+/*                     EXPORTED TYPES and DEFINITIONS                       */
+/****************************************************************************/
+
+/* Longest Sensor Multilevel Report: header, type, level and a 4 byte value */
+#define SENSOR_ML_RECORD_FRAME_SIZE   8
+
+/* One buffered report. Bytes beyond frameLength must be readable but are ignored */
+typedef struct _SENSOR_ML_RECORD_
+{
+  uint8_t nodeId;
+  uint8_t frameLength;
+  uint8_t frame[SENSOR_ML_RECORD_FRAME_SIZE];
+} SENSOR_ML_RECORD;
+
+/* Output columns, each with room for at least the number of input records */
+typedef struct _SENSOR_ML_COLUMNS_
+{
+  uint8_t *pNodeId;
+  uint8_t *pSensorType;
+  uint8_t *pScale;
+  float   *pValue;
+} SENSOR_ML_COLUMNS;
+
+/****************************************************************************/
+/*                           EXPORTED FUNCTIONS                             */
+/****************************************************************************/
+
+/**
+ * Copy a received report into a batch record.
+ *
+ * \param[out] pRecord     Record to fill.
+ * \param[in]  nodeId      Source node of the report.
+ * \param[in]  pFrame      Report starting with the command class byte.
+ * \param[in]  frameLength Length of \a pFrame. Bytes beyond
+ *                         SENSOR_ML_RECORD_FRAME_SIZE are not needed.
+ */
+void
+SensorMultilevelRecordSet(
+  SENSOR_ML_RECORD *pRecord,
+  uint8_t nodeId,
+  const uint8_t *pFrame,
+  uint8_t frameLength);
+
+/**
+ * Decode a batch of reports into columns.
+ *
+ * \param[in]  pRecords    Buffered reports.
+ * \param[in]  recordCount Number of records.
+ * \param[out] pColumns    Output columns. Valid reports are written densely
+ *                         in input order.
+ * \return Number of rows written. Records that are not valid Sensor
+ *         Multilevel Reports are skipped.
+ */
+uint32_t
+SensorMultilevelDecodeBatch(
+  const SENSOR_ML_RECORD *pRecords,
+  uint32_t recordCount,
+  const SENSOR_ML_COLUMNS *pColumns);
+
+/**
+ * Decode a single report.
+ *
+ * \param[in]  pFrame      Report starting with the command class byte.
+ * \param[in]  frameLength Length of \a pFrame.
+ * \param[out] pSensorType Sensor type.
+ * \param[out] pScale      Scale.
+ * \param[out] pValue      Value with precision applied.
+ * \return TRUE if \a pFrame is a valid Sensor Multilevel Report.
+ */
+BOOL
+SensorMultilevelDecode(
+  const uint8_t *pFrame,
+  uint8_t frameLength,
+  uint8_t *pSensorType,
+  uint8_t *pScale,
+  float *pValue);
+
+#endif /* _ZW_SENSOR_MULTILEVEL_DECODER_H_ */
@@ -0,0 +1,139 @@
+/****************************************************************************
+ *
+ * Description: Compiled Multilevel Sensor type and scale registry.
+ *
+ ****************************************************************************/
+/**
+ * \file ZW_sensor_multilevel_registry.h
+ * \brief Sensor type/scale names and conversion to SI units.
+ *
+ * The assigned sensor types and scales of "Registries/Multilevel Sensor
+ * Command Class, list of assigned Multilevel Sensor types and scales.xlsx"
+ * are compiled by tools/gen_sensor_multilevel_registry.py into read-only
+ * tables (ZW_sensor_multilevel_registry_table.c) indexed by
+ * (sensor type << 2) | scale.
+ *
+ * Each slot carries a linear conversion to an SI unit, si = value * scale +
+ * offset, stored as separate scale, offset and unit arrays. Normalizing the
+ * columns of SensorMultilevelDecodeBatch() is then one indexed load of each
+ * coefficient and a multiply-add per row, with no branches and no per report
+ * lookup by name. Unassigned type/scale pairs convert to NaN with unit
+ * SENSOR_SI_INVALID.
+ */
+#ifndef _ZW_SENSOR_MULTILEVEL_REGISTRY_H_
+#define _ZW_SENSOR_MULTILEVEL_REGISTRY_H_
+
+/****************************************************************************/
+/*                              INCLUDE FILES                               */
+/****************************************************************************/
+#include <stdint.h>
+#include <ZW_typedefs.h>
+#include <ZW_sensor_multilevel_decoder.h>
+
+/****************************************************************************/
+/*                     EXPORTED TYPES and DEFINITIONS                       */
+/****************************************************************************/
+
+/* SI unit of a normalized value */
+typedef enum _E_SENSOR_SI_UNIT_
+{
+  SENSOR_SI_NONE = 0,                   /* No SI equivalent, value passed through */
+  SENSOR_SI_DIMENSIONLESS,              /* Ratio, percentages are divided by 100 */
+  SENSOR_SI_KELVIN,
+  SENSOR_SI_LUX,
+  SENSOR_SI_WATT,
+  SENSOR_SI_KILOGRAM_PER_CUBIC_METER,
+  SENSOR_SI_METER_PER_SECOND,
+  SENSOR_SI_RADIAN,
+  SENSOR_SI_PASCAL,
+  SENSOR_SI_WATT_PER_SQUARE_METER,
+  SENSOR_SI_METER,
+  SENSOR_SI_KILOGRAM,
+  SENSOR_SI_VOLT,
+  SENSOR_SI_AMPERE,
+  SENSOR_SI_CUBIC_METER_PER_SECOND,
+  SENSOR_SI_CUBIC_METER,
+  SENSOR_SI_HERTZ,
+  SENSOR_SI_OHM_METER,
+  SENSOR_SI_OHM,
+  SENSOR_SI_SIEMENS_PER_METER,
+  SENSOR_SI_SECOND,
+  SENSOR_SI_MOLE_PER_CUBIC_METER,
+  SENSOR_SI_BECQUEREL_PER_CUBIC_METER,
+  SENSOR_SI_JOULE,
+  SENSOR_SI_METER_PER_SQUARE_SECOND,
+  SENSOR_SI_NEWTON,
+  SENSOR_SI_INVALID = 0xFF              /* Type/scale not assigned */
+} E_SENSOR_SI_UNIT;
+
+/****************************************************************************/
+/*                           EXPORTED FUNCTIONS                             */
+/****************************************************************************/
+
+/**
+ * Name of a sensor type, NULL if not assigned.
+ */
+const char *
+SensorMultilevelTypeName(
+  uint8_t sensorType);
+
+/**
+ * TRUE if the sensor type is deprecated.
+ */
+BOOL
+SensorMultilevelTypeDeprecated(
+  uint8_t sensorType);
+
+/**
+ * Label of a scale of a sensor type, NULL if not assigned.
+ */
+const char *
+SensorMultilevelScaleName(
+  uint8_t sensorType,
+  uint8_t scale);
+
+/**
+ * Command class version introducing a scale, 0 if not assigned.
+ */
+uint8_t
+SensorMultilevelScaleVersion(
+  uint8_t sensorType,
+  uint8_t scale);
+
+/**
+ * Symbol of an SI unit, e.g. "K" or "m3/s". Empty for SENSOR_SI_NONE and
+ * SENSOR_SI_DIMENSIONLESS.
+ */
+const char *
+SensorMultilevelSiSymbol(
+  E_SENSOR_SI_UNIT unit);
+
+/**
+ * Convert one value to its SI unit.
+ *
+ * \param[out] pUnit Unit of the returned value.
+ * \return Converted value, NaN if the type/scale is not assigned.
+ */
+float
+SensorMultilevelToSi(
+  uint8_t sensorType,
+  uint8_t scale,
+  float value,
+  E_SENSOR_SI_UNIT *pUnit);
+
+/**
+ * Convert the rows of decoded columns to SI units.
+ *
+ * \param[in]  pColumns Columns filled by SensorMultilevelDecodeBatch().
+ * \param[in]  rowCount Number of rows.
+ * \param[out] pSiValue Converted values, may alias pColumns->pValue.
+ * \param[out] pSiUnit  E_SENSOR_SI_UNIT per row, NULL if not needed.
+ */
+void
+SensorMultilevelNormalizeBatch(
+  const SENSOR_ML_COLUMNS *pColumns,
+  uint32_t rowCount,
+  float *pSiValue,
+  uint8_t *pSiUnit);
+
+#endif /* _ZW_SENSOR_MULTILEVEL_REGISTRY_H_ */
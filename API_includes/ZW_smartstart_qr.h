@@ -0,0 +1,143 @@
+/****************************************************************************
+ *
+ * Description: SmartStart QR code parser.
+ *
+ ****************************************************************************/
+/**
+ * \file ZW_smartstart_qr.h
+ * \brief Parser of Node Provisioning QR code strings, single or in batches.
+ *
+ * A QR code string is all decimal digits:
+ *
+ *   "90" lead-in, version (2), checksum (5), requested keys (3), DSK (8 x 5),
+ *   then TLVs of type (2, type << 1 | critical flag), length (2, in digits)
+ *   and value.
+ *
+ * The checksum is the first two bytes of the SHA-1 hash of the string after
+ * the checksum field. Numeric fields of 5 digits hold 16 bit values. Every
+ * digit group is range checked.
+ *
+ * SmartStartQrParse() writes into a caller supplied result and allocates
+ * nothing. The digit check uses SSE2 when the compiler targets it.
+ * SmartStartQrParseBatch() parses one QR code per line of a CSV text on
+ * several threads. Results are written in line order.
+ */
+#ifndef _ZW_SMARTSTART_QR_H_
+#define _ZW_SMARTSTART_QR_H_
+
+/****************************************************************************/
+/*                              INCLUDE FILES                               */
+/****************************************************************************/
+#include <stdint.h>
+#include <stddef.h>
+#include <ZW_typedefs.h>
+#include <ZW_provisioning_store.h>
+
+/****************************************************************************/
+/*                     EXPORTED TYPES and DEFINITIONS                       */
+/****************************************************************************/
+
+/* Digits of a QR code before the first TLV */
+#define SMARTSTART_QR_MIN_LENGTH      52
+
+/* QR code versions */
+#define SMARTSTART_QR_VERSION_S2      0
+#define SMARTSTART_QR_VERSION_SMARTSTART 1
+
+/* Bits of SMARTSTART_QR.tlvPresent, indexed by PROVISIONING_TLV_* */
+#define SMARTSTART_QR_TLV_BIT(type)   (1u << (type))
+
+/* Max bytes written by SmartStartQrToTlv() */
+#define SMARTSTART_QR_MAX_TLV         64
+
+typedef enum _E_SMARTSTART_QR_STATUS_
+{
+  SMARTSTART_QR_OK = 0,
+  SMARTSTART_QR_EMPTY,                /* Blank line or no such column */
+  SMARTSTART_QR_NOT_DIGITS,           /* Not all decimal digits, e.g. a CSV header */
+  SMARTSTART_QR_TOO_SHORT,
+  SMARTSTART_QR_BAD_LEAD_IN,
+  SMARTSTART_QR_BAD_VERSION,
+  SMARTSTART_QR_BAD_CHECKSUM,
+  SMARTSTART_QR_BAD_VALUE,            /* Digit group out of range */
+  SMARTSTART_QR_BAD_TLV,              /* TLV length wrong or past the end */
+  SMARTSTART_QR_UNSUPPORTED_CRITICAL  /* Unknown critical TLV */
+} E_SMARTSTART_QR_STATUS;
+
+/* A parsed QR code */
+typedef struct _SMARTSTART_QR_
+{
+  uint8_t  status;                    /* E_SMARTSTART_QR_STATUS */
+  uint8_t  version;
+  uint8_t  requestedKeys;             /* SECURITY_KEY_* bits */
+  uint8_t  dsk[PROVISIONING_DSK_LENGTH];
+  uint32_t tlvPresent;                /* SMARTSTART_QR_TLV_BIT() of the TLVs found */
+  /* PROVISIONING_TLV_PRODUCT_TYPE */
+  uint8_t  genericDeviceClass;
+  uint8_t  specificDeviceClass;
+  uint16_t installerIconType;
+  /* PROVISIONING_TLV_PRODUCT_ID */
+  uint16_t manufacturerId;
+  uint16_t productType;
+  uint16_t productId;
+  uint16_t applicationVersion;        /* Version << 8 | revision */
+  /* PROVISIONING_TLV_MAX_INCLUSION_REQUEST_INTERVAL, in 128 s units */
+  uint8_t  maxInclusionRequestInterval;
+  /* PROVISIONING_TLV_UUID16 */
+  uint8_t  uuidPresentation;
+  uint8_t  uuid[16];
+  /* PROVISIONING_TLV_SUPPORTED_PROTOCOLS */
+  uint32_t supportedProtocols;
+} SMARTSTART_QR;
+
+/****************************************************************************/
+/*                           EXPORTED FUNCTIONS                             */
+/****************************************************************************/
+
+/**
+ * Parse one QR code string.
+ *
+ * \param[in]  pText   Digits, not zero terminated.
+ * \param[in]  length  Number of digits.
+ * \param[out] pQr     Result, status included.
+ */
+E_SMARTSTART_QR_STATUS
+SmartStartQrParse(
+  const char *pText,
+  size_t length,
+  SMARTSTART_QR *pQr);
+
+/**
+ * Parse the QR codes in one column of a CSV text, one result per line.
+ * Fields may be quoted; white space around them is ignored.
+ *
+ * \param[in]  column      Field holding the QR code, 0 for the first.
+ * \param[out] pResults    One result per line, in line order.
+ * \param[in]  maxResults  Results beyond this are not stored.
+ * \param[in]  threads     Threads to use, 0 for one per CPU.
+ * \param[out] pFailed     Lines with a status other than SMARTSTART_QR_OK, may be NULL.
+ * \return Number of lines, which may exceed \a maxResults.
+ */
+uint32_t
+SmartStartQrParseBatch(
+  const char *pText,
+  size_t length,
+  uint8_t column,
+  SMARTSTART_QR *pResults,
+  uint32_t maxResults,
+  uint8_t threads,
+  uint32_t *pFailed);
+
+/**
+ * Convert the TLVs of a parsed QR code to Node Provisioning metadata TLVs,
+ * ready for ProvisioningStoreSet().
+ *
+ * \param[out] pTlv Buffer of SMARTSTART_QR_MAX_TLV bytes.
+ * \return Bytes written.
+ */
+uint16_t
+SmartStartQrToTlv(
+  const SMARTSTART_QR *pQr,
+  uint8_t *pTlv);
+
+#endif /* _ZW_SMARTSTART_QR_H_ */
@@ -0,0 +1,229 @@
+/****************************************************************************
+ *
+ * Description: Installation and Maintenance statistics collector.
+ *
+ ****************************************************************************/
+/**
+ * \file ZW_statistics_collector.h
+ * \brief Polls Network Management Installation and Maintenance statistics of
+ *        all nodes and keeps rolling aggregates.
+ *
+ * Nodes are polled round robin with STATISTICS_GET_V2, one node at a time,
+ * each at most once per poll interval. Transmit airtime is budgeted from the
+ * TX timers of the protocol like in ZW_interview_scheduler.h: no Get is sent
+ * while the airtime spent in the current window exceeds the budget.
+ *
+ * Each STATISTICS_REPORT_V2 adds one sample per metric. The route change,
+ * transmission count, packet error and transmission time statistics are
+ * counters, so their sample is the increase since the previous report of
+ * the node; the first report only sets the base. The neighbor sample is the
+ * number of neighbors.
+ *
+ * Memory is fixed: per node and metric the last STATS_COLLECTOR_WINDOW
+ * samples give the rolling min and max, and an EWMA covers the longer
+ * term. The aggregates are updated when a report arrives, so a snapshot is
+ * only a copy. Snapshots may be taken from another thread than the one
+ * feeding the collector; a per node sequence count makes the copy
+ * consistent without a lock.
+ */
+#ifndef _ZW_STATISTICS_COLLECTOR_H_
+#define _ZW_STATISTICS_COLLECTOR_H_
+
+/****************************************************************************/
+/*                              INCLUDE FILES                               */
+/****************************************************************************/
+#include <stdint.h>
+#include <ZW_typedefs.h>
+
+/****************************************************************************/
+/*                     EXPORTED TYPES and DEFINITIONS                       */
+/****************************************************************************/
+
+/* Max node ID that can be polled */
+#define STATS_COLLECTOR_MAX_NODES        232
+
+/* Samples in the rolling min/max window, a power of 2 */
+#define STATS_COLLECTOR_WINDOW           16
+
+/* EWMA weight of a new sample is 1 / 2^STATS_COLLECTOR_EWMA_SHIFT */
+#define STATS_COLLECTOR_EWMA_SHIFT       3
+
+/* Time to wait for a Statistics Report */
+#define STATS_COLLECTOR_TIMEOUT_MS       2000
+
+/* Length of a Statistics Get frame */
+#define STATS_COLLECTOR_GET_LENGTH       3
+
+/* Metrics, indexed by the STATISTICS_REPORT_*_V2 type */
+typedef enum _E_STATS_METRIC_
+{
+  STATS_METRIC_ROUTE_CHANGES = 0,     /* STATISTICS_REPORT_ROUTE_CHANGES_RC_V2 */
+  STATS_METRIC_TRANSMISSIONS,         /* STATISTICS_REPORT_TRANSMISSION_COUNT_TC_V2 */
+  STATS_METRIC_NEIGHBORS,             /* STATISTICS_REPORT_NEIGHBORS_NB_V2 */
+  STATS_METRIC_PACKET_ERRORS,         /* STATISTICS_REPORT_PACKET_ERROR_COUNT_PEC_V2 */
+  STATS_METRIC_TX_TIME,               /* STATISTICS_REPORT_SUM_OF_TRANSMISSION_TIMES_TS_V2, ms */
+  STATS_METRIC_TX_TIME_SQUARED,       /* STATISTICS_REPORT_SUM_OF_TRANSMISSION_TIMES_SQURARED_TS2_V2 */
+  STATS_METRIC_COUNT
+} E_STATS_METRIC;
+
+/* Aggregates of one metric of a node */
+typedef struct _STATS_METRIC_SUMMARY_
+{
+  uint32_t last;
+  uint32_t min;                       /* Over the last STATS_COLLECTOR_WINDOW samples */
+  uint32_t max;
+  uint32_t ewma;                      /* Rounded */
+  uint32_t samples;                   /* Samples since the node was added */
+} STATS_METRIC_SUMMARY;
+
+/* Snapshot of a node */
+typedef struct _STATS_NODE_SNAPSHOT_
+{
+  uint32_t lastReportMs;
+  uint32_t polls;
+  uint32_t timeouts;                  /* Gets not acknowledged or not answered */
+  STATS_METRIC_SUMMARY metric[STATS_METRIC_COUNT];
+} STATS_NODE_SNAPSHOT;
+
+/* Collector state per node */
+typedef struct _STATS_COLLECTOR_NODE_
+{
+  uint32_t sequence;                  /* Odd while the snapshot is updated */
+  STATS_NODE_SNAPSHOT snapshot;
+  uint32_t window[STATS_METRIC_COUNT][STATS_COLLECTOR_WINDOW];
+  uint64_t ewma[STATS_METRIC_COUNT];  /* Fixed point, 16 fractional bits */
+  uint32_t counterBase[STATS_METRIC_COUNT];
+  uint32_t lastPollMs;
+  uint8_t  active;
+  uint8_t  polled;                    /* lastPollMs is valid */
+  uint8_t  baseValid;                 /* Bits of the metrics with a counterBase */
+} STATS_COLLECTOR_NODE;
+
+/* Totals of the collector */
+typedef struct _STATS_COLLECTOR_STATS_
+{
+  uint32_t gets;
+  uint32_t reports;
+  uint32_t timeouts;
+  uint32_t malformed;                 /* Reports that could not be parsed */
+  uint32_t budgetStalls;              /* Polls that could not transmit for lack of airtime */
+} STATS_COLLECTOR_STATS;
+
+/**
+ * Transmit a Statistics Get. Return FALSE if it could not be queued; it is
+ * retried on the next poll. Completion is reported with
+ * StatsCollectorTxDone().
+ */
+typedef BOOL (*STATS_SEND_FUNC)(void *pUser, uint8_t nodeId, const uint8_t *pFrame, uint8_t frameLength);
+
+/**
+ * Return the airtime transmitted so far in ms, the sum of ZW_GetTxTimer()
+ * over all channels. Only differences are used, so it may wrap.
+ */
+typedef uint32_t (*STATS_TX_TIME_FUNC)(void *pUser);
+
+/* Collector instance */
+typedef struct _STATS_COLLECTOR_
+{
+  STATS_SEND_FUNC pSend;
+  STATS_TX_TIME_FUNC pTxTime;
+  void *pUser;
+  uint32_t pollIntervalMs;            /* Min time between two Gets of a node */
+  uint32_t airtimeBudgetMs;           /* Max airtime per window, 0 for no limit */
+  uint32_t airtimeWindowMs;
+  uint32_t windowStartMs;
+  uint32_t windowStartTxMs;
+  uint32_t pendingSinceMs;
+  uint8_t  pending;                   /* Node whose Get is outstanding, 0 if none */
+  uint8_t  transmitting;              /* Get of pending is on the radio */
+  uint8_t  cursor;                    /* Last node polled */
+  STATS_COLLECTOR_STATS stats;
+  STATS_COLLECTOR_NODE nodes[STATS_COLLECTOR_MAX_NODES + 1];
+} STATS_COLLECTOR;
+
+/****************************************************************************/
+/*                           EXPORTED FUNCTIONS                             */
+/****************************************************************************/
+
+/**
+ * Initialize the collector.
+ *
+ * \param[in] pollIntervalMs  Min time between two Gets of a node.
+ * \param[in] airtimeBudgetMs Max airtime per window, 0 for no limit.
+ * \param[in] airtimeWindowMs Length of the budget window.
+ * \param[in] pTxTime         Airtime source, may be NULL if there is no budget.
+ */
+void
+StatsCollectorInit(
+  STATS_COLLECTOR *pColl,
+  uint32_t pollIntervalMs,
+  uint32_t airtimeBudgetMs,
+  uint32_t airtimeWindowMs,
+  STATS_SEND_FUNC pSend,
+  STATS_TX_TIME_FUNC pTxTime,
+  void *pUser);
+
+/**
+ * Start polling a node. Its aggregates are cleared.
+ *
+ * \return FALSE if the ID is invalid.
+ */
+BOOL
+StatsCollectorAdd(
+  STATS_COLLECTOR *pColl,
+  uint8_t nodeId);
+
+/**
+ * Stop polling a node. Its snapshot remains readable.
+ */
+void
+StatsCollectorRemove(
+  STATS_COLLECTOR *pColl,
+  uint8_t nodeId);
+
+/**
+ * Report the transmit completion of the Get sent for a node.
+ *
+ * \param[in] acked FALSE if the Get was not acknowledged.
+ */
+void
+StatsCollectorTxDone(
+  STATS_COLLECTOR *pColl,
+  uint8_t nodeId,
+  BOOL acked,
+  uint32_t nowMs);
+
+/**
+ * Handle a received STATISTICS_REPORT_V2. Unsolicited reports of polled
+ * nodes are added too.
+ *
+ * \return FALSE if the frame is not a valid Statistics Report of a polled node.
+ */
+BOOL
+StatsCollectorReport(
+  STATS_COLLECTOR *pColl,
+  const uint8_t *pCmd,
+  uint8_t length,
+  uint32_t nowMs);
+
+/**
+ * Send the next Get and handle timeouts. Call after every transmit
+ * completion and report, and periodically.
+ */
+void
+StatsCollectorPoll(
+  STATS_COLLECTOR *pColl,
+  uint32_t nowMs);
+
+/**
+ * Copy the aggregates of a node.
+ *
+ * \return FALSE if the ID is invalid or the node has never been added.
+ */
+BOOL
+StatsCollectorSnapshot(
+  const STATS_COLLECTOR *pColl,
+  uint8_t nodeId,
+  STATS_NODE_SNAPSHOT *pSnapshot);
+
+#endif /* _ZW_STATISTICS_COLLECTOR_H_ */
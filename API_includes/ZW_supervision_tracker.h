@@ -0,0 +1,227 @@
+/****************************************************************************
+ *
+ * Description: Supervision session tracker with timer wheel timeouts.
+ *
+ ****************************************************************************/
+/**
+ * \file ZW_supervision_tracker.h
+ * \brief Tracking of outstanding COMMAND_CLASS_SUPERVISION sessions.
+ *
+ * Every Supervision Get opens a session that stays alive until a final
+ * Supervision Report (anything but SUPERVISION_REPORT_WORKING) is received or
+ * the session times out. A "working" report re-arms the timeout using the
+ * duration carried in the report.
+ *
+ * Sessions come from a caller allocated pool and are found through a direct
+ * (node ID, session ID) index, so opening, matching and closing a session are
+ * constant time regardless of how many sessions are outstanding. Timeouts are
+ * kept in a hierarchical timer wheel with SUPERVISION_WHEEL_LEVELS levels of
+ * SUPERVISION_WHEEL_SLOTS slots and a resolution of SUPERVISION_TICK_MS.
+ *
+ * Reports and timeouts are not delivered one by one. They are appended to a
+ * caller supplied event buffer which is handed to the batch callback when it
+ * fills up or when SupervisionTrackerFlush() is called.
+ *
+ * The batch callback may be called from within SupervisionTrackerReport()
+ * and SupervisionTrackerAdvance(), with the tracker in a consistent state.
+ * It may open and cancel sessions, but must not call
+ * SupervisionTrackerReport(), SupervisionTrackerAdvance() or
+ * SupervisionTrackerFlush(): these queue or deliver events while the event
+ * buffer is being delivered.
+ */
+#ifndef _ZW_SUPERVISION_TRACKER_H_
+#define _ZW_SUPERVISION_TRACKER_H_
+
+/****************************************************************************/
+/*                              INCLUDE FILES                               */
+/****************************************************************************/
+#include <stdint.h>
+#include <ZW_typedefs.h>
+
+/****************************************************************************/
+/*                     EXPORTED TYPES and DEFINITIONS                       */
+/****************************************************************************/
+
+/* Max node ID sessions can be opened to */
+#define SUPERVISION_MAX_NODES          232
+
+/* session_id is a 6 bit field */
+#define SUPERVISION_SESSION_ID_COUNT   64
+
+/* Timer wheel geometry */
+#define SUPERVISION_TICK_MS            10
+#define SUPERVISION_WHEEL_BITS         6
+#define SUPERVISION_WHEEL_SLOTS        (1 << SUPERVISION_WHEEL_BITS)
+#define SUPERVISION_WHEEL_LEVELS       4
+
+/* Extra time allowed after the duration announced in a "working" report */
+#define SUPERVISION_WORKING_GRACE_MS   5000
+
+/* Marker for "no session" in links and indexes */
+#define SUPERVISION_NO_SESSION         0xFFFF
+
+/* Event status for a session that timed out. Other values are SUPERVISION_REPORT_* */
+#define SUPERVISION_STATUS_TIMEOUT     0xFE
+
+/* Event passed to the batch callback */
+typedef struct _SUPERVISION_EVENT_
+{
+  void    *pContext;                /* Context given to SupervisionTrackerOpen() */
+  uint8_t  nodeId;
+  uint8_t  sessionId;
+  uint8_t  status;                  /* SUPERVISION_REPORT_* or SUPERVISION_STATUS_TIMEOUT */
+  uint8_t  duration;                /* Duration field of the report, 0 for timeouts */
+  BOOL     final;                   /* TRUE when the session has been closed */
+} SUPERVISION_EVENT;
+
+/**
+ * Receive a batch of events. The array is only valid during the call.
+ */
+typedef void (*SUPERVISION_BATCH_FUNC)(void *pUser, const SUPERVISION_EVENT *pEvents, uint16_t eventCount);
+
+/* One session. Allocated by the application and owned by the tracker */
+typedef struct _SUPERVISION_SESSION_
+{
+  void    *pContext;
+  uint32_t expiresTick;
+  uint16_t next;                    /* Timer slot or free list link */
+  uint16_t prev;                    /* Timer slot link */
+  uint16_t slot;                    /* Timer wheel slot, SUPERVISION_NO_SESSION if not armed */
+  uint8_t  nodeId;                  /* 0 when free */
+  uint8_t  sessionId;
+} SUPERVISION_SESSION;
+
+/* Tracker instance */
+typedef struct _SUPERVISION_TRACKER_
+{
+  SUPERVISION_SESSION *pSessions;
+  uint16_t sessionCount;
+  uint16_t freeHead;
+  uint16_t activeCount;
+  uint32_t currentTick;
+  uint32_t baseMs;                  /* Time of tick 0 */
+  SUPERVISION_EVENT *pEvents;
+  uint16_t eventCapacity;
+  uint16_t eventCount;
+  SUPERVISION_BATCH_FUNC pBatch;
+  void *pUser;
+  SUPERVISION_EVENT singleEvent;    /* Event buffer when none is given */
+  uint8_t  nextSessionId[SUPERVISION_MAX_NODES + 1];
+  uint16_t wheel[SUPERVISION_WHEEL_LEVELS * SUPERVISION_WHEEL_SLOTS];
+  uint16_t index[(SUPERVISION_MAX_NODES + 1) * SUPERVISION_SESSION_ID_COUNT];
+} SUPERVISION_TRACKER;
+
+/* Result of SupervisionTrackerReport() */
+typedef enum _E_SUPERVISION_MATCH_
+{
+  SUPERVISION_MATCH_FINAL = 0,      /* Report closed the session */
+  SUPERVISION_MATCH_WORKING,        /* Report extended the session */
+  SUPERVISION_MATCH_UNKNOWN,        /* No such session, e.g. already timed out */
+  SUPERVISION_MATCH_INVALID         /* Not a Supervision Report */
+} E_SUPERVISION_MATCH;
+
+/****************************************************************************/
+/*                           EXPORTED FUNCTIONS                             */
+/****************************************************************************/
+
+/**
+ * Initialize a tracker. No memory is allocated by the tracker.
+ *
+ * \param[out] pTracker      Tracker instance.
+ * \param[in]  pSessions     Session pool.
+ * \param[in]  sessionCount  Number of sessions in \a pSessions.
+ * \param[in]  pEvents       Event buffer for batched delivery.
+ * \param[in]  eventCapacity Number of events in \a pEvents. With 0 every
+ *                           event is delivered on its own.
+ * \param[in]  pBatch        Batch callback.
+ * \param[in]  pUser         Passed unmodified to \a pBatch.
+ * \param[in]  nowMs         Current time in milliseconds.
+ */
+void
+SupervisionTrackerInit(
+  SUPERVISION_TRACKER *pTracker,
+  SUPERVISION_SESSION *pSessions,
+  uint16_t sessionCount,
+  SUPERVISION_EVENT *pEvents,
+  uint16_t eventCapacity,
+  SUPERVISION_BATCH_FUNC pBatch,
+  void *pUser,
+  uint32_t nowMs);
+
+/**
+ * Open a session for a Supervision Get to \a nodeId.
+ *
+ * \param[in]  timeoutMs  Time to wait for the first report.
+ * \param[in]  pContext   Returned in every event of the session.
+ * \param[out] pSessionId Session ID to put in the Supervision Get.
+ * \param[in]  nowMs      Current time in milliseconds.
+ * \return TRUE if opened, FALSE if the pool is exhausted or all session IDs
+ *         of the node are in use.
+ */
+BOOL
+SupervisionTrackerOpen(
+  SUPERVISION_TRACKER *pTracker,
+  uint8_t nodeId,
+  uint32_t timeoutMs,
+  void *pContext,
+  uint8_t *pSessionId,
+  uint32_t nowMs);
+
+/**
+ * Build a Supervision Get encapsulating \a pCommand.
+ *
+ * \param[out] pFrame        Output buffer, at least commandLength + 4 bytes.
+ * \param[in]  sessionId     Session ID from SupervisionTrackerOpen().
+ * \param[in]  statusUpdates TRUE to ask for "working" updates.
+ * \return Length of the frame.
+ */
+uint8_t
+SupervisionTrackerBuildGet(
+  uint8_t *pFrame,
+  uint8_t sessionId,
+  BOOL statusUpdates,
+  const uint8_t *pCommand,
+  uint8_t commandLength);
+
+/**
+ * Match a received Supervision Report against the open sessions.
+ *
+ * \param[in] pFrame      Frame starting with the command class byte.
+ * \param[in] frameLength Length of \a pFrame.
+ * \param[in] nowMs       Current time in milliseconds.
+ */
+E_SUPERVISION_MATCH
+SupervisionTrackerReport(
+  SUPERVISION_TRACKER *pTracker,
+  uint8_t nodeId,
+  const uint8_t *pFrame,
+  uint8_t frameLength,
+  uint32_t nowMs);
+
+/**
+ * Close a session without delivering an event, e.g. when the Get could not
+ * be transmitted.
+ */
+void
+SupervisionTrackerCancel(
+  SUPERVISION_TRACKER *pTracker,
+  uint8_t nodeId,
+  uint8_t sessionId);
+
+/**
+ * Advance the timer wheel to \a nowMs and queue timeout events for expired
+ * sessions. Call periodically, at least every few seconds.
+ */
+void
+SupervisionTrackerAdvance(
+  SUPERVISION_TRACKER *pTracker,
+  uint32_t nowMs);
+
+/**
+ * Deliver all queued events to the batch callback.
+ */
+void
+SupervisionTrackerFlush(
+  SUPERVISION_TRACKER *pTracker);
+
+#endif /* _ZW_SUPERVISION_TRACKER_H_ */
@@ -0,0 +1,277 @@
+/****************************************************************************
+ *
+ * Description: Transport Service V2 segmentation and reassembly engine.
+ *
+ ****************************************************************************/
+/**
+ * \file ZW_transport_service.h
+ * \brief Transport Service V2 segmentation and reassembly.
+ *
+ * Datagrams longer than the max payload size are carried by
+ * COMMAND_CLASS_TRANSPORT_SERVICE_V2 as one COMMAND_FIRST_SEGMENT_V2 followed
+ * by a number of COMMAND_SUBSEQUENT_SEGMENT_V2 frames.
+ *
+ * The receiver keeps a pool of preallocated sessions. Each session owns a
+ * datagram buffer of TS_MAX_DATAGRAM_SIZE bytes and a bitmap with one bit per
+ * datagram byte, so segments are copied straight to their final offset and
+ * holes are found by scanning the bitmap one word at a time. When the last
+ * segment has been seen or the session times out, only the first missing
+ * offset is requested with COMMAND_SEGMENT_REQUEST_V2, one request at a time
+ * as required by the specification. Sessions are looked up directly by
+ * source node, so many nodes can transfer concurrently.
+ *
+ * The transmitter side builds segments for any datagram offset so a
+ * COMMAND_SEGMENT_REQUEST_V2 can be answered with exactly the missing segment.
+ */
+#ifndef _ZW_TRANSPORT_SERVICE_H_
+#define _ZW_TRANSPORT_SERVICE_H_
+
+/****************************************************************************/
+/*                              INCLUDE FILES                               */
+/****************************************************************************/
+#include <stdint.h>
+
+/****************************************************************************/
+/*                     EXPORTED TYPES and DEFINITIONS                       */
+/****************************************************************************/
+
+/* Max node ID accepted as session source */
+#define TS_MAX_NODES                 232
+
+/* datagram_size is an 11 bit field */
+#define TS_MAX_DATAGRAM_SIZE         2047
+
+/* Number of session IDs, session_id is a 4 bit field */
+#define TS_SESSION_ID_COUNT          16
+
+/* Words in the per session received-byte bitmap */
+#define TS_BITMAP_WORDS              ((TS_MAX_DATAGRAM_SIZE + 63) / 64)
+
+/* Header and checksum overhead of a First Segment without header extension */
+#define TS_FIRST_SEGMENT_OVERHEAD        6
+/* Header and checksum overhead of a Subsequent Segment without header extension */
+#define TS_SUBSEQUENT_SEGMENT_OVERHEAD   7
+
+/* Idle time before the receiver requests the first missing segment */
+#define TS_RX_REQUEST_TIMEOUT_MS     800
+/* Number of unanswered Segment Requests before a session is abandoned */
+#define TS_RX_MAX_REQUESTS           4
+
+/* Session slot marker for "no session" */
+#define TS_NO_SESSION                0xFFFF
+
+/* Result of TransportServiceRxFrame() */
+typedef enum _E_TS_RX_STATUS_
+{
+  TS_RX_SEGMENT_STORED = 0,    /* Segment stored, datagram still incomplete */
+  TS_RX_DATAGRAM_COMPLETE,     /* Datagram completed and delivered */
+  TS_RX_DUPLICATE,             /* Segment for an already completed session */
+  TS_RX_CHECKSUM_ERROR,        /* Segment dropped, frame check sequence mismatch */
+  TS_RX_INVALID_FRAME,         /* Frame malformed or not a segment */
+  TS_RX_NO_RESOURCES           /* Session pool exhausted, Segment Wait sent */
+} E_TS_RX_STATUS;
+
+/* Receiver statistics, all counters wrap */
+typedef struct _TS_RX_STATISTICS_
+{
+  uint32_t segmentsReceived;    /* Segments with valid checksum */
+  uint32_t checksumErrors;      /* Segments dropped due to checksum error */
+  uint32_t payloadBytes;        /* New datagram bytes stored */
+  uint32_t duplicateBytes;      /* Datagram bytes received more than once */
+  uint32_t segmentRequests;     /* COMMAND_SEGMENT_REQUEST_V2 sent */
+  uint32_t segmentWaits;        /* COMMAND_SEGMENT_WAIT_V2 sent */
+  uint32_t datagramsDelivered;  /* Datagrams passed to the application */
+  uint32_t datagramsAborted;    /* Sessions dropped after timeout */
+  uint32_t bytesDelivered;      /* Sum of delivered datagram sizes */
+} TS_RX_STATISTICS;
+
+/* Application callbacks used by the receiver */
+typedef struct _TS_RX_CALLBACKS_
+{
+  /**
+   * Transmit a Transport Service control frame (Segment Request, Segment
+   * Complete or Segment Wait) to \a destNode.
+   */
+  void (*pSend)(void *pUser, uint8_t destNode, const uint8_t *pFrame, uint8_t frameLength);
+  /**
+   * Deliver a reassembled datagram. \a pDatagram is only valid during the call.
+   */
+  void (*pDeliver)(void *pUser, uint8_t sourceNode, const uint8_t *pDatagram, uint16_t datagramLength);
+} TS_RX_CALLBACKS;
+
+/* One reassembly session. Allocated by the application and owned by the engine */
+typedef struct _TS_RX_SESSION_
+{
+  uint64_t receivedMap[TS_BITMAP_WORDS];  /* Bit set for every datagram byte received */
+  uint32_t lastActivityMs;                /* Time of last segment or request */
+  uint16_t datagramSize;
+  uint16_t bytesReceived;
+  uint16_t requestedOffset;               /* Offset of outstanding Segment Request */
+  uint16_t nextFree;                      /* Free list link */
+  uint8_t  sourceNode;                    /* 0 when the session is free */
+  uint8_t  sessionId;
+  uint8_t  lastSeen;                      /* TRUE once the segment ending the datagram was stored */
+  uint8_t  requestPending;                /* TRUE while a Segment Request is outstanding */
+  uint8_t  requestCount;                  /* Requests sent without progress */
+  uint8_t  segmentPayload;                /* Largest segment payload seen, used for Segment Wait */
+  uint8_t  datagram[TS_MAX_DATAGRAM_SIZE];
+} TS_RX_SESSION;
+
+/* Receiver instance */
+typedef struct _TS_RX_CONTEXT_
+{
+  TS_RX_SESSION *pSessions;
+  uint16_t sessionCount;
+  uint16_t freeHead;
+  uint16_t activeCount;
+  /* Session slot per source node, TS_NO_SESSION when idle */
+  uint16_t nodeSession[TS_MAX_NODES + 1];
+  /* Last completed session ID per node with bit 7 set, used to repeat Segment Complete */
+  uint8_t  completedSession[TS_MAX_NODES + 1];
+  const TS_RX_CALLBACKS *pCallbacks;
+  void *pUser;
+  TS_RX_STATISTICS stats;
+} TS_RX_CONTEXT;
+
+/* Transmitter session for one outgoing datagram */
+typedef struct _TS_TX_SESSION_
+{
+  const uint8_t *pDatagram;
+  uint16_t datagramSize;
+  uint16_t nextOffset;      /* Next offset to send in the initial pass */
+  uint8_t  sessionId;
+  uint8_t  segmentPayload;  /* Max payload bytes per segment */
+  uint8_t  complete;        /* TRUE when Segment Complete has been received */
+  uint8_t  waitSegments;    /* pendingFragments of the last Segment Wait */
+} TS_TX_SESSION;
+
+/* Control frames interpreted by TransportServiceTxControl() */
+typedef enum _E_TS_TX_EVENT_
+{
+  TS_TX_EVENT_NONE = 0,     /* Not a control frame for this session */
+  TS_TX_EVENT_REQUEST,      /* Resend the segment at the returned offset */
+  TS_TX_EVENT_COMPLETE,     /* Receiver has the whole datagram */
+  TS_TX_EVENT_WAIT          /* Receiver busy, retry after waitSegments segments */
+} E_TS_TX_EVENT;
+
+/****************************************************************************/
+/*                           EXPORTED FUNCTIONS                             */
+/****************************************************************************/
+
+/**
+ * Initialize a receiver with a caller allocated session pool.
+ *
+ * \param[out] pCtx         Receiver instance.
+ * \param[in]  pSessions    Session pool. No memory is allocated by the engine.
+ * \param[in]  sessionCount Number of sessions in \a pSessions, max TS_NO_SESSION - 1.
+ * \param[in]  pCallbacks   Transmit and delivery callbacks.
+ * \param[in]  pUser        Passed unmodified to the callbacks.
+ */
+void
+TransportServiceRxInit(
+  TS_RX_CONTEXT *pCtx,
+  TS_RX_SESSION *pSessions,
+  uint16_t sessionCount,
+  const TS_RX_CALLBACKS *pCallbacks,
+  void *pUser);
+
+/**
+ * Process a received COMMAND_CLASS_TRANSPORT_SERVICE_V2 segment.
+ *
+ * \param[in] pCtx        Receiver instance.
+ * \param[in] sourceNode  Node ID the frame was received from.
+ * \param[in] pFrame      Frame starting with the command class byte.
+ * \param[in] frameLength Length of \a pFrame including the frame check sequence.
+ * \param[in] nowMs       Current time in milliseconds.
+ * \return Outcome of the frame, see E_TS_RX_STATUS.
+ */
+E_TS_RX_STATUS
+TransportServiceRxFrame(
+  TS_RX_CONTEXT *pCtx,
+  uint8_t sourceNode,
+  const uint8_t *pFrame,
+  uint8_t frameLength,
+  uint32_t nowMs);
+
+/**
+ * Request missing segments of sessions idle for TS_RX_REQUEST_TIMEOUT_MS and
+ * abort sessions that stopped responding. Call periodically.
+ *
+ * \param[in] pCtx  Receiver instance.
+ * \param[in] nowMs Current time in milliseconds.
+ */
+void
+TransportServiceRxPoll(
+  TS_RX_CONTEXT *pCtx,
+  uint32_t nowMs);
+
+/**
+ * Get the first missing byte offset of the session from \a sourceNode.
+ *
+ * \return Offset of the first hole, or the datagram size when no hole exists.
+ *         TS_NO_SESSION if no session is active for the node.
+ */
+uint16_t
+TransportServiceRxFirstHole(
+  const TS_RX_CONTEXT *pCtx,
+  uint8_t sourceNode);
+
+/**
+ * Prepare a transmit session.
+ *
+ * \param[out] pTx            Transmit session.
+ * \param[in]  pDatagram      Datagram to send, must stay valid until complete.
+ * \param[in]  datagramSize   Size of \a pDatagram, max TS_MAX_DATAGRAM_SIZE.
+ * \param[in]  sessionId      Session ID, 0..TS_SESSION_ID_COUNT - 1.
+ * \param[in]  maxPayloadSize Max payload size of the link, e.g. from ZW_GetMaxPayloadSize().
+ * \return 1 on success, 0 if the parameters cannot be segmented.
+ */
+uint8_t
+TransportServiceTxInit(
+  TS_TX_SESSION *pTx,
+  const uint8_t *pDatagram,
+  uint16_t datagramSize,
+  uint8_t sessionId,
+  uint8_t maxPayloadSize);
+
+/**
+ * Build the segment starting at \a offset.
+ *
+ * \param[in]  pTx        Transmit session.
+ * \param[in]  offset     Datagram offset of the segment.
+ * \param[out] pFrame     Buffer for the segment, at least maxPayloadSize bytes.
+ * \return Length of the segment written to \a pFrame, 0 if \a offset is out of range.
+ */
+uint8_t
+TransportServiceTxSegment(
+  const TS_TX_SESSION *pTx,
+  uint16_t offset,
+  uint8_t *pFrame);
+
+/**
+ * Build the next segment of the initial transmission pass.
+ *
+ * \return Length of the segment written to \a pFrame, 0 when all segments were sent.
+ */
+uint8_t
+TransportServiceTxNext(
+  TS_TX_SESSION *pTx,
+  uint8_t *pFrame);
+
+/**
+ * Interpret a control frame received from the destination.
+ *
+ * \param[in,out] pTx         Transmit session.
+ * \param[in]     pFrame      Frame starting with the command class byte.
+ * \param[in]     frameLength Length of \a pFrame.
+ * \param[out]    pOffset     Requested offset for TS_TX_EVENT_REQUEST.
+ * \return Event carried by the frame.
+ */
+E_TS_TX_EVENT
+TransportServiceTxControl(
+  TS_TX_SESSION *pTx,
+  const uint8_t *pFrame,
+  uint8_t frameLength,
+  uint16_t *pOffset);
+
+#endif /* _ZW_TRANSPORT_SERVICE_H_ */
@@ -0,0 +1,183 @@
+/****************************************************************************
+ *
+ * Description: User Code Command Class slot synchronization.
+ *
+ ****************************************************************************/
+/**
+ * \file ZW_user_code_sync.h
+ * \brief Diff based synchronization of door lock user codes.
+ *
+ * The caller keeps a table of USER_CODE_SYNC_SLOT per lock, indexed by user
+ * identifier - 1. A slot holds the code the lock should have (desired) and a
+ * hash of the slot content last reported by the lock. Only the hash is kept
+ * for the lock side, so a lock with many slots costs a few bytes per slot.
+ *
+ * UserCodeSyncPush() sends USER_CODE_SET only for slots whose desired hash
+ * differs from the lock's. If the lock supports Multi Command, the commands
+ * are packed into COMMAND_CLASS_MULTI_CMD frames up to the max payload size,
+ * so the lock is kept awake for fewer frames. With verification, each Set is
+ * followed by a USER_CODE_GET of the same slot in the same frame, and the
+ * slot is in sync only once the report matches. Slots that were never read
+ * are read the same way by UserCodeSyncVerify().
+ *
+ * The hash covers the user ID status and, for occupied and reserved slots,
+ * the code.
+ */
+#ifndef _ZW_USER_CODE_SYNC_H_
+#define _ZW_USER_CODE_SYNC_H_
+
+/****************************************************************************/
+/*                              INCLUDE FILES                               */
+/****************************************************************************/
+#include <stdint.h>
+#include <ZW_typedefs.h>
+
+/****************************************************************************/
+/*                     EXPORTED TYPES and DEFINITIONS                       */
+/****************************************************************************/
+
+/* User codes are 4 to 10 digits */
+#define USER_CODE_SYNC_MIN_CODE_LENGTH     4
+#define USER_CODE_SYNC_MAX_CODE_LENGTH     10
+
+/* User identifiers are one byte */
+#define USER_CODE_SYNC_MAX_SLOTS           255
+
+/* Multi Command header: command class, command and number of commands */
+#define USER_CODE_SYNC_MULTI_CMD_HEADER    3
+
+/* Largest frame built: a Multi Command frame filling the largest max payload size */
+#define USER_CODE_SYNC_MAX_FRAME_LENGTH    160
+
+/* Slot flags */
+#define USER_CODE_SLOT_FLAG_CACHED         0x01 /* lockHash holds the lock's slot content */
+#define USER_CODE_SLOT_FLAG_DESIRED        0x02 /* The desired content is set */
+#define USER_CODE_SLOT_FLAG_PENDING        0x04 /* Set sent, waiting for the report verifying it */
+#define USER_CODE_SLOT_FLAG_REJECTED       0x08 /* The lock did not take the desired code */
+#define USER_CODE_SLOT_FLAG_UNSUPPORTED    0x10 /* The lock reported the slot as not available */
+
+/* One user code slot */
+typedef struct _USER_CODE_SYNC_SLOT_
+{
+  uint8_t  flags;                /* USER_CODE_SLOT_FLAG_* */
+  uint8_t  status;               /* Desired USER_CODE_SET_* user ID status */
+  uint8_t  codeLength;
+  uint8_t  userCode[USER_CODE_SYNC_MAX_CODE_LENGTH];
+  uint32_t desiredHash;
+  uint32_t lockHash;
+} USER_CODE_SYNC_SLOT;
+
+/* Slots of one lock */
+typedef struct _USER_CODE_SYNC_LOCK_
+{
+  uint8_t  nodeId;
+  uint8_t  maxPayload;           /* Max command length the lock accepts in one frame */
+  BOOL     multiCmd;             /* The lock supports COMMAND_CLASS_MULTI_CMD */
+  uint8_t  slotCount;            /* Slots in pSlots, lowered by a Users Number Report */
+  USER_CODE_SYNC_SLOT *pSlots;   /* Index user identifier - 1 */
+} USER_CODE_SYNC_LOCK;
+
+/* Frame counts of one push or verify */
+typedef struct _USER_CODE_SYNC_STATS_
+{
+  uint16_t frames;               /* Frames sent */
+  uint16_t multiCmdFrames;       /* Frames with more than one command */
+  uint16_t sets;
+  uint16_t gets;
+  uint16_t slotsSkipped;         /* Slots already in sync */
+  uint32_t bytes;                /* Payload bytes of all frames */
+} USER_CODE_SYNC_STATS;
+
+/**
+ * Transmit one frame to a lock. \a pFrame is only valid during the call.
+ * Return FALSE if the frame could not be queued; the sync stops and can be
+ * repeated later.
+ */
+typedef BOOL (*USER_CODE_SYNC_SEND_FUNC)(void *pUser, uint8_t nodeId, const uint8_t *pFrame, uint8_t frameLength);
+
+/****************************************************************************/
+/*                           EXPORTED FUNCTIONS                             */
+/****************************************************************************/
+
+/**
+ * Initialize a lock with a caller owned slot table. All slots start unknown.
+ *
+ * \param[in] maxPayload Max command length, batches are split to fit.
+ * \param[in] multiCmd   TRUE if the lock supports Multi Command at the key
+ *                       the frames are sent with.
+ * \param[in] slotCount  Slots in \a pSlots, the lock's supported users.
+ */
+void
+UserCodeSyncLockInit(
+  USER_CODE_SYNC_LOCK *pLock,
+  uint8_t nodeId,
+  uint8_t maxPayload,
+  BOOL multiCmd,
+  USER_CODE_SYNC_SLOT *pSlots,
+  uint8_t slotCount);
+
+/**
+ * Set the desired content of a slot.
+ *
+ * \param[in] status  USER_CODE_SET_* user ID status.
+ * \param[in] pCode   Code digits, ignored for USER_CODE_SET_AVAILABLE_NOT_SET.
+ * \return FALSE if the slot does not exist or the code length is invalid.
+ */
+BOOL
+UserCodeSyncSetDesired(
+  USER_CODE_SYNC_LOCK *pLock,
+  uint8_t userId,
+  uint8_t status,
+  const uint8_t *pCode,
+  uint8_t codeLength);
+
+/**
+ * Send all slots whose desired content differs from the lock's.
+ *
+ * \param[in]  verify  TRUE to read each slot back after setting it. Otherwise
+ *                     a slot is taken as set once its frame is queued.
+ * \param[out] pStats  Frame counts, may be NULL.
+ * \return FALSE if a frame could not be sent.
+ */
+BOOL
+UserCodeSyncPush(
+  USER_CODE_SYNC_LOCK *pLock,
+  BOOL verify,
+  USER_CODE_SYNC_SEND_FUNC pSend,
+  void *pUser,
+  USER_CODE_SYNC_STATS *pStats);
+
+/**
+ * Read all slots with unknown content or waiting for verification.
+ *
+ * \param[out] pStats  Frame counts, may be NULL.
+ * \return FALSE if a frame could not be sent.
+ */
+BOOL
+UserCodeSyncVerify(
+  USER_CODE_SYNC_LOCK *pLock,
+  USER_CODE_SYNC_SEND_FUNC pSend,
+  void *pUser,
+  USER_CODE_SYNC_STATS *pStats);
+
+/**
+ * Update the lock side from a USER_CODE_REPORT or USERS_NUMBER_REPORT.
+ * Reports received in a Multi Command frame are passed one by one.
+ *
+ * \return TRUE if the frame was a User Code report.
+ */
+BOOL
+UserCodeSyncReport(
+  USER_CODE_SYNC_LOCK *pLock,
+  const uint8_t *pFrame,
+  uint8_t frameLength);
+
+/**
+ * Forget the lock side of all slots, e.g. after codes were changed at the
+ * keypad.
+ */
+void
+UserCodeSyncInvalidate(
+  USER_CODE_SYNC_LOCK *pLock);
+
+#endif /* _ZW_USER_CODE_SYNC_H_ */
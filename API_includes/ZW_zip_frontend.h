@@ -0,0 +1,298 @@
+/****************************************************************************
+ *
+ * Description: Batched UDP front-end for Z/IP packets.
+ *
+ ****************************************************************************/
+/**
+ * \file ZW_zip_frontend.h
+ * \brief Z/IP (COMMAND_CLASS_ZIP_V3) packet front-end for LAN clients.
+ *
+ * Datagrams are received and sent in batches of up to ZIP_FRONTEND_BATCH
+ * with recvmmsg() and sendmmsg(), so a burst of client requests costs a
+ * single system call each way.
+ *
+ * ZipPacketParse() decodes the COMMAND_ZIP_PACKET header and its header
+ * extension in place. Known options are checked and unknown critical options
+ * are rejected, and the result points into the datagram. No copy is made.
+ *
+ * A request that starts a Serial API operation is registered with
+ * ZipFrontendPendingAdd(). That returns the callback ID (funcID) to use for
+ * the operation. When the Serial API callback arrives,
+ * ZipFrontendPendingComplete() sends the ACK or NACK for the sequence number
+ * of the request. A retransmission of a request that is still pending is
+ * answered with NACK Waiting and is not passed on again.
+ *
+ * The front-end binds to any address given, so everything can be exercised
+ * on the loopback interface.
+ *
+ * ZIP_FRONTEND holds struct mmsghdr arrays, which glibc only declares with
+ * _GNU_SOURCE: translation units including this header are built with
+ * -D_GNU_SOURCE.
+ */
+#ifndef _ZW_ZIP_FRONTEND_H_
+#define _ZW_ZIP_FRONTEND_H_
+
+/****************************************************************************/
+/*                              INCLUDE FILES                               */
+/****************************************************************************/
+#include <stdint.h>
+#include <sys/socket.h>
+#include <netinet/in.h>
+#include <ZW_typedefs.h>
+
+/****************************************************************************/
+/*                     EXPORTED TYPES and DEFINITIONS                       */
+/****************************************************************************/
+
+/* Datagrams per recvmmsg()/sendmmsg() call */
+#define ZIP_FRONTEND_BATCH                32
+
+/* Largest datagram handled, the IPv6 minimum MTU */
+#define ZIP_FRONTEND_MAX_DATAGRAM         1280
+
+/* COMMAND_ZIP_PACKET header without extension */
+#define ZIP_PACKET_HEADER_LENGTH          7
+
+/* Header extension option types, ZIP_OPTION_CRITICAL set for critical ones */
+#define ZIP_OPTION_CRITICAL               0x80
+#define ZIP_OPTION_TYPE_MASK              0x7F
+#define ZIP_OPTION_EXPECTED_DELAY         0x01
+#define ZIP_OPTION_IME_GET                0x02 /* Installation and Maintenance Get */
+#define ZIP_OPTION_IME_REPORT             0x03 /* Installation and Maintenance Report */
+#define ZIP_OPTION_ENCAPSULATION_FORMAT   0x04
+#define ZIP_OPTION_MULTICAST              0x05
+
+/* Bits of ZIP_PACKET.options for the options present */
+#define ZIP_OPTION_BIT(type)              (1u << (type))
+
+/* Serial API callback IDs are one byte, 0 means no callback */
+#define ZIP_FRONTEND_MAX_PENDING          255
+
+typedef enum _E_ZIP_PARSE_STATUS_
+{
+  ZIP_PARSE_OK = 0,
+  ZIP_PARSE_NOT_ZIP,                      /* Not a COMMAND_ZIP_PACKET */
+  ZIP_PARSE_TRUNCATED,                    /* Shorter than its header or extension */
+  ZIP_PARSE_BAD_EXTENSION,                /* Option lengths do not add up */
+  ZIP_PARSE_UNSUPPORTED_OPTION            /* Unknown critical option, answer with NACK Option Error */
+} E_ZIP_PARSE_STATUS;
+
+/* A parsed packet, all pointers into the datagram */
+typedef struct _ZIP_PACKET_
+{
+  uint8_t  flags1;                        /* COMMAND_ZIP_PACKET_PROPERTIES1_* */
+  uint8_t  flags2;                        /* COMMAND_ZIP_PACKET_PROPERTIES2_* */
+  uint8_t  seqNo;
+  uint8_t  sourceEndpoint;
+  uint8_t  destinationEndpoint;           /* Bit address flag included */
+  uint8_t  options;                       /* ZIP_OPTION_BIT() of the options present */
+  uint8_t  securityClass;                 /* Encapsulation format: requested security class */
+  uint8_t  encapsulationFlags;            /* Encapsulation format: CRC16 and other flags */
+  uint32_t expectedDelay;                 /* Seconds, from the Expected Delay option */
+  const uint8_t *pImeReport;              /* Installation and Maintenance Report TLVs */
+  uint8_t  imeReportLength;
+  const uint8_t *pMulticast;              /* Multicast addressing option value */
+  uint8_t  multicastLength;
+  const uint8_t *pCommand;                /* Z-Wave command, NULL if none */
+  uint16_t commandLength;
+} ZIP_PACKET;
+
+/* A LAN client */
+typedef struct _ZIP_CLIENT_
+{
+  struct sockaddr_storage address;
+  socklen_t addressLength;
+} ZIP_CLIENT;
+
+/* Request waiting for a Serial API callback */
+typedef struct _ZIP_PENDING_
+{
+  ZIP_CLIENT client;
+  uint32_t startMs;
+  uint8_t  used;
+  uint8_t  ackRequested;
+  uint8_t  seqNo;
+  uint8_t  sourceEndpoint;                /* Of the request */
+  uint8_t  destinationEndpoint;
+  uint8_t  next;                          /* Next callback ID in the hash bucket, 0 for none */
+} ZIP_PENDING;
+
+/* Counters */
+typedef struct _ZIP_FRONTEND_STATS_
+{
+  uint32_t received;                      /* Datagrams received */
+  uint32_t sent;                          /* Datagrams sent */
+  uint32_t recvCalls;                     /* recvmmsg() calls returning data */
+  uint32_t sendCalls;                     /* sendmmsg() calls */
+  uint32_t dropped;                       /* Not Z/IP or malformed */
+  uint32_t duplicates;                    /* Retransmissions of pending requests */
+  uint32_t sendErrors;                    /* Datagrams that could not be sent */
+} ZIP_FRONTEND_STATS;
+
+struct _ZIP_FRONTEND_;
+
+/**
+ * Called for each valid packet received, except retransmissions of pending
+ * requests. \a pPacket and the data it points to are only valid during the
+ * call.
+ */
+typedef void (*ZIP_PACKET_HANDLER)(void *pUser, struct _ZIP_FRONTEND_ *pFrontend, const ZIP_CLIENT *pClient,
+                                   const ZIP_PACKET *pPacket);
+
+/* Front-end instance */
+typedef struct _ZIP_FRONTEND_
+{
+  int fd;
+  ZIP_PACKET_HANDLER pHandler;
+  void *pUser;
+  uint8_t  txCount;                       /* Datagrams queued for the next sendmmsg() */
+  uint8_t  nextCallbackId;
+  uint16_t pendingCount;
+  ZIP_FRONTEND_STATS stats;
+  uint8_t  buckets[256];                  /* Pending requests by client and sequence number */
+  ZIP_PENDING pending[ZIP_FRONTEND_MAX_PENDING + 1];  /* Index callback ID */
+  struct mmsghdr rxMsg[ZIP_FRONTEND_BATCH];
+  struct iovec rxIov[ZIP_FRONTEND_BATCH];
+  struct sockaddr_storage rxAddress[ZIP_FRONTEND_BATCH];
+  uint8_t  rxBuffer[ZIP_FRONTEND_BATCH][ZIP_FRONTEND_MAX_DATAGRAM];
+  struct mmsghdr txMsg[ZIP_FRONTEND_BATCH];
+  struct iovec txIov[ZIP_FRONTEND_BATCH];
+  struct sockaddr_storage txAddress[ZIP_FRONTEND_BATCH];
+  uint16_t txLength[ZIP_FRONTEND_BATCH];
+  uint8_t  txBuffer[ZIP_FRONTEND_BATCH][ZIP_FRONTEND_MAX_DATAGRAM];
+} ZIP_FRONTEND;
+
+/****************************************************************************/
+/*                           EXPORTED FUNCTIONS                             */
+/****************************************************************************/
+
+/**
+ * Parse a COMMAND_ZIP_PACKET in place.
+ */
+E_ZIP_PARSE_STATUS
+ZipPacketParse(
+  const uint8_t *pData,
+  uint16_t length,
+  ZIP_PACKET *pPacket);
+
+/**
+ * Build a COMMAND_ZIP_PACKET without header extension.
+ *
+ * \param[in]  pCommand  Z-Wave command, may be NULL for a bare ACK or NACK.
+ * \param[out] pOut      Buffer of ZIP_PACKET_HEADER_LENGTH + \a commandLength bytes.
+ * \return Length of the packet.
+ */
+uint16_t
+ZipPacketBuild(
+  uint8_t flags1,
+  uint8_t flags2,
+  uint8_t seqNo,
+  uint8_t sourceEndpoint,
+  uint8_t destinationEndpoint,
+  const uint8_t *pCommand,
+  uint16_t commandLength,
+  uint8_t *pOut);
+
+/**
+ * Open a non-blocking UDP socket bound to \a pAddress, port 0 for any.
+ *
+ * \return FALSE if the socket could not be created or bound.
+ */
+BOOL
+ZipFrontendOpen(
+  ZIP_FRONTEND *pFrontend,
+  const struct sockaddr *pAddress,
+  socklen_t addressLength,
+  ZIP_PACKET_HANDLER pHandler,
+  void *pUser);
+
+/**
+ * Close the socket. Queued datagrams are dropped.
+ */
+void
+ZipFrontendClose(
+  ZIP_FRONTEND *pFrontend);
+
+/**
+ * Receive and handle all datagrams waiting, one batch per system call.
+ * Replies queued by the handler are sent before returning.
+ *
+ * \return Number of datagrams received.
+ */
+uint32_t
+ZipFrontendPoll(
+  ZIP_FRONTEND *pFrontend);
+
+/**
+ * Queue a datagram. The queue is sent when it is full or on
+ * ZipFrontendFlush().
+ *
+ * \return FALSE if the datagram is too long.
+ */
+BOOL
+ZipFrontendQueue(
+  ZIP_FRONTEND *pFrontend,
+  const ZIP_CLIENT *pClient,
+  const uint8_t *pData,
+  uint16_t length);
+
+/**
+ * Queue the ACK or NACK of a packet.
+ *
+ * \param[in] flags1  COMMAND_ZIP_PACKET_PROPERTIES1_ACK_RESPONSE_BIT_MASK or
+ *                    NACK_RESPONSE with its qualifier bits.
+ */
+BOOL
+ZipFrontendReply(
+  ZIP_FRONTEND *pFrontend,
+  const ZIP_CLIENT *pClient,
+  uint8_t seqNo,
+  uint8_t requestSourceEndpoint,
+  uint8_t requestDestinationEndpoint,
+  uint8_t flags1);
+
+/**
+ * Send all queued datagrams.
+ */
+void
+ZipFrontendFlush(
+  ZIP_FRONTEND *pFrontend);
+
+/**
+ * Register a request waiting for a Serial API operation.
+ *
+ * \return Callback ID to pass to the Serial API function, 0 if the table is
+ *         full.
+ */
+uint8_t
+ZipFrontendPendingAdd(
+  ZIP_FRONTEND *pFrontend,
+  const ZIP_CLIENT *pClient,
+  const ZIP_PACKET *pPacket,
+  uint32_t nowMs);
+
+/**
+ * Complete a pending request from its Serial API callback. The ACK or NACK
+ * is sent if the request asked for one.
+ *
+ * \return FALSE if no request is pending for the callback ID.
+ */
+BOOL
+ZipFrontendPendingComplete(
+  ZIP_FRONTEND *pFrontend,
+  uint8_t callbackId,
+  BOOL success);
+
+/**
+ * Drop pending requests older than \a timeoutMs without a reply; the client
+ * retransmits or gives up by itself.
+ *
+ * \return Number of requests dropped.
+ */
+uint16_t
+ZipFrontendPendingExpire(
+  ZIP_FRONTEND *pFrontend,
+  uint32_t nowMs,
+  uint32_t timeoutMs);
+
+#endif /* _ZW_ZIP_FRONTEND_H_ */
@@ -0,0 +1,389 @@
+/****************************************************************************
+ *
+ * Description: AES-128 CCM authenticated encryption.
+ *
+ ****************************************************************************/
+
+/****************************************************************************/
+/*                              INCLUDE FILES                               */
+/****************************************************************************/
+#include <string.h>
+#include <ZW_typedefs.h>
+#include <ZW_aes.h>
+#include <ZW_aes_ccm.h>
+
+/****************************************************************************/
+/*                      PRIVATE TYPES and DEFINITIONS                       */
+/****************************************************************************/
+
+/* Flags byte of B0 */
+#define FLAG_ADATA                   0x40
+#define FLAG_TAG_SHIFT               3
+
+/* Bytes encoding the length of the additional data */
+#define AAD_LENGTH_BYTES             2
+
+/* Frames CcmBatch() steps through together */
+#define BATCH_GROUP                  8
+
+/* Blocks a frame encrypts per step: CBC-MAC, and counter blocks 0 and 1 on the first step */
+#define LANES_PER_FRAME              3
+
+/* A frame being processed */
+typedef struct _CCM_WORK_
+{
+  CCM_JOB *pJob;
+  uint8_t  mac[AES_BLOCK_LENGTH];     /* CBC-MAC state, B0 before the first step */
+  uint8_t  counter[AES_BLOCK_LENGTH]; /* Counter block 0 */
+  uint8_t  s0[AES_BLOCK_LENGTH];      /* Counter block 0 encrypted, masks the tag */
+  uint16_t payloadLength;
+  uint16_t payloadBlocks;
+  uint16_t aadBlocks;
+  uint16_t macSteps;
+} CCM_WORK;
+
+/*
+ * Schedule of a frame with a additional data blocks and n payload blocks:
+ *
+ *   step 0         CBC-MAC of B0, counter blocks 0 and 1
+ *   step s >= 1    CBC-MAC of block s of the formatted input, counter block s + 1
+ *
+ * Payload block j is encrypted or decrypted with counter block j + 1 at
+ * step j and enters the CBC-MAC at step 1 + a + j, so the plaintext a
+ * decryption authenticates is always ready a step ahead.
+ */
+
+/****************************************************************************/
+/*                           PRIVATE FUNCTIONS                              */
+/****************************************************************************/
+
+/* Block k of the length prefixed, zero padded additional data */
+static void
+AadBlock(
+  const CCM_JOB *pJob,
+  uint16_t k,
+  uint8_t *pBlock)
+{
+  uint32_t position = (uint32_t)k * AES_BLOCK_LENGTH;
+  uint8_t i;
+
+  for (i = 0; i < AES_BLOCK_LENGTH; i++, position++)
+  {
+    if (0 == position)
+    {
+      pBlock[i] = (uint8_t)(pJob->aadLength >> 8);
+    }
+    else if (1 == position)
+    {
+      pBlock[i] = (uint8_t)pJob->aadLength;
+    }
+    else if (position - AAD_LENGTH_BYTES < pJob->aadLength)
+    {
+      pBlock[i] = pJob->pAad[position - AAD_LENGTH_BYTES];
+    }
+    else
+    {
+      pBlock[i] = 0;
+    }
+  }
+}
+
+/* Bytes of payload block j */
+static uint8_t
+BlockBytes(
+  const CCM_WORK *pWork,
+  uint16_t j)
+{
+  uint16_t left = (uint16_t)(pWork->payloadLength - j * AES_BLOCK_LENGTH);
+
+  return (uint8_t)(left < AES_BLOCK_LENGTH ? left : AES_BLOCK_LENGTH);
+}
+
+/* Check a job and prepare its work; FALSE with pJob->status set if it is rejected */
+static BOOL
+WorkStart(
+  CCM_WORK *pWork,
+  CCM_JOB *pJob)
+{
+  uint8_t q = (uint8_t)(15 - pJob->nonceLength);
+
+  if (pJob->nonceLength < CCM_MIN_NONCE_LENGTH || pJob->nonceLength > CCM_MAX_NONCE_LENGTH
+      || pJob->tagLength < CCM_MIN_TAG_LENGTH || pJob->tagLength > CCM_MAX_TAG_LENGTH
+      || (pJob->tagLength & 1)
+      || pJob->aadLength > CCM_MAX_AAD_LENGTH
+      || (pJob->decrypt && pJob->length < pJob->tagLength))
+  {
+    pJob->status = CCM_INVALID;
+    return FALSE;
+  }
+  pWork->pJob = pJob;
+  pWork->payloadLength = (uint16_t)(pJob->decrypt ? pJob->length - pJob->tagLength : pJob->length);
+  pWork->payloadBlocks = (uint16_t)((pWork->payloadLength + AES_BLOCK_LENGTH - 1) / AES_BLOCK_LENGTH);
+  pWork->aadBlocks = 0;
+  if (pJob->aadLength)
+  {
+    pWork->aadBlocks = (uint16_t)((AAD_LENGTH_BYTES + pJob->aadLength + AES_BLOCK_LENGTH - 1)
+                                  / AES_BLOCK_LENGTH);
+  }
+  pWork->macSteps = (uint16_t)(1 + pWork->aadBlocks + pWork->payloadBlocks);
+
+  /* B0: flags, nonce, payload length */
+  memset(pWork->mac, 0, AES_BLOCK_LENGTH);
+  pWork->mac[0] = (uint8_t)((pJob->aadLength ? FLAG_ADATA : 0)
+                            | (((pJob->tagLength - 2) / 2) << FLAG_TAG_SHIFT) | (q - 1));
+  memcpy(&pWork->mac[1], pJob->pNonce, pJob->nonceLength);
+  pWork->mac[AES_BLOCK_LENGTH - 2] = (uint8_t)(pWork->payloadLength >> 8);
+  pWork->mac[AES_BLOCK_LENGTH - 1] = (uint8_t)pWork->payloadLength;
+
+  /* Counter block 0: flags, nonce, counter */
+  memset(pWork->counter, 0, AES_BLOCK_LENGTH);
+  pWork->counter[0] = (uint8_t)(q - 1);
+  memcpy(&pWork->counter[1], pJob->pNonce, pJob->nonceLength);
+  return TRUE;
+}
+
+static void
+CounterBlock(
+  const CCM_WORK *pWork,
+  uint16_t i,
+  uint8_t *pBlock)
+{
+  memcpy(pBlock, pWork->counter, AES_BLOCK_LENGTH);
+  pBlock[AES_BLOCK_LENGTH - 2] = (uint8_t)(i >> 8);
+  pBlock[AES_BLOCK_LENGTH - 1] = (uint8_t)i;
+}
+
+/* Tag of a finished frame; compared without an early exit on decryption */
+static BOOL
+WorkFinish(
+  CCM_WORK *pWork)
+{
+  CCM_JOB *pJob = pWork->pJob;
+  uint8_t diff = 0;
+  uint8_t i;
+
+  for (i = 0; i < pJob->tagLength; i++)
+  {
+    uint8_t t = pWork->mac[i] ^ pWork->s0[i];
+
+    if (pJob->decrypt)
+    {
+      diff |= (uint8_t)(t ^ pJob->pIn[pWork->payloadLength + i]);
+    }
+    else
+    {
+      pJob->pOut[pWork->payloadLength + i] = t;
+    }
+  }
+  if (diff)
+  {
+    memset(pJob->pOut, 0, pWork->payloadLength);
+    pJob->status = CCM_AUTH_FAILED;
+    return FALSE;
+  }
+  pJob->status = CCM_OK;
+  return TRUE;
+}
+
+static uint32_t
+ProcessGroup(
+  CCM_WORK *pWork,
+  uint8_t count)
+{
+  const AES_KEY_SCHEDULE *schedules[LANES_PER_FRAME * BATCH_GROUP];
+  uint8_t blocks[LANES_PER_FRAME * BATCH_GROUP * AES_BLOCK_LENGTH];
+  uint16_t counterIndex[LANES_PER_FRAME * BATCH_GROUP];  /* Counter of a lane, 0xFFFF for CBC-MAC */
+  uint8_t owner[LANES_PER_FRAME * BATCH_GROUP];
+  uint32_t verified = 0;
+  uint16_t step;
+  uint8_t lanes;
+  uint8_t i;
+  uint8_t j;
+
+  for (step = 0; ; step++)
+  {
+    lanes = 0;
+    for (i = 0; i < count; i++)
+    {
+      CCM_WORK *w = &pWork[i];
+      const CCM_JOB *pJob = w->pJob;
+      uint8_t *pBlock;
+      uint16_t first;
+      uint16_t last;
+      uint16_t k;
+
+      if (step < w->macSteps)
+      {
+        pBlock = &blocks[lanes * AES_BLOCK_LENGTH];
+        if (0 == step)
+        {
+          memcpy(pBlock, w->mac, AES_BLOCK_LENGTH);
+        }
+        else
+        {
+          if (step <= w->aadBlocks)
+          {
+            AadBlock(pJob, (uint16_t)(step - 1), pBlock);
+          }
+          else
+          {
+            uint16_t block = (uint16_t)(step - 1 - w->aadBlocks);
+            const uint8_t *pPlain = pJob->decrypt ? pJob->pOut : pJob->pIn;
+            uint8_t n = BlockBytes(w, block);
+
+            memcpy(pBlock, &pPlain[block * AES_BLOCK_LENGTH], n);
+            memset(&pBlock[n], 0, AES_BLOCK_LENGTH - n);
+          }
+          for (j = 0; j < AES_BLOCK_LENGTH; j++)
+          {
+            pBlock[j] ^= w->mac[j];
+          }
+        }
+        schedules[lanes] = pJob->pKey;
+        counterIndex[lanes] = 0xFFFF;
+        owner[lanes++] = i;
+      }
+
+      first = 0 == step ? 0 : (uint16_t)(step + 1);
+      last = (uint16_t)(step + 1);
+      for (k = first; k <= last && k <= w->payloadBlocks; k++)
+      {
+        CounterBlock(w, k, &blocks[lanes * AES_BLOCK_LENGTH]);
+        schedules[lanes] = pJob->pKey;
+        counterIndex[lanes] = k;
+        owner[lanes++] = i;
+      }
+    }
+    if (0 == lanes)
+    {
+      break;
+    }
+
+    AesEncryptBlocks(schedules, blocks, blocks, lanes);
+
+    for (j = 0; j < lanes; j++)
+    {
+      CCM_WORK *w = &pWork[owner[j]];
+      const uint8_t *pKeyStream = &blocks[j * AES_BLOCK_LENGTH];
+
+      if (0xFFFF == counterIndex[j])
+      {
+        memcpy(w->mac, pKeyStream, AES_BLOCK_LENGTH);
+      }
+      else if (0 == counterIndex[j])
+      {
+        memcpy(w->s0, pKeyStream, AES_BLOCK_LENGTH);
+      }
+      else
+      {
+        uint16_t block = (uint16_t)(counterIndex[j] - 1);
+        uint16_t offset = (uint16_t)(block * AES_BLOCK_LENGTH);
+        uint8_t n = BlockBytes(w, block);
+        uint8_t b;
+
+        for (b = 0; b < n; b++)
+        {
+          w->pJob->pOut[offset + b] = w->pJob->pIn[offset + b] ^ pKeyStream[b];
+        }
+      }
+    }
+  }
+
+  for (i = 0; i < count; i++)
+  {
+    if (WorkFinish(&pWork[i]))
+    {
+      verified++;
+    }
+  }
+  return verified;
+}
+
+/****************************************************************************/
+/*                           EXPORTED FUNCTIONS                             */
+/****************************************************************************/
+
+uint32_t
+CcmBatch(
+  CCM_JOB *pJobs,
+  uint32_t count)
+{
+  CCM_WORK work[BATCH_GROUP];
+  uint32_t verified = 0;
+  uint8_t pending = 0;
+  uint32_t i;
+
+  for (i = 0; i < count; i++)
+  {
+    if (!WorkStart(&work[pending], &pJobs[i]))
+    {
+      continue;
+    }
+    if (++pending == BATCH_GROUP)
+    {
+      verified += ProcessGroup(work, pending);
+      pending = 0;
+    }
+  }
+  if (pending)
+  {
+    verified += ProcessGroup(work, pending);
+  }
+  return verified;
+}
+
+E_CCM_STATUS
+CcmEncrypt(
+  const AES_KEY_SCHEDULE *pKey,
+  const uint8_t *pNonce,
+  uint8_t nonceLength,
+  const uint8_t *pAad,
+  uint16_t aadLength,
+  const uint8_t *pIn,
+  uint16_t length,
+  uint8_t *pOut,
+  uint8_t tagLength)
+{
+  CCM_JOB job;
+
+  job.pKey = pKey;
+  job.pNonce = pNonce;
+  job.pAad = pAad;
+  job.pIn = pIn;
+  job.pOut = pOut;
+  job.aadLength = aadLength;
+  job.length = length;
+  job.nonceLength = nonceLength;
+  job.tagLength = tagLength;
+  job.decrypt = FALSE;
+  CcmBatch(&job, 1);
+  return (E_CCM_STATUS)job.status;
+}
+
+E_CCM_STATUS
+CcmDecrypt(
+  const AES_KEY_SCHEDULE *pKey,
+  const uint8_t *pNonce,
+  uint8_t nonceLength,
+  const uint8_t *pAad,
+  uint16_t aadLength,
+  const uint8_t *pIn,
+  uint16_t length,
+  uint8_t *pOut,
+  uint8_t tagLength)
+{
+  CCM_JOB job;
+
+  job.pKey = pKey;
+  job.pNonce = pNonce;
+  job.pAad = pAad;
+  job.pIn = pIn;
+  job.pOut = pOut;
+  job.aadLength = aadLength;
+  job.length = length;
+  job.nonceLength = nonceLength;
+  job.tagLength = tagLength;
+  job.decrypt = TRUE;
+  CcmBatch(&job, 1);
+  return (E_CCM_STATUS)job.status;
+}
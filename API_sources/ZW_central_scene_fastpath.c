@@ -0,0 +1,261 @@
+/****************************************************************************
+ *
+ * Description: Direct dispatch of Central Scene notifications to scene
+ *              handlers.
+ *
+ ****************************************************************************/
+
+/****************************************************************************/
+/*                              INCLUDE FILES                               */
+/****************************************************************************/
+#include <string.h>
+#include <ZW_typedefs.h>
+#include <ZW_classcmd.h>
+#include <ZW_SerialAPI.h>
+#include <ZW_central_scene_fastpath.h>
+
+/****************************************************************************/
+/*                      PRIVATE TYPES and DEFINITIONS                       */
+/****************************************************************************/
+
+/* Serial frame: SOF, length, type, function ID, ..., checksum */
+#define SERIAL_OFFSET_LENGTH        1
+#define SERIAL_OFFSET_TYPE          2
+#define SERIAL_OFFSET_FUNC_ID       3
+#define SERIAL_MIN_LENGTH           5
+
+/* Parameter offsets of the application command handlers */
+#define ACH_OFFSET_SOURCE           5  /* rxStatus, sourceNode, cmdLength, cmd */
+#define ACH_BRIDGE_OFFSET_SOURCE    6  /* rxStatus, destNode, sourceNode, cmdLength, cmd */
+
+/* Encapsulation header lengths */
+#define SUPERVISION_GET_HEADER      4
+#define MULTI_CHANNEL_ENCAP_HEADER  4
+#define NOTIFICATION_LENGTH         5
+
+/****************************************************************************/
+/*                           PRIVATE FUNCTIONS                              */
+/****************************************************************************/
+
+static E_CENTRAL_SCENE_RESULT
+Dispatch(
+  CENTRAL_SCENE_FAST_PATH *pFastPath,
+  uint8_t nodeId,
+  uint8_t endpoint,
+  const uint8_t *pNotification)
+{
+  CENTRAL_SCENE_NODE *pNode = &pFastPath->nodes[nodeId];
+  uint8_t sequence = pNotification[2];
+  uint8_t keyAttributes = pNotification[3] & CENTRAL_SCENE_NOTIFICATION_PROPERTIES1_KEY_ATTRIBUTES_MASK_V3;
+  BOOL slowRefresh = (pNotification[3] & CENTRAL_SCENE_NOTIFICATION_PROPERTIES1_SLOW_REFRESH_BIT_MASK_V3) ? TRUE : FALSE;
+  uint8_t sceneNumber = pNotification[4];
+  E_CENTRAL_SCENE_RESULT result = CENTRAL_SCENE_NO_HANDLER;
+  uint16_t i;
+
+  pFastPath->stats.notifications++;
+  if (pNode->sequenceValid && pNode->lastSequence == sequence)
+  {
+    pFastPath->stats.duplicates++;
+    return CENTRAL_SCENE_DUPLICATE;
+  }
+  pNode->sequenceValid = TRUE;
+  pNode->lastSequence = sequence;
+
+  for (i = pNode->head; CENTRAL_SCENE_NO_BINDING != i; i = pFastPath->pBindings[i].next)
+  {
+    const CENTRAL_SCENE_BINDING *pBinding = &pFastPath->pBindings[i];
+
+    if ((CENTRAL_SCENE_ANY_SCENE == pBinding->sceneNumber || sceneNumber == pBinding->sceneNumber)
+        && (CENTRAL_SCENE_ANY_ENDPOINT == pBinding->endpoint || endpoint == pBinding->endpoint)
+        && (pBinding->keyMask & CENTRAL_SCENE_KEY_BIT(keyAttributes)))
+    {
+      pBinding->pHandler(pBinding->pUser, nodeId, endpoint, sceneNumber, keyAttributes, slowRefresh);
+      pFastPath->stats.dispatched++;
+      result = CENTRAL_SCENE_DISPATCHED;
+    }
+  }
+  return result;
+}
+
+/****************************************************************************/
+/*                           EXPORTED FUNCTIONS                             */
+/****************************************************************************/
+
+void
+CentralSceneFastPathInit(
+  CENTRAL_SCENE_FAST_PATH *pFastPath,
+  CENTRAL_SCENE_BINDING *pBindings,
+  uint16_t bindingCount)
+{
+  uint16_t i;
+
+  memset(pFastPath, 0, sizeof(CENTRAL_SCENE_FAST_PATH));
+  pFastPath->pBindings = pBindings;
+  pFastPath->bindingCount = bindingCount;
+  for (i = 0; i < bindingCount; i++)
+  {
+    pBindings[i].next = (uint16_t)((i + 1 < bindingCount) ? i + 1 : CENTRAL_SCENE_NO_BINDING);
+  }
+  pFastPath->freeHead = bindingCount ? 0 : CENTRAL_SCENE_NO_BINDING;
+  for (i = 0; i <= CENTRAL_SCENE_MAX_NODES; i++)
+  {
+    pFastPath->nodes[i].head = CENTRAL_SCENE_NO_BINDING;
+  }
+}
+
+BOOL
+CentralSceneBind(
+  CENTRAL_SCENE_FAST_PATH *pFastPath,
+  uint8_t nodeId,
+  uint8_t endpoint,
+  uint8_t sceneNumber,
+  uint8_t keyMask,
+  CENTRAL_SCENE_HANDLER pHandler,
+  void *pUser)
+{
+  CENTRAL_SCENE_BINDING *pBinding;
+  uint16_t *pLink;
+  uint16_t index = pFastPath->freeHead;
+
+  if (0 == nodeId || nodeId > CENTRAL_SCENE_MAX_NODES || CENTRAL_SCENE_NO_BINDING == index || NULL == pHandler)
+  {
+    return FALSE;
+  }
+  pBinding = &pFastPath->pBindings[index];
+  pFastPath->freeHead = pBinding->next;
+  pBinding->next = CENTRAL_SCENE_NO_BINDING;
+  pBinding->sceneNumber = sceneNumber;
+  pBinding->endpoint = endpoint;
+  pBinding->keyMask = keyMask;
+  pBinding->pHandler = pHandler;
+  pBinding->pUser = pUser;
+
+  /* Append, handlers are called in binding order */
+  pLink = &pFastPath->nodes[nodeId].head;
+  while (CENTRAL_SCENE_NO_BINDING != *pLink)
+  {
+    pLink = &pFastPath->pBindings[*pLink].next;
+  }
+  *pLink = index;
+  return TRUE;
+}
+
+void
+CentralSceneUnbindNode(
+  CENTRAL_SCENE_FAST_PATH *pFastPath,
+  uint8_t nodeId)
+{
+  CENTRAL_SCENE_NODE *pNode;
+
+  if (0 == nodeId || nodeId > CENTRAL_SCENE_MAX_NODES)
+  {
+    return;
+  }
+  pNode = &pFastPath->nodes[nodeId];
+  while (CENTRAL_SCENE_NO_BINDING != pNode->head)
+  {
+    uint16_t index = pNode->head;
+
+    pNode->head = pFastPath->pBindings[index].next;
+    pFastPath->pBindings[index].next = pFastPath->freeHead;
+    pFastPath->freeHead = index;
+  }
+  pNode->sequenceValid = FALSE;
+}
+
+E_CENTRAL_SCENE_RESULT
+CentralSceneFastPathSerialFrame(
+  CENTRAL_SCENE_FAST_PATH *pFastPath,
+  const uint8_t *pFrame,
+  uint8_t length)
+{
+  uint8_t dataLength;
+  uint8_t source;
+  uint8_t checksum = 0xFF;
+  uint8_t i;
+
+  if (length < SERIAL_MIN_LENGTH || SOF != pFrame[0] || REQUEST != pFrame[SERIAL_OFFSET_TYPE])
+  {
+    return CENTRAL_SCENE_NOT_SCENE;
+  }
+  if (FUNC_ID_APPLICATION_COMMAND_HANDLER == pFrame[SERIAL_OFFSET_FUNC_ID])
+  {
+    source = ACH_OFFSET_SOURCE;
+  }
+  else if (FUNC_ID_APPLICATION_COMMAND_HANDLER_BRIDGE == pFrame[SERIAL_OFFSET_FUNC_ID])
+  {
+    source = ACH_BRIDGE_OFFSET_SOURCE;
+  }
+  else
+  {
+    return CENTRAL_SCENE_NOT_SCENE;
+  }
+
+  /* The length byte counts itself, type, function ID and parameters */
+  dataLength = pFrame[SERIAL_OFFSET_LENGTH];
+  if ((uint16_t)dataLength + 2 != length || source + 2 > dataLength)
+  {
+    return CENTRAL_SCENE_NOT_SCENE;
+  }
+  for (i = SERIAL_OFFSET_LENGTH; i <= dataLength; i++)
+  {
+    checksum ^= pFrame[i];
+  }
+  if (checksum != pFrame[dataLength + 1])
+  {
+    return CENTRAL_SCENE_NOT_SCENE;
+  }
+  /* Trailing fields (RSSI, multicast mask) may follow the command */
+  if (source + 2 + pFrame[source + 1] > dataLength + 1)
+  {
+    return CENTRAL_SCENE_NOT_SCENE;
+  }
+  return CentralSceneFastPathCommand(pFastPath, pFrame[source], 0, &pFrame[source + 2], pFrame[source + 1]);
+}
+
+E_CENTRAL_SCENE_RESULT
+CentralSceneFastPathCommand(
+  CENTRAL_SCENE_FAST_PATH *pFastPath,
+  uint8_t nodeId,
+  uint8_t endpoint,
+  const uint8_t *pCommand,
+  uint8_t length)
+{
+  if (0 == nodeId || nodeId > CENTRAL_SCENE_MAX_NODES)
+  {
+    return CENTRAL_SCENE_NOT_SCENE;
+  }
+  for (;;)
+  {
+    if (length < 2)
+    {
+      return CENTRAL_SCENE_NOT_SCENE;
+    }
+    if (COMMAND_CLASS_CENTRAL_SCENE_V3 == pCommand[0])
+    {
+      if (CENTRAL_SCENE_NOTIFICATION_V3 != pCommand[1] || length < NOTIFICATION_LENGTH)
+      {
+        return CENTRAL_SCENE_NOT_SCENE;
+      }
+      return Dispatch(pFastPath, nodeId, endpoint, pCommand);
+    }
+    if (COMMAND_CLASS_SUPERVISION == pCommand[0] && SUPERVISION_GET == pCommand[1]
+        && length >= SUPERVISION_GET_HEADER && pCommand[3] <= length - SUPERVISION_GET_HEADER)
+    {
+      length = pCommand[3];
+      pCommand += SUPERVISION_GET_HEADER;
+    }
+    else if (COMMAND_CLASS_MULTI_CHANNEL_V4 == pCommand[0] && MULTI_CHANNEL_CMD_ENCAP_V4 == pCommand[1]
+             && length > MULTI_CHANNEL_ENCAP_HEADER)
+    {
+      /* Source end point, without the bit addressing flag */
+      endpoint = pCommand[2] & 0x7F;
+      length -= MULTI_CHANNEL_ENCAP_HEADER;
+      pCommand += MULTI_CHANNEL_ENCAP_HEADER;
+    }
+    else
+    {
+      return CENTRAL_SCENE_NOT_SCENE;
+    }
+  }
+}
@@ -0,0 +1,499 @@
+/****************************************************************************
+ *
+ * Description: Configuration Command Class parameter synchronization.
+ *
+ ****************************************************************************/
+
+/****************************************************************************/
+/*                              INCLUDE FILES                               */
+/****************************************************************************/
+#include <string.h>
+#include <ZW_typedefs.h>
+#include <ZW_classcmd.h>
+#include <ZW_config_sync.h>
+
+/****************************************************************************/
+/*                      PRIVATE TYPES and DEFINITIONS                       */
+/****************************************************************************/
+
+/* Max parameters in one bulk command, the count field is one byte */
+#define BULK_MAX_PARAMS            255
+
+/* Single commands address parameters with one byte */
+#define SINGLE_MAX_NUMBER          255
+
+/* Header lengths of received reports */
+#define REPORT_HEADER_LENGTH       4
+#define BULK_REPORT_HEADER_LENGTH  7
+
+/* Decides whether a parameter takes part in a push or refresh */
+typedef BOOL (*NEEDS_FUNC)(const CONFIG_SYNC_PARAM *pParam);
+
+/****************************************************************************/
+/*                           PRIVATE FUNCTIONS                              */
+/****************************************************************************/
+
+static uint32_t
+SizeMask(uint8_t size)
+{
+  return (size >= 4) ? 0xFFFFFFFFUL : ((1UL << (size * 8)) - 1);
+}
+
+static BOOL
+NeedsWrite(const CONFIG_SYNC_PARAM *pParam)
+{
+  uint32_t mask = SizeMask(pParam->size);
+
+  if ((pParam->flags & (CONFIG_PARAM_FLAG_DESIRED | CONFIG_PARAM_FLAG_READ_ONLY | CONFIG_PARAM_FLAG_PENDING))
+      != CONFIG_PARAM_FLAG_DESIRED)
+  {
+    return FALSE;
+  }
+  return (0 == (pParam->flags & CONFIG_PARAM_FLAG_CACHED))
+         || ((pParam->cachedValue ^ pParam->desiredValue) & mask);
+}
+
+static BOOL
+NeedsRead(const CONFIG_SYNC_PARAM *pParam)
+{
+  return 0 == (pParam->flags & CONFIG_PARAM_FLAG_CACHED);
+}
+
+/* Value a Set sends for the parameter */
+static uint32_t
+WriteValue(const CONFIG_SYNC_PARAM *pParam)
+{
+  return (pParam->flags & CONFIG_PARAM_FLAG_DESIRED) ? pParam->desiredValue : pParam->cachedValue;
+}
+
+static BOOL
+BulkAllowed(
+  const CONFIG_SYNC_NODE *pNode,
+  const CONFIG_SYNC_PARAM *pParam)
+{
+  return pNode->version >= CONFIG_SYNC_BULK_MIN_VERSION
+         && 0 == (pParam->flags & CONFIG_PARAM_FLAG_NO_BULK);
+}
+
+static uint8_t
+PutValue(
+  uint8_t *pOut,
+  uint32_t value,
+  uint8_t size)
+{
+  uint8_t i;
+
+  for (i = 0; i < size; i++)
+  {
+    pOut[i] = (uint8_t)(value >> (8 * (size - 1 - i)));
+  }
+  return size;
+}
+
+static uint32_t
+GetValue(
+  const uint8_t *pIn,
+  uint8_t size)
+{
+  uint32_t value = 0;
+  uint8_t i;
+
+  for (i = 0; i < size; i++)
+  {
+    value = (value << 8) | pIn[i];
+  }
+  return value;
+}
+
+/**
+ * Find the parameters of one bulk frame starting at \a first. Parameters the
+ * push or refresh does not need are included when they lie between needed
+ * ones, have consecutive numbers and the same size, and cost no more bytes
+ * than a new frame header. Returns the number of parameters in the frame.
+ */
+static uint16_t
+BulkRun(
+  const CONFIG_SYNC_NODE *pNode,
+  uint16_t first,
+  uint8_t maxParams,
+  NEEDS_FUNC pNeeds,
+  BOOL write,
+  uint16_t *pBridged)
+{
+  const CONFIG_SYNC_PARAM *pParams = pNode->pParams;
+  uint8_t size = pParams[first].size;
+  uint16_t lastNeeded = first;
+  uint16_t j;
+
+  for (j = first + 1; j < pNode->paramCount && (uint16_t)(j - first) < maxParams; j++)
+  {
+    const CONFIG_SYNC_PARAM *pParam = &pParams[j];
+
+    if (pParam->number != pParams[j - 1].number + 1 || pParam->size != size || !BulkAllowed(pNode, pParam))
+    {
+      break;
+    }
+    if (pNeeds(pParam))
+    {
+      lastNeeded = j;
+      continue;
+    }
+    /* Bridging a parameter in a Set requires a known value to write back */
+    if (write && ((pParam->flags & CONFIG_PARAM_FLAG_READ_ONLY)
+                  || 0 == (pParam->flags & (CONFIG_PARAM_FLAG_CACHED | CONFIG_PARAM_FLAG_DESIRED))))
+    {
+      break;
+    }
+    if ((uint16_t)(j - lastNeeded) * size > CONFIG_SYNC_BULK_SET_HEADER)
+    {
+      break;
+    }
+  }
+  *pBridged = 0;
+  for (j = first; j <= lastNeeded; j++)
+  {
+    if (!pNeeds(&pParams[j]))
+    {
+      (*pBridged)++;
+    }
+  }
+  return (uint16_t)(lastNeeded - first + 1);
+}
+
+static uint8_t
+MaxBulkParams(
+  const CONFIG_SYNC_NODE *pNode,
+  uint8_t size)
+{
+  uint16_t room = (pNode->maxPayload > CONFIG_SYNC_MAX_FRAME_LENGTH) ? CONFIG_SYNC_MAX_FRAME_LENGTH : pNode->maxPayload;
+  uint16_t count;
+
+  if (room <= CONFIG_SYNC_BULK_SET_HEADER)
+  {
+    return 1;
+  }
+  count = (uint16_t)((room - CONFIG_SYNC_BULK_SET_HEADER) / size);
+  if (0 == count)
+  {
+    count = 1;
+  }
+  return (uint8_t)((count > BULK_MAX_PARAMS) ? BULK_MAX_PARAMS : count);
+}
+
+/* Index of the first parameter with a number >= \a number */
+static uint16_t
+LowerBound(
+  const CONFIG_SYNC_NODE *pNode,
+  uint16_t number)
+{
+  uint16_t low = 0;
+  uint16_t high = pNode->paramCount;
+
+  while (low < high)
+  {
+    uint16_t mid = (uint16_t)((low + high) / 2);
+    if (pNode->pParams[mid].number < number)
+    {
+      low = mid + 1;
+    }
+    else
+    {
+      high = mid;
+    }
+  }
+  return low;
+}
+
+static void
+CountStats(
+  CONFIG_SYNC_STATS *pStats,
+  BOOL bulk,
+  uint16_t params,
+  uint16_t bridged)
+{
+  if (bulk)
+  {
+    pStats->bulkFrames++;
+  }
+  else
+  {
+    pStats->singleFrames++;
+  }
+  pStats->paramsChanged += params - bridged;
+  pStats->paramsBridged += bridged;
+}
+
+/****************************************************************************/
+/*                           EXPORTED FUNCTIONS                             */
+/****************************************************************************/
+
+void
+ConfigSyncNodeInit(
+  CONFIG_SYNC_NODE *pNode,
+  uint8_t nodeId,
+  uint8_t version,
+  uint8_t maxPayload,
+  CONFIG_SYNC_PARAM *pParams,
+  uint16_t paramCount)
+{
+  pNode->nodeId = nodeId;
+  pNode->version = version;
+  pNode->maxPayload = maxPayload;
+  pNode->pParams = pParams;
+  pNode->paramCount = paramCount;
+}
+
+CONFIG_SYNC_PARAM *
+ConfigSyncFind(
+  CONFIG_SYNC_NODE *pNode,
+  uint16_t number)
+{
+  uint16_t index = LowerBound(pNode, number);
+
+  if (index < pNode->paramCount && pNode->pParams[index].number == number)
+  {
+    return &pNode->pParams[index];
+  }
+  return NULL;
+}
+
+BOOL
+ConfigSyncSetDesired(
+  CONFIG_SYNC_NODE *pNode,
+  uint16_t number,
+  uint32_t value)
+{
+  CONFIG_SYNC_PARAM *pParam = ConfigSyncFind(pNode, number);
+
+  if (NULL == pParam || (pParam->flags & CONFIG_PARAM_FLAG_READ_ONLY))
+  {
+    return FALSE;
+  }
+  pParam->desiredValue = value & SizeMask(pParam->size);
+  pParam->flags = (uint8_t)((pParam->flags | CONFIG_PARAM_FLAG_DESIRED) & ~CONFIG_PARAM_FLAG_PENDING);
+  return TRUE;
+}
+
+BOOL
+ConfigSyncPush(
+  CONFIG_SYNC_NODE *pNode,
+  CONFIG_SYNC_SEND_FUNC pSend,
+  void *pUser,
+  CONFIG_SYNC_STATS *pStats)
+{
+  CONFIG_SYNC_STATS stats;
+  uint8_t frame[CONFIG_SYNC_MAX_FRAME_LENGTH];
+  uint16_t i = 0;
+
+  memset(&stats, 0, sizeof(stats));
+  while (i < pNode->paramCount)
+  {
+    CONFIG_SYNC_PARAM *pParam = &pNode->pParams[i];
+    uint16_t count;
+    uint16_t bridged;
+    uint16_t k;
+    uint8_t length;
+
+    if (!NeedsWrite(pParam))
+    {
+      stats.paramsSkipped++;
+      i++;
+      continue;
+    }
+    if (!BulkAllowed(pNode, pParam))
+    {
+      if (pParam->number <= SINGLE_MAX_NUMBER)
+      {
+        frame[0] = COMMAND_CLASS_CONFIGURATION_V4;
+        frame[1] = CONFIGURATION_SET_V4;
+        frame[2] = (uint8_t)pParam->number;
+        frame[3] = pParam->size & CONFIGURATION_SET_LEVEL_SIZE_MASK_V4;
+        length = (uint8_t)(4 + PutValue(&frame[4], pParam->desiredValue, pParam->size));
+        if (!pSend(pUser, pNode->nodeId, frame, length))
+        {
+          break;
+        }
+        pParam->cachedValue = pParam->desiredValue;
+        pParam->flags |= CONFIG_PARAM_FLAG_CACHED;
+        CountStats(&stats, FALSE, 1, 0);
+      }
+      else
+      {
+        stats.paramsFailed++;
+      }
+      i++;
+      continue;
+    }
+
+    count = BulkRun(pNode, i, MaxBulkParams(pNode, pParam->size), NeedsWrite, TRUE, &bridged);
+    frame[0] = COMMAND_CLASS_CONFIGURATION_V4;
+    frame[1] = CONFIGURATION_BULK_SET_V4;
+    frame[2] = (uint8_t)(pParam->number >> 8);
+    frame[3] = (uint8_t)pParam->number;
+    frame[4] = (uint8_t)count;
+    frame[5] = (uint8_t)((pParam->size & CONFIGURATION_BULK_SET_PROPERTIES1_SIZE_MASK_V4)
+                         | CONFIGURATION_BULK_SET_PROPERTIES1_HANDSHAKE_BIT_MASK_V4);
+    length = CONFIG_SYNC_BULK_SET_HEADER;
+    for (k = 0; k < count; k++)
+    {
+      length += PutValue(&frame[length], WriteValue(&pParam[k]), pParam->size);
+    }
+    if (!pSend(pUser, pNode->nodeId, frame, length))
+    {
+      break;
+    }
+    /* The cached values are updated by the Bulk Report the handshake asks for */
+    for (k = 0; k < count; k++)
+    {
+      if (NeedsWrite(&pParam[k]))
+      {
+        pParam[k].flags |= CONFIG_PARAM_FLAG_PENDING;
+      }
+    }
+    CountStats(&stats, TRUE, count, bridged);
+    i += count;
+  }
+  if (pStats)
+  {
+    *pStats = stats;
+  }
+  return (BOOL)(i >= pNode->paramCount);
+}
+
+BOOL
+ConfigSyncRefresh(
+  CONFIG_SYNC_NODE *pNode,
+  CONFIG_SYNC_SEND_FUNC pSend,
+  void *pUser,
+  CONFIG_SYNC_STATS *pStats)
+{
+  CONFIG_SYNC_STATS stats;
+  uint8_t frame[CONFIG_SYNC_BULK_GET_LENGTH];
+  uint16_t i = 0;
+
+  memset(&stats, 0, sizeof(stats));
+  while (i < pNode->paramCount)
+  {
+    CONFIG_SYNC_PARAM *pParam = &pNode->pParams[i];
+    uint16_t count;
+    uint16_t bridged;
+
+    if (!NeedsRead(pParam))
+    {
+      stats.paramsSkipped++;
+      i++;
+      continue;
+    }
+    if (!BulkAllowed(pNode, pParam))
+    {
+      if (pParam->number <= SINGLE_MAX_NUMBER)
+      {
+        frame[0] = COMMAND_CLASS_CONFIGURATION_V4;
+        frame[1] = CONFIGURATION_GET_V4;
+        frame[2] = (uint8_t)pParam->number;
+        if (!pSend(pUser, pNode->nodeId, frame, 3))
+        {
+          break;
+        }
+        CountStats(&stats, FALSE, 1, 0);
+      }
+      else
+      {
+        stats.paramsFailed++;
+      }
+      i++;
+      continue;
+    }
+
+    /* The node splits the answer over several Bulk Reports if needed */
+    count = BulkRun(pNode, i, BULK_MAX_PARAMS, NeedsRead, FALSE, &bridged);
+    frame[0] = COMMAND_CLASS_CONFIGURATION_V4;
+    frame[1] = CONFIGURATION_BULK_GET_V4;
+    frame[2] = (uint8_t)(pParam->number >> 8);
+    frame[3] = (uint8_t)pParam->number;
+    frame[4] = (uint8_t)count;
+    if (!pSend(pUser, pNode->nodeId, frame, CONFIG_SYNC_BULK_GET_LENGTH))
+    {
+      break;
+    }
+    CountStats(&stats, TRUE, count, bridged);
+    i += count;
+  }
+  if (pStats)
+  {
+    *pStats = stats;
+  }
+  return (BOOL)(i >= pNode->paramCount);
+}
+
+BOOL
+ConfigSyncReport(
+  CONFIG_SYNC_NODE *pNode,
+  const uint8_t *pFrame,
+  uint8_t frameLength)
+{
+  CONFIG_SYNC_PARAM *pParam;
+  CONFIG_SYNC_PARAM *pEnd = pNode->pParams + pNode->paramCount;
+  uint16_t number;
+  uint8_t count;
+  uint8_t size;
+  uint8_t k;
+
+  if (frameLength < 2 || COMMAND_CLASS_CONFIGURATION_V4 != pFrame[0])
+  {
+    return FALSE;
+  }
+  if (CONFIGURATION_REPORT_V4 == pFrame[1])
+  {
+    size = (frameLength >= REPORT_HEADER_LENGTH) ? (pFrame[3] & CONFIGURATION_REPORT_LEVEL_SIZE_MASK_V4) : 0;
+    if (0 == size || frameLength < REPORT_HEADER_LENGTH + size)
+    {
+      return FALSE;
+    }
+    pParam = ConfigSyncFind(pNode, pFrame[2]);
+    if (pParam)
+    {
+      pParam->size = size;
+      pParam->cachedValue = GetValue(&pFrame[REPORT_HEADER_LENGTH], size);
+      pParam->flags = (uint8_t)((pParam->flags | CONFIG_PARAM_FLAG_CACHED) & ~CONFIG_PARAM_FLAG_PENDING);
+    }
+    return TRUE;
+  }
+  if (CONFIGURATION_BULK_REPORT_V4 != pFrame[1] || frameLength < BULK_REPORT_HEADER_LENGTH)
+  {
+    return FALSE;
+  }
+  number = (uint16_t)((pFrame[2] << 8) | pFrame[3]);
+  count = pFrame[4];
+  size = pFrame[6] & CONFIGURATION_BULK_REPORT_PROPERTIES1_SIZE_MASK_V4;
+  if (0 == size || frameLength < BULK_REPORT_HEADER_LENGTH + count * size)
+  {
+    return FALSE;
+  }
+  /* Parameters are consecutive; walk the sorted table from the first one */
+  pParam = &pNode->pParams[LowerBound(pNode, number)];
+  for (k = 0; k < count && pParam < pEnd; k++, number++)
+  {
+    if (pParam->number != number)
+    {
+      continue;
+    }
+    pParam->size = size;
+    pParam->cachedValue = GetValue(&pFrame[BULK_REPORT_HEADER_LENGTH + k * size], size);
+    pParam->flags = (uint8_t)((pParam->flags | CONFIG_PARAM_FLAG_CACHED) & ~CONFIG_PARAM_FLAG_PENDING);
+    pParam++;
+  }
+  return TRUE;
+}
+
+void
+ConfigSyncInvalidate(
+  CONFIG_SYNC_NODE *pNode)
+{
+  uint16_t i;
+
+  for (i = 0; i < pNode->paramCount; i++)
+  {
+    pNode->pParams[i].flags &= (uint8_t)~(CONFIG_PARAM_FLAG_CACHED | CONFIG_PARAM_FLAG_PENDING);
+  }
+}
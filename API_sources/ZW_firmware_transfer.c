@@ -0,0 +1,345 @@
+/****************************************************************************
+ *
+ * Description: Firmware Update Meta Data transfer to a node.
+ *
+ ****************************************************************************/
+
+/****************************************************************************/
+/*                              INCLUDE FILES                               */
+/****************************************************************************/
+#include <stdlib.h>
+#include <string.h>
+#include <ZW_typedefs.h>
+#include <ZW_classcmd.h>
+#include <ZW_crc.h>
+#include <ZW_firmware_transfer.h>
+
+/****************************************************************************/
+/*                      PRIVATE TYPES and DEFINITIONS                       */
+/****************************************************************************/
+
+/* Frame lengths of the node's commands */
+#define REQUEST_REPORT_LENGTH        3
+#define GET_LENGTH                   5
+#define STATUS_REPORT_LENGTH         3
+#define STATUS_REPORT_WAIT_LENGTH    5
+
+/* Report header: command class, command, properties1 and report number LSB */
+#define REPORT_HEADER_LENGTH         4
+
+/****************************************************************************/
+/*                           PRIVATE FUNCTIONS                              */
+/****************************************************************************/
+
+static void
+ReportHeader(
+  uint8_t *pHeader,
+  uint16_t reportNumber,
+  BOOL last)
+{
+  pHeader[0] = COMMAND_CLASS_FIRMWARE_UPDATE_MD_V5;
+  pHeader[1] = FIRMWARE_UPDATE_MD_REPORT_V5;
+  pHeader[2] = (uint8_t)((reportNumber >> 8) & FIRMWARE_UPDATE_MD_REPORT_PROPERTIES1_REPORT_NUMBER_1_MASK_V5);
+  if (last)
+  {
+    pHeader[2] |= FIRMWARE_UPDATE_MD_REPORT_PROPERTIES1_LAST_BIT_MASK_V5;
+  }
+  pHeader[3] = (uint8_t)reportNumber;
+}
+
+/* Image bytes carried by a report */
+static uint16_t
+ReportDataLength(
+  const FW_TRANSFER *pTransfer,
+  uint16_t reportNumber)
+{
+  uint32_t offset = (uint32_t)(reportNumber - 1) * pTransfer->fragmentSize;
+  uint32_t left = pTransfer->imageLength - offset;
+
+  return (left < pTransfer->fragmentSize) ? (uint16_t)left : pTransfer->fragmentSize;
+}
+
+/* Split the image with the current fragment size and checksum every report */
+static BOOL
+PrepareReports(FW_TRANSFER *pTransfer)
+{
+  uint32_t count = (pTransfer->imageLength + pTransfer->fragmentSize - 1) / pTransfer->fragmentSize;
+  uint16_t *pCrc;
+  uint16_t reportNumber;
+
+  if (0 == count || count > FW_TRANSFER_MAX_REPORTS)
+  {
+    return FALSE;
+  }
+  pCrc = realloc(pTransfer->pReportCrc, count * sizeof(uint16_t));
+  if (NULL == pCrc)
+  {
+    return FALSE;
+  }
+  pTransfer->pReportCrc = pCrc;
+  pTransfer->reportCount = (uint16_t)count;
+  for (reportNumber = 1; reportNumber <= count; reportNumber++)
+  {
+    uint8_t header[REPORT_HEADER_LENGTH];
+    uint16_t crc;
+
+    ReportHeader(header, reportNumber, reportNumber == count);
+    crc = ZW_CheckCrc16(CRC_INIT_VALUE, header, sizeof(header));
+    pCrc[reportNumber - 1] = ZW_CheckCrc16(crc,
+                                           pTransfer->pImage + (uint32_t)(reportNumber - 1) * pTransfer->fragmentSize,
+                                           ReportDataLength(pTransfer, reportNumber));
+  }
+  return TRUE;
+}
+
+static BOOL
+SendRequestGet(
+  FW_TRANSFER *pTransfer,
+  uint32_t nowMs)
+{
+  uint8_t frame[FW_TRANSFER_REQUEST_GET_LENGTH];
+
+  if (!PrepareReports(pTransfer))
+  {
+    return FALSE;
+  }
+  frame[0] = COMMAND_CLASS_FIRMWARE_UPDATE_MD_V5;
+  frame[1] = FIRMWARE_UPDATE_MD_REQUEST_GET_V5;
+  frame[2] = (uint8_t)(pTransfer->manufacturerId >> 8);
+  frame[3] = (uint8_t)pTransfer->manufacturerId;
+  frame[4] = (uint8_t)(pTransfer->firmwareId >> 8);
+  frame[5] = (uint8_t)pTransfer->firmwareId;
+  frame[6] = (uint8_t)(pTransfer->imageChecksum >> 8);
+  frame[7] = (uint8_t)pTransfer->imageChecksum;
+  frame[8] = pTransfer->firmwareTarget;
+  frame[9] = (uint8_t)(pTransfer->fragmentSize >> 8);
+  frame[10] = (uint8_t)pTransfer->fragmentSize;
+  frame[11] = pTransfer->activation ? FIRMWARE_UPDATE_MD_REQUEST_GET_PROPERTIES1_ACTIVATION_BIT_MASK_V5 : 0;
+  frame[12] = pTransfer->hardwareVersion;
+  if (!pTransfer->pSend(pTransfer->pUser, pTransfer->nodeId, frame, sizeof(frame)))
+  {
+    return FALSE;
+  }
+  pTransfer->stats.requestAttempts++;
+  pTransfer->lastActivityMs = nowMs;
+  pTransfer->state = FW_TRANSFER_REQUESTING;
+  return TRUE;
+}
+
+static void
+Finish(
+  FW_TRANSFER *pTransfer,
+  BOOL success,
+  uint32_t nowMs)
+{
+  pTransfer->state = success ? FW_TRANSFER_DONE : FW_TRANSFER_FAILED;
+  pTransfer->stats.doneMs = nowMs;
+}
+
+/* Answer a Get with up to numberOfReports reports in a row */
+static void
+SendReports(
+  FW_TRANSFER *pTransfer,
+  uint16_t reportNumber,
+  uint8_t numberOfReports)
+{
+  uint8_t frame[FW_TRANSFER_MAX_FRAME_LENGTH];
+
+  if (0 == numberOfReports)
+  {
+    numberOfReports = 1;
+  }
+  while (numberOfReports-- && 0 != reportNumber && reportNumber <= pTransfer->reportCount)
+  {
+    uint16_t length = ReportDataLength(pTransfer, reportNumber);
+    uint16_t crc = pTransfer->pReportCrc[reportNumber - 1];
+
+    ReportHeader(frame, reportNumber, reportNumber == pTransfer->reportCount);
+    memcpy(&frame[REPORT_HEADER_LENGTH],
+           pTransfer->pImage + (uint32_t)(reportNumber - 1) * pTransfer->fragmentSize, length);
+    frame[REPORT_HEADER_LENGTH + length] = (uint8_t)(crc >> 8);
+    frame[REPORT_HEADER_LENGTH + length + 1] = (uint8_t)crc;
+    if (!pTransfer->pSend(pTransfer->pUser, pTransfer->nodeId, frame,
+                          (uint8_t)(length + FW_TRANSFER_REPORT_OVERHEAD)))
+    {
+      /* The node asks again for what it did not get */
+      return;
+    }
+    pTransfer->stats.reports++;
+    pTransfer->stats.bytesSent += length;
+    if (reportNumber <= pTransfer->highestSent)
+    {
+      pTransfer->stats.repeatedReports++;
+    }
+    else
+    {
+      pTransfer->highestSent = reportNumber;
+    }
+    if (reportNumber == pTransfer->reportCount)
+    {
+      pTransfer->state = FW_TRANSFER_VERIFYING;
+    }
+    reportNumber++;
+  }
+}
+
+/****************************************************************************/
+/*                           EXPORTED FUNCTIONS                             */
+/****************************************************************************/
+
+void
+FwTransferInit(
+  FW_TRANSFER *pTransfer,
+  uint8_t nodeId,
+  const uint8_t *pImage,
+  uint32_t imageLength,
+  uint16_t manufacturerId,
+  uint16_t firmwareId,
+  uint8_t firmwareTarget,
+  uint8_t hardwareVersion,
+  BOOL activation,
+  FW_TRANSFER_SEND_FUNC pSend,
+  void *pUser)
+{
+  memset(pTransfer, 0, sizeof(*pTransfer));
+  pTransfer->nodeId = nodeId;
+  pTransfer->pImage = pImage;
+  pTransfer->imageLength = imageLength;
+  pTransfer->manufacturerId = manufacturerId;
+  pTransfer->firmwareId = firmwareId;
+  pTransfer->firmwareTarget = firmwareTarget;
+  pTransfer->hardwareVersion = hardwareVersion;
+  pTransfer->activation = activation ? TRUE : FALSE;
+  pTransfer->pSend = pSend;
+  pTransfer->pUser = pUser;
+}
+
+BOOL
+FwTransferStart(
+  FW_TRANSFER *pTransfer,
+  uint8_t maxPayload,
+  uint8_t overhead,
+  uint16_t maxFragmentSize,
+  uint32_t nowMs)
+{
+  int32_t fragmentSize = (int32_t)maxPayload - overhead - FW_TRANSFER_REPORT_OVERHEAD;
+
+  if (fragmentSize > FW_TRANSFER_MAX_FRAME_LENGTH - FW_TRANSFER_REPORT_OVERHEAD)
+  {
+    fragmentSize = FW_TRANSFER_MAX_FRAME_LENGTH - FW_TRANSFER_REPORT_OVERHEAD;
+  }
+  if (maxFragmentSize && fragmentSize > maxFragmentSize)
+  {
+    fragmentSize = maxFragmentSize;
+  }
+  if (fragmentSize <= 0 || 0 == pTransfer->imageLength)
+  {
+    return FALSE;
+  }
+  pTransfer->fragmentSize = (uint16_t)fragmentSize;
+  pTransfer->imageChecksum = ZW_CheckCrc16(CRC_INIT_VALUE, pTransfer->pImage, pTransfer->imageLength);
+  pTransfer->highestSent = 0;
+  pTransfer->status = 0;
+  pTransfer->waitTimeSec = 0;
+  memset(&pTransfer->stats, 0, sizeof(pTransfer->stats));
+  pTransfer->stats.startMs = nowMs;
+  return SendRequestGet(pTransfer, nowMs);
+}
+
+BOOL
+FwTransferFrame(
+  FW_TRANSFER *pTransfer,
+  const uint8_t *pFrame,
+  uint8_t frameLength,
+  uint32_t nowMs)
+{
+  if (frameLength < 2 || COMMAND_CLASS_FIRMWARE_UPDATE_MD_V5 != pFrame[0])
+  {
+    return FALSE;
+  }
+  switch (pFrame[1])
+  {
+    case FIRMWARE_UPDATE_MD_REQUEST_REPORT_V5:
+      if (frameLength < REQUEST_REPORT_LENGTH || FW_TRANSFER_REQUESTING != pTransfer->state)
+      {
+        return FALSE;
+      }
+      pTransfer->lastActivityMs = nowMs;
+      pTransfer->status = pFrame[2];
+      if (FIRMWARE_UPDATE_MD_REQUEST_REPORT_VALID_COMBINATION_V5 == pFrame[2])
+      {
+        pTransfer->state = FW_TRANSFER_SENDING;
+      }
+      else if (FIRMWARE_UPDATE_MD_REQUEST_REPORT_INVALID_FRAGMENT_SIZE_V5 == pFrame[2]
+               && pTransfer->fragmentSize > FW_TRANSFER_MIN_FRAGMENT)
+      {
+        /* Offer three quarters of the size until the node takes it */
+        pTransfer->fragmentSize = (uint16_t)(pTransfer->fragmentSize * 3 / 4);
+        if (pTransfer->fragmentSize < FW_TRANSFER_MIN_FRAGMENT)
+        {
+          pTransfer->fragmentSize = FW_TRANSFER_MIN_FRAGMENT;
+        }
+        if (!SendRequestGet(pTransfer, nowMs))
+        {
+          Finish(pTransfer, FALSE, nowMs);
+        }
+      }
+      else
+      {
+        Finish(pTransfer, FALSE, nowMs);
+      }
+      return TRUE;
+
+    case FIRMWARE_UPDATE_MD_GET_V5:
+      if (frameLength < GET_LENGTH
+          || (FW_TRANSFER_SENDING != pTransfer->state && FW_TRANSFER_VERIFYING != pTransfer->state))
+      {
+        return FALSE;
+      }
+      pTransfer->lastActivityMs = nowMs;
+      pTransfer->stats.gets++;
+      SendReports(pTransfer,
+                  (uint16_t)(((pFrame[3] & FIRMWARE_UPDATE_MD_GET_PROPERTIES1_REPORT_NUMBER_1_MASK_V5) << 8) | pFrame[4]),
+                  pFrame[2]);
+      return TRUE;
+
+    case FIRMWARE_UPDATE_MD_STATUS_REPORT_V5:
+      if (frameLength < STATUS_REPORT_LENGTH
+          || (FW_TRANSFER_SENDING != pTransfer->state && FW_TRANSFER_VERIFYING != pTransfer->state))
+      {
+        return FALSE;
+      }
+      pTransfer->status = pFrame[2];
+      if (frameLength >= STATUS_REPORT_WAIT_LENGTH)
+      {
+        pTransfer->waitTimeSec = (uint16_t)((pFrame[3] << 8) | pFrame[4]);
+      }
+      Finish(pTransfer, pFrame[2] >= FIRMWARE_UPDATE_MD_STATUS_REPORT_SUCCESSFULLY_WAITING_FOR_ACTIVATION_V5, nowMs);
+      return TRUE;
+
+    default:
+      return FALSE;
+  }
+}
+
+void
+FwTransferPoll(
+  FW_TRANSFER *pTransfer,
+  uint32_t nowMs)
+{
+  if ((FW_TRANSFER_REQUESTING == pTransfer->state || FW_TRANSFER_SENDING == pTransfer->state
+       || FW_TRANSFER_VERIFYING == pTransfer->state)
+      && (uint32_t)(nowMs - pTransfer->lastActivityMs) >= FW_TRANSFER_TIMEOUT_MS)
+  {
+    Finish(pTransfer, FALSE, nowMs);
+  }
+}
+
+void
+FwTransferFree(FW_TRANSFER *pTransfer)
+{
+  free(pTransfer->pReportCrc);
+  pTransfer->pReportCrc = NULL;
+  pTransfer->reportCount = 0;
+  pTransfer->state = FW_TRANSFER_IDLE;
+}
@@ -0,0 +1,704 @@
+/****************************************************************************
+ *
+ * Description: Persistent node interview cache.
+ *
+ ****************************************************************************/
+
+/****************************************************************************/
+/*                              INCLUDE FILES                               */
+/****************************************************************************/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <ZW_typedefs.h>
+#include <ZW_crc.h>
+#include <ZW_interview_cache.h>
+
+/****************************************************************************/
+/*                      PRIVATE TYPES and DEFINITIONS                       */
+/****************************************************************************/
+
+#define FILE_MAGIC              0x4349575AUL   /* "ZWIC" */
+#define FILE_VERSION            1
+
+#define MIN_PROFILES            16
+#define INITIAL_HEAP_PER_PROFILE 512
+
+#define PROFILE_EMPTY           0
+#define PROFILE_USED            1
+#define PROFILE_DELETED         2   /* Tombstone, keeps probe chains intact */
+
+/* Appended to the file name while a rebuilt file is written */
+#define REBUILD_SUFFIX          ".rebuild"
+
+/*
+ * File layout, all in host byte order:
+ *   FILE_HEADER
+ *   NODE_ENTRY[INTERVIEW_CACHE_MAX_NODES + 1], indexed by node ID
+ *   PROFILE_ENTRY[profileCapacity], open addressing on the identity
+ *   heap of profile records, offsets relative to its start
+ */
+typedef struct _FILE_HEADER_
+{
+  uint32_t magic;
+  uint32_t version;
+  uint32_t profileCapacity;     /* Power of two */
+  uint32_t profileSlotsUsed;    /* Used and deleted slots */
+  uint32_t heapCapacity;
+  uint32_t heapUsed;
+  uint32_t heapGarbage;         /* Bytes of replaced profiles */
+  uint32_t reserved[9];
+} FILE_HEADER;
+
+typedef struct _NODE_ENTRY_
+{
+  INTERVIEW_IDENTITY identity;
+  uint16_t valid;
+  uint16_t reserved;
+} NODE_ENTRY;
+
+typedef struct _PROFILE_ENTRY_
+{
+  INTERVIEW_IDENTITY identity;
+  uint16_t state;               /* PROFILE_EMPTY/USED/DELETED */
+  uint16_t crc;                 /* ZW_CheckCrc16 of the records */
+  uint32_t dataOffset;
+  uint32_t dataLength;
+} PROFILE_ENTRY;
+
+struct _INTERVIEW_CACHE_
+{
+  char *pPath;
+  int fd;
+  uint8_t *pMap;
+  size_t mapSize;
+  FILE_HEADER *pHeader;
+  NODE_ENTRY *pNodes;
+  PROFILE_ENTRY *pProfiles;
+  uint8_t *pHeap;
+  uint8_t *pVerified;           /* One bit per profile slot, set once the CRC was checked */
+};
+
+/****************************************************************************/
+/*                           PRIVATE FUNCTIONS                              */
+/****************************************************************************/
+
+static size_t
+FileSize(
+  uint32_t profileCapacity,
+  uint32_t heapCapacity)
+{
+  return sizeof(FILE_HEADER)
+         + (INTERVIEW_CACHE_MAX_NODES + 1) * sizeof(NODE_ENTRY)
+         + (size_t)profileCapacity * sizeof(PROFILE_ENTRY)
+         + heapCapacity;
+}
+
+/* FNV-1a over the identity fields */
+static uint32_t
+HashIdentity(const INTERVIEW_IDENTITY *pIdentity)
+{
+  const uint8_t *p = (const uint8_t *)pIdentity;
+  uint32_t hash = 0x811C9DC5UL;
+  uint8_t i;
+
+  for (i = 0; i < sizeof(INTERVIEW_IDENTITY); i++)
+  {
+    hash = (hash ^ p[i]) * 0x01000193UL;
+  }
+  return hash;
+}
+
+static BOOL
+SameIdentity(
+  const INTERVIEW_IDENTITY *pA,
+  const INTERVIEW_IDENTITY *pB)
+{
+  return 0 == memcmp(pA, pB, sizeof(INTERVIEW_IDENTITY));
+}
+
+/* Point the section pointers into a new mapping and reset the verified bits */
+static E_INTERVIEW_CACHE_STATUS
+MapFile(
+  INTERVIEW_CACHE *pCache,
+  size_t size)
+{
+  void *pMap;
+  uint32_t capacity;
+
+  if (pCache->pMap)
+  {
+    munmap(pCache->pMap, pCache->mapSize);
+    pCache->pMap = NULL;
+  }
+  pMap = mmap(NULL, size, PROT_READ | PROT_WRITE, MAP_SHARED, pCache->fd, 0);
+  if (MAP_FAILED == pMap)
+  {
+    return INTERVIEW_CACHE_IO_ERROR;
+  }
+  pCache->pMap = pMap;
+  pCache->mapSize = size;
+  pCache->pHeader = (FILE_HEADER *)pCache->pMap;
+  pCache->pNodes = (NODE_ENTRY *)(pCache->pMap + sizeof(FILE_HEADER));
+  pCache->pProfiles = (PROFILE_ENTRY *)(pCache->pNodes + INTERVIEW_CACHE_MAX_NODES + 1);
+  capacity = pCache->pHeader->profileCapacity;
+  pCache->pHeap = (uint8_t *)(pCache->pProfiles + capacity);
+
+  free(pCache->pVerified);
+  pCache->pVerified = calloc((capacity + 7) / 8, 1);
+  return pCache->pVerified ? INTERVIEW_CACHE_OK : INTERVIEW_CACHE_NO_MEMORY;
+}
+
+/* Create or truncate a file to an empty cache and map it, pCache->fd is opened */
+static E_INTERVIEW_CACHE_STATUS
+FileCreate(
+  INTERVIEW_CACHE *pCache,
+  const char *pPath,
+  uint32_t profileCapacity,
+  uint32_t heapCapacity)
+{
+  FILE_HEADER header;
+
+  memset(&header, 0, sizeof(header));
+  header.magic = FILE_MAGIC;
+  header.version = FILE_VERSION;
+  header.profileCapacity = profileCapacity;
+  header.heapCapacity = heapCapacity;
+  /* Extending the truncated file makes it read back as zeros */
+  pCache->fd = open(pPath, O_RDWR | O_CREAT | O_TRUNC, 0644);
+  if (pCache->fd < 0
+      || 0 != ftruncate(pCache->fd, (off_t)FileSize(profileCapacity, heapCapacity))
+      || pwrite(pCache->fd, &header, sizeof(header), 0) != (ssize_t)sizeof(header))
+  {
+    return INTERVIEW_CACHE_IO_ERROR;
+  }
+  return MapFile(pCache, FileSize(profileCapacity, heapCapacity));
+}
+
+/* Slot holding an identity, or -1 */
+static int32_t
+ProfileFind(
+  const INTERVIEW_CACHE *pCache,
+  const INTERVIEW_IDENTITY *pIdentity)
+{
+  uint32_t mask = pCache->pHeader->profileCapacity - 1;
+  uint32_t pos = HashIdentity(pIdentity) & mask;
+  uint32_t probes;
+
+  for (probes = 0; probes <= mask; probes++)
+  {
+    const PROFILE_ENTRY *pEntry = &pCache->pProfiles[pos];
+
+    if (PROFILE_EMPTY == pEntry->state)
+    {
+      break;
+    }
+    if (PROFILE_USED == pEntry->state && SameIdentity(&pEntry->identity, pIdentity))
+    {
+      return (int32_t)pos;
+    }
+    pos = (pos + 1) & mask;
+  }
+  return -1;
+}
+
+/* Free slot for a new identity; the table is never full, see Reserve() */
+static uint32_t
+ProfileInsert(
+  INTERVIEW_CACHE *pCache,
+  const INTERVIEW_IDENTITY *pIdentity)
+{
+  uint32_t mask = pCache->pHeader->profileCapacity - 1;
+  uint32_t pos = HashIdentity(pIdentity) & mask;
+
+  while (PROFILE_USED == pCache->pProfiles[pos].state)
+  {
+    pos = (pos + 1) & mask;
+  }
+  if (PROFILE_EMPTY == pCache->pProfiles[pos].state)
+  {
+    pCache->pHeader->profileSlotsUsed++;
+  }
+  pCache->pProfiles[pos].identity = *pIdentity;
+  pCache->pProfiles[pos].state = PROFILE_USED;
+  pCache->pProfiles[pos].dataOffset = 0;
+  pCache->pProfiles[pos].dataLength = 0;
+  return pos;
+}
+
+/* Check the CRC of a profile the first time it is used since open */
+static BOOL
+ProfileVerify(
+  INTERVIEW_CACHE *pCache,
+  uint32_t slot)
+{
+  PROFILE_ENTRY *pEntry = &pCache->pProfiles[slot];
+  uint8_t bit = (uint8_t)(1 << (slot & 7));
+
+  if (pCache->pVerified[slot >> 3] & bit)
+  {
+    return TRUE;
+  }
+  if ((uint64_t)pEntry->dataOffset + pEntry->dataLength > pCache->pHeader->heapUsed
+      || pEntry->crc != ZW_CheckCrc16(CRC_INIT_VALUE, pCache->pHeap + pEntry->dataOffset, pEntry->dataLength))
+  {
+    pEntry->state = PROFILE_DELETED;
+    pCache->pHeader->heapGarbage += pEntry->dataLength;
+    return FALSE;
+  }
+  pCache->pVerified[slot >> 3] |= bit;
+  return TRUE;
+}
+
+/*
+ * Rewrite the file with new capacities. Live profiles are rehashed and
+ * their records packed to the start of the heap, which drops tombstones and
+ * the records of replaced profiles.
+ *
+ * The new file is written under another name and renamed over the old one,
+ * so a crash or a full disk leaves the old file, and the old mapping stays
+ * in use until the rename succeeded.
+ */
+static E_INTERVIEW_CACHE_STATUS
+Rebuild(
+  INTERVIEW_CACHE *pCache,
+  uint32_t profileCapacity,
+  uint32_t heapCapacity)
+{
+  INTERVIEW_CACHE newCache;
+  const FILE_HEADER *pHeader = pCache->pHeader;
+  char *pNewPath;
+  uint32_t heapUsed = 0;
+  uint32_t i;
+  E_INTERVIEW_CACHE_STATUS status;
+
+  pNewPath = malloc(strlen(pCache->pPath) + sizeof(REBUILD_SUFFIX));
+  if (NULL == pNewPath)
+  {
+    return INTERVIEW_CACHE_NO_MEMORY;
+  }
+  sprintf(pNewPath, "%s%s", pCache->pPath, REBUILD_SUFFIX);
+  memset(&newCache, 0, sizeof(newCache));
+  status = FileCreate(&newCache, pNewPath, profileCapacity, heapCapacity);
+  if (INTERVIEW_CACHE_OK == status)
+  {
+    memcpy(newCache.pNodes, pCache->pNodes, (INTERVIEW_CACHE_MAX_NODES + 1) * sizeof(NODE_ENTRY));
+    for (i = 0; i < pHeader->profileCapacity; i++)
+    {
+      const PROFILE_ENTRY *pOld = &pCache->pProfiles[i];
+      uint32_t slot;
+
+      if (PROFILE_USED != pOld->state || (uint64_t)pOld->dataOffset + pOld->dataLength > pHeader->heapUsed)
+      {
+        continue;
+      }
+      slot = ProfileInsert(&newCache, &pOld->identity);
+      newCache.pProfiles[slot].crc = pOld->crc;
+      newCache.pProfiles[slot].dataOffset = heapUsed;
+      newCache.pProfiles[slot].dataLength = pOld->dataLength;
+      memcpy(newCache.pHeap + heapUsed, pCache->pHeap + pOld->dataOffset, pOld->dataLength);
+      heapUsed += pOld->dataLength;
+    }
+    newCache.pHeader->heapUsed = heapUsed;
+    /* On disk before it replaces the old file */
+    if (0 != msync(newCache.pMap, newCache.mapSize, MS_SYNC)
+        || 0 != rename(pNewPath, pCache->pPath))
+    {
+      status = INTERVIEW_CACHE_IO_ERROR;
+    }
+  }
+  if (INTERVIEW_CACHE_OK != status)
+  {
+    if (newCache.pMap)
+    {
+      munmap(newCache.pMap, newCache.mapSize);
+    }
+    if (newCache.fd >= 0)
+    {
+      close(newCache.fd);
+      unlink(pNewPath);
+    }
+    free(newCache.pVerified);
+    free(pNewPath);
+    return status;
+  }
+  free(pNewPath);
+  munmap(pCache->pMap, pCache->mapSize);
+  close(pCache->fd);
+  free(pCache->pVerified);
+  newCache.pPath = pCache->pPath;
+  *pCache = newCache;
+  return INTERVIEW_CACHE_OK;
+}
+
+/* Make room for one more profile and length bytes of records */
+static E_INTERVIEW_CACHE_STATUS
+Reserve(
+  INTERVIEW_CACHE *pCache,
+  BOOL newProfile,
+  uint32_t length)
+{
+  FILE_HEADER *pHeader = pCache->pHeader;
+  uint32_t profileCapacity = pHeader->profileCapacity;
+  uint32_t heapCapacity = pHeader->heapCapacity;
+  uint64_t live = (uint64_t)length;
+
+  if (pHeader->heapGarbage < pHeader->heapUsed)
+  {
+    live += pHeader->heapUsed - pHeader->heapGarbage;
+  }
+  if (newProfile && (pHeader->profileSlotsUsed + 1) * 4 > profileCapacity * 3)
+  {
+    /* Keep the load factor below 3/4, tombstones included */
+    profileCapacity *= 2;
+  }
+  if ((uint64_t)pHeader->heapUsed + length > heapCapacity)
+  {
+    /* Grow unless packing frees at least half of the heap */
+    while (live * 2 > heapCapacity)
+    {
+      if (heapCapacity > 0x7FFFFFFFUL)
+      {
+        return INTERVIEW_CACHE_NO_MEMORY;
+      }
+      heapCapacity *= 2;
+    }
+  }
+  else if (profileCapacity == pHeader->profileCapacity)
+  {
+    return INTERVIEW_CACHE_OK;
+  }
+  return Rebuild(pCache, profileCapacity, heapCapacity);
+}
+
+static BOOL
+NodeValid(uint8_t nodeId)
+{
+  return 0 != nodeId && nodeId <= INTERVIEW_CACHE_MAX_NODES;
+}
+
+/****************************************************************************/
+/*                           EXPORTED FUNCTIONS                             */
+/****************************************************************************/
+
+E_INTERVIEW_CACHE_STATUS
+InterviewCacheOpen(
+  const char *pPath,
+  uint32_t profileCapacity,
+  INTERVIEW_CACHE **ppCache)
+{
+  INTERVIEW_CACHE *pCache = calloc(1, sizeof(INTERVIEW_CACHE));
+  FILE_HEADER header;
+  struct stat st;
+  uint32_t capacity = MIN_PROFILES;
+  E_INTERVIEW_CACHE_STATUS status = INTERVIEW_CACHE_IO_ERROR;
+
+  if (NULL == pCache)
+  {
+    return INTERVIEW_CACHE_NO_MEMORY;
+  }
+  while (capacity < profileCapacity && capacity < 0x10000)
+  {
+    capacity *= 2;
+  }
+  pCache->pPath = strdup(pPath);
+  if (NULL == pCache->pPath)
+  {
+    free(pCache);
+    return INTERVIEW_CACHE_NO_MEMORY;
+  }
+  pCache->fd = open(pPath, O_RDWR | O_CREAT, 0644);
+  if (pCache->fd < 0 || 0 != fstat(pCache->fd, &st))
+  {
+    goto fail;
+  }
+  if ((size_t)st.st_size >= sizeof(header)
+      && pread(pCache->fd, &header, sizeof(header), 0) == (ssize_t)sizeof(header)
+      && FILE_MAGIC == header.magic && FILE_VERSION == header.version
+      && header.profileCapacity >= MIN_PROFILES
+      && 0 == (header.profileCapacity & (header.profileCapacity - 1))
+      && header.heapUsed <= header.heapCapacity
+      && (size_t)st.st_size == FileSize(header.profileCapacity, header.heapCapacity))
+  {
+    status = MapFile(pCache, (size_t)st.st_size);
+  }
+  else
+  {
+    /* New file, other format version or damaged header: start over */
+    close(pCache->fd);
+    status = FileCreate(pCache, pPath, capacity, capacity * INITIAL_HEAP_PER_PROFILE);
+  }
+  if (INTERVIEW_CACHE_OK != status)
+  {
+    goto fail;
+  }
+  *ppCache = pCache;
+  return INTERVIEW_CACHE_OK;
+
+fail:
+  if (pCache->pMap)
+  {
+    munmap(pCache->pMap, pCache->mapSize);
+  }
+  if (pCache->fd >= 0)
+  {
+    close(pCache->fd);
+  }
+  free(pCache->pVerified);
+  free(pCache->pPath);
+  free(pCache);
+  return status;
+}
+
+E_INTERVIEW_CACHE_STATUS
+InterviewCacheSync(INTERVIEW_CACHE *pCache)
+{
+  if (0 != msync(pCache->pMap, pCache->mapSize, MS_SYNC))
+  {
+    return INTERVIEW_CACHE_IO_ERROR;
+  }
+  return INTERVIEW_CACHE_OK;
+}
+
+E_INTERVIEW_CACHE_STATUS
+InterviewCacheClose(INTERVIEW_CACHE *pCache)
+{
+  E_INTERVIEW_CACHE_STATUS status;
+
+  if (NULL == pCache)
+  {
+    return INTERVIEW_CACHE_OK;
+  }
+  status = InterviewCacheSync(pCache);
+  munmap(pCache->pMap, pCache->mapSize);
+  close(pCache->fd);
+  free(pCache->pVerified);
+  free(pCache->pPath);
+  free(pCache);
+  return status;
+}
+
+E_INTERVIEW_CACHE_STATUS
+InterviewCacheGet(
+  INTERVIEW_CACHE *pCache,
+  uint8_t nodeId,
+  const uint8_t **ppData,
+  uint32_t *pLength,
+  INTERVIEW_IDENTITY *pIdentity)
+{
+  NODE_ENTRY *pNode;
+  int32_t slot;
+
+  if (!NodeValid(nodeId))
+  {
+    return INTERVIEW_CACHE_INVALID;
+  }
+  pNode = &pCache->pNodes[nodeId];
+  if (!pNode->valid)
+  {
+    return INTERVIEW_CACHE_MISS;
+  }
+  slot = ProfileFind(pCache, &pNode->identity);
+  if (slot < 0)
+  {
+    pNode->valid = 0;
+    return INTERVIEW_CACHE_MISS;
+  }
+  if (!ProfileVerify(pCache, (uint32_t)slot))
+  {
+    pNode->valid = 0;
+    return INTERVIEW_CACHE_CORRUPT;
+  }
+  *ppData = pCache->pHeap + pCache->pProfiles[slot].dataOffset;
+  *pLength = pCache->pProfiles[slot].dataLength;
+  if (pIdentity)
+  {
+    *pIdentity = pNode->identity;
+  }
+  return INTERVIEW_CACHE_OK;
+}
+
+E_INTERVIEW_CACHE_STATUS
+InterviewCacheAdopt(
+  INTERVIEW_CACHE *pCache,
+  uint8_t nodeId,
+  const INTERVIEW_IDENTITY *pIdentity,
+  const uint8_t **ppData,
+  uint32_t *pLength)
+{
+  int32_t slot;
+
+  if (!NodeValid(nodeId) || NULL == pIdentity)
+  {
+    return INTERVIEW_CACHE_INVALID;
+  }
+  slot = ProfileFind(pCache, pIdentity);
+  if (slot < 0)
+  {
+    return INTERVIEW_CACHE_MISS;
+  }
+  if (!ProfileVerify(pCache, (uint32_t)slot))
+  {
+    return INTERVIEW_CACHE_CORRUPT;
+  }
+  pCache->pNodes[nodeId].identity = *pIdentity;
+  pCache->pNodes[nodeId].valid = 1;
+  *ppData = pCache->pHeap + pCache->pProfiles[slot].dataOffset;
+  *pLength = pCache->pProfiles[slot].dataLength;
+  return INTERVIEW_CACHE_OK;
+}
+
+E_INTERVIEW_CACHE_STATUS
+InterviewCacheValidate(
+  INTERVIEW_CACHE *pCache,
+  uint8_t nodeId,
+  const INTERVIEW_IDENTITY *pIdentity)
+{
+  NODE_ENTRY *pNode;
+
+  if (!NodeValid(nodeId) || NULL == pIdentity)
+  {
+    return INTERVIEW_CACHE_INVALID;
+  }
+  pNode = &pCache->pNodes[nodeId];
+  if (!pNode->valid)
+  {
+    return INTERVIEW_CACHE_MISS;
+  }
+  if (!SameIdentity(&pNode->identity, pIdentity))
+  {
+    /* The old profile stays, other nodes may still run that firmware */
+    pNode->valid = 0;
+    return INTERVIEW_CACHE_STALE;
+  }
+  return INTERVIEW_CACHE_OK;
+}
+
+E_INTERVIEW_CACHE_STATUS
+InterviewCacheStore(
+  INTERVIEW_CACHE *pCache,
+  uint8_t nodeId,
+  const INTERVIEW_IDENTITY *pIdentity,
+  const uint8_t *pData,
+  uint32_t length)
+{
+  PROFILE_ENTRY *pEntry;
+  int32_t slot;
+  E_INTERVIEW_CACHE_STATUS status;
+
+  if (!NodeValid(nodeId) || NULL == pIdentity || (NULL == pData && length))
+  {
+    return INTERVIEW_CACHE_INVALID;
+  }
+  slot = ProfileFind(pCache, pIdentity);
+  if (slot < 0 || length > pCache->pProfiles[slot].dataLength)
+  {
+    status = Reserve(pCache, slot < 0, length);
+    if (INTERVIEW_CACHE_OK != status)
+    {
+      return status;
+    }
+    slot = ProfileFind(pCache, pIdentity);
+    if (slot < 0)
+    {
+      slot = (int32_t)ProfileInsert(pCache, pIdentity);
+    }
+    pEntry = &pCache->pProfiles[slot];
+    pCache->pHeader->heapGarbage += pEntry->dataLength;
+    pEntry->dataOffset = pCache->pHeader->heapUsed;
+    pCache->pHeader->heapUsed += length;
+  }
+  else
+  {
+    /* Shorter or equal records are rewritten in place */
+    pEntry = &pCache->pProfiles[slot];
+    pCache->pHeader->heapGarbage += pEntry->dataLength - length;
+  }
+  if (length)
+  {
+    memcpy(pCache->pHeap + pEntry->dataOffset, pData, length);
+  }
+  pEntry->dataLength = length;
+  pEntry->crc = ZW_CheckCrc16(CRC_INIT_VALUE, pCache->pHeap + pEntry->dataOffset, length);
+  pCache->pVerified[slot >> 3] |= (uint8_t)(1 << (slot & 7));
+
+  pCache->pNodes[nodeId].identity = *pIdentity;
+  pCache->pNodes[nodeId].valid = 1;
+  return INTERVIEW_CACHE_OK;
+}
+
+void
+InterviewCacheRemoveNode(
+  INTERVIEW_CACHE *pCache,
+  uint8_t nodeId)
+{
+  if (NodeValid(nodeId))
+  {
+    pCache->pNodes[nodeId].valid = 0;
+  }
+}
+
+BOOL
+InterviewRecordAppend(
+  uint8_t *pBuffer,
+  uint32_t capacity,
+  uint32_t *pLength,
+  uint8_t type,
+  uint8_t endpoint,
+  const uint8_t *pData,
+  uint16_t dataLength)
+{
+  uint8_t *p = pBuffer + *pLength;
+
+  if ((uint64_t)*pLength + INTERVIEW_RECORD_HEADER + dataLength > capacity)
+  {
+    return FALSE;
+  }
+  p[0] = type;
+  p[1] = endpoint;
+  memcpy(&p[2], &dataLength, sizeof(dataLength));
+  if (dataLength)
+  {
+    memcpy(&p[INTERVIEW_RECORD_HEADER], pData, dataLength);
+  }
+  *pLength += INTERVIEW_RECORD_HEADER + dataLength;
+  return TRUE;
+}
+
+BOOL
+InterviewRecordFind(
+  const uint8_t *pData,
+  uint32_t length,
+  uint32_t *pOffset,
+  uint8_t type,
+  uint8_t endpoint,
+  const uint8_t **ppRecord,
+  uint16_t *pRecordLength)
+{
+  uint32_t offset = *pOffset;
+
+  while ((uint64_t)offset + INTERVIEW_RECORD_HEADER <= length)
+  {
+    uint16_t recordLength;
+
+    memcpy(&recordLength, &pData[offset + 2], sizeof(recordLength));
+    if ((uint64_t)offset + INTERVIEW_RECORD_HEADER + recordLength > length)
+    {
+      break;
+    }
+    if (type == pData[offset] && endpoint == pData[offset + 1])
+    {
+      *ppRecord = &pData[offset + INTERVIEW_RECORD_HEADER];
+      *pRecordLength = recordLength;
+      *pOffset = offset + INTERVIEW_RECORD_HEADER + recordLength;
+      return TRUE;
+    }
+    offset += INTERVIEW_RECORD_HEADER + recordLength;
+  }
+  *pOffset = length;
+  return FALSE;
+}
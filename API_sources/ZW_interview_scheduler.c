@@ -0,0 +1,489 @@
+/****************************************************************************
+ *
+ * Description: Parallel node interview scheduler.
+ *
+ ****************************************************************************/
+
+/****************************************************************************/
+/*                              INCLUDE FILES                               */
+/****************************************************************************/
+#include <string.h>
+#include <ZW_typedefs.h>
+#include <ZW_classcmd.h>
+#include <ZW_interview_scheduler.h>
+
+/****************************************************************************/
+/*                      PRIVATE TYPES and DEFINITIONS                       */
+/****************************************************************************/
+
+/* End of ready queue, node ID 0 is never interviewed */
+#define NO_NODE                      0
+
+/* Values of INTERVIEW_SCHED_NODE.noMoreInfo */
+#define NO_MORE_INFO_NONE            0
+#define NO_MORE_INFO_SLEEP           1   /* Steps remain for the next wake-up */
+#define NO_MORE_INFO_FINISH          2   /* Last frame of the interview */
+
+typedef enum _E_ISSUE_RESULT_
+{
+  ISSUE_SENT,                  /* Frame handed to the protocol */
+  ISSUE_FINISHED,              /* No step left, the radio is still free */
+  ISSUE_BLOCKED                /* Send function refused the frame */
+} E_ISSUE_RESULT;
+
+/****************************************************************************/
+/*                           PRIVATE FUNCTIONS                              */
+/****************************************************************************/
+
+static void
+ReadyPush(
+  INTERVIEW_SCHED *pSched,
+  uint8_t nodeId,
+  BOOL front)
+{
+  INTERVIEW_SCHED_NODE *pNode = &pSched->nodes[nodeId];
+  uint8_t *pHead = pNode->listening ? &pSched->listeningHead : &pSched->awakeHead;
+  uint8_t *pTail = pNode->listening ? &pSched->listeningTail : &pSched->awakeTail;
+
+  pNode->state = INTERVIEW_NODE_READY;
+  if (pNode->queued)
+  {
+    return;
+  }
+  pNode->queued = TRUE;
+  pNode->next = NO_NODE;
+  if (NO_NODE == *pHead)
+  {
+    *pHead = nodeId;
+    *pTail = nodeId;
+  }
+  else if (front)
+  {
+    pNode->next = *pHead;
+    *pHead = nodeId;
+  }
+  else
+  {
+    pSched->nodes[*pTail].next = nodeId;
+    *pTail = nodeId;
+  }
+}
+
+static uint8_t
+ReadyPop(
+  INTERVIEW_SCHED *pSched,
+  uint8_t *pHead,
+  uint8_t *pTail)
+{
+  uint8_t nodeId = *pHead;
+
+  if (NO_NODE != nodeId)
+  {
+    *pHead = pSched->nodes[nodeId].next;
+    if (NO_NODE == *pHead)
+    {
+      *pTail = NO_NODE;
+    }
+    pSched->nodes[nodeId].queued = FALSE;
+  }
+  return nodeId;
+}
+
+static void
+NodeFinish(
+  INTERVIEW_SCHED *pSched,
+  uint8_t nodeId,
+  BOOL success,
+  uint32_t nowMs)
+{
+  INTERVIEW_SCHED_NODE *pNode = &pSched->nodes[nodeId];
+
+  pNode->state = success ? INTERVIEW_NODE_DONE : INTERVIEW_NODE_FAILED;
+  pNode->doneMs = nowMs;
+  pSched->stats.lastDoneMs = nowMs;
+  if (success)
+  {
+    pSched->stats.nodesDone++;
+  }
+  else
+  {
+    pSched->stats.nodesFailed++;
+  }
+  if (pSched->pDone)
+  {
+    pSched->pDone(pSched->pUser, nodeId, success);
+  }
+}
+
+/* The current step got no acknowledgement or no report */
+static void
+StepFailed(
+  INTERVIEW_SCHED *pSched,
+  uint8_t nodeId,
+  uint32_t nowMs)
+{
+  INTERVIEW_SCHED_NODE *pNode = &pSched->nodes[nodeId];
+
+  pSched->stats.retries++;
+  if (!pNode->listening)
+  {
+    /* Most likely back asleep, repeat the step at the next wake-up. A missed
+     * wake-up costs no airtime, so it never fails the interview */
+    pNode->state = INTERVIEW_NODE_ASLEEP;
+  }
+  else if (++pNode->retries > INTERVIEW_SCHED_MAX_RETRIES)
+  {
+    NodeFinish(pSched, nodeId, FALSE, nowMs);
+  }
+  else
+  {
+    ReadyPush(pSched, nodeId, TRUE);
+  }
+}
+
+/* Send the next step of a node, or WAKE_UP_NO_MORE_INFORMATION once it has none */
+static E_ISSUE_RESULT
+NodeIssue(
+  INTERVIEW_SCHED *pSched,
+  uint8_t nodeId,
+  uint32_t nowMs)
+{
+  INTERVIEW_SCHED_NODE *pNode = &pSched->nodes[nodeId];
+  uint8_t frame[INTERVIEW_SCHED_MAX_FRAME];
+  uint8_t frameLength = 0;
+  BOOL expectReport = TRUE;
+
+  if (!pSched->pStep(pSched->pUser, nodeId, pNode->step, frame, &frameLength, &expectReport))
+  {
+    if (pNode->listening)
+    {
+      NodeFinish(pSched, nodeId, TRUE, nowMs);
+      return ISSUE_FINISHED;
+    }
+    frame[0] = COMMAND_CLASS_WAKE_UP;
+    frame[1] = WAKE_UP_NO_MORE_INFORMATION;
+    frameLength = 2;
+    expectReport = FALSE;
+    pNode->noMoreInfo = NO_MORE_INFO_FINISH;
+  }
+  if (!pSched->pSend(pSched->pUser, nodeId, frame, frameLength))
+  {
+    pNode->noMoreInfo = NO_MORE_INFO_NONE;
+    return ISSUE_BLOCKED;
+  }
+  if (!pNode->started)
+  {
+    if (0 == pSched->stats.frames)
+    {
+      pSched->stats.firstStartMs = nowMs;
+    }
+    pNode->started = TRUE;
+    pNode->startMs = nowMs;
+  }
+  pSched->stats.frames++;
+  pSched->transmitting = nodeId;
+  pNode->expectReport = (uint8_t)expectReport;
+  pNode->lastActivityMs = nowMs;
+  pNode->state = INTERVIEW_NODE_TRANSMITTING;
+  return ISSUE_SENT;
+}
+
+/* Send WAKE_UP_NO_MORE_INFORMATION to an awake node that stopped answering */
+static E_ISSUE_RESULT
+NodeSendToSleep(
+  INTERVIEW_SCHED *pSched,
+  uint8_t nodeId,
+  uint32_t nowMs)
+{
+  INTERVIEW_SCHED_NODE *pNode = &pSched->nodes[nodeId];
+  uint8_t frame[2];
+
+  frame[0] = COMMAND_CLASS_WAKE_UP;
+  frame[1] = WAKE_UP_NO_MORE_INFORMATION;
+  if (!pSched->pSend(pSched->pUser, nodeId, frame, sizeof(frame)))
+  {
+    return ISSUE_BLOCKED;
+  }
+  pSched->stats.frames++;
+  pSched->transmitting = nodeId;
+  pNode->noMoreInfo = NO_MORE_INFO_SLEEP;
+  pNode->expectReport = FALSE;
+  pNode->lastActivityMs = nowMs;
+  pNode->state = INTERVIEW_NODE_TRANSMITTING;
+  return ISSUE_SENT;
+}
+
+/* FALSE while the airtime spent in the current window exceeds the budget */
+static BOOL
+AirtimeAvailable(
+  INTERVIEW_SCHED *pSched,
+  uint32_t nowMs)
+{
+  uint32_t txMs;
+
+  if (0 == pSched->airtimeBudgetMs || NULL == pSched->pTxTime)
+  {
+    return TRUE;
+  }
+  txMs = pSched->pTxTime(pSched->pUser);
+  if ((uint32_t)(nowMs - pSched->windowStartMs) >= pSched->airtimeWindowMs)
+  {
+    pSched->windowStartMs = nowMs;
+    pSched->windowStartTxMs = txMs;
+  }
+  return (uint32_t)(txMs - pSched->windowStartTxMs) < pSched->airtimeBudgetMs;
+}
+
+/****************************************************************************/
+/*                           EXPORTED FUNCTIONS                             */
+/****************************************************************************/
+
+void
+InterviewSchedInit(
+  INTERVIEW_SCHED *pSched,
+  uint8_t maxOutstanding,
+  uint32_t airtimeBudgetMs,
+  uint32_t airtimeWindowMs,
+  INTERVIEW_STEP_FUNC pStep,
+  INTERVIEW_SEND_FUNC pSend,
+  INTERVIEW_TX_TIME_FUNC pTxTime,
+  INTERVIEW_DONE_FUNC pDone,
+  void *pUser)
+{
+  memset(pSched, 0, sizeof(*pSched));
+  pSched->pStep = pStep;
+  pSched->pSend = pSend;
+  pSched->pTxTime = pTxTime;
+  pSched->pDone = pDone;
+  pSched->pUser = pUser;
+  pSched->maxOutstanding = maxOutstanding ? maxOutstanding : 1;
+  pSched->airtimeBudgetMs = airtimeBudgetMs;
+  pSched->airtimeWindowMs = airtimeWindowMs;
+  if (pTxTime)
+  {
+    pSched->windowStartTxMs = pTxTime(pUser);
+  }
+}
+
+BOOL
+InterviewSchedAdd(
+  INTERVIEW_SCHED *pSched,
+  uint8_t nodeId,
+  BOOL listening)
+{
+  INTERVIEW_SCHED_NODE *pNode;
+
+  if (0 == nodeId || nodeId > INTERVIEW_SCHED_MAX_NODES)
+  {
+    return FALSE;
+  }
+  pNode = &pSched->nodes[nodeId];
+  if (INTERVIEW_NODE_IDLE != pNode->state && INTERVIEW_NODE_DONE != pNode->state
+      && INTERVIEW_NODE_FAILED != pNode->state)
+  {
+    return FALSE;
+  }
+  memset(pNode, 0, sizeof(*pNode));
+  pNode->listening = listening ? TRUE : FALSE;
+  if (listening)
+  {
+    ReadyPush(pSched, nodeId, FALSE);
+  }
+  else
+  {
+    pNode->state = INTERVIEW_NODE_ASLEEP;
+  }
+  return TRUE;
+}
+
+BOOL
+InterviewSchedWakeUp(
+  INTERVIEW_SCHED *pSched,
+  uint8_t nodeId,
+  uint32_t nowMs)
+{
+  INTERVIEW_SCHED_NODE *pNode;
+
+  if (0 == nodeId || nodeId > INTERVIEW_SCHED_MAX_NODES)
+  {
+    return FALSE;
+  }
+  pNode = &pSched->nodes[nodeId];
+  switch (pNode->state)
+  {
+    case INTERVIEW_NODE_ASLEEP:
+      pNode->lastActivityMs = nowMs;
+      ReadyPush(pSched, nodeId, FALSE);
+      return TRUE;
+
+    case INTERVIEW_NODE_READY:
+    case INTERVIEW_NODE_TRANSMITTING:
+    case INTERVIEW_NODE_WAITING:
+      return TRUE;
+
+    default:
+      return FALSE;
+  }
+}
+
+void
+InterviewSchedTxDone(
+  INTERVIEW_SCHED *pSched,
+  uint8_t nodeId,
+  BOOL acked,
+  uint32_t nowMs)
+{
+  INTERVIEW_SCHED_NODE *pNode;
+
+  if (0 == nodeId || nodeId != pSched->transmitting)
+  {
+    return;
+  }
+  pSched->transmitting = NO_NODE;
+  pNode = &pSched->nodes[nodeId];
+  pNode->lastActivityMs = nowMs;
+  if (NO_MORE_INFO_NONE != pNode->noMoreInfo)
+  {
+    /* The node goes to sleep whether it heard the frame or not */
+    if (NO_MORE_INFO_FINISH == pNode->noMoreInfo)
+    {
+      NodeFinish(pSched, nodeId, TRUE, nowMs);
+    }
+    else
+    {
+      pNode->state = INTERVIEW_NODE_ASLEEP;
+    }
+    pNode->noMoreInfo = NO_MORE_INFO_NONE;
+  }
+  else if (!acked)
+  {
+    StepFailed(pSched, nodeId, nowMs);
+  }
+  else if (pNode->expectReport)
+  {
+    pNode->state = INTERVIEW_NODE_WAITING;
+    pSched->outstanding++;
+  }
+  else
+  {
+    pNode->step++;
+    pNode->retries = 0;
+    ReadyPush(pSched, nodeId, FALSE);
+  }
+}
+
+BOOL
+InterviewSchedReport(
+  INTERVIEW_SCHED *pSched,
+  uint8_t nodeId,
+  uint32_t nowMs)
+{
+  INTERVIEW_SCHED_NODE *pNode;
+
+  if (0 == nodeId || nodeId > INTERVIEW_SCHED_MAX_NODES)
+  {
+    return FALSE;
+  }
+  pNode = &pSched->nodes[nodeId];
+  if (INTERVIEW_NODE_WAITING != pNode->state)
+  {
+    return FALSE;
+  }
+  pSched->outstanding--;
+  pNode->step++;
+  pNode->retries = 0;
+  pNode->lastActivityMs = nowMs;
+  ReadyPush(pSched, nodeId, FALSE);
+  return TRUE;
+}
+
+void
+InterviewSchedPoll(
+  INTERVIEW_SCHED *pSched,
+  uint32_t nowMs)
+{
+  uint16_t nodeId;
+
+  if (pSched->outstanding)
+  {
+    for (nodeId = 1; nodeId <= INTERVIEW_SCHED_MAX_NODES; nodeId++)
+    {
+      INTERVIEW_SCHED_NODE *pNode = &pSched->nodes[nodeId];
+
+      if (INTERVIEW_NODE_WAITING != pNode->state
+          || (uint32_t)(nowMs - pNode->lastActivityMs) < INTERVIEW_SCHED_TIMEOUT_MS)
+      {
+        continue;
+      }
+      pSched->outstanding--;
+      StepFailed(pSched, (uint8_t)nodeId, nowMs);
+      if (INTERVIEW_NODE_ASLEEP == pNode->state)
+      {
+        /* Let it sleep now instead of waiting for its own timeout */
+        pNode->noMoreInfo = NO_MORE_INFO_SLEEP;
+        ReadyPush(pSched, (uint8_t)nodeId, TRUE);
+      }
+    }
+  }
+  if (NO_NODE != pSched->transmitting)
+  {
+    return;
+  }
+  if (!AirtimeAvailable(pSched, nowMs))
+  {
+    pSched->stats.budgetStalls++;
+    return;
+  }
+  for (;;)
+  {
+    uint8_t *pHead = &pSched->awakeHead;
+    uint8_t *pTail = &pSched->awakeTail;
+    E_ISSUE_RESULT result;
+    uint8_t next;
+
+    if (NO_NODE == *pHead)
+    {
+      pHead = &pSched->listeningHead;
+      pTail = &pSched->listeningTail;
+    }
+    if (NO_NODE == *pHead || pSched->outstanding >= pSched->maxOutstanding)
+    {
+      break;
+    }
+    next = ReadyPop(pSched, pHead, pTail);
+    if (NO_MORE_INFO_SLEEP == pSched->nodes[next].noMoreInfo)
+    {
+      result = NodeSendToSleep(pSched, next, nowMs);
+    }
+    else
+    {
+      result = NodeIssue(pSched, next, nowMs);
+    }
+    if (ISSUE_BLOCKED == result)
+    {
+      ReadyPush(pSched, next, TRUE);
+      break;
+    }
+    if (ISSUE_SENT == result)
+    {
+      break;
+    }
+  }
+}
+
+BOOL
+InterviewSchedBusy(
+  const INTERVIEW_SCHED *pSched)
+{
+  uint16_t nodeId;
+
+  for (nodeId = 1; nodeId <= INTERVIEW_SCHED_MAX_NODES; nodeId++)
+  {
+    uint8_t state = pSched->nodes[nodeId].state;
+    if (INTERVIEW_NODE_IDLE != state && INTERVIEW_NODE_DONE != state && INTERVIEW_NODE_FAILED != state)
+    {
+      return TRUE;
+    }
+  }
+  return FALSE;
+}
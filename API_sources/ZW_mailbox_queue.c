@@ -0,0 +1,843 @@
+/****************************************************************************
+ *
+ * Description: Disk backed Mailbox queues for sleeping nodes.
+ *
+ ****************************************************************************/
+
+/****************************************************************************/
+/*                              INCLUDE FILES                               */
+/****************************************************************************/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <pthread.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <ZW_typedefs.h>
+#include <ZW_crc.h>
+#include <ZW_mailbox_queue.h>
+
+/****************************************************************************/
+/*                      PRIVATE TYPES and DEFINITIONS                       */
+/****************************************************************************/
+
+#define FILE_MAGIC            0x424D575AUL   /* "ZWMB" */
+#define FILE_VERSION          1
+#define RECORD_MAGIC          0x31434552UL   /* "REC1" */
+
+#define RECORD_QUEUED         0
+#define RECORD_DELIVERED      1
+
+/* Offset marking the end of a node's list. Offset 0 is the file header */
+#define NO_RECORD             0
+
+#define COMPACT_SUFFIX        ".compact"
+
+/*
+ * File layout, all in host byte order:
+ *   FILE_HEADER
+ *   records, each RECORD_HEADER + frame, padded to 8 bytes
+ * The file is extended in MAILBOX_QUEUE_GROW_BYTES steps; the zeros after the
+ * last record end the scan on open.
+ */
+typedef struct _FILE_HEADER_
+{
+  uint32_t magic;
+  uint32_t version;
+  uint64_t reserved;
+} FILE_HEADER;
+
+typedef struct _RECORD_HEADER_
+{
+  uint32_t magic;
+  uint32_t sequence;        /* Increases with every record appended */
+  uint32_t next;            /* Next record of the node, rebuilt on open */
+  uint32_t timestamp;
+  uint8_t  nodeId;
+  uint8_t  state;           /* RECORD_QUEUED or RECORD_DELIVERED, updated in place */
+  uint8_t  length;
+  uint8_t  reserved;
+  uint16_t crc;             /* ZW_CheckCrc16 of sequence, timestamp, nodeId, length and frame */
+  uint16_t reserved2;
+} RECORD_HEADER;
+
+typedef struct _NODE_QUEUE_
+{
+  uint32_t head;            /* Offset of the oldest queued record */
+  uint32_t tail;
+  uint32_t count;
+} NODE_QUEUE;
+
+/* Log file being written */
+typedef struct _LOG_
+{
+  int fd;
+  uint8_t *pMap;            /* maxLogBytes reserved, fileSize backed by the file */
+  uint64_t fileSize;
+  uint64_t used;
+} LOG;
+
+struct _MAILBOX_QUEUE_
+{
+  pthread_mutex_t lock;
+  pthread_cond_t wake;      /* Signals the compactor */
+  pthread_t compactor;
+  BOOL compactorRunning;
+  BOOL stop;
+  BOOL compacting;
+  char *pPath;
+  uint64_t maxLogBytes;
+  LOG log;
+  uint32_t nextSequence;
+  MAILBOX_QUEUE_STATS stats;
+  NODE_QUEUE nodes[MAILBOX_QUEUE_MAX_NODES + 1];
+};
+
+/****************************************************************************/
+/*                           PRIVATE FUNCTIONS                              */
+/****************************************************************************/
+
+static uint32_t
+RecordSize(uint8_t length)
+{
+  return (uint32_t)((sizeof(RECORD_HEADER) + length + 7) & ~7UL);
+}
+
+static RECORD_HEADER *
+Record(
+  const LOG *pLog,
+  uint32_t offset)
+{
+  return (RECORD_HEADER *)(pLog->pMap + offset);
+}
+
+static uint16_t
+RecordCrc(const RECORD_HEADER *pRecord)
+{
+  uint8_t fields[10];
+  uint16_t crc;
+
+  memcpy(&fields[0], &pRecord->sequence, 4);
+  memcpy(&fields[4], &pRecord->timestamp, 4);
+  fields[8] = pRecord->nodeId;
+  fields[9] = pRecord->length;
+  crc = ZW_CheckCrc16(CRC_INIT_VALUE, fields, sizeof(fields));
+  return ZW_CheckCrc16(crc, (const uint8_t *)(pRecord + 1), pRecord->length);
+}
+
+static BOOL
+NodeValid(uint8_t nodeId)
+{
+  return 0 != nodeId && nodeId <= MAILBOX_QUEUE_MAX_NODES;
+}
+
+static void
+LogUnmap(
+  LOG *pLog,
+  uint64_t maxLogBytes)
+{
+  if (pLog->pMap)
+  {
+    munmap(pLog->pMap, (size_t)maxLogBytes);
+    pLog->pMap = NULL;
+  }
+  if (pLog->fd >= 0)
+  {
+    close(pLog->fd);
+    pLog->fd = -1;
+  }
+}
+
+/* Reserve the whole address range once, so record pointers stay valid when
+ * the file grows */
+static E_MAILBOX_QUEUE_STATUS
+LogMap(
+  LOG *pLog,
+  uint64_t maxLogBytes)
+{
+  void *pMap = mmap(NULL, (size_t)maxLogBytes, PROT_READ | PROT_WRITE, MAP_SHARED, pLog->fd, 0);
+
+  if (MAP_FAILED == pMap)
+  {
+    return MAILBOX_QUEUE_IO_ERROR;
+  }
+  pLog->pMap = pMap;
+  return MAILBOX_QUEUE_OK;
+}
+
+/* Make room for \a size more bytes */
+static E_MAILBOX_QUEUE_STATUS
+LogReserve(
+  LOG *pLog,
+  uint64_t maxLogBytes,
+  uint32_t size)
+{
+  uint64_t fileSize = pLog->fileSize;
+
+  if (pLog->used + size <= fileSize)
+  {
+    return MAILBOX_QUEUE_OK;
+  }
+  if (pLog->used + size > maxLogBytes)
+  {
+    return MAILBOX_QUEUE_FULL;
+  }
+  while (pLog->used + size > fileSize)
+  {
+    fileSize += MAILBOX_QUEUE_GROW_BYTES;
+  }
+  if (fileSize > maxLogBytes)
+  {
+    fileSize = maxLogBytes;
+  }
+  if (0 != ftruncate(pLog->fd, (off_t)fileSize))
+  {
+    return MAILBOX_QUEUE_IO_ERROR;
+  }
+  pLog->fileSize = fileSize;
+  return MAILBOX_QUEUE_OK;
+}
+
+/* Create an empty log file */
+static E_MAILBOX_QUEUE_STATUS
+LogCreate(
+  LOG *pLog,
+  const char *pPath,
+  uint64_t maxLogBytes)
+{
+  FILE_HEADER *pHeader;
+  E_MAILBOX_QUEUE_STATUS status;
+
+  pLog->fd = open(pPath, O_RDWR | O_CREAT | O_TRUNC, 0644);
+  pLog->fileSize = 0;
+  pLog->used = 0;
+  if (pLog->fd < 0)
+  {
+    return MAILBOX_QUEUE_IO_ERROR;
+  }
+  status = LogMap(pLog, maxLogBytes);
+  if (MAILBOX_QUEUE_OK == status)
+  {
+    status = LogReserve(pLog, maxLogBytes, sizeof(FILE_HEADER));
+  }
+  if (MAILBOX_QUEUE_OK != status)
+  {
+    return status;
+  }
+  pHeader = (FILE_HEADER *)pLog->pMap;
+  pHeader->magic = FILE_MAGIC;
+  pHeader->version = FILE_VERSION;
+  pLog->used = sizeof(FILE_HEADER);
+  return MAILBOX_QUEUE_OK;
+}
+
+/* Append a record and link it to the tail of its node */
+static E_MAILBOX_QUEUE_STATUS
+LogAppend(
+  LOG *pLog,
+  uint64_t maxLogBytes,
+  NODE_QUEUE *pNode,
+  uint32_t sequence,
+  uint32_t timestamp,
+  uint8_t nodeId,
+  const uint8_t *pFrame,
+  uint8_t length)
+{
+  uint32_t size = RecordSize(length);
+  uint32_t offset = (uint32_t)pLog->used;
+  RECORD_HEADER *pRecord;
+  E_MAILBOX_QUEUE_STATUS status = LogReserve(pLog, maxLogBytes, size);
+
+  if (MAILBOX_QUEUE_OK != status)
+  {
+    return status;
+  }
+  pRecord = Record(pLog, offset);
+  memset(pRecord, 0, size);
+  memcpy(pRecord + 1, pFrame, length);
+  pRecord->sequence = sequence;
+  pRecord->next = NO_RECORD;
+  pRecord->timestamp = timestamp;
+  pRecord->nodeId = nodeId;
+  pRecord->state = RECORD_QUEUED;
+  pRecord->length = length;
+  pRecord->crc = RecordCrc(pRecord);
+  pRecord->magic = RECORD_MAGIC;
+
+  if (NO_RECORD == pNode->tail)
+  {
+    pNode->head = offset;
+  }
+  else
+  {
+    Record(pLog, pNode->tail)->next = offset;
+  }
+  pNode->tail = offset;
+  pNode->count++;
+  pLog->used += size;
+  return MAILBOX_QUEUE_OK;
+}
+
+/* Scan the log, drop a torn record at the end and rebuild the node lists */
+static void
+LogScan(MAILBOX_QUEUE *pQueue)
+{
+  LOG *pLog = &pQueue->log;
+  uint64_t offset = sizeof(FILE_HEADER);
+
+  while (offset + sizeof(RECORD_HEADER) <= pLog->fileSize)
+  {
+    RECORD_HEADER *pRecord = Record(pLog, (uint32_t)offset);
+    uint32_t size = RecordSize(pRecord->length);
+
+    if (RECORD_MAGIC != pRecord->magic || !NodeValid(pRecord->nodeId) || 0 == pRecord->length
+        || offset + size > pLog->fileSize || pRecord->crc != RecordCrc(pRecord))
+    {
+      break;
+    }
+    if ((uint32_t)(pRecord->sequence + 1 - pQueue->nextSequence) < 0x80000000UL)
+    {
+      pQueue->nextSequence = pRecord->sequence + 1;
+    }
+    pRecord->next = NO_RECORD;
+    if (RECORD_QUEUED == pRecord->state)
+    {
+      NODE_QUEUE *pNode = &pQueue->nodes[pRecord->nodeId];
+
+      if (NO_RECORD == pNode->tail)
+      {
+        pNode->head = (uint32_t)offset;
+      }
+      else
+      {
+        Record(pLog, pNode->tail)->next = (uint32_t)offset;
+      }
+      pNode->tail = (uint32_t)offset;
+      pNode->count++;
+      pQueue->stats.queuedFrames++;
+      pQueue->stats.queuedBytes += size;
+    }
+    else
+    {
+      pQueue->stats.garbageBytes += size;
+    }
+    offset += size;
+  }
+  /* Clear what is left of a torn record so it cannot reappear behind a new one */
+  memset(pLog->pMap + offset, 0, (size_t)(pLog->fileSize - offset));
+  pLog->used = offset;
+}
+
+static BOOL
+NeedsCompaction(const MAILBOX_QUEUE *pQueue)
+{
+  return pQueue->stats.garbageBytes >= MAILBOX_QUEUE_COMPACT_MIN_BYTES
+         && pQueue->stats.garbageBytes > pQueue->stats.queuedBytes;
+}
+
+/* Remove the head record of a node. Called with the lock held */
+static void
+PopLocked(
+  MAILBOX_QUEUE *pQueue,
+  NODE_QUEUE *pNode)
+{
+  RECORD_HEADER *pRecord = Record(&pQueue->log, pNode->head);
+  uint32_t size = RecordSize(pRecord->length);
+
+  pRecord->state = RECORD_DELIVERED;
+  pNode->head = pRecord->next;
+  if (NO_RECORD == pNode->head)
+  {
+    pNode->tail = NO_RECORD;
+  }
+  pNode->count--;
+  pQueue->stats.queuedFrames--;
+  pQueue->stats.queuedBytes -= size;
+  pQueue->stats.garbageBytes += size;
+  if (pQueue->compactorRunning && NeedsCompaction(pQueue))
+  {
+    pthread_cond_signal(&pQueue->wake);
+  }
+}
+
+static void *
+CompactorThread(void *pArg)
+{
+  MAILBOX_QUEUE *pQueue = (MAILBOX_QUEUE *)pArg;
+
+  pthread_mutex_lock(&pQueue->lock);
+  while (!pQueue->stop)
+  {
+    BOOL compacted = FALSE;
+
+    if (NeedsCompaction(pQueue))
+    {
+      pthread_mutex_unlock(&pQueue->lock);
+      compacted = (MAILBOX_QUEUE_OK == MailboxQueueCompact(pQueue));
+      pthread_mutex_lock(&pQueue->lock);
+    }
+    /* After a failed or concurrent compaction, wait for the next pop to retry */
+    if (!compacted && !pQueue->stop)
+    {
+      pthread_cond_wait(&pQueue->wake, &pQueue->lock);
+    }
+  }
+  pthread_mutex_unlock(&pQueue->lock);
+  return NULL;
+}
+
+/****************************************************************************/
+/*                           EXPORTED FUNCTIONS                             */
+/****************************************************************************/
+
+E_MAILBOX_QUEUE_STATUS
+MailboxQueueOpen(
+  const char *pPath,
+  uint64_t maxLogBytes,
+  MAILBOX_QUEUE **ppQueue)
+{
+  MAILBOX_QUEUE *pQueue;
+  FILE_HEADER header;
+  struct stat st;
+  E_MAILBOX_QUEUE_STATUS status = MAILBOX_QUEUE_IO_ERROR;
+
+  /* Record offsets are 32 bit */
+  if (maxLogBytes < MAILBOX_QUEUE_GROW_BYTES || maxLogBytes > 0xFFFFFFFFUL)
+  {
+    return MAILBOX_QUEUE_INVALID;
+  }
+  pQueue = calloc(1, sizeof(MAILBOX_QUEUE));
+  if (NULL == pQueue)
+  {
+    return MAILBOX_QUEUE_NO_MEMORY;
+  }
+  pQueue->pPath = strdup(pPath);
+  pQueue->maxLogBytes = maxLogBytes;
+  pQueue->log.fd = -1;
+  if (NULL == pQueue->pPath)
+  {
+    status = MAILBOX_QUEUE_NO_MEMORY;
+    goto fail;
+  }
+  pQueue->log.fd = open(pPath, O_RDWR | O_CREAT, 0644);
+  if (pQueue->log.fd < 0 || 0 != fstat(pQueue->log.fd, &st))
+  {
+    goto fail;
+  }
+  if ((uint64_t)st.st_size >= sizeof(header)
+      && pread(pQueue->log.fd, &header, sizeof(header), 0) == (ssize_t)sizeof(header)
+      && FILE_MAGIC == header.magic && FILE_VERSION == header.version)
+  {
+    if ((uint64_t)st.st_size > maxLogBytes)
+    {
+      /* Queued frames may lie beyond the limit, leave the file as it is */
+      status = MAILBOX_QUEUE_FULL;
+      goto fail;
+    }
+    pQueue->log.fileSize = (uint64_t)st.st_size;
+    status = LogMap(&pQueue->log, maxLogBytes);
+    if (MAILBOX_QUEUE_OK == status)
+    {
+      LogScan(pQueue);
+    }
+  }
+  else
+  {
+    /* New file, other format version or damaged header: start over */
+    close(pQueue->log.fd);
+    status = LogCreate(&pQueue->log, pPath, maxLogBytes);
+  }
+  if (MAILBOX_QUEUE_OK != status)
+  {
+    goto fail;
+  }
+  pthread_mutex_init(&pQueue->lock, NULL);
+  pthread_cond_init(&pQueue->wake, NULL);
+  *ppQueue = pQueue;
+  return MAILBOX_QUEUE_OK;
+
+fail:
+  LogUnmap(&pQueue->log, maxLogBytes);
+  free(pQueue->pPath);
+  free(pQueue);
+  return status;
+}
+
+E_MAILBOX_QUEUE_STATUS
+MailboxQueueSync(MAILBOX_QUEUE *pQueue)
+{
+  E_MAILBOX_QUEUE_STATUS status = MAILBOX_QUEUE_OK;
+
+  pthread_mutex_lock(&pQueue->lock);
+  if (0 != msync(pQueue->log.pMap, (size_t)pQueue->log.fileSize, MS_SYNC))
+  {
+    status = MAILBOX_QUEUE_IO_ERROR;
+  }
+  pthread_mutex_unlock(&pQueue->lock);
+  return status;
+}
+
+E_MAILBOX_QUEUE_STATUS
+MailboxQueueClose(MAILBOX_QUEUE *pQueue)
+{
+  E_MAILBOX_QUEUE_STATUS status;
+
+  if (NULL == pQueue)
+  {
+    return MAILBOX_QUEUE_OK;
+  }
+  if (pQueue->compactorRunning)
+  {
+    pthread_mutex_lock(&pQueue->lock);
+    pQueue->stop = TRUE;
+    pthread_cond_signal(&pQueue->wake);
+    pthread_mutex_unlock(&pQueue->lock);
+    pthread_join(pQueue->compactor, NULL);
+  }
+  status = MailboxQueueSync(pQueue);
+  LogUnmap(&pQueue->log, pQueue->maxLogBytes);
+  pthread_cond_destroy(&pQueue->wake);
+  pthread_mutex_destroy(&pQueue->lock);
+  free(pQueue->pPath);
+  free(pQueue);
+  return status;
+}
+
+E_MAILBOX_QUEUE_STATUS
+MailboxQueuePush(
+  MAILBOX_QUEUE *pQueue,
+  uint8_t nodeId,
+  const uint8_t *pFrame,
+  uint8_t length,
+  uint32_t timestamp)
+{
+  E_MAILBOX_QUEUE_STATUS status;
+
+  if (!NodeValid(nodeId) || 0 == length)
+  {
+    return MAILBOX_QUEUE_INVALID;
+  }
+  pthread_mutex_lock(&pQueue->lock);
+  status = LogAppend(&pQueue->log, pQueue->maxLogBytes, &pQueue->nodes[nodeId], pQueue->nextSequence, timestamp,
+                     nodeId, pFrame, length);
+  if (MAILBOX_QUEUE_OK == status)
+  {
+    pQueue->nextSequence++;
+    pQueue->stats.queuedFrames++;
+    pQueue->stats.queuedBytes += RecordSize(length);
+  }
+  pthread_mutex_unlock(&pQueue->lock);
+  return status;
+}
+
+E_MAILBOX_QUEUE_STATUS
+MailboxQueueFront(
+  MAILBOX_QUEUE *pQueue,
+  uint8_t nodeId,
+  uint8_t *pFrame,
+  uint8_t *pLength,
+  uint32_t *pTimestamp)
+{
+  const RECORD_HEADER *pRecord;
+
+  if (!NodeValid(nodeId))
+  {
+    return MAILBOX_QUEUE_INVALID;
+  }
+  pthread_mutex_lock(&pQueue->lock);
+  if (NO_RECORD == pQueue->nodes[nodeId].head)
+  {
+    pthread_mutex_unlock(&pQueue->lock);
+    return MAILBOX_QUEUE_EMPTY;
+  }
+  /* Copied, the record moves when the log is compacted */
+  pRecord = Record(&pQueue->log, pQueue->nodes[nodeId].head);
+  memcpy(pFrame, pRecord + 1, pRecord->length);
+  *pLength = pRecord->length;
+  if (pTimestamp)
+  {
+    *pTimestamp = pRecord->timestamp;
+  }
+  pthread_mutex_unlock(&pQueue->lock);
+  return MAILBOX_QUEUE_OK;
+}
+
+E_MAILBOX_QUEUE_STATUS
+MailboxQueuePop(
+  MAILBOX_QUEUE *pQueue,
+  uint8_t nodeId)
+{
+  E_MAILBOX_QUEUE_STATUS status = MAILBOX_QUEUE_EMPTY;
+
+  if (!NodeValid(nodeId))
+  {
+    return MAILBOX_QUEUE_INVALID;
+  }
+  pthread_mutex_lock(&pQueue->lock);
+  if (NO_RECORD != pQueue->nodes[nodeId].head)
+  {
+    PopLocked(pQueue, &pQueue->nodes[nodeId]);
+    status = MAILBOX_QUEUE_OK;
+  }
+  pthread_mutex_unlock(&pQueue->lock);
+  return status;
+}
+
+uint16_t
+MailboxQueueWakeUp(
+  MAILBOX_QUEUE *pQueue,
+  uint8_t nodeId,
+  uint16_t maxFrames,
+  MAILBOX_QUEUE_SEND_FUNC pSend,
+  void *pUser)
+{
+  uint8_t frame[MAILBOX_QUEUE_MAX_FRAME];
+  uint16_t delivered = 0;
+
+  if (!NodeValid(nodeId))
+  {
+    return 0;
+  }
+  while (delivered < maxFrames)
+  {
+    NODE_QUEUE *pNode = &pQueue->nodes[nodeId];
+    const RECORD_HEADER *pRecord;
+    uint32_t sequence;
+    uint8_t length;
+
+    pthread_mutex_lock(&pQueue->lock);
+    if (NO_RECORD == pNode->head)
+    {
+      pthread_mutex_unlock(&pQueue->lock);
+      break;
+    }
+    pRecord = Record(&pQueue->log, pNode->head);
+    sequence = pRecord->sequence;
+    length = pRecord->length;
+    memcpy(frame, pRecord + 1, length);
+    pthread_mutex_unlock(&pQueue->lock);
+
+    if (!pSend(pUser, nodeId, frame, length))
+    {
+      break;
+    }
+
+    /* The head may have been popped or dropped while sending */
+    pthread_mutex_lock(&pQueue->lock);
+    if (NO_RECORD != pNode->head && Record(&pQueue->log, pNode->head)->sequence == sequence)
+    {
+      PopLocked(pQueue, pNode);
+    }
+    pthread_mutex_unlock(&pQueue->lock);
+    delivered++;
+  }
+  return delivered;
+}
+
+void
+MailboxQueueDropNode(
+  MAILBOX_QUEUE *pQueue,
+  uint8_t nodeId)
+{
+  if (!NodeValid(nodeId))
+  {
+    return;
+  }
+  pthread_mutex_lock(&pQueue->lock);
+  while (NO_RECORD != pQueue->nodes[nodeId].head)
+  {
+    PopLocked(pQueue, &pQueue->nodes[nodeId]);
+  }
+  pthread_mutex_unlock(&pQueue->lock);
+}
+
+uint32_t
+MailboxQueueCount(
+  MAILBOX_QUEUE *pQueue,
+  uint8_t nodeId)
+{
+  uint32_t count;
+
+  if (!NodeValid(nodeId))
+  {
+    return 0;
+  }
+  pthread_mutex_lock(&pQueue->lock);
+  count = pQueue->nodes[nodeId].count;
+  pthread_mutex_unlock(&pQueue->lock);
+  return count;
+}
+
+E_MAILBOX_QUEUE_STATUS
+MailboxQueueCompact(MAILBOX_QUEUE *pQueue)
+{
+  NODE_QUEUE nodes[MAILBOX_QUEUE_MAX_NODES + 1];
+  LOG newLog;
+  LOG oldLog;
+  char *pNewPath;
+  uint64_t cursor = sizeof(FILE_HEADER);
+  uint64_t garbage = 0;
+  E_MAILBOX_QUEUE_STATUS status;
+  BOOL synced = FALSE;
+  uint16_t i;
+
+  pthread_mutex_lock(&pQueue->lock);
+  if (pQueue->compacting)
+  {
+    pthread_mutex_unlock(&pQueue->lock);
+    return MAILBOX_QUEUE_BUSY;
+  }
+  pQueue->compacting = TRUE;
+  pthread_mutex_unlock(&pQueue->lock);
+
+  memset(nodes, 0, sizeof(nodes));
+  memset(&newLog, 0, sizeof(newLog));
+  newLog.fd = -1;
+  pNewPath = malloc(strlen(pQueue->pPath) + sizeof(COMPACT_SUFFIX));
+  if (NULL == pNewPath)
+  {
+    status = MAILBOX_QUEUE_NO_MEMORY;
+    goto done;
+  }
+  sprintf(pNewPath, "%s%s", pQueue->pPath, COMPACT_SUFFIX);
+  status = LogCreate(&newLog, pNewPath, pQueue->maxLogBytes);
+  if (MAILBOX_QUEUE_OK != status)
+  {
+    goto done;
+  }
+
+  /* Copy the queued records a chunk at a time. Records popped meanwhile are
+   * a prefix of their node's list and are skipped below */
+  for (;;)
+  {
+    uint16_t copied = 0;             /* Records visited under this lock hold */
+    BOOL caughtUp;
+
+    pthread_mutex_lock(&pQueue->lock);
+    while (cursor < pQueue->log.used && copied < MAILBOX_QUEUE_COMPACT_CHUNK && MAILBOX_QUEUE_OK == status)
+    {
+      const RECORD_HEADER *pRecord = Record(&pQueue->log, (uint32_t)cursor);
+
+      if (RECORD_QUEUED == pRecord->state)
+      {
+        status = LogAppend(&newLog, pQueue->maxLogBytes, &nodes[pRecord->nodeId], pRecord->sequence,
+                           pRecord->timestamp, pRecord->nodeId, (const uint8_t *)(pRecord + 1), pRecord->length);
+      }
+      cursor += RecordSize(pRecord->length);
+      copied++;
+    }
+    caughtUp = (cursor >= pQueue->log.used);
+    if (MAILBOX_QUEUE_OK != status || (caughtUp && synced))
+    {
+      /* Done copying, the lock is kept for the switch */
+      break;
+    }
+    pthread_mutex_unlock(&pQueue->lock);
+    if (caughtUp)
+    {
+      /* Write the copy to disk outside the lock, the sync before the switch
+       * then only has the records pushed meanwhile */
+      if (0 != msync(newLog.pMap, (size_t)newLog.fileSize, MS_SYNC))
+      {
+        status = MAILBOX_QUEUE_IO_ERROR;
+        goto done;
+      }
+      synced = TRUE;
+    }
+  }
+  if (MAILBOX_QUEUE_OK != status)
+  {
+    pthread_mutex_unlock(&pQueue->lock);
+    goto done;
+  }
+
+  for (i = 1; i <= MAILBOX_QUEUE_MAX_NODES; i++)
+  {
+    NODE_QUEUE *pNode = &nodes[i];
+    const NODE_QUEUE *pOld = &pQueue->nodes[i];
+    uint32_t headSequence = 0;
+
+    if (NO_RECORD != pOld->head)
+    {
+      headSequence = Record(&pQueue->log, pOld->head)->sequence;
+    }
+    while (NO_RECORD != pNode->head
+           && (NO_RECORD == pOld->head || Record(&newLog, pNode->head)->sequence != headSequence))
+    {
+      RECORD_HEADER *pRecord = Record(&newLog, pNode->head);
+
+      pRecord->state = RECORD_DELIVERED;
+      garbage += RecordSize(pRecord->length);
+      pNode->head = pRecord->next;
+      pNode->count--;
+    }
+    if (NO_RECORD == pNode->head)
+    {
+      pNode->tail = NO_RECORD;
+    }
+  }
+  /* The new log must be on disk before it replaces the old one */
+  if (0 != msync(newLog.pMap, (size_t)newLog.fileSize, MS_SYNC)
+      || 0 != rename(pNewPath, pQueue->pPath))
+  {
+    pthread_mutex_unlock(&pQueue->lock);
+    status = MAILBOX_QUEUE_IO_ERROR;
+    goto done;
+  }
+  oldLog = pQueue->log;
+  pQueue->log = newLog;
+  newLog.fd = -1;
+  newLog.pMap = NULL;
+  memcpy(pQueue->nodes, nodes, sizeof(nodes));
+  pQueue->stats.garbageBytes = garbage;
+  pQueue->stats.compactions++;
+  pthread_mutex_unlock(&pQueue->lock);
+  /* Unmapping writes back dirty pages, keep it out of the lock */
+  LogUnmap(&oldLog, pQueue->maxLogBytes);
+
+done:
+  if (newLog.fd >= 0)
+  {
+    LogUnmap(&newLog, pQueue->maxLogBytes);
+    unlink(pNewPath);
+  }
+  free(pNewPath);
+  pthread_mutex_lock(&pQueue->lock);
+  pQueue->compacting = FALSE;
+  pthread_mutex_unlock(&pQueue->lock);
+  return status;
+}
+
+E_MAILBOX_QUEUE_STATUS
+MailboxQueueStartCompactor(MAILBOX_QUEUE *pQueue)
+{
+  E_MAILBOX_QUEUE_STATUS status = MAILBOX_QUEUE_OK;
+
+  pthread_mutex_lock(&pQueue->lock);
+  if (!pQueue->compactorRunning)
+  {
+    if (0 == pthread_create(&pQueue->compactor, NULL, CompactorThread, pQueue))
+    {
+      pQueue->compactorRunning = TRUE;
+    }
+    else
+    {
+      status = MAILBOX_QUEUE_NO_MEMORY;
+    }
+  }
+  pthread_mutex_unlock(&pQueue->lock);
+  return status;
+}
+
+void
+MailboxQueueGetStats(
+  MAILBOX_QUEUE *pQueue,
+  MAILBOX_QUEUE_STATS *pStats)
+{
+  pthread_mutex_lock(&pQueue->lock);
+  *pStats = pQueue->stats;
+  pStats->fileBytes = pQueue->log.fileSize;
+  pthread_mutex_unlock(&pQueue->lock);
+}
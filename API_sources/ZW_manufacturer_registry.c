@@ -0,0 +1,84 @@
+/****************************************************************************
+ *
+ * Description: Compiled Z-Wave Manufacturer ID registry.
+ *
+ ****************************************************************************/
+
+/****************************************************************************/
+/*                              INCLUDE FILES                               */
+/****************************************************************************/
+#include <stddef.h>
+#include <ZW_manufacturer_registry.h>
+
+/****************************************************************************/
+/*                      PRIVATE TYPES and DEFINITIONS                       */
+/****************************************************************************/
+
+/* Must match tools/gen_manufacturer_registry.py */
+#define HASH_MULTIPLIER   0x9E3779B1UL
+#define BUCKET_BITS       8
+#define NO_NAME           0xFFFF
+
+typedef struct _MANUFACTURER_SLOT_
+{
+  uint16_t manufacturerId;
+  uint16_t nameOffset;           /* Offset in manufacturerNames, NO_NAME for an empty slot */
+  uint16_t formerNameOffset;     /* NO_NAME if never renamed */
+} MANUFACTURER_SLOT;
+
+/****************************************************************************/
+/*                              PRIVATE DATA                                */
+/****************************************************************************/
+
+#include "ZW_manufacturer_registry_table.c"
+
+/****************************************************************************/
+/*                           PRIVATE FUNCTIONS                              */
+/****************************************************************************/
+
+static const MANUFACTURER_SLOT *
+Lookup(uint16_t manufacturerId)
+{
+  uint32_t hash = (uint32_t)(manufacturerId * HASH_MULTIPLIER);
+  const MANUFACTURER_SLOT *pSlot;
+
+  hash ^= manufacturerDisplacement[hash >> (32 - BUCKET_BITS)];
+  pSlot = &manufacturerSlots[hash & (MANUFACTURER_TABLE_SLOTS - 1)];
+  if (pSlot->manufacturerId != manufacturerId || NO_NAME == pSlot->nameOffset)
+  {
+    return NULL;
+  }
+  return pSlot;
+}
+
+/****************************************************************************/
+/*                           EXPORTED FUNCTIONS                             */
+/****************************************************************************/
+
+const char *
+ManufacturerRegistryName(
+  uint16_t manufacturerId)
+{
+  const MANUFACTURER_SLOT *pSlot = Lookup(manufacturerId);
+
+  return pSlot ? &manufacturerNames[pSlot->nameOffset] : NULL;
+}
+
+const char *
+ManufacturerRegistryFormerName(
+  uint16_t manufacturerId)
+{
+  const MANUFACTURER_SLOT *pSlot = Lookup(manufacturerId);
+
+  if (NULL == pSlot || NO_NAME == pSlot->formerNameOffset)
+  {
+    return NULL;
+  }
+  return &manufacturerNames[pSlot->formerNameOffset];
+}
+
+uint16_t
+ManufacturerRegistryCount(void)
+{
+  return MANUFACTURER_TABLE_COUNT;
+}
@@ -0,0 +1,1717 @@
+/****************************************************************************
+ *
+ * Description: Manufacturer ID perfect hash table.
+ *
+ * Generated by tools/gen_manufacturer_registry.py from
+ * "Registries/Z-Wave Manufacturer ID List.xlsx". Do not edit.
+ *
+ ****************************************************************************/
+
+#define MANUFACTURER_TABLE_SLOTS  1024
+#define MANUFACTURER_TABLE_COUNT  730
+
+static const char manufacturerNames[12120] =
+  "Z-Wave Protocol Owner" "\0"
+  "Abode" "\0"
+  "KDDI" "\0"
+  "Qees" "\0"
+  "NEOCONTROL US LLC" "\0"
+  "Applied Micro Electronics \"AME\" BV" "\0"
+  "INTERSOFT" "\0"
+  "Qolsys" "\0"
+  "Z-Wave Alliance" "\0"
+  "Reserved" "\0"
+  "Springs Window Fashions" "\0"
+  "Frostdale" "\0"
+  "Remotec" "\0"
+  "Somfy" "\0"
+  "Schneider Electric" "\0"
+  "Calix" "\0"
+  "Grib" "\0"
+  "Environexus Pty. Ltd." "\0"
+  "Broadband Energy Networks Inc." "\0"
+  "KUMHO ELECTRIC, INC" "\0"
+  "Tyco (China) Investment Co., Ltd." "\0"
+  "WeBeHome AB" "\0"
+  "Internet Dom" "\0"
+  "Rehau AG + Co" "\0"
+  "Axis Communications AB" "\0"
+  "AcroComm Corp." "\0"
+  "Raritan" "\0"
+  "ESSENTIAL TECHNOLOGIES INC." "\0"
+  "Pella" "\0"
+  "ShenZhen Sunricher Technology Limited" "\0"
+  "PC Partner" "\0"
+  "IWATSU" "\0"
+  "EcoNet Controls" "\0"
+  "Lite Automation" "\0"
+  "SimonTech S.L.U" "\0"
+  "Vision Security" "\0"
+  "Z-works Inc." "\0"
+  "Connectivity Solutions GmbH" "\0"
+  "iEXERGY GmbH" "\0"
+  "MASTER SRL DIVISIONE ELETTRICA" "\0"
+  "GUANGDONG PHNIX ECO-ENERGY SOLUTION LTD." "\0"
+  "Novar Electrical Devices and Systems (EDS)" "\0"
+  "eZEX Corporation" "\0"
+  "HORNBACH Baumarkt AG" "\0"
+  "BuLogics" "\0"
+  "JR Automation Technology" "\0"
+  "Dragon Tech Industrial, Ltd." "\0"
+  "Fantem" "\0"
+  "Enwox Technologies s.r.o." "\0"
+  "HEIGHTS TELECOM T LTD" "\0"
+  "HomeSeer Technologies" "\0"
+  "Digital Watchdog" "\0"
+  "SmartThings, Inc." "\0"
+  "D-3 Technology Co. Ltd" "\0"
+  "Systech Corporation" "\0"
+  "Eka Systems" "\0"
+  "COMAP" "\0"
+  "Zooz" "\0"
+  "TKH Group / Eminent" "\0"
+  "Vemmio" "\0"
+  "CentraLite Systems, Inc" "\0"
+  "SMK Manufacturing Inc." "\0"
+  "Masonite" "\0"
+  "Shenzhen Heiman Technology Co., Ltd" "\0"
+  "RPE Ajax LLC (dbs Secur Ltd)" "\0"
+  "Rently" "\0"
+  "Honeywell" "\0"
+  "iamsmart" "\0"
+  "DRACOR Inc." "\0"
+  "BeSense" "\0"
+  "Remote Solution" "\0"
+  "Scientia Technologies, Inc." "\0"
+  "Raylios" "\0"
+  "AEM Acotel Engineering and Manufacturing Spa" "\0"
+  "Queenlock Ind. Co., Ltd." "\0"
+  "Intermatic" "\0"
+  "iRevo" "\0"
+  "Shenzhen ZHIQU Technology Limited" "\0"
+  "Centurylink" "\0"
+  "wiDom" "\0"
+  "Home Automation Europe" "\0"
+  "Panodic Electric (Shenzhen) Limited" "\0"
+  "Tecom Co., Ltd." "\0"
+  "Vero Duco" "\0"
+  "LG Innotek" "\0"
+  "Paxton Access Ltd" "\0"
+  "TrickleStar" "\0"
+  "Z-Wave.Me" "\0"
+  "Starkoff" "\0"
+  "SmartDHOME S.r.l" "\0"
+  "ECS" "\0"
+  "Woodward Labs" "\0"
+  "Control4 Corporation" "\0"
+  "Building 36 Technologies" "\0"
+  "CribOS" "\0"
+  "Digital 5, Inc." "\0"
+  "Gigaset" "\0"
+  "Telldus Technologies AB" "\0"
+  "UNION COMMUNITY Co., Ltd" "\0"
+  "Balboa Instruments" "\0"
+  "Embedded System Design Limited" "\0"
+  "2KLIC" "\0"
+  "TONG LUNG METAL INDUSTRY CO., LTD." "\0"
+  "San Shih Electrical Enterprise Co., Ltd." "\0"
+  "Gemtek Technology Co., Ltd" "\0"
+  "Shenzhen Easyhome Technology Co., Ltd." "\0"
+  "Prodrive Technologies" "\0"
+  "DVACO GROUP" "\0"
+  "Cooper Lighting" "\0"
+  "Westcontrol AS" "\0"
+  "Poly-control" "\0"
+  "Sine Wireless" "\0"
+  "SECO SRL" "\0"
+  "North China University of Technology" "\0"
+  "Bulcraft Control" "\0"
+  "Ness Corporation Pty Ltd" "\0"
+  "Milanity, Inc." "\0"
+  "Smart Armor" "\0"
+  "Atech" "\0"
+  "Eco Life Engineering Co., Ltd." "\0"
+  "Red Bee Co. Ltd" "\0"
+  "Zhejiang Jiuxing Electric Co Ltd" "\0"
+  "iCOM Technology b.v." "\0"
+  "Johnson Controls, Inc." "\0"
+  "Liaoning Youwang Lighting and Electronic Technology Pty Ltd" "\0"
+  "Beijing Sino-American Boyi Software Development Co., Ltd" "\0"
+  "Avadesign Technology Co., Ltd." "\0"
+  "TechniSat Digital GmbH" "\0"
+  "KUNDO xT GmbH" "\0"
+  "AstraLink" "\0"
+  "Vera Control" "\0"
+  "DEFARO" "\0"
+  "Raonix Co., Ltd." "\0"
+  "Napco Security Technologies, Inc." "\0"
+  "StarVedia" "\0"
+  "Huawei Technologies Co., Ltd." "\0"
+  "Martec Access Products" "\0"
+  "Amdocs" "\0"
+  "CHENGPUTECH" "\0"
+  "ASITEQ" "\0"
+  "Securifi Ltd." "\0"
+  "Diceworld" "\0"
+  "T&W\357\274\210SHENZHEN GONGJIN ELECTRONICS CO.,LTD\357\274\211" "\0"
+  "Strattec Advanced Logic,LLC" "\0"
+  "STRATTEC Security Corporation" "\0"
+  "Hangzhou Hikvision Digital Technology Co.,Ltd." "\0"
+  "Techniku" "\0"
+  "Aeinnovation (AEI)" "\0"
+  "Check-It Solutions Inc." "\0"
+  "Exigent Sensors" "\0"
+  "TMC Technology Ltd." "\0"
+  "Prodea" "\0"
+  "Fakro" "\0"
+  "Tricklestar Ltd. (former Empower Controls Ltd.)" "\0"
+  "Wenzhou MTLC Electric Appliances Co.,Ltd." "\0"
+  "Inventec" "\0"
+  "Hampoo" "\0"
+  "LUXEASY technology company LTD." "\0"
+  "BBM Corporation" "\0"
+  "Athom BV" "\0"
+  "Lagotek Corporation" "\0"
+  "Foard Systems" "\0"
+  "M2M Solution" "\0"
+  "Electric Ireland" "\0"
+  "Vates" "\0"
+  "TIMEVALVE, Inc." "\0"
+  "Leviton" "\0"
+  "Zinno" "\0"
+  "Light Engine Limited" "\0"
+  "ABUS Security-Center GmbH & Co. KG" "\0"
+  "Wr@p" "\0"
+  "Promixis, LLC" "\0"
+  "R-import Ltd." "\0"
+  "Radio Thermostat Company of America (RTC)" "\0"
+  "Shenzhen Golden Security Technology Co., Ltd" "\0"
+  "Sunjet Components Corp." "\0"
+  "Wilshine Holding Co., Ltd" "\0"
+  "Monster Cable" "\0"
+  "Evolve" "\0"
+  "STEINEL GmbH" "\0"
+  "China Security & Fire IOT Sensing CO., LTD" "\0"
+  "Reitz-Group.de" "\0"
+  "PARATECH" "\0"
+  "Climax Technology, Ltd." "\0"
+  "Boundary Technologies Ltd" "\0"
+  "Visualize" "\0"
+  "Eltex Enterprise Ltd." "\0"
+  "Honest Technology Co., Ltd." "\0"
+  "Cytech Technology Pre Ltd." "\0"
+  "Shenzhen Thingsview Tech" "\0"
+  "DTV Research Unipessoal, Lda" "\0"
+  "Accel Lab Ltd." "\0"
+  "PowerLynx" "\0"
+  "Transducers Direct" "\0"
+  "ViewQwest Pte Ltd" "\0"
+  "UTC Fire and Security Americas Corp" "\0"
+  "Jin Tao Bao" "\0"
+  "Kopera Development Inc." "\0"
+  "Toshiba Visual Solution" "\0"
+  "Kamstrup A/S" "\0"
+  "Computime" "\0"
+  "INNOVUS" "\0"
+  "Empers Tech Co., Ltd." "\0"
+  "Alertme" "\0"
+  "SmartAll Inc." "\0"
+  "Toledo & Co., Inc." "\0"
+  "There Corporation" "\0"
+  "Pulse Technologies (Aspalis)" "\0"
+  "Guangzhou Ruixiang M&E Co., Ltd" "\0"
+  "Bandi Comm Tech Inc." "\0"
+  "Shenzhen Tripath Digital Audio Equipment Co.,Ltd" "\0"
+  "Reply S.p.A." "\0"
+  "SONG JIANG YUN-AN TECHNOLOGY CO., LTD." "\0"
+  "Senmatic A/S" "\0"
+  "Volansys Technologies" "\0"
+  "Shenzhen JBT Smart Lighting Co., Ltd" "\0"
+  "Asia Heading" "\0"
+  "ConvergeX Ltd." "\0"
+  "Shenzhen iSurpass Technology Co. ,Ltd" "\0"
+  "RATOC Systems Inc." "\0"
+  "Monoprice" "\0"
+  "Revolv Inc" "\0"
+  "Ring" "\0"
+  "Shenzhen Saykey Technology Co., Ltd" "\0"
+  "AdMobilize, LLC" "\0"
+  "KlickH Pvt Ltd." "\0"
+  "BeNext" "\0"
+  "Oregon Automation" "\0"
+  "Ingersoll Rand (was Ecolink)" "\0"
+  "Homemanageables, Inc." "\0"
+  "NIE Technology Co., Ltd" "\0"
+  "Homee GmbH" "\0"
+  "Viva Labs AS" "\0"
+  "Inwido AB" "\0"
+  "WRT Intelligent Technology CO., LTD." "\0"
+  "Sensative AB" "\0"
+  "Lifestyle Networks" "\0"
+  "nCube" "\0"
+  "Huapin Information Technology Co.,Ltd" "\0"
+  "A-1 Components" "\0"
+  "ID Lock AS" "\0"
+  "Shangdong Smart Life Data System Co.,Ltd" "\0"
+  "CBCC Domotique SAS" "\0"
+  "Gerber Technology" "\0"
+  "Chamberlain Group" "\0"
+  "Wayne Dalton" "\0"
+  "OnSite Pro" "\0"
+  "Coventive Technologies Inc." "\0"
+  "August Home" "\0"
+  "S1" "\0"
+  "DynaQuip Controls" "\0"
+  "MTC Maintronic Germany" "\0"
+  "Systemair Sverige AB" "\0"
+  "GE Appliances" "\0"
+  "TKB Home" "\0"
+  "Shandong Smart Life Data System Co .LTD" "\0"
+  "Hauppauge" "\0"
+  "Seluxit" "\0"
+  "Flex Automation" "\0"
+  "Z-Wave Technologia" "\0"
+  "Winytechnology" "\0"
+  "Universal Devices, Inc" "\0"
+  "MIWA Lock Co., Ltd" "\0"
+  "Embedit A/S" "\0"
+  "DigitalZone" "\0"
+  "Resideo" "\0"
+  "ConnectHome" "\0"
+  "ELK Products, Inc." "\0"
+  "Shenzhen Sen5 Technology Co., Ltd." "\0"
+  "Domitech Products, LLC" "\0"
+  "McoHome Technology Co., Ltd" "\0"
+  "Grenton Sp. z o.o." "\0"
+  "Buffalo Inc." "\0"
+  "NorthQ" "\0"
+  "International Integrated Systems, Inc. (IISI)" "\0"
+  "ACT - Advanced Control Technologies" "\0"
+  "Inovelli" "\0"
+  "Sprue Safety Products Ltd" "\0"
+  "Telsey" "\0"
+  "Tronico Technology Co. Ltd." "\0"
+  "MYHOMEBOX B.V." "\0"
+  "Remote Technologies Incorporated" "\0"
+  "Amper Sistemas" "\0"
+  "Hubitat, Inc." "\0"
+  "Carrier" "\0"
+  "ROC-Connect, Inc." "\0"
+  "TEDEE Sp\303\263\305\202ka z Ograniczon\304\205 Odpowiedzialno\305\233ci\304\205" "\0"
+  "Dawon DNS" "\0"
+  "HOSEOTELNET" "\0"
+  "PassivSystems Limited" "\0"
+  "Forest Group Nederland B.V" "\0"
+  "Kame Logic s.r.l." "\0"
+  "Golden Mark (HK) Ltd" "\0"
+  "Cyberhouse" "\0"
+  "GuangZhou Zeewave Information Technology Co., Ltd." "\0"
+  "Glamo Inc." "\0"
+  "SoftAtHome" "\0"
+  "Holtec Electronics BV" "\0"
+  "MB Turn Key Design" "\0"
+  "Smart Electronic Industrial (Dongguan) Co., Limited" "\0"
+  "Think Simple srl" "\0"
+  "WINKA ELECTRONIC CO.,LTD" "\0"
+  "Webee Life" "\0"
+  "VDA" "\0"
+  "Nexa Trading AB" "\0"
+  "Home Automation Inc." "\0"
+  "zConnect" "\0"
+  "Animus Home AB" "\0"
+  "Nice S.p.A." "\0"
+  "OpenPeak Inc." "\0"
+  "Logic Group" "\0"
+  "Logic Home Control, Logic Soft" "\0"
+  "Ningbo Sentek Electronics Co., Ltd" "\0"
+  "ATSUMI Electric Co.,Ltd." "\0"
+  "Echostar" "\0"
+  "SHENZHEN AOYA INDUSTRY CO. LTD" "\0"
+  "Delaney Hardware" "\0"
+  "Home Automated Living" "\0"
+  "Shandong Bittel Intelligent Technology Co., Ltd" "\0"
+  "RISCO Group" "\0"
+  "Cloud Media" "\0"
+  "HELTUN" "\0"
+  "Sercomm Corp" "\0"
+  "fifthplay nv" "\0"
+  "FollowGood Technology Company Ltd." "\0"
+  "AUCEAN TECHNOLOGY. INC" "\0"
+  "White Rabbit" "\0"
+  "Foxconn" "\0"
+  "KOOL KONCEPTS" "\0"
+  "Sengled Co., Ltd." "\0"
+  "Havenlock Inc." "\0"
+  "Diehl AKO" "\0"
+  "EASY SAVER Co., Inc" "\0"
+  "Venstar Inc." "\0"
+  "Inlon Srl" "\0"
+  "Mercury Corporation" "\0"
+  "Telular" "\0"
+  "Universal Electronics Inc." "\0"
+  "Aeotec Limited" "\0"
+  "Intel" "\0"
+  "BMS Evler LTD" "\0"
+  "iRidium mobile" "\0"
+  "Shenzhen Meian Technology Co. Ltd" "\0"
+  "Shenzhen 3nod Acousticlink Co., LTD" "\0"
+  "Ecolink" "\0"
+  "2gig Technologies Inc." "\0"
+  "Alphanetworks" "\0"
+  "Chromagic Technologies Corporation" "\0"
+  "Quby" "\0"
+  "SmartHome Partner GmbH" "\0"
+  "CyberTAN Technology, Inc." "\0"
+  "Soosan Hometech" "\0"
+  "Comfortability" "\0"
+  "GES" "\0"
+  "CodeTrack AB" "\0"
+  "Xanboo" "\0"
+  "Invalance" "\0"
+  "AcTEC (Fuzhou) Electronics Co., Ltd." "\0"
+  "Swann Communications Pty Ltd" "\0"
+  "Electronic Solutions" "\0"
+  "Ameta International Co. Ltd." "\0"
+  "Willis Electric Co., Ltd." "\0"
+  "ControlThink LC" "\0"
+  "CONFIO TECHNOLOGIES PRIVATE LIMITED" "\0"
+  "Dongguan Zhou Da Electronics Co.,Ltd" "\0"
+  "AENSys Informatics Ltd." "\0"
+  "Antik Technology Ltd." "\0"
+  "Technicolor" "\0"
+  "EMT Controls" "\0"
+  "Alarm.com" "\0"
+  "HAB Home Intelligence, LLC" "\0"
+  "Merten" "\0"
+  "Ilevia srl" "\0"
+  "ASSA ABLOY" "\0"
+  "Fibargroup" "\0"
+  "Everspring" "\0"
+  "iungo.nl B.V." "\0"
+  "Smart Products, Inc." "\0"
+  "Teptron AB" "\0"
+  "Stelpro" "\0"
+  "Globalchina-Tech" "\0"
+  "BeSafer" "\0"
+  "Xiamen AcTEC Electronics Co., Ltd." "\0"
+  "Walmart, Inc. on behalf of its affiliate Project Franklin, LLC" "\0"
+  "Elexa Consumer Products Inc." "\0"
+  "Powerhouse Dynamics" "\0"
+  "Nihon Lock Service Co., Ltd." "\0"
+  "Nanjing IoTx Intelligent Technology Co., Ltd." "\0"
+  "Tell It Online" "\0"
+  "Shanghai Longchuang Eco-energy Systems Co., Ltd" "\0"
+  "Vivint" "\0"
+  "Scout Alarm" "\0"
+  "Philio Technology Corp" "\0"
+  "Codeatelier GmbH" "\0"
+  "Chuango Security Technology Corporation" "\0"
+  "MSK - Miyakawa Seisakusho" "\0"
+  "Siterwell Technology HK Co., LTD" "\0"
+  "zwaveproducts.com" "\0"
+  "D-Link" "\0"
+  "Motorola" "\0"
+  "Secure Meters (UK) Ltd" "\0"
+  "Secure Controls (UK) Ltd." "\0"
+  "Hankook Gas Kiki CO.,LTD." "\0"
+  "MOBILUS MOTOR Sp\303\263\305\202ka z o.o." "\0"
+  "Sony Network Communications Inc." "\0"
+  "Smartrent.com, LLC" "\0"
+  "ZTE Corporation" "\0"
+  "MODACOM CO., LTD." "\0"
+  "Universe Future" "\0"
+  "Loudwater Technologies, LLC" "\0"
+  "Pytronic AB" "\0"
+  "CasaWorks" "\0"
+  "iAutomade Pte Ltd" "\0"
+  "B\303\266nig und Kallenbach oHG" "\0"
+  "Arlo Technologies, Inc." "\0"
+  "LINK ELECTRONICS Co., Ltd." "\0"
+  "Nortek Security & Control LLC" "\0"
+  "LIMEI" "\0"
+  "Hogar Controls" "\0"
+  "Home controls" "\0"
+  "AEON Labs" "\0"
+  "ZyXEL" "\0"
+  "Cvnet" "\0"
+  "Connected Object" "\0"
+  "Ingersoll Rand" "\0"
+  "Huawei Device Co., Ltd." "\0"
+  "permundo GmbH" "\0"
+  "U-Tec Group" "\0"
+  "Bellatrix Systems, Inc." "\0"
+  "Home Director" "\0"
+  "Elear Solutions Tech Pvt. Ltd." "\0"
+  "Namron AS" "\0"
+  "Enplug" "\0"
+  "Evolvere SpA" "\0"
+  "EbV" "\0"
+  "Express Controls" "\0"
+  "GKB Security Corporation" "\0"
+  "Shenzhen Liao Wang Tong Da Technology Ltd" "\0"
+  "Qingdao hongyu cles air conditioning co.,ltd." "\0"
+  "Exhausto" "\0"
+  "CCC Air Inc." "\0"
+  "HomeScenario" "\0"
+  "Eurotronics" "\0"
+  "GreenWave Reality Inc." "\0"
+  "Tingcore AB (Info24 AB)" "\0"
+  "Logitech" "\0"
+  "Wuhan NWD Technology Co., Ltd." "\0"
+  "Powerley" "\0"
+  "Dune-HD" "\0"
+  "Kichler" "\0"
+  "RS Scene Automation" "\0"
+  "SATCO Products, Inc." "\0"
+  "Shanghai Dorlink Intelligent Technologies Co.,Ltd" "\0"
+  "Watt Stopper" "\0"
+  "Dongguan Will Power Technology" "\0"
+  "Focal Point Limited" "\0"
+  "Foxconn Industrial Internet" "\0"
+  "Shenzhen Neo Electronics Co., Ltd" "\0"
+  "Destiny Networks" "\0"
+  "INNOPIA Technologies, Inc." "\0"
+  "HZC Electric Co., Limited" "\0"
+  "ADT" "\0"
+  "LifeShield LLC" "\0"
+  "Devolo" "\0"
+  "HiTech Automation" "\0"
+  "IOOOTA" "\0"
+  "Decoris Intelligent System Limited" "\0"
+  "LG Electronics" "\0"
+  "TEM AG" "\0"
+  "AMADAS Co., LTD" "\0"
+  "Innoband Technologies, Inc" "\0"
+  "CONNECTION TECHNOLOGY SYSTEMS" "\0"
+  "DMP (Digital Monitoring Products)" "\0"
+  "Dusun Electron Ltd." "\0"
+  "Panasonic ES Shin Dong-A Co., Ltd" "\0"
+  "Ei Electronics" "\0"
+  "ViewSonic Corporation" "\0"
+  "LEEDARSON LIGHTING CO., LTD." "\0"
+  "Shenzhen Kaadas Intelligent Technology Co., Ltd" "\0"
+  "Guangzhou_SIMT Limited" "\0"
+  "Sequoia Technology LTD" "\0"
+  "Vestel Elektronik Ticaret ve Sanayi A.S." "\0"
+  "Vipa-Star" "\0"
+  "3e Technologies" "\0"
+  "Great Connection System Pte. Ltd." "\0"
+  "KeyWe Inc" "\0"
+  "Guardtec Inc" "\0"
+  "Nanjing Easthouse Electrical Co., Ltd." "\0"
+  "UHS Systems Pty Ltd Australia" "\0"
+  "Residential Control Systems, Inc. (RCS)" "\0"
+  "NHN Entertainment" "\0"
+  "Newland Communication Science Technology Co., Ltd." "\0"
+  "Trane Corporation" "\0"
+  "Popp & Co" "\0"
+  "Horus Smart Control" "\0"
+  "Living Style Enterprises, Ltd." "\0"
+  "Benetek" "\0"
+  "Nokia (Alcatel-Lucent USA Inc.)" "\0"
+  "Zonoff" "\0"
+  "LS Control" "\0"
+  "Hoppe" "\0"
+  "Taiwan iCATCH Inc." "\0"
+  "Icontrol Networks" "\0"
+  "BTSTAR(HK) TECHNOLOGY COMPANY LIMITED" "\0"
+  "ThermoFloor" "\0"
+  "Heatit" "\0"
+  "Marmitek BV" "\0"
+  "NYSEARCH" "\0"
+  "Alphonsus Tech" "\0"
+  "Boca Devices" "\0"
+  "Holion Electronic Engineering Co., Ltd" "\0"
+  "Hyundai Telecom" "\0"
+  "RET Nanjing Intelligence System CO.,Ltd" "\0"
+  "SecureNet Technologies" "\0"
+  "SOREL GmbH" "\0"
+  "Sylvania" "\0"
+  "Enblink Co. Ltd" "\0"
+  "VARIA3 GmbH" "\0"
+  "ABUS August Bremicker S\303\266hne KG" "\0"
+  "Cegedev" "\0"
+  "Arkea" "\0"
+  "Netgear" "\0"
+  "FortrezZ LLC" "\0"
+  "TODKI" "\0"
+  "Omnima Limited" "\0"
+  "Verizon" "\0"
+  "Pixela Corporation" "\0"
+  "Contec intelligent housing" "\0"
+  "Yardi Systems, Inc" "\0"
+  "Homepro" "\0"
+  "Lumi" "\0"
+  "Clare Controls" "\0"
+  "Exceptional Innovations" "\0"
+  "HangZhou iMagic Technology Co., Ltd" "\0"
+  "casenio AG" "\0"
+  "Liveguard Ltd." "\0"
+  "COMMAX" "\0"
+  "IntelliCon" "\0"
+  "Luffanet Co. Lte." "\0"
+  "Herald Datanetics Limited" "\0"
+  "Kjell & Co Elektronik" "\0"
+  "Essence Security" "\0"
+  "Alula" "\0"
+  "Resolution Products" "\0"
+  "Sony Mobile Communications Inc." "\0"
+  "Danfoss" "\0"
+  "Axesstel Inc" "\0"
+  "Wintop" "\0"
+  "Askey Computer Corp." "\0"
+  "SWYCS" "\0"
+  "SANAV" "\0"
+  "Eelectron SpA" "\0"
+  "Ubitech" "\0"
+  "MITSUMI" "\0"
+  "Jasco Products" "\0"
+  "Future Home AS" "\0"
+  "Twisthink" "\0"
+  "Inkel Corp." "\0"
+  "SafeTech Products" "\0"
+  "IOTAS" "\0"
+  "Flextronics" "\0"
+  "Color Kinetics Incorporated" "\0"
+  "MCT CO., LTD" "\0"
+  "Leak Intelligence, LLC" "\0"
+  "Dwelo Inc." "\0"
+  "PHILIA TECHNOLOGY Co., Ltd." "\0"
+  "KOCOM" "\0"
+  "HANK Electronics Ltd" "\0"
+  "Goap" "\0"
+  "Rubetek" "\0"
+  "Defacontrols BV" "\0"
+  "TP-Link Technologies Co., Ltd." "\0"
+  "Spectrum Brands" "\0"
+  "Motion Control Systems" "\0"
+  "WOOREE Lighting Co.,Ltd." "\0"
+  "Sharp" "\0"
+  "SBCK Corp." "\0"
+  "Smartly AS" "\0"
+  "Pragmatic Consulting Inc." "\0"
+  "Embedded Data Systems" "\0"
+  "TAEWON Lighting Co., Ltd." "\0"
+  "Team Digital Limited" "\0"
+  "Ondo Connectivity" "\0"
+  "CPRO" "\0"
+  "2B Electronics" "\0"
+  "ST&T Electric Corporation" "\0"
+  "Advanced Optronic Devices Co.,Ltd" "\0"
+  "ZHONGSHAN YunJia INTELLIGENT TECHNOLOGY CO.,LTD" "\0"
+  "KIWILAB" "\0"
+  "Samsung Electronics Co., Ltd." "\0"
+  "UFairy G.R. Tech" "\0"
+  "OBLO LIVING LLC" "\0"
+  "Swidget Corp" "\0"
+  "Calm Technologies Inc." "\0"
+  "BRK Brands, Inc." "\0"
+  "Team Precision PCL" "\0"
+  "Anchor Tech" "\0"
+  "Secure Wireless" "\0"
+  "Blaze Automation" "\0"
+  "Taiwan Fu Hsing Industrial Co., Ltd." "\0"
+  "Cherubini Spa" "\0"
+  "Tridium" "\0"
+  "neusta next GmbH & Co. KG" "\0"
+  "Wireless Maingate AB" "\0"
+  "Allegion" "\0"
+  "Samsung SDS" "\0"
+  "Wink Inc." "\0"
+  "Lowes" "\0"
+  "Zykronix" "\0"
+  "Smartron India Pvt Ltd." "\0"
+  "ALLEATO" "\0"
+  "ID-RF" "\0"
+  "Kaipule Technology Co., Ltd." "\0"
+  "Vimar CRS" "\0"
+  "LifeSmart Inc." "\0"
+  "Star Automation" "\0"
+  "BFT S.p.A." "\0"
+  "Cameo Communications Inc." "\0"
+  "GE" "\0"
+  "Eco Automation" "\0"
+  "Zipato" "\0"
+  "Honest Technology" "\0"
+  "Abilia" "\0"
+  "Good Way Technology Co., Ltd" "\0"
+  "Dooya" "\0"
+  "AdTrustMedia LLC dba: eZLO" "\0"
+  "JLabs Corporation" "\0"
+  "Airzone - Corporaci\303\263n Empresarial Altra S.L." "\0"
+  "Zdata, LLC." "\0"
+  "NEEO AG" "\0"
+  "m2m Solution" "\0"
+  "El-Gev Electronics LTD" "\0"
+  "Inergy Systems LLC" "\0"
+  "Nexia Home Intelligence" "\0"
+  "Eaton" "\0"
+  "Cooper Wiring Devices" "\0"
+  "NEC Platforms Ltd" "\0"
+  "A.KEEMPLECOM LIMITED" "\0"
+  "Novateqni HK Ltd" "\0"
+  "Locstar Technology Co., Ltd" "\0";
+
+static const uint16_t manufacturerDisplacement[256] =
+{
+  0x000, 0x002, 0x004, 0x000, 0x000, 0x000, 0x002, 0x000,
+  0x000, 0x000, 0x000, 0x001, 0x000, 0x000, 0x000, 0x002,
+  0x001, 0x000, 0x000, 0x000, 0x001, 0x000, 0x001, 0x000,
+  0x001, 0x000, 0x000, 0x000, 0x000, 0x001, 0x000, 0x001,
+  0x002, 0x002, 0x000, 0x000, 0x002, 0x001, 0x002, 0x000,
+  0x000, 0x000, 0x002, 0x003, 0x003, 0x000, 0x001, 0x000,
+  0x000, 0x000, 0x002, 0x001, 0x001, 0x000, 0x000, 0x000,
+  0x000, 0x000, 0x000, 0x000, 0x001, 0x005, 0x003, 0x000,
+  0x003, 0x000, 0x000, 0x000, 0x000, 0x002, 0x000, 0x005,
+  0x000, 0x000, 0x000, 0x002, 0x000, 0x003, 0x000, 0x000,
+  0x000, 0x002, 0x000, 0x001, 0x001, 0x000, 0x002, 0x000,
+  0x002, 0x002, 0x001, 0x009, 0x003, 0x000, 0x000, 0x000,
+  0x000, 0x001, 0x003, 0x000, 0x001, 0x001, 0x000, 0x000,
+  0x005, 0x000, 0x001, 0x000, 0x000, 0x004, 0x000, 0x000,
+  0x000, 0x001, 0x000, 0x000, 0x001, 0x006, 0x000, 0x000,
+  0x001, 0x000, 0x002, 0x005, 0x000, 0x002, 0x000, 0x008,
+  0x000, 0x001, 0x000, 0x000, 0x003, 0x000, 0x000, 0x000,
+  0x003, 0x004, 0x000, 0x004, 0x000, 0x002, 0x004, 0x000,
+  0x000, 0x001, 0x007, 0x000, 0x000, 0x00D, 0x000, 0x000,
+  0x003, 0x003, 0x000, 0x000, 0x000, 0x000, 0x00B, 0x001,
+  0x002, 0x001, 0x000, 0x001, 0x005, 0x000, 0x000, 0x000,
+  0x002, 0x001, 0x000, 0x000, 0x000, 0x006, 0x000, 0x000,
+  0x000, 0x008, 0x006, 0x000, 0x001, 0x004, 0x008, 0x000,
+  0x002, 0x000, 0x000, 0x004, 0x000, 0x002, 0x001, 0x000,
+  0x006, 0x000, 0x004, 0x005, 0x004, 0x002, 0x000, 0x000,
+  0x005, 0x002, 0x000, 0x001, 0x00C, 0x001, 0x007, 0x000,
+  0x006, 0x000, 0x007, 0x000, 0x000, 0x001, 0x000, 0x00A,
+  0x000, 0x000, 0x001, 0x000, 0x003, 0x001, 0x000, 0x000,
+  0x002, 0x002, 0x002, 0x001, 0x007, 0x000, 0x006, 0x000,
+  0x00F, 0x002, 0x002, 0x001, 0x001, 0x000, 0x000, 0x006,
+  0x000, 0x002, 0x002, 0x002, 0x007, 0x003, 0x000, 0x003,
+  0x002, 0x000, 0x009, 0x000, 0x013, 0x003, 0x000, 0x003,
+};
+
+static const MANUFACTURER_SLOT manufacturerSlots[MANUFACTURER_TABLE_SLOTS] =
+{
+  { 0x0000, 0x0000, 0xFFFF },
+  { 0x0400, 0x0016, 0xFFFF },
+  { 0x0337, 0x001C, 0xFFFF },
+  { 0x0000, 0xFFFF, 0xFFFF },
+  { 0x0095, 0x0021, 0xFFFF },
+  { 0x0351, 0x0026, 0xFFFF },
+  { 0x0000, 0xFFFF, 0xFFFF },
+  { 0x0144, 0x0038, 0xFFFF },
+  { 0x0288, 0x005B, 0xFFFF },
+  { 0x012A, 0x0065, 0xFFFF },
+  { 0x031D, 0x006C, 0xFFFF },
+  { 0x007B, 0x007C, 0xFFFF },
+  { 0x0000, 0xFFFF, 0xFFFF },
+  { 0x0000, 0xFFFF, 0xFFFF },
+  { 0x0000, 0xFFFF, 0xFFFF },
+  { 0x026E, 0x0085, 0xFFFF },
+  { 0x0110, 0x009D, 0xFFFF },
+  { 0x0000, 0xFFFF, 0xFFFF },
+  { 0x0303, 0x007C, 0xFFFF },
+  { 0x0061, 0x007C, 0xFFFF },
+  { 0x5254, 0x00A7, 0xFFFF },
+  { 0x0047, 0x00AF, 0xFFFF },
+  { 0x0254, 0x007C, 0xFFFF },
+  { 0x0447, 0x00B5, 0xFFFF },
+  { 0x0398, 0x00C8, 0xFFFF },
+  { 0x0000, 0xFFFF, 0xFFFF },
+  { 0x018B, 0x00CE, 0xFFFF },
+  { 0x042D, 0x00D3, 0xFFFF },
+  { 0x0000, 0xFFFF, 0xFFFF },
+  { 0x002D, 0x00E9, 0xFFFF },
+  { 0x037E, 0x007C, 0xFFFF },
+  { 0x023A, 0x0108, 0xFFFF },
+  { 0x0220, 0x011C, 0xFFFF },
+  { 0x0171, 0x013E, 0xFFFF },
+  { 0x0013, 0x014A, 0xFFFF },
+  { 0x0413, 0x0157, 0xFFFF },
+  { 0x0206, 0x007C, 0xFFFF },
+  { 0x0364, 0x0165, 0xFFFF },
+  { 0x0000, 0xFFFF, 0xFFFF },
+  { 0x0000, 0xFFFF, 0xFFFF },
+  { 0x0000, 0xFFFF, 0xFFFF },
+  { 0x034A, 0x017C, 0xFFFF },
+  { 0x008E, 0x018B, 0xFFFF },
+  { 0x029B, 0x0193, 0xFFFF },
+  { 0x0000, 0xFFFF, 0xFFFF },
+  { 0x0000, 0xFFFF, 0xFFFF },
+  { 0x0000, 0xFFFF, 0xFFFF },
+  { 0x013D, 0x01AF, 0xFFFF },
+  { 0x0330, 0x01B5, 0xFFFF },
+  { 0x0281, 0x01DB, 0xFFFF },
+  { 0x0000, 0xFFFF, 0xFFFF },
+  { 0x0123, 0x01E6, 0xFFFF },
+  { 0x0157, 0x01ED, 0xFFFF },
+  { 0x0000, 0xFFFF, 0xFFFF },
+  { 0x0316, 0x01FD, 0xFFFF },
+  { 0x0267, 0x020D, 0xFFFF },
+  { 0x0000, 0xFFFF, 0xFFFF },
+  { 0x0109, 0x021D, 0xFFFF },
+  { 0x0000, 0xFFFF, 0xFFFF },
+  { 0x005A, 0x007C, 0xFFFF },
+  { 0x0074, 0x007C, 0xFFFF },
+  { 0x024D, 0x022D, 0xFFFF },
+  { 0x0000, 0xFFFF, 0xFFFF },
+  { 0x019E, 0x023A, 0x0256 },
+  { 0x0440, 0x0263, 0xFFFF },
+  { 0x0391, 0x0282, 0xFFFF },
+  { 0x0040, 0x02AB, 0xFFFF },
+  { 0x0000, 0xFFFF, 0xFFFF },
+  { 0x0233, 0x02D6, 0xFFFF },
+  { 0x0377, 0x02E7, 0xFFFF },
+  { 0x0026, 0x02FC, 0xFFFF },
+  { 0x0426, 0x0305, 0xFFFF },
+  { 0x0184, 0x031E, 0xFFFF },
+  { 0x0000, 0xFFFF, 0xFFFF },
+  { 0x016A, 0x033B, 0xFFFF },
+  { 0x0219, 0x0342, 0xFFFF },
+  { 0x040C, 0x035C, 0xFFFF },
+  { 0x000C, 0x0372, 0xFFFF },
+  { 0x0000, 0xFFFF, 0xFFFF },
+  { 0x035D, 0x0388, 0xFFFF },
+  { 0x0000, 0xFFFF, 0xFFFF },
+  { 0x0000, 0xFFFF, 0xFFFF },
+  { 0x0150, 0x0399, 0xFFFF },
+  { 0x0343, 0x007C, 0xFFFF },
+  { 0x0294, 0x03AB, 0xFFFF },
+  { 0xFFF2, 0x007C, 0xFFFF },
+  { 0x0136, 0x03C2, 0xFFFF },
+  { 0x0087, 0x03D6, 0xFFFF },
+  { 0x0000, 0xFFFF, 0xFFFF },
+  { 0x0000, 0xFFFF, 0xFFFF },
+  { 0x0329, 0x03E2, 0xFFFF },
+  { 0x027A, 0x03E8, 0xFFFF },
+  { 0x011C, 0x03ED, 0xFFFF },
+  { 0x006D, 0x007C, 0xFFFF },
+  { 0x030F, 0x0401, 0xFFFF },
+  { 0x0000, 0xFFFF, 0xFFFF },
+  { 0x0246, 0x0408, 0xFFFF },
+  { 0x0053, 0x007C, 0xFFFF },
+  { 0x0102, 0x0420, 0xFFFF },
+  { 0x0453, 0x0437, 0xFFFF },
+  { 0x0000, 0xFFFF, 0xFFFF },
+  { 0x0260, 0x0440, 0xFFFF },
+  { 0x0000, 0xFFFF, 0xFFFF },
+  { 0x0197, 0x0464, 0xFFFF },
+  { 0x0439, 0x0481, 0xFFFF },
+  { 0x0039, 0x0488, 0xFFFF },
+  { 0x038A, 0x0492, 0xFFFF },
+  { 0x0000, 0xFFFF, 0xFFFF },
+  { 0x017D, 0x049B, 0xFFFF },
+  { 0x041F, 0x04A7, 0xFFFF },
+  { 0x022C, 0x04AF, 0xFFFF },
+  { 0x001F, 0x04BF, 0xFFFF },
+  { 0x0370, 0x04DB, 0xFFFF },
+  { 0x0000, 0xFFFF, 0xFFFF },
+  { 0x0405, 0x04E3, 0xFFFF },
+  { 0x0163, 0x0510, 0xFFFF },
+  { 0x0000, 0xFFFF, 0xFFFF },
+  { 0x0005, 0x0529, 0xFFFF },
+  { 0x0212, 0x0534, 0xFFFF },
+  { 0x0356, 0x053A, 0xFFFF },
+  { 0x033C, 0x055C, 0xFFFF },
+  { 0x0149, 0x0568, 0xFFFF },
+  { 0x009A, 0x056E, 0xFFFF },
+  { 0x0000, 0xFFFF, 0xFFFF },
+  { 0x0000, 0xFFFF, 0xFFFF },
+  { 0x028D, 0x0585, 0xFFFF },
+  { 0x0000, 0xFFFF, 0xFFFF },
+  { 0x012F, 0x05A9, 0xFFFF },
+  { 0x0080, 0x05B9, 0xFFFF },
+  { 0x0000, 0xFFFF, 0xFFFF },
+  { 0x0273, 0x05C3, 0xFFFF },
+  { 0x0322, 0x05CE, 0xFFFF },
+  { 0x0000, 0xFFFF, 0xFFFF },
+  { 0x0000, 0xFFFF, 0xFFFF },
+  { 0x0066, 0x05E0, 0xFFFF },
+  { 0x0115, 0x05EC, 0xFFFF },
+  { 0x0000, 0xFFFF, 0xFFFF },
+  { 0x0259, 0x05F6, 0xFFFF },
+  { 0x0000, 0xFFFF, 0xFFFF },
+  { 0x0308, 0x007C, 0xFFFF },
+  { 0x044C, 0x05FF, 0xFFFF },
+  { 0x039D, 0x0610, 0xFFFF },
+  { 0x004C, 0x0614, 0xFFFF },
+  { 0x023F, 0x0622, 0xFFFF },
+  { 0x0190, 0x0637, 0xFFFF },
+  { 0x0000, 0xFFFF, 0xFFFF },
+  { 0x0000, 0xFFFF, 0xFFFF },
+  { 0x0383, 0x0650, 0xFFFF },
+  { 0x0032, 0x0657, 0xFFFF },
+  { 0x0225, 0x007C, 0xFFFF },
+  { 0x0432, 0x0667, 0xFFFF },
+  { 0x0176, 0x066F, 0xFFFF },
+  { 0x0418, 0x0687, 0xFFFF },
+  { 0x0018, 0x06A0, 0xFFFF },
+  { 0x0000, 0xFFFF, 0xFFFF },
+  { 0x020B, 0x06B3, 0xFFFF },
+  { 0x015C, 0x007C, 0xFFFF },
+  { 0x0369, 0x06D2, 0xFFFF },
+  { 0x0000, 0xFFFF, 0xFFFF },
+  { 0x034F, 0x06D8, 0xFFFF },
+  { 0x0142, 0x007C, 0xFFFF },
+  { 0x0000, 0xFFFF, 0xFFFF },
+  { 0x0000, 0xFFFF, 0xFFFF },
+  { 0x0093, 0x06FB, 0xFFFF },
+  { 0x0000, 0xFFFF, 0xFFFF },
+  { 0x0335, 0x0724, 0xFFFF },
+  { 0x0286, 0x073F, 0xFFFF },
+  { 0x005F, 0x007C, 0xFFFF },
+  { 0x0128, 0x0766, 0xFFFF },
+  { 0x031B, 0x077C, 0xFFFF },
+  { 0x0000, 0xFFFF, 0xFFFF },
+  { 0x0000, 0xFFFF, 0xFFFF },
+  { 0x0079, 0x0788, 0xFFFF },
+  { 0x026C, 0x0798, 0xFFFF },
+  { 0x010E, 0x07A7, 0xFFFF },
+  { 0x0000, 0xFFFF, 0xFFFF },
+  { 0x0045, 0x07B4, 0xFFFF },
+  { 0x0301, 0x07C2, 0xFFFF },
+  { 0x0252, 0x07CB, 0xFFFF },
+  { 0x0000, 0xFFFF, 0xFFFF },
+  { 0x0000, 0xFFFF, 0xFFFF },
+  { 0x0445, 0x007C, 0xFFFF },
+  { 0x0000, 0xFFFF, 0xFFFF },
+  { 0x0396, 0x07F0, 0xFFFF },
+  { 0x0189, 0x0801, 0xFFFF },
+  { 0x0238, 0x081A, 0xFFFF },
+  { 0x042B, 0x0829, 0xFFFF },
+  { 0x002B, 0x0835, 0xFFFF },
+  { 0x037C, 0x083B, 0xFFFF },
+  { 0x0000, 0xFFFF, 0xFFFF },
+  { 0x021E, 0x085A, 0xFFFF },
+  { 0x016F, 0x086A, 0xFFFF },
+  { 0x0011, 0x088B, 0xFFFF },
+  { 0x0411, 0x08A0, 0xFFFF },
+  { 0x0362, 0x08B7, 0xFFFF },
+  { 0x0000, 0xFFFF, 0xFFFF },
+  { 0x0204, 0x08F3, 0xFFFF },
+  { 0x0155, 0x092C, 0xFFFF },
+  { 0x0000, 0xFFFF, 0xFFFF },
+  { 0x0000, 0xFFFF, 0xFFFF },
+  { 0x0000, 0xFFFF, 0xFFFF },
+  { 0x0299, 0x094B, 0xFFFF },
+  { 0x0348, 0x0962, 0xFFFF },
+  { 0x013B, 0x0970, 0xFFFF },
+  { 0x008C, 0x097A, 0xFFFF },
+  { 0x0000, 0xFFFF, 0xFFFF },
+  { 0x027F, 0x007C, 0xFFFF },
+  { 0x032E, 0x0987, 0xFFFF },
+  { 0x0314, 0x098E, 0xFFFF },
+  { 0x0121, 0x099F, 0xFFFF },
+  { 0x0000, 0xFFFF, 0xFFFF },
+  { 0x0072, 0x007C, 0xFFFF },
+  { 0x0265, 0x09C1, 0xFFFF },
+  { 0x0000, 0xFFFF, 0xFFFF },
+  { 0x0000, 0xFFFF, 0xFFFF },
+  { 0x0107, 0x007C, 0xFFFF },
+  { 0x0058, 0x007C, 0xFFFF },
+  { 0x024B, 0x09CB, 0xFFFF },
+  { 0x0000, 0xFFFF, 0xFFFF },
+  { 0x0000, 0xFFFF, 0xFFFF },
+  { 0x003E, 0x09E9, 0xFFFF },
+  { 0x019C, 0x0A00, 0xFFFF },
+  { 0x043E, 0x007C, 0xFFFF },
+  { 0x038F, 0x0A07, 0xFFFF },
+  { 0x0000, 0xFFFF, 0xFFFF },
+  { 0x0231, 0x0A13, 0xFFFF },
+  { 0x0182, 0x0A1A, 0xFFFF },
+  { 0x0000, 0xFFFF, 0xFFFF },
+  { 0x0024, 0x007C, 0xFFFF },
+  { 0x0424, 0x0A28, 0xFFFF },
+  { 0x0375, 0x0A32, 0xFFFF },
+  { 0x0217, 0x0A60, 0xFFFF },
+  { 0x0168, 0x0A7C, 0xFFFF },
+  { 0x0000, 0xFFFF, 0xFFFF },
+  { 0x040A, 0x0A9A, 0xFFFF },
+  { 0x000A, 0x0AC9, 0xFFFF },
+  { 0x035B, 0x0AD2, 0xFFFF },
+  { 0x0000, 0xFFFF, 0xFFFF },
+  { 0x014E, 0x0AE5, 0xFFFF },
+  { 0x009F, 0x0AFD, 0xFFFF },
+  { 0xFFF0, 0x007C, 0xFFFF },
+  { 0x0327, 0x0B0D, 0xFFFF },
+  { 0x0292, 0x007C, 0xFFFF },
+  { 0x0000, 0xFFFF, 0xFFFF },
+  { 0x0000, 0xFFFF, 0xFFFF },
+  { 0x0134, 0x007C, 0xFFFF },
+  { 0x0341, 0x0B21, 0xFFFF },
+  { 0x0085, 0x0B28, 0xFFFF },
+  { 0x0000, 0xFFFF, 0xFFFF },
+  { 0x006B, 0x0B2E, 0xFFFF },
+  { 0x011A, 0x0B5E, 0xFFFF },
+  { 0x0278, 0x0B88, 0xFFFF },
+  { 0x0000, 0xFFFF, 0xFFFF },
+  { 0x030D, 0x0B91, 0xFFFF },
+  { 0x025E, 0x0B98, 0xFFFF },
+  { 0x0000, 0xFFFF, 0xFFFF },
+  { 0x0100, 0x007C, 0xFFFF },
+  { 0x0451, 0x0BB8, 0xFFFF },
+  { 0x0244, 0x0BC8, 0xFFFF },
+  { 0x0051, 0x0BD1, 0xFFFF },
+  { 0x0037, 0x0BE5, 0xFFFF },
+  { 0x0000, 0xFFFF, 0xFFFF },
+  { 0x0195, 0x0BF3, 0xFFFF },
+  { 0x0437, 0x0C00, 0xFFFF },
+  { 0x0388, 0x0C11, 0xFFFF },
+  { 0x0000, 0xFFFF, 0xFFFF },
+  { 0x017B, 0x007C, 0xFFFF },
+  { 0x022A, 0x0C17, 0xFFFF },
+  { 0x001D, 0x0C27, 0xFFFF },
+  { 0x041D, 0x007C, 0xFFFF },
+  { 0x036E, 0x0C2F, 0xFFFF },
+  { 0x0000, 0xFFFF, 0xFFFF },
+  { 0x0210, 0x0C35, 0xFFFF },
+  { 0x0403, 0x0C4A, 0xFFFF },
+  { 0x0003, 0x0C6D, 0xFFFF },
+  { 0x0161, 0x0C72, 0xFFFF },
+  { 0x0354, 0x007C, 0xFFFF },
+  { 0x0000, 0xFFFF, 0xFFFF },
+  { 0x0147, 0x0C80, 0xFFFF },
+  { 0x0000, 0xFFFF, 0xFFFF },
+  { 0x0098, 0x0C8E, 0xFFFF },
+  { 0x0000, 0xFFFF, 0xFFFF },
+  { 0x033A, 0x0CB8, 0xFFFF },
+  { 0x028B, 0x0CE5, 0xFFFF },
+  { 0x0000, 0xFFFF, 0xFFFF },
+  { 0x012D, 0x0CFD, 0xFFFF },
+  { 0x007E, 0x0D17, 0xFFFF },
+  { 0x0000, 0xFFFF, 0xFFFF },
+  { 0x0113, 0x0D25, 0xFFFF },
+  { 0x0000, 0xFFFF, 0xFFFF },
+  { 0x0000, 0xFFFF, 0xFFFF },
+  { 0x0271, 0x0D2C, 0xFFFF },
+  { 0x0320, 0x0D39, 0xFFFF },
+  { 0x0064, 0x0D64, 0xFFFF },
+  { 0x0257, 0x0D73, 0xFFFF },
+  { 0x018E, 0x0D7C, 0xFFFF },
+  { 0x0000, 0xFFFF, 0xFFFF },
+  { 0x044A, 0x0D94, 0xFFFF },
+  { 0x004A, 0x0DAE, 0xFFFF },
+  { 0x039B, 0x0DB8, 0xFFFF },
+  { 0x0000, 0xFFFF, 0xFFFF },
+  { 0x023D, 0x0DCE, 0xFFFF },
+  { 0x0000, 0xFFFF, 0xFFFF },
+  { 0x0306, 0x007C, 0xFFFF },
+  { 0x0030, 0x0DEA, 0xFFFF },
+  { 0x0381, 0x0E05, 0xFFFF },
+  { 0x0223, 0x0E1E, 0xFFFF },
+  { 0x0430, 0x0E3B, 0xFFFF },
+  { 0x0000, 0xFFFF, 0xFFFF },
+  { 0x0016, 0x0E4A, 0xFFFF },
+  { 0x0416, 0x0E54, 0xFFFF },
+  { 0x0367, 0x0E67, 0xFFFF },
+  { 0x034D, 0x007C, 0xFFFF },
+  { 0x0209, 0x0E79, 0xFFFF },
+  { 0x015A, 0x0E9D, 0xFFFF },
+  { 0x0174, 0x0EA9, 0xFFFF },
+  { 0x0000, 0xFFFF, 0xFFFF },
+  { 0x0000, 0xFFFF, 0xFFFF },
+  { 0x029E, 0x007C, 0xFFFF },
+  { 0x0000, 0xFFFF, 0xFFFF },
+  { 0x0333, 0x0EC1, 0xFFFF },
+  { 0x0091, 0x0ED9, 0xFFFF },
+  { 0x0140, 0x0EE6, 0xFFFF },
+  { 0x0077, 0x0EF0, 0xFFFF },
+  { 0x0284, 0x0EF8, 0xFFFF },
+  { 0x0000, 0xFFFF, 0xFFFF },
+  { 0x0126, 0x0F0E, 0xFFFF },
+  { 0x0000, 0xFFFF, 0xFFFF },
+  { 0x026A, 0x0F16, 0xFFFF },
+  { 0x0319, 0x0F24, 0xFFFF },
+  { 0x0000, 0xFFFF, 0xFFFF },
+  { 0x0000, 0xFFFF, 0xFFFF },
+  { 0x010C, 0x0F37, 0xFFFF },
+  { 0x0000, 0xFFFF, 0xFFFF },
+  { 0x0000, 0xFFFF, 0xFFFF },
+  { 0x005D, 0x0F49, 0xFFFF },
+  { 0x016D, 0x0F66, 0xFFFF },
+  { 0x0236, 0x0F86, 0xFFFF },
+  { 0x0250, 0x0F9B, 0xFFFF },
+  { 0x0443, 0x0FCC, 0xFFFF },
+  { 0x0394, 0x0FD9, 0xFFFF },
+  { 0x0000, 0xFFFF, 0xFFFF },
+  { 0x0043, 0x1000, 0xFFFF },
+  { 0x0187, 0x007C, 0xFFFF },
+  { 0x0429, 0x100D, 0xFFFF },
+  { 0x0000, 0xFFFF, 0xFFFF },
+  { 0x037A, 0x1023, 0xFFFF },
+  { 0x0029, 0x1048, 0xFFFF },
+  { 0x0000, 0xFFFF, 0xFFFF },
+  { 0x000F, 0x1055, 0xFFFF },
+  { 0x021C, 0x1064, 0xFFFF },
+  { 0x040F, 0x108A, 0xFFFF },
+  { 0x0360, 0x007C, 0xFFFF },
+  { 0x0000, 0xFFFF, 0xFFFF },
+  { 0x0202, 0x109D, 0xFFFF },
+  { 0x0153, 0x10A7, 0xFFFF },
+  { 0x0346, 0x10B2, 0xFFFF },
+  { 0x0000, 0xFFFF, 0xFFFF },
+  { 0x032C, 0x10B7, 0xFFFF },
+  { 0x0297, 0x10DB, 0xFFFF },
+  { 0x0139, 0x10EB, 0xFFFF },
+  { 0x0000, 0xFFFF, 0xFFFF },
+  { 0x008A, 0x10FB, 0xFFFF },
+  { 0x0000, 0xFFFF, 0xFFFF },
+  { 0x0000, 0xFFFF, 0xFFFF },
+  { 0x027D, 0x1102, 0xFFFF },
+  { 0x0000, 0xFFFF, 0xFFFF },
+  { 0x011F, 0x1114, 0xFFFF },
+  { 0x0070, 0x1131, 0xFFFF },
+  { 0x0000, 0xFFFF, 0xFFFF },
+  { 0x0312, 0x1147, 0xFFFF },
+  { 0x0000, 0xFFFF, 0xFFFF },
+  { 0x0056, 0x007C, 0xFFFF },
+  { 0x0105, 0x007C, 0xFFFF },
+  { 0x0456, 0x115F, 0xFFFF },
+  { 0x0000, 0xFFFF, 0xFFFF },
+  { 0x0263, 0x116A, 0xFFFF },
+  { 0x0249, 0x1177, 0xFFFF },
+  { 0x022F, 0x1181, 0xFFFF },
+  { 0x019A, 0x11A6, 0xFFFF },
+  { 0x003C, 0x11B3, 0xFFFF },
+  { 0x038D, 0x11C6, 0xFFFF },
+  { 0x043C, 0x007C, 0xFFFF },
+  { 0x0000, 0xFFFF, 0xFFFF },
+  { 0x0422, 0x007C, 0xFFFF },
+  { 0x0180, 0x11CC, 0xFFFF },
+  { 0x0022, 0x11F2, 0xFFFF },
+  { 0x0373, 0x1201, 0xFFFF },
+  { 0x0000, 0xFFFF, 0xFFFF },
+  { 0x0215, 0x120C, 0xFFFF },
+  { 0x0166, 0x1235, 0xFFFF },
+  { 0x0000, 0xFFFF, 0xFFFF },
+  { 0x0408, 0x1248, 0xFFFF },
+  { 0x0359, 0x125A, 0xFFFF },
+  { 0x0008, 0x126C, 0xFFFF },
+  { 0x0000, 0xFFFF, 0xFFFF },
+  { 0x014C, 0x1279, 0xFFFF },
+  { 0x009D, 0x1284, 0xFFFF },
+  { 0x0000, 0xFFFF, 0xFFFF },
+  { 0x033F, 0x12A0, 0xFFFF },
+  { 0x0290, 0x12AC, 0xFFFF },
+  { 0x0000, 0xFFFF, 0xFFFF },
+  { 0x0132, 0x12AF, 0xFFFF },
+  { 0x0083, 0x12C1, 0xFFFF },
+  { 0x0000, 0xFFFF, 0xFFFF },
+  { 0x0276, 0x12D8, 0xFFFF },
+  { 0x0325, 0x007C, 0xFFFF },
+  { 0x044F, 0x12ED, 0xFFFF },
+  { 0x0118, 0x12FB, 0xFFFF },
+  { 0x0000, 0xFFFF, 0xFFFF },
+  { 0x0000, 0xFFFF, 0xFFFF },
+  { 0x030B, 0x1304, 0xFFFF },
+  { 0x025C, 0x132C, 0xFFFF },
+  { 0x0000, 0xFFFF, 0xFFFF },
+  { 0x0069, 0x1336, 0xFFFF },
+  { 0x004F, 0x133E, 0x134E },
+  { 0x0000, 0xFFFF, 0xFFFF },
+  { 0x0000, 0xFFFF, 0xFFFF },
+  { 0x0242, 0x1361, 0xFFFF },
+  { 0x0193, 0x1370, 0xFFFF },
+  { 0x0435, 0x1387, 0xFFFF },
+  { 0x0035, 0x139A, 0xFFFF },
+  { 0x0386, 0x007C, 0xFFFF },
+  { 0x0000, 0xFFFF, 0xFFFF },
+  { 0x0228, 0x13A6, 0xFFFF },
+  { 0x041B, 0x13B2, 0xFFFF },
+  { 0x0179, 0x13BA, 0xFFFF },
+  { 0x001B, 0x13C6, 0xFFFF },
+  { 0x0000, 0xFFFF, 0xFFFF },
+  { 0x036C, 0x13D9, 0xFFFF },
+  { 0x020E, 0x13FC, 0xFFFF },
+  { 0x015F, 0x1413, 0xFFFF },
+  { 0x0000, 0xFFFF, 0xFFFF },
+  { 0x0401, 0x142F, 0xFFFF },
+  { 0x0000, 0xFFFF, 0xFFFF },
+  { 0x0352, 0x007C, 0xFFFF },
+  { 0x0000, 0xFFFF, 0xFFFF },
+  { 0x0000, 0xFFFF, 0xFFFF },
+  { 0x0145, 0x1442, 0xFFFF },
+  { 0x0096, 0x144F, 0xFFFF },
+  { 0x0338, 0x1456, 0xFFFF },
+  { 0x0289, 0x007C, 0xFFFF },
+  { 0x0001, 0x1484, 0xFFFF },
+  { 0x012B, 0x007C, 0xFFFF },
+  { 0x007C, 0x007C, 0xFFFF },
+  { 0x0000, 0xFFFF, 0xFFFF },
+  { 0x031E, 0x14A8, 0xFFFF },
+  { 0x026F, 0x14B1, 0xFFFF },
+  { 0x0048, 0x14CB, 0xFFFF },
+  { 0x0111, 0x14D2, 0xFFFF },
+  { 0x0000, 0xFFFF, 0xFFFF },
+  { 0x0062, 0x007C, 0xFFFF },
+  { 0x0000, 0xFFFF, 0xFFFF },
+  { 0x0304, 0x14EE, 0xFFFF },
+  { 0x0255, 0x14FD, 0xFFFF },
+  { 0x0000, 0xFFFF, 0xFFFF },
+  { 0x0448, 0x151E, 0xFFFF },
+  { 0x0399, 0x152D, 0xFFFF },
+  { 0x002E, 0x153B, 0xFFFF },
+  { 0x023B, 0x1543, 0xFFFF },
+  { 0x042E, 0x1555, 0xFFFF },
+  { 0x0000, 0xFFFF, 0xFFFF },
+  { 0x018C, 0x1588, 0xFFFF },
+  { 0x037F, 0x007C, 0xFFFF },
+  { 0x0000, 0xFFFF, 0xFFFF },
+  { 0x0221, 0x1592, 0xFFFF },
+  { 0x0172, 0x159E, 0xFFFF },
+  { 0x0207, 0x15B4, 0xFFFF },
+  { 0x0414, 0x15CF, 0xFFFF },
+  { 0x0365, 0x15E1, 0xFFFF },
+  { 0x0000, 0xFFFF, 0xFFFF },
+  { 0x0014, 0x15F6, 0xFFFF },
+  { 0x0158, 0x1601, 0xFFFF },
+  { 0x0000, 0xFFFF, 0xFFFF },
+  { 0x0000, 0xFFFF, 0xFFFF },
+  { 0x034B, 0x1634, 0xFFFF },
+  { 0x029C, 0x163F, 0xFFFF },
+  { 0x013E, 0x164A, 0xFFFF },
+  { 0x0000, 0xFFFF, 0xFFFF },
+  { 0x008F, 0x1660, 0xFFFF },
+  { 0x0000, 0xFFFF, 0xFFFF },
+  { 0x0000, 0xFFFF, 0xFFFF },
+  { 0x0282, 0x1673, 0xFFFF },
+  { 0x0000, 0xFFFF, 0xFFFF },
+  { 0x0124, 0x007C, 0xFFFF },
+  { 0x0075, 0x007C, 0xFFFF },
+  { 0x0317, 0x16A7, 0xFFFF },
+  { 0x0331, 0x16B8, 0xFFFF },
+  { 0x0000, 0xFFFF, 0xFFFF },
+  { 0x0000, 0xFFFF, 0xFFFF },
+  { 0x019F, 0x16D1, 0xFFFF },
+  { 0x010A, 0x16DC, 0xFFFF },
+  { 0x0268, 0x16E0, 0xFFFF },
+  { 0x0000, 0xFFFF, 0xFFFF },
+  { 0x005B, 0x16F0, 0xFFFF },
+  { 0x024E, 0x1705, 0xFFFF },
+  { 0x0392, 0x170E, 0xFFFF },
+  { 0x0441, 0x171D, 0xFFFF },
+  { 0x0041, 0x1729, 0xFFFF },
+  { 0x0234, 0x1737, 0x1743 },
+  { 0x0185, 0x1762, 0xFFFF },
+  { 0x0427, 0x1785, 0xFFFF },
+  { 0x0000, 0xFFFF, 0xFFFF },
+  { 0x0027, 0x007C, 0xFFFF },
+  { 0x0000, 0xFFFF, 0xFFFF },
+  { 0x016B, 0x179E, 0xFFFF },
+  { 0x021A, 0x17A7, 0xFFFF },
+  { 0x040D, 0x17C6, 0xFFFF },
+  { 0x0000, 0xFFFF, 0xFFFF },
+  { 0x000D, 0x17D7, 0xFFFF },
+  { 0x0378, 0x17ED, 0xFFFF },
+  { 0x035E, 0x181D, 0xFFFF },
+  { 0x0200, 0x1829, 0xFFFF },
+  { 0x0000, 0xFFFF, 0xFFFF },
+  { 0x0344, 0x1835, 0xFFFF },
+  { 0x0000, 0xFFFF, 0xFFFF },
+  { 0x0151, 0x183C, 0xFFFF },
+  { 0x0295, 0x1849, 0xFFFF },
+  { 0x0000, 0xFFFF, 0xFFFF },
+  { 0x0137, 0x1856, 0xFFFF },
+  { 0x0088, 0x007C, 0xFFFF },
+  { 0x0000, 0xFFFF, 0xFFFF },
+  { 0x032A, 0x1879, 0xFFFF },
+  { 0x027B, 0x1890, 0xFFFF },
+  { 0x0000, 0xFFFF, 0xFFFF },
+  { 0x011D, 0x189D, 0xFFFF },
+  { 0x006E, 0x007C, 0xFFFF },
+  { 0x0000, 0xFFFF, 0xFFFF },
+  { 0x0261, 0x18A5, 0xFFFF },
+  { 0x0454, 0x18B3, 0xFFFF },
+  { 0x043A, 0x18C5, 0xFFFF },
+  { 0x0103, 0x18D4, 0xFFFF },
+  { 0x0310, 0x007C, 0xFFFF },
+  { 0x0000, 0xFFFF, 0xFFFF },
+  { 0x0054, 0x007C, 0xFFFF },
+  { 0x0247, 0x18DE, 0xFFFF },
+  { 0x0198, 0x18F2, 0xFFFF },
+  { 0x0000, 0xFFFF, 0xFFFF },
+  { 0x003A, 0x18FF, 0xFFFF },
+  { 0x0000, 0xFFFF, 0xFFFF },
+  { 0x0000, 0xFFFF, 0xFFFF },
+  { 0x0000, 0xFFFF, 0xFFFF },
+  { 0x022D, 0x1909, 0xFFFF },
+  { 0x017E, 0x191D, 0xFFFF },
+  { 0x0020, 0x1925, 0xFFFF },
+  { 0x0371, 0x1940, 0xFFFF },
+  { 0x0006, 0x194F, 0xFFFF },
+  { 0x0213, 0x1955, 0xFFFF },
+  { 0x0164, 0x007C, 0xFFFF },
+  { 0x0420, 0x1963, 0xFFFF },
+  { 0x0406, 0x1972, 0xFFFF },
+  { 0x0357, 0x1994, 0xFFFF },
+  { 0x014A, 0x19B8, 0xFFFF },
+  { 0x0000, 0xFFFF, 0xFFFF },
+  { 0x009B, 0x19C0, 0xFFFF },
+  { 0x0000, 0xFFFF, 0xFFFF },
+  { 0x0000, 0xFFFF, 0xFFFF },
+  { 0x0000, 0xFFFF, 0xFFFF },
+  { 0x028E, 0x19D7, 0xFFFF },
+  { 0x033D, 0x007C, 0xFFFF },
+  { 0x0116, 0x19E5, 0xFFFF },
+  { 0x0081, 0x007C, 0xFFFF },
+  { 0x0130, 0x1A08, 0xFFFF },
+  { 0x0323, 0x1A0D, 0xFFFF },
+  { 0x0000, 0xFFFF, 0xFFFF },
+  { 0x0067, 0x1A24, 0xFFFF },
+  { 0x0274, 0x1A3E, 0xFFFF },
+  { 0x0000, 0xFFFF, 0xFFFF },
+  { 0x0000, 0xFFFF, 0xFFFF },
+  { 0x0309, 0x1A4E, 0xFFFF },
+  { 0x025A, 0x1A5D, 0xFFFF },
+  { 0x0000, 0xFFFF, 0xFFFF },
+  { 0x044D, 0x1A61, 0xFFFF },
+  { 0x004D, 0x1A6E, 0xFFFF },
+  { 0x039E, 0x1A75, 0xFFFF },
+  { 0x0000, 0xFFFF, 0xFFFF },
+  { 0x0433, 0x1A7F, 0xFFFF },
+  { 0x0191, 0x1AA4, 0xFFFF },
+  { 0x0177, 0x007C, 0xFFFF },
+  { 0x0033, 0x1AC1, 0xFFFF },
+  { 0x0384, 0x1AD6, 0xFFFF },
+  { 0x015D, 0x1AF3, 0xFFFF },
+  { 0x0000, 0xFFFF, 0xFFFF },
+  { 0x0226, 0x007C, 0xFFFF },
+  { 0x0000, 0xFFFF, 0xFFFF },
+  { 0x0019, 0x1B0D, 0xFFFF },
+  { 0x036A, 0x007C, 0xFFFF },
+  { 0x0419, 0x1B1D, 0xFFFF },
+  { 0x020C, 0x1B41, 0xFFFF },
+  { 0x0000, 0xFFFF, 0xFFFF },
+  { 0x0000, 0xFFFF, 0xFFFF },
+  { 0xFFFF, 0x007C, 0xFFFF },
+  { 0x0350, 0x1B66, 0xFFFF },
+  { 0x026D, 0x1B7E, 0xFFFF },
+  { 0x0143, 0x007C, 0xFFFF },
+  { 0x0240, 0x1B94, 0xFFFF },
+  { 0x0336, 0x1BA0, 0xFFFF },
+  { 0x0094, 0x1BAD, 0xFFFF },
+  { 0x0000, 0xFFFF, 0xFFFF },
+  { 0x0287, 0x1BB7, 0xFFFF },
+  { 0x0000, 0xFFFF, 0xFFFF },
+  { 0x0000, 0xFFFF, 0xFFFF },
+  { 0x007A, 0x1BD2, 0xFFFF },
+  { 0x031C, 0x1BD9, 0xFFFF },
+  { 0x0000, 0xFFFF, 0xFFFF },
+  { 0x0129, 0x1BE4, 0xFFFF },
+  { 0x0000, 0xFFFF, 0xFFFF },
+  { 0x010F, 0x1BEF, 0xFFFF },
+  { 0x0302, 0x007C, 0xFFFF },
+  { 0x0060, 0x1BFA, 0xFFFF },
+  { 0x0000, 0xFFFF, 0xFFFF },
+  { 0x0253, 0x1C05, 0xFFFF },
+  { 0x0446, 0x007C, 0xFFFF },
+  { 0x0000, 0xFFFF, 0xFFFF },
+  { 0x0046, 0x1C13, 0xFFFF },
+  { 0x0397, 0x1C28, 0xFFFF },
+  { 0x0239, 0x1C33, 0xFFFF },
+  { 0x0000, 0xFFFF, 0xFFFF },
+  { 0x0000, 0xFFFF, 0xFFFF },
+  { 0x018A, 0x1C3B, 0xFFFF },
+  { 0x002C, 0x133E, 0x1C4C },
+  { 0x037D, 0x1C54, 0xFFFF },
+  { 0x042C, 0x1C77, 0xFFFF },
+  { 0x021F, 0x1CB6, 0xFFFF },
+  { 0x0170, 0x1CD3, 0xFFFF },
+  { 0x0412, 0x1CE7, 0xFFFF },
+  { 0x0363, 0x1D04, 0xFFFF },
+  { 0x0012, 0x1D32, 0xFFFF },
+  { 0x0000, 0xFFFF, 0xFFFF },
+  { 0x0205, 0x1D41, 0xFFFF },
+  { 0x0156, 0x1D71, 0xFFFF },
+  { 0x0000, 0xFFFF, 0xFFFF },
+  { 0x0000, 0xFFFF, 0xFFFF },
+  { 0x032F, 0x007C, 0xFFFF },
+  { 0x029A, 0x1D78, 0xFFFF },
+  { 0x0000, 0xFFFF, 0xFFFF },
+  { 0x013C, 0x1D84, 0xFFFF },
+  { 0x0349, 0x1D9B, 0xFFFF },
+  { 0x0000, 0xFFFF, 0xFFFF },
+  { 0x008D, 0x007C, 0xFFFF },
+  { 0x0280, 0x1DAC, 0xFFFF },
+  { 0x0000, 0xFFFF, 0xFFFF },
+  { 0x0122, 0x1DD4, 0xFFFF },
+  { 0x0073, 0x007C, 0xFFFF },
+  { 0x0000, 0xFFFF, 0xFFFF },
+  { 0x0000, 0xFFFF, 0xFFFF },
+  { 0x0266, 0x1DEE, 0xFFFF },
+  { 0x0315, 0x1E0F, 0xFFFF },
+  { 0x0108, 0x1E21, 0xFFFF },
+  { 0x003F, 0x1E28, 0xFFFF },
+  { 0x0000, 0xFFFF, 0xFFFF },
+  { 0x0059, 0x1E31, 0x1E48 },
+  { 0x024C, 0x1E62, 0xFFFF },
+  { 0x019D, 0x1E7C, 0xFFFF },
+  { 0x043F, 0x1E9A, 0xFFFF },
+  { 0x0000, 0xFFFF, 0xFFFF },
+  { 0x0390, 0x1EBB, 0xFFFF },
+  { 0x0425, 0x1ECE, 0xFFFF },
+  { 0x0232, 0x1EDE, 0xFFFF },
+  { 0x0183, 0x1EF0, 0xFFFF },
+  { 0x0000, 0xFFFF, 0xFFFF },
+  { 0x0025, 0x1F00, 0xFFFF },
+  { 0x0376, 0x1F1C, 0xFFFF },
+  { 0x000B, 0x1F28, 0xFFFF },
+  { 0x0218, 0x1F32, 0xFFFF },
+  { 0x0169, 0x1F44, 0xFFFF },
+  { 0x0000, 0xFFFF, 0xFFFF },
+  { 0x040B, 0x1F5E, 0xFFFF },
+  { 0x035C, 0x1F76, 0xFFFF },
+  { 0x0000, 0xFFFF, 0xFFFF },
+  { 0x0000, 0xFFFF, 0xFFFF },
+  { 0x014F, 0x1F91, 0xFFFF },
+  { 0xFFF1, 0x007C, 0xFFFF },
+  { 0x0000, 0xFFFF, 0xFFFF },
+  { 0x0342, 0x1FAF, 0xFFFF },
+  { 0x0293, 0x1FB5, 0x1FC4 },
+  { 0x0000, 0xFFFF, 0xFFFF },
+  { 0x0000, 0xFFFF, 0xFFFF },
+  { 0x0086, 0x1FD2, 0xFFFF },
+  { 0x0135, 0x1FDC, 0xFFFF },
+  { 0x0328, 0x1FE2, 0xFFFF },
+  { 0x0279, 0x007C, 0xFFFF },
+  { 0x0000, 0xFFFF, 0xFFFF },
+  { 0x011B, 0x1FE8, 0xFFFF },
+  { 0x006C, 0x1FF9, 0xFFFF },
+  { 0x030E, 0x007C, 0xFFFF },
+  { 0x025F, 0x2008, 0xFFFF },
+  { 0x0000, 0xFFFF, 0xFFFF },
+  { 0x0101, 0x007C, 0xFFFF },
+  { 0x0000, 0xFFFF, 0xFFFF },
+  { 0x0000, 0xFFFF, 0xFFFF },
+  { 0x0000, 0xFFFF, 0xFFFF },
+  { 0x0052, 0x007C, 0xFFFF },
+  { 0x0245, 0x2020, 0xFFFF },
+  { 0x0452, 0x202E, 0xFFFF },
+  { 0x0196, 0x203A, 0xFFFF },
+  { 0x0038, 0x2052, 0xFFFF },
+  { 0x0389, 0x2060, 0xFFFF },
+  { 0x0438, 0x207F, 0xFFFF },
+  { 0x041E, 0x2089, 0xFFFF },
+  { 0x036F, 0x2090, 0xFFFF },
+  { 0x017C, 0x209D, 0xFFFF },
+  { 0x001E, 0x20A1, 0xFFFF },
+  { 0x022B, 0x20B2, 0xFFFF },
+  { 0x0000, 0xFFFF, 0xFFFF },
+  { 0x0211, 0x20CB, 0xFFFF },
+  { 0x0000, 0xFFFF, 0xFFFF },
+  { 0x0000, 0xFFFF, 0xFFFF },
+  { 0x0355, 0x20F5, 0xFFFF },
+  { 0x0004, 0x2123, 0xFFFF },
+  { 0x0404, 0x212C, 0xFFFF },
+  { 0x0162, 0x2139, 0xFFFF },
+  { 0x0148, 0x2146, 0xFFFF },
+  { 0x0099, 0x2152, 0xFFFF },
+  { 0x033B, 0x2169, 0xFFFF },
+  { 0x0000, 0xFFFF, 0xFFFF },
+  { 0x0000, 0xFFFF, 0xFFFF },
+  { 0x007F, 0x2181, 0xFFFF },
+  { 0x012E, 0x218A, 0xFFFF },
+  { 0x028C, 0x21A9, 0xFFFF },
+  { 0x0321, 0x007C, 0xFFFF },
+  { 0x0000, 0xFFFF, 0xFFFF },
+  { 0x0000, 0xFFFF, 0xFFFF },
+  { 0x0272, 0x21B2, 0xFFFF },
+  { 0x0114, 0x21BA, 0xFFFF },
+  { 0x0065, 0x21C2, 0xFFFF },
+  { 0x0000, 0xFFFF, 0xFFFF },
+  { 0x0307, 0x21D6, 0xFFFF },
+  { 0x023E, 0x21EB, 0xFFFF },
+  { 0x0000, 0xFFFF, 0xFFFF },
+  { 0x004B, 0x221D, 0xFFFF },
+  { 0x044B, 0x222A, 0xFFFF },
+  { 0x018F, 0x2249, 0xFFFF },
+  { 0x039C, 0x225D, 0xFFFF },
+  { 0x0000, 0xFFFF, 0xFFFF },
+  { 0x0258, 0x2279, 0xFFFF },
+  { 0x0000, 0xFFFF, 0xFFFF },
+  { 0x0031, 0x229B, 0xFFFF },
+  { 0x0382, 0x22AC, 0xFFFF },
+  { 0x0431, 0x22C7, 0xFFFF },
+  { 0x0224, 0x22E1, 0x22E5 },
+  { 0x0175, 0x22F4, 0xFFFF },
+  { 0x0417, 0x007C, 0xFFFF },
+  { 0x0017, 0x22FB, 0xFFFF },
+  { 0x0000, 0xFFFF, 0xFFFF },
+  { 0x0368, 0x230D, 0xFFFF },
+  { 0x020A, 0x2314, 0xFFFF },
+  { 0x0000, 0xFFFF, 0xFFFF },
+  { 0x0000, 0xFFFF, 0xFFFF },
+  { 0x015B, 0x2337, 0xFFFF },
+  { 0x034E, 0x2346, 0xFFFF },
+  { 0x029F, 0x234D, 0xFFFF },
+  { 0x0000, 0xFFFF, 0xFFFF },
+  { 0x0141, 0x235D, 0xFFFF },
+  { 0x0092, 0x007C, 0xFFFF },
+  { 0x0000, 0xFFFF, 0xFFFF },
+  { 0x0285, 0x2378, 0xFFFF },
+  { 0x0127, 0x2396, 0xFFFF },
+  { 0x0334, 0x23B8, 0xFFFF },
+  { 0x0000, 0xFFFF, 0xFFFF },
+  { 0x031A, 0x23CC, 0xFFFF },
+  { 0x0000, 0xFFFF, 0xFFFF },
+  { 0x0078, 0x007C, 0xFFFF },
+  { 0x026B, 0x23EE, 0xFFFF },
+  { 0x0000, 0xFFFF, 0xFFFF },
+  { 0x0000, 0xFFFF, 0xFFFF },
+  { 0x010D, 0x007C, 0xFFFF },
+  { 0x005E, 0x23FD, 0xFFFF },
+  { 0x0300, 0x2413, 0xFFFF },
+  { 0x0251, 0x007C, 0xFFFF },
+  { 0x0000, 0xFFFF, 0xFFFF },
+  { 0x0444, 0x007C, 0xFFFF },
+  { 0x021D, 0x2430, 0xFFFF },
+  { 0x0395, 0x2460, 0xFFFF },
+  { 0x0044, 0x2477, 0xFFFF },
+  { 0x0237, 0x248E, 0xFFFF },
+  { 0x0188, 0x24B7, 0xFFFF },
+  { 0x002A, 0x24C1, 0xFFFF },
+  { 0x042A, 0x24D1, 0xFFFF },
+  { 0x037B, 0x24F3, 0x24FD },
+  { 0x0000, 0xFFFF, 0xFFFF },
+  { 0x0000, 0xFFFF, 0xFFFF },
+  { 0x0000, 0xFFFF, 0xFFFF },
+  { 0x016E, 0x250A, 0xFFFF },
+  { 0x0410, 0x2531, 0xFFFF },
+  { 0x0010, 0x254F, 0xFFFF },
+  { 0x0361, 0x2577, 0xFFFF },
+  { 0x0203, 0x2589, 0xFFFF },
+  { 0x008B, 0x25BC, 0xFFFF },
+  { 0x0000, 0xFFFF, 0xFFFF },
+  { 0x0154, 0x25CE, 0xFFFF },
+  { 0x0347, 0x007C, 0xFFFF },
+  { 0x0298, 0x25D8, 0xFFFF },
+  { 0x0000, 0xFFFF, 0xFFFF },
+  { 0x0000, 0xFFFF, 0xFFFF },
+  { 0x013A, 0x25EC, 0xFFFF },
+  { 0x0000, 0xFFFF, 0xFFFF },
+  { 0x032D, 0x260B, 0xFFFF },
+  { 0x027E, 0x2613, 0xFFFF },
+  { 0x0000, 0xFFFF, 0xFFFF },
+  { 0x0120, 0x2633, 0xFFFF },
+  { 0x0071, 0x263A, 0xFFFF },
+  { 0x0313, 0x2645, 0xFFFF },
+  { 0x0057, 0x007C, 0xFFFF },
+  { 0x0000, 0xFFFF, 0xFFFF },
+  { 0x0264, 0x264B, 0xFFFF },
+  { 0x0000, 0xFFFF, 0xFFFF },
+  { 0x0106, 0x265E, 0xFFFF },
+  { 0x024A, 0x2670, 0xFFFF },
+  { 0x0000, 0xFFFF, 0xFFFF },
+  { 0x0000, 0xFFFF, 0xFFFF },
+  { 0x019B, 0x2696, 0x26A2 },
+  { 0x043D, 0x007C, 0xFFFF },
+  { 0x003D, 0x26A9, 0xFFFF },
+  { 0x038E, 0x26B5, 0xFFFF },
+  { 0x0000, 0xFFFF, 0xFFFF },
+  { 0x0230, 0x26BE, 0xFFFF },
+  { 0x0000, 0xFFFF, 0xFFFF },
+  { 0x0023, 0x26CD, 0xFFFF },
+  { 0x0181, 0x26DA, 0xFFFF },
+  { 0x0374, 0x2701, 0xFFFF },
+  { 0x0000, 0xFFFF, 0xFFFF },
+  { 0x0216, 0x2711, 0xFFFF },
+  { 0x0167, 0x2739, 0xFFFF },
+  { 0x035A, 0x2750, 0xFFFF },
+  { 0x0009, 0x275B, 0xFFFF },
+  { 0x014D, 0x2764, 0xFFFF },
+  { 0x0423, 0x2774, 0xFFFF },
+  { 0x0000, 0xFFFF, 0xFFFF },
+  { 0x0409, 0x2780, 0xFFFF },
+  { 0x009E, 0x007C, 0xFFFF },
+  { 0x0000, 0xFFFF, 0xFFFF },
+  { 0x0000, 0xFFFF, 0xFFFF },
+  { 0x0291, 0x27A0, 0x27A8 },
+  { 0x0000, 0xFFFF, 0xFFFF },
+  { 0x0133, 0x27AE, 0xFFFF },
+  { 0x0084, 0x27B6, 0xFFFF },
+  { 0x0000, 0xFFFF, 0xFFFF },
+  { 0x0326, 0x27C3, 0xFFFF },
+  { 0x0000, 0xFFFF, 0xFFFF },
+  { 0x0000, 0xFFFF, 0xFFFF },
+  { 0x0119, 0x27C9, 0xFFFF },
+  { 0x006A, 0x007C, 0xFFFF },
+  { 0x0000, 0xFFFF, 0xFFFF },
+  { 0x030C, 0x27D8, 0xFFFF },
+  { 0x0000, 0xFFFF, 0xFFFF },
+  { 0x0277, 0x27E0, 0xFFFF },
+  { 0x025D, 0x27F3, 0xFFFF },
+  { 0x0450, 0x280E, 0xFFFF },
+  { 0x0050, 0x2821, 0xFFFF },
+  { 0x0000, 0xFFFF, 0xFFFF },
+  { 0x0436, 0x2829, 0xFFFF },
+  { 0x0194, 0x282E, 0xFFFF },
+  { 0x0000, 0xFFFF, 0xFFFF },
+  { 0x0036, 0x283D, 0xFFFF },
+  { 0x0387, 0x2855, 0xFFFF },
+  { 0x0000, 0xFFFF, 0xFFFF },
+  { 0x0243, 0x2879, 0xFFFF },
+  { 0x017A, 0x2884, 0xFFFF },
+  { 0x0229, 0x2893, 0xFFFF },
+  { 0x001C, 0x289A, 0xFFFF },
+  { 0x036D, 0x28A5, 0xFFFF },
+  { 0x020F, 0x28B7, 0xFFFF },
+  { 0x041C, 0x28D1, 0xFFFF },
+  { 0x0160, 0x28E7, 0xFFFF },
+  { 0x0353, 0x28F8, 0x28FE },
+  { 0x0402, 0x2912, 0xFFFF },
+  { 0x0002, 0x2932, 0xFFFF },
+  { 0x0146, 0x293A, 0xFFFF },
+  { 0x0000, 0xFFFF, 0xFFFF },
+  { 0x0000, 0xFFFF, 0xFFFF },
+  { 0x0097, 0x2947, 0xFFFF },
+  { 0x028A, 0x294E, 0xFFFF },
+  { 0x0000, 0xFFFF, 0xFFFF },
+  { 0x0000, 0xFFFF, 0xFFFF },
+  { 0x0339, 0x2963, 0xFFFF },
+  { 0x012C, 0x2969, 0xFFFF },
+  { 0x007D, 0x007C, 0xFFFF },
+  { 0x0000, 0xFFFF, 0xFFFF },
+  { 0x031F, 0x296F, 0xFFFF },
+  { 0x0270, 0x297D, 0xFFFF },
+  { 0x0000, 0xFFFF, 0xFFFF },
+  { 0x0112, 0x2985, 0xFFFF },
+  { 0x0063, 0x298D, 0xFFFF },
+  { 0x0000, 0xFFFF, 0xFFFF },
+  { 0x0000, 0xFFFF, 0xFFFF },
+  { 0x0000, 0xFFFF, 0xFFFF },
+  { 0x0305, 0x299C, 0xFFFF },
+  { 0x0049, 0x29AB, 0xFFFF },
+  { 0x0449, 0x007C, 0xFFFF },
+  { 0x039A, 0x007C, 0xFFFF },
+  { 0x0256, 0x29B5, 0xFFFF },
+  { 0x023C, 0x29C1, 0xFFFF },
+  { 0x042F, 0x29D3, 0xFFFF },
+  { 0x018D, 0x29D9, 0xFFFF },
+  { 0x002F, 0x29E5, 0xFFFF },
+  { 0x0000, 0xFFFF, 0xFFFF },
+  { 0x0000, 0xFFFF, 0xFFFF },
+  { 0x0222, 0x2A01, 0xFFFF },
+  { 0x0173, 0x2A0E, 0xFFFF },
+  { 0x0380, 0x007C, 0xFFFF },
+  { 0x0415, 0x2A25, 0xFFFF },
+  { 0x0366, 0x2A30, 0xFFFF },
+  { 0x034C, 0x2A4C, 0xFFFF },
+  { 0x0208, 0x2A52, 0xFFFF },
+  { 0x0159, 0x2A67, 0xFFFF },
+  { 0x0000, 0xFFFF, 0xFFFF },
+  { 0x0000, 0xFFFF, 0xFFFF },
+  { 0x0015, 0x007C, 0xFFFF },
+  { 0x029D, 0x2A6C, 0xFFFF },
+  { 0x0000, 0xFFFF, 0xFFFF },
+  { 0x013F, 0x2A74, 0xFFFF },
+  { 0x0332, 0x007C, 0xFFFF },
+  { 0x0000, 0xFFFF, 0xFFFF },
+  { 0x0283, 0x2A84, 0xFFFF },
+  { 0x0090, 0x2AA3, 0xFFFF },
+  { 0x0000, 0xFFFF, 0xFFFF },
+  { 0x0125, 0x2AB3, 0xFFFF },
+  { 0x0076, 0x007C, 0xFFFF },
+  { 0x0000, 0xFFFF, 0xFFFF },
+  { 0x0269, 0x2ACA, 0xFFFF },
+  { 0x0000, 0xFFFF, 0xFFFF },
+  { 0x0000, 0xFFFF, 0xFFFF },
+  { 0x010B, 0x2AE3, 0xFFFF },
+  { 0x005C, 0x007C, 0xFFFF },
+  { 0x0318, 0x2AE9, 0xFFFF },
+  { 0x0000, 0xFFFF, 0xFFFF },
+  { 0x024F, 0x2AF4, 0xFFFF },
+  { 0x0442, 0x007C, 0xFFFF },
+  { 0x0000, 0xFFFF, 0xFFFF },
+  { 0x0042, 0x2AFF, 0xFFFF },
+  { 0x0393, 0x2B19, 0xFFFF },
+  { 0x0000, 0xFFFF, 0xFFFF },
+  { 0x0235, 0x2B2F, 0xFFFF },
+  { 0x0186, 0x2B49, 0xFFFF },
+  { 0x0000, 0xFFFF, 0xFFFF },
+  { 0x0428, 0x2B5E, 0xFFFF },
+  { 0x0379, 0x2B70, 0xFFFF },
+  { 0x0028, 0x2B75, 0xFFFF },
+  { 0x021B, 0x2B84, 0xFFFF },
+  { 0x016C, 0x2B9E, 0xFFFF },
+  { 0x040E, 0x2BC0, 0xFFFF },
+  { 0x000E, 0x007C, 0xFFFF },
+  { 0x035F, 0x2BF0, 0xFFFF },
+  { 0x0000, 0xFFFF, 0xFFFF },
+  { 0x0201, 0x2BF8, 0xFFFF },
+  { 0x0152, 0x2C16, 0xFFFF },
+  { 0x0000, 0xFFFF, 0xFFFF },
+  { 0x0000, 0xFFFF, 0xFFFF },
+  { 0x0000, 0xFFFF, 0xFFFF },
+  { 0x0296, 0x2C27, 0xFFFF },
+  { 0x0345, 0x2C37, 0x2C44 },
+  { 0x0138, 0x2C5B, 0xFFFF },
+  { 0x0089, 0x2C6C, 0xFFFF },
+  { 0x0000, 0xFFFF, 0xFFFF },
+  { 0x032B, 0x2C7F, 0xFFFF },
+  { 0x027C, 0x007C, 0xFFFF },
+  { 0x0000, 0xFFFF, 0xFFFF },
+  { 0x011E, 0x2C8B, 0xFFFF },
+  { 0x006F, 0x007C, 0xFFFF },
+  { 0x0000, 0xFFFF, 0xFFFF },
+  { 0x0311, 0x2C9B, 0xFFFF },
+  { 0x0262, 0x2CAC, 0xFFFF },
+  { 0x0000, 0xFFFF, 0xFFFF },
+  { 0x0104, 0x007C, 0xFFFF },
+  { 0x0455, 0x2CD1, 0xFFFF },
+  { 0x0055, 0x2CDF, 0xFFFF },
+  { 0x0000, 0xFFFF, 0xFFFF },
+  { 0x0248, 0x2CE7, 0xFFFF },
+  { 0x0199, 0x2D01, 0xFFFF },
+  { 0x043B, 0x007C, 0xFFFF },
+  { 0x003B, 0x2D16, 0xFFFF },
+  { 0x0000, 0xFFFF, 0xFFFF },
+  { 0x022E, 0x2D1F, 0xFFFF },
+  { 0x017F, 0x2D2B, 0xFFFF },
+  { 0x038C, 0x2D35, 0xFFFF },
+  { 0x0021, 0x2D3B, 0xFFFF },
+  { 0x0421, 0x2D44, 0xFFFF },
+  { 0x0372, 0x2D5C, 0xFFFF },
+  { 0x0000, 0xFFFF, 0xFFFF },
+  { 0x0165, 0x2D64, 0xFFFF },
+  { 0x0214, 0x2D6A, 0xFFFF },
+  { 0x0007, 0x2D87, 0xFFFF },
+  { 0x0407, 0x2D91, 0xFFFF },
+  { 0x0358, 0x2DA0, 0xFFFF },
+  { 0x0000, 0xFFFF, 0xFFFF },
+  { 0x014B, 0x2DB0, 0xFFFF },
+  { 0x0000, 0xFFFF, 0xFFFF },
+  { 0x009C, 0x2DBB, 0xFFFF },
+  { 0x033E, 0x2DD5, 0xFFFF },
+  { 0x0000, 0xFFFF, 0xFFFF },
+  { 0x028F, 0x2DD8, 0xFFFF },
+  { 0x0082, 0x007C, 0xFFFF },
+  { 0x0131, 0x2DE7, 0xFFFF },
+  { 0x0324, 0x007C, 0xFFFF },
+  { 0x0000, 0xFFFF, 0xFFFF },
+  { 0x0275, 0x2DEE, 0xFFFF },
+  { 0x0000, 0xFFFF, 0xFFFF },
+  { 0x0000, 0xFFFF, 0xFFFF },
+  { 0x0117, 0x2E00, 0xFFFF },
+  { 0x0068, 0x2E07, 0xFFFF },
+  { 0x0000, 0xFFFF, 0xFFFF },
+  { 0x030A, 0x2E24, 0xFFFF },
+  { 0x025B, 0x2E2A, 0xFFFF },
+  { 0x0000, 0xFFFF, 0xFFFF },
+  { 0x039F, 0x2E45, 0xFFFF },
+  { 0x044E, 0x2E57, 0xFFFF },
+  { 0x004E, 0x2E85, 0xFFFF },
+  { 0x0000, 0xFFFF, 0xFFFF },
+  { 0x0241, 0x2E91, 0xFFFF },
+  { 0x0192, 0x2E99, 0xFFFF },
+  { 0x0227, 0x007C, 0xFFFF },
+  { 0x0034, 0x2EA6, 0xFFFF },
+  { 0x0385, 0x2EBD, 0xFFFF },
+  { 0x0434, 0x007C, 0xFFFF },
+  { 0x0000, 0xFFFF, 0xFFFF },
+  { 0x0000, 0xFFFF, 0xFFFF },
+  { 0x0178, 0x2ED0, 0xFFFF },
+  { 0x001A, 0x2EE8, 0x2EEE },
+  { 0x036B, 0x2F04, 0xFFFF },
+  { 0x041A, 0x2F16, 0xFFFF },
+  { 0x020D, 0x2F2B, 0xFFFF },
+  { 0x015E, 0x2F3C, 0xFFFF },
+  { 0x0000, 0xFFFF, 0xFFFF },
+};
@@ -0,0 +1,889 @@
+/****************************************************************************
+ *
+ * Description: Compressed time-series store for Meter Reports.
+ *
+ ****************************************************************************/
+
+/****************************************************************************/
+/*                              INCLUDE FILES                               */
+/****************************************************************************/
+#include <stdlib.h>
+#include <string.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <ZW_typedefs.h>
+#include <ZW_classcmd.h>
+#include <ZW_meter_store.h>
+
+/****************************************************************************/
+/*                      PRIVATE TYPES and DEFINITIONS                       */
+/****************************************************************************/
+
+#define FILE_MAGIC            0x544D575AUL   /* "ZWMT" */
+#define FILE_VERSION          1
+#define BLOCK_MAGIC           0x4B4C4231UL   /* "1BLK" */
+
+/* Worst case bits of one encoded point: two 4 bit prefixes with 33 bit values */
+#define POINT_MAX_BITS        74
+
+#define INITIAL_SERIES        64
+#define INITIAL_BLOCKS        8
+
+/* Header at the start of the file. Stored in host byte order */
+typedef struct _FILE_HEADER_
+{
+  uint32_t magic;
+  uint32_t version;
+  uint64_t reserved;
+} FILE_HEADER;
+
+/* Header preceding every block payload. Stored in host byte order */
+typedef struct _BLOCK_HEADER_
+{
+  uint32_t magic;
+  uint16_t payloadBytes;
+  uint16_t count;           /* Points in the block, including the first */
+  uint64_t key;
+  uint32_t firstTimestamp;
+  uint32_t lastTimestamp;
+  int32_t  firstValue;
+  uint8_t  precision;
+  uint8_t  reserved[3];
+} BLOCK_HEADER;
+
+/* Location of a flushed block */
+typedef struct _BLOCK_REF_
+{
+  uint64_t offset;
+  uint32_t firstTimestamp;
+  uint32_t lastTimestamp;
+} BLOCK_REF;
+
+/* Block being filled */
+typedef struct _OPEN_BLOCK_
+{
+  BLOCK_HEADER header;
+  uint32_t bitPos;
+  int64_t  lastDelta;       /* Timestamp delta of the last point */
+  int32_t  lastValue;
+  uint8_t  payload[METER_STORE_BLOCK_BYTES];
+} OPEN_BLOCK;
+
+typedef struct _SERIES_
+{
+  uint64_t key;
+  BLOCK_REF *pBlocks;
+  uint32_t blockCount;
+  uint32_t blockCapacity;
+  uint32_t lastTimestamp;   /* Last point across all blocks */
+  int32_t  lastValue;
+  BOOL     hasPoints;
+  /* Fields of the last stored report, used for duplicate detection */
+  BOOL     hasReport;
+  uint16_t reportDeltaTime;
+  uint32_t reportTimestamp;
+  int32_t  reportValue;
+  int32_t  reportPrevious;
+  OPEN_BLOCK *pOpen;        /* NULL when no block is being filled */
+} SERIES;
+
+struct _METER_STORE_
+{
+  int fd;
+  uint64_t fileSize;
+  const uint8_t *pMap;
+  size_t mapSize;
+  SERIES *pSeries;
+  uint32_t seriesCount;
+  uint32_t seriesCapacity;
+  uint32_t *pHash;          /* Open addressing, series index + 1, 0 = empty */
+  uint32_t hashCapacity;    /* Power of two */
+};
+
+/* Bit stream cursor */
+typedef struct _BIT_STREAM_
+{
+  uint8_t *pData;
+  const uint8_t *pRead;
+  uint32_t bitPos;
+} BIT_STREAM;
+
+/****************************************************************************/
+/*                           PRIVATE FUNCTIONS                              */
+/****************************************************************************/
+
+static void
+BitsWrite(
+  BIT_STREAM *pStream,
+  uint64_t value,
+  uint8_t bits)
+{
+  while (bits--)
+  {
+    uint32_t byte = pStream->bitPos >> 3;
+    uint8_t mask = (uint8_t)(0x80 >> (pStream->bitPos & 7));
+
+    if (0 == (pStream->bitPos & 7))
+    {
+      pStream->pData[byte] = 0;
+    }
+    if ((value >> bits) & 1)
+    {
+      pStream->pData[byte] |= mask;
+    }
+    pStream->bitPos++;
+  }
+}
+
+static uint64_t
+BitsRead(
+  BIT_STREAM *pStream,
+  uint8_t bits)
+{
+  uint64_t value = 0;
+
+  while (bits--)
+  {
+    value = (value << 1) | ((pStream->pRead[pStream->bitPos >> 3] >> (7 - (pStream->bitPos & 7))) & 1);
+    pStream->bitPos++;
+  }
+  return value;
+}
+
+static uint64_t
+ZigZag(int64_t v)
+{
+  return ((uint64_t)v << 1) ^ (uint64_t)(v >> 63);
+}
+
+static int64_t
+UnZigZag(uint64_t u)
+{
+  return (int64_t)(u >> 1) ^ -(int64_t)(u & 1);
+}
+
+/* Prefix code used for both timestamps and values:
+ * '0' zero, '10' + b1 bits, '110' + b2 bits, '1110' + b3 bits, '1111' + 33 bits */
+static void
+WriteCode(
+  BIT_STREAM *pStream,
+  int64_t v,
+  const uint8_t *pWidths)
+{
+  uint64_t u = ZigZag(v);
+
+  if (0 == u)
+  {
+    BitsWrite(pStream, 0, 1);
+  }
+  else if (u < ((uint64_t)1 << pWidths[0]))
+  {
+    BitsWrite(pStream, 0x2, 2);
+    BitsWrite(pStream, u, pWidths[0]);
+  }
+  else if (u < ((uint64_t)1 << pWidths[1]))
+  {
+    BitsWrite(pStream, 0x6, 3);
+    BitsWrite(pStream, u, pWidths[1]);
+  }
+  else if (u < ((uint64_t)1 << pWidths[2]))
+  {
+    BitsWrite(pStream, 0xE, 4);
+    BitsWrite(pStream, u, pWidths[2]);
+  }
+  else
+  {
+    BitsWrite(pStream, 0xF, 4);
+    BitsWrite(pStream, u, 33);
+  }
+}
+
+static int64_t
+ReadCode(
+  BIT_STREAM *pStream,
+  const uint8_t *pWidths)
+{
+  uint8_t ones = 0;
+
+  while (ones < 4 && BitsRead(pStream, 1))
+  {
+    ones++;
+  }
+  if (0 == ones)
+  {
+    return 0;
+  }
+  return UnZigZag(BitsRead(pStream, (4 == ones) ? 33 : pWidths[ones - 1]));
+}
+
+/* Delta-of-delta timestamps are usually tiny, value deltas span wider ranges */
+static const uint8_t timestampWidths[3] = { 7, 9, 12 };
+static const uint8_t valueWidths[3] = { 6, 13, 20 };
+
+static uint32_t
+HashKey(uint64_t key)
+{
+  key ^= key >> 33;
+  key *= 0xFF51AFD7ED558CCDULL;
+  key ^= key >> 33;
+  return (uint32_t)key;
+}
+
+static E_METER_STORE_STATUS
+HashInsert(
+  METER_STORE *pStore,
+  uint64_t key,
+  uint32_t seriesIndex)
+{
+  uint32_t mask;
+  uint32_t pos;
+
+  if ((pStore->seriesCount + 1) * 2 > pStore->hashCapacity)
+  {
+    /* Keep the load factor below one half */
+    uint32_t capacity = pStore->hashCapacity ? pStore->hashCapacity * 2 : INITIAL_SERIES * 2;
+    uint32_t *pHash = calloc(capacity, sizeof(uint32_t));
+    uint32_t i;
+
+    if (NULL == pHash)
+    {
+      return METER_STORE_NO_MEMORY;
+    }
+    for (i = 0; i < pStore->seriesCount; i++)
+    {
+      pos = HashKey(pStore->pSeries[i].key) & (capacity - 1);
+      while (pHash[pos])
+      {
+        pos = (pos + 1) & (capacity - 1);
+      }
+      pHash[pos] = i + 1;
+    }
+    free(pStore->pHash);
+    pStore->pHash = pHash;
+    pStore->hashCapacity = capacity;
+  }
+  mask = pStore->hashCapacity - 1;
+  pos = HashKey(key) & mask;
+  while (pStore->pHash[pos])
+  {
+    pos = (pos + 1) & mask;
+  }
+  pStore->pHash[pos] = seriesIndex + 1;
+  return METER_STORE_OK;
+}
+
+static SERIES *
+SeriesFind(
+  const METER_STORE *pStore,
+  uint64_t key)
+{
+  uint32_t mask = pStore->hashCapacity - 1;
+  uint32_t pos;
+
+  if (0 == pStore->hashCapacity)
+  {
+    return NULL;
+  }
+  pos = HashKey(key) & mask;
+  while (pStore->pHash[pos])
+  {
+    SERIES *pSeries = &pStore->pSeries[pStore->pHash[pos] - 1];
+    if (pSeries->key == key)
+    {
+      return pSeries;
+    }
+    pos = (pos + 1) & mask;
+  }
+  return NULL;
+}
+
+static SERIES *
+SeriesGet(
+  METER_STORE *pStore,
+  uint64_t key)
+{
+  SERIES *pSeries = SeriesFind(pStore, key);
+
+  if (pSeries)
+  {
+    return pSeries;
+  }
+  if (pStore->seriesCount == pStore->seriesCapacity)
+  {
+    uint32_t capacity = pStore->seriesCapacity ? pStore->seriesCapacity * 2 : INITIAL_SERIES;
+    SERIES *pNew = realloc(pStore->pSeries, capacity * sizeof(SERIES));
+    if (NULL == pNew)
+    {
+      return NULL;
+    }
+    pStore->pSeries = pNew;
+    pStore->seriesCapacity = capacity;
+  }
+  if (METER_STORE_OK != HashInsert(pStore, key, pStore->seriesCount))
+  {
+    return NULL;
+  }
+  pSeries = &pStore->pSeries[pStore->seriesCount++];
+  memset(pSeries, 0, sizeof(*pSeries));
+  pSeries->key = key;
+  return pSeries;
+}
+
+static E_METER_STORE_STATUS
+SeriesAddBlock(
+  SERIES *pSeries,
+  uint64_t offset,
+  uint32_t firstTimestamp,
+  uint32_t lastTimestamp)
+{
+  if (pSeries->blockCount == pSeries->blockCapacity)
+  {
+    uint32_t capacity = pSeries->blockCapacity ? pSeries->blockCapacity * 2 : INITIAL_BLOCKS;
+    BLOCK_REF *pNew = realloc(pSeries->pBlocks, capacity * sizeof(BLOCK_REF));
+    if (NULL == pNew)
+    {
+      return METER_STORE_NO_MEMORY;
+    }
+    pSeries->pBlocks = pNew;
+    pSeries->blockCapacity = capacity;
+  }
+  pSeries->pBlocks[pSeries->blockCount].offset = offset;
+  pSeries->pBlocks[pSeries->blockCount].firstTimestamp = firstTimestamp;
+  pSeries->pBlocks[pSeries->blockCount].lastTimestamp = lastTimestamp;
+  pSeries->blockCount++;
+  return METER_STORE_OK;
+}
+
+/* Append the open block of a series to the file */
+static E_METER_STORE_STATUS
+SeriesFlush(
+  METER_STORE *pStore,
+  SERIES *pSeries)
+{
+  OPEN_BLOCK *pOpen = pSeries->pOpen;
+  uint64_t offset = pStore->fileSize;
+  size_t length;
+
+  if (NULL == pOpen)
+  {
+    return METER_STORE_OK;
+  }
+  pOpen->header.payloadBytes = (uint16_t)((pOpen->bitPos + 7) >> 3);
+  length = sizeof(BLOCK_HEADER) + pOpen->header.payloadBytes;
+  if (pwrite(pStore->fd, &pOpen->header, sizeof(BLOCK_HEADER), (off_t)offset) != (ssize_t)sizeof(BLOCK_HEADER)
+      || pwrite(pStore->fd, pOpen->payload, pOpen->header.payloadBytes, (off_t)(offset + sizeof(BLOCK_HEADER)))
+         != (ssize_t)pOpen->header.payloadBytes)
+  {
+    return METER_STORE_IO_ERROR;
+  }
+  pStore->fileSize += length;
+  if (METER_STORE_OK != SeriesAddBlock(pSeries, offset, pOpen->header.firstTimestamp, pOpen->header.lastTimestamp))
+  {
+    return METER_STORE_NO_MEMORY;
+  }
+  free(pOpen);
+  pSeries->pOpen = NULL;
+  return METER_STORE_OK;
+}
+
+/* Make sure the read-only mapping covers all flushed blocks */
+static E_METER_STORE_STATUS
+MapRefresh(METER_STORE *pStore)
+{
+  void *pMap;
+
+  if (pStore->mapSize >= pStore->fileSize)
+  {
+    return METER_STORE_OK;
+  }
+  if (pStore->pMap)
+  {
+    munmap((void *)pStore->pMap, pStore->mapSize);
+    pStore->pMap = NULL;
+    pStore->mapSize = 0;
+  }
+  pMap = mmap(NULL, (size_t)pStore->fileSize, PROT_READ, MAP_SHARED, pStore->fd, 0);
+  if (MAP_FAILED == pMap)
+  {
+    return METER_STORE_IO_ERROR;
+  }
+  pStore->pMap = pMap;
+  pStore->mapSize = (size_t)pStore->fileSize;
+  return METER_STORE_OK;
+}
+
+/* Decode one block and visit the points within range. Returns FALSE if stopped */
+static BOOL
+VisitBlock(
+  const BLOCK_HEADER *pHeader,
+  const uint8_t *pPayload,
+  uint32_t fromTimestamp,
+  uint32_t toTimestamp,
+  METER_STORE_VISIT_FUNC pVisit,
+  void *pUser)
+{
+  BIT_STREAM stream;
+  uint32_t timestamp = pHeader->firstTimestamp;
+  int64_t delta = 0;
+  int32_t value = pHeader->firstValue;
+  uint16_t i;
+
+  stream.pRead = pPayload;
+  stream.bitPos = 0;
+  for (i = 0; i < pHeader->count; i++)
+  {
+    if (i)
+    {
+      delta += ReadCode(&stream, timestampWidths);
+      timestamp = (uint32_t)(timestamp + delta);
+      value = (int32_t)(value + ReadCode(&stream, valueWidths));
+    }
+    if (timestamp > toTimestamp)
+    {
+      return FALSE;
+    }
+    if (timestamp >= fromTimestamp && !pVisit(pUser, timestamp, value, pHeader->precision))
+    {
+      return FALSE;
+    }
+  }
+  return TRUE;
+}
+
+/* Visitor keeping the value of the last point of a block */
+static BOOL
+LastValueVisit(
+  void *pUser,
+  uint32_t timestamp,
+  int32_t rawValue,
+  uint8_t precision)
+{
+  (void)timestamp;
+  (void)precision;
+  *(int32_t *)pUser = rawValue;
+  return TRUE;
+}
+
+/* Rebuild the series index from the block headers of an existing file */
+static E_METER_STORE_STATUS
+ScanBlocks(METER_STORE *pStore)
+{
+  uint64_t offset = sizeof(FILE_HEADER);
+  E_METER_STORE_STATUS status = MapRefresh(pStore);
+  uint32_t i;
+
+  if (METER_STORE_OK != status)
+  {
+    return status;
+  }
+  while (offset + sizeof(BLOCK_HEADER) <= pStore->fileSize)
+  {
+    BLOCK_HEADER header;
+    SERIES *pSeries;
+
+    memcpy(&header, pStore->pMap + offset, sizeof(header));
+    if (BLOCK_MAGIC != header.magic || 0 == header.count
+        || offset + sizeof(BLOCK_HEADER) + header.payloadBytes > pStore->fileSize)
+    {
+      break;
+    }
+    pSeries = SeriesGet(pStore, header.key);
+    if (NULL == pSeries
+        || METER_STORE_OK != SeriesAddBlock(pSeries, offset, header.firstTimestamp, header.lastTimestamp))
+    {
+      return METER_STORE_NO_MEMORY;
+    }
+    pSeries->lastTimestamp = header.lastTimestamp;
+    pSeries->hasPoints = TRUE;
+    offset += sizeof(BLOCK_HEADER) + header.payloadBytes;
+  }
+  /* The last value of a series is only in the payload of its last block */
+  for (i = 0; i < pStore->seriesCount; i++)
+  {
+    SERIES *pSeries = &pStore->pSeries[i];
+    const uint8_t *pBlock = pStore->pMap + pSeries->pBlocks[pSeries->blockCount - 1].offset;
+    BLOCK_HEADER header;
+
+    memcpy(&header, pBlock, sizeof(header));
+    VisitBlock(&header, pBlock + sizeof(BLOCK_HEADER), 0, 0xFFFFFFFFUL, LastValueVisit, &pSeries->lastValue);
+  }
+  if (offset != pStore->fileSize)
+  {
+    /* Drop a block torn by a crash */
+    if (0 != ftruncate(pStore->fd, (off_t)offset))
+    {
+      return METER_STORE_IO_ERROR;
+    }
+    munmap((void *)pStore->pMap, pStore->mapSize);
+    pStore->pMap = NULL;
+    pStore->mapSize = 0;
+    pStore->fileSize = offset;
+  }
+  return METER_STORE_OK;
+}
+
+/****************************************************************************/
+/*                           EXPORTED FUNCTIONS                             */
+/****************************************************************************/
+
+E_METER_STORE_STATUS
+MeterStoreOpen(
+  const char *pPath,
+  METER_STORE **ppStore)
+{
+  METER_STORE *pStore = calloc(1, sizeof(METER_STORE));
+  FILE_HEADER header;
+  struct stat st;
+  E_METER_STORE_STATUS status = METER_STORE_IO_ERROR;
+
+  if (NULL == pStore)
+  {
+    return METER_STORE_NO_MEMORY;
+  }
+  pStore->fd = open(pPath, O_RDWR | O_CREAT, 0644);
+  if (pStore->fd < 0 || 0 != fstat(pStore->fd, &st))
+  {
+    goto fail;
+  }
+  if (0 == st.st_size)
+  {
+    header.magic = FILE_MAGIC;
+    header.version = FILE_VERSION;
+    header.reserved = 0;
+    if (pwrite(pStore->fd, &header, sizeof(header), 0) != (ssize_t)sizeof(header))
+    {
+      goto fail;
+    }
+    pStore->fileSize = sizeof(header);
+  }
+  else
+  {
+    if ((size_t)st.st_size < sizeof(header)
+        || pread(pStore->fd, &header, sizeof(header), 0) != (ssize_t)sizeof(header)
+        || FILE_MAGIC != header.magic || FILE_VERSION != header.version)
+    {
+      status = METER_STORE_INVALID;
+      goto fail;
+    }
+    pStore->fileSize = (uint64_t)st.st_size;
+    status = ScanBlocks(pStore);
+    if (METER_STORE_OK != status)
+    {
+      goto fail;
+    }
+  }
+  *ppStore = pStore;
+  return METER_STORE_OK;
+
+fail:
+  if (pStore->pMap)
+  {
+    munmap((void *)pStore->pMap, pStore->mapSize);
+  }
+  if (pStore->fd >= 0)
+  {
+    close(pStore->fd);
+  }
+  while (pStore->seriesCount)
+  {
+    free(pStore->pSeries[--pStore->seriesCount].pBlocks);
+  }
+  free(pStore->pSeries);
+  free(pStore->pHash);
+  free(pStore);
+  return status;
+}
+
+E_METER_STORE_STATUS
+MeterStoreFlush(METER_STORE *pStore)
+{
+  uint32_t i;
+
+  for (i = 0; i < pStore->seriesCount; i++)
+  {
+    E_METER_STORE_STATUS status = SeriesFlush(pStore, &pStore->pSeries[i]);
+    if (METER_STORE_OK != status)
+    {
+      return status;
+    }
+  }
+  return (0 == fdatasync(pStore->fd)) ? METER_STORE_OK : METER_STORE_IO_ERROR;
+}
+
+E_METER_STORE_STATUS
+MeterStoreClose(METER_STORE *pStore)
+{
+  E_METER_STORE_STATUS status;
+  uint32_t i;
+
+  if (NULL == pStore)
+  {
+    return METER_STORE_OK;
+  }
+  status = MeterStoreFlush(pStore);
+  if (pStore->pMap)
+  {
+    munmap((void *)pStore->pMap, pStore->mapSize);
+  }
+  close(pStore->fd);
+  for (i = 0; i < pStore->seriesCount; i++)
+  {
+    free(pStore->pSeries[i].pBlocks);
+    free(pStore->pSeries[i].pOpen);
+  }
+  free(pStore->pSeries);
+  free(pStore->pHash);
+  free(pStore);
+  return status;
+}
+
+E_METER_STORE_STATUS
+MeterStoreAppend(
+  METER_STORE *pStore,
+  uint64_t key,
+  uint32_t timestamp,
+  int32_t rawValue,
+  uint8_t precision)
+{
+  SERIES *pSeries = SeriesGet(pStore, key);
+  OPEN_BLOCK *pOpen;
+  BIT_STREAM stream;
+  int64_t delta;
+
+  if (NULL == pSeries)
+  {
+    return METER_STORE_NO_MEMORY;
+  }
+  if (pSeries->hasPoints && timestamp < pSeries->lastTimestamp)
+  {
+    return METER_STORE_OUT_OF_ORDER;
+  }
+  pOpen = pSeries->pOpen;
+  if (pOpen && (pOpen->header.precision != precision || 0xFFFF == pOpen->header.count
+                || pOpen->bitPos + POINT_MAX_BITS > METER_STORE_BLOCK_BYTES * 8))
+  {
+    E_METER_STORE_STATUS status = SeriesFlush(pStore, pSeries);
+    if (METER_STORE_OK != status)
+    {
+      return status;
+    }
+    pOpen = NULL;
+  }
+  if (NULL == pOpen)
+  {
+    /* The first point of a block is carried raw in the header */
+    pOpen = malloc(sizeof(OPEN_BLOCK));
+    if (NULL == pOpen)
+    {
+      return METER_STORE_NO_MEMORY;
+    }
+    memset(&pOpen->header, 0, sizeof(pOpen->header));
+    pOpen->header.magic = BLOCK_MAGIC;
+    pOpen->header.count = 1;
+    pOpen->header.key = key;
+    pOpen->header.firstTimestamp = timestamp;
+    pOpen->header.lastTimestamp = timestamp;
+    pOpen->header.firstValue = rawValue;
+    pOpen->header.precision = precision;
+    pOpen->bitPos = 0;
+    pOpen->lastDelta = 0;
+    pOpen->lastValue = rawValue;
+    pSeries->pOpen = pOpen;
+  }
+  else
+  {
+    stream.pData = pOpen->payload;
+    stream.bitPos = pOpen->bitPos;
+    delta = (int64_t)timestamp - pOpen->header.lastTimestamp;
+    WriteCode(&stream, delta - pOpen->lastDelta, timestampWidths);
+    WriteCode(&stream, (int64_t)rawValue - pOpen->lastValue, valueWidths);
+    pOpen->bitPos = stream.bitPos;
+    pOpen->lastDelta = delta;
+    pOpen->lastValue = rawValue;
+    pOpen->header.lastTimestamp = timestamp;
+    pOpen->header.count++;
+  }
+  pSeries->lastTimestamp = timestamp;
+  pSeries->lastValue = rawValue;
+  pSeries->hasPoints = TRUE;
+  return METER_STORE_OK;
+}
+
+E_METER_STORE_STATUS
+MeterStoreAppendReport(
+  METER_STORE *pStore,
+  uint8_t nodeId,
+  uint8_t endpoint,
+  const uint8_t *pFrame,
+  uint8_t frameLength,
+  uint32_t timestamp)
+{
+  SERIES *pSeries;
+  uint64_t key;
+  uint16_t scale;
+  uint16_t deltaTime = 0;
+  int32_t value = 0;
+  int32_t previous = 0;
+  BOOL hasPrevious = FALSE;
+  uint8_t size;
+  uint8_t precision;
+  uint8_t pos;
+  uint8_t i;
+
+  if (frameLength < 5 || COMMAND_CLASS_METER_V5 != pFrame[0] || METER_REPORT_V5 != pFrame[1])
+  {
+    return METER_STORE_INVALID;
+  }
+  size = pFrame[3] & METER_REPORT_PROPERTIES2_SIZE_MASK_V5;
+  precision = (uint8_t)(pFrame[3] >> 5);
+  if ((1 != size && 2 != size && 4 != size) || frameLength < 4 + size)
+  {
+    return METER_STORE_INVALID;
+  }
+  scale = (uint16_t)(((pFrame[2] & METER_REPORT_PROPERTIES1_SCALE_BIT_2_BIT_MASK_V5) >> 5)
+                     | ((pFrame[3] & METER_REPORT_PROPERTIES2_SCALE_BITS_10_MASK_V5)
+                        >> METER_REPORT_PROPERTIES2_SCALE_BITS_10_SHIFT_V5));
+  for (i = 0; i < size; i++)
+  {
+    value = (int32_t)(((uint32_t)value << 8) | pFrame[4 + i]);
+  }
+  /* Sign extend 1 and 2 byte values */
+  value = (int32_t)((uint32_t)value << (32 - 8 * size)) >> (32 - 8 * size);
+  pos = (uint8_t)(4 + size);
+
+  /* Version 2+: delta time and, if non zero, the previous value */
+  if (frameLength >= pos + 2)
+  {
+    deltaTime = (uint16_t)((pFrame[pos] << 8) | pFrame[pos + 1]);
+    pos = (uint8_t)(pos + 2);
+    if (deltaTime && frameLength >= pos + size)
+    {
+      for (i = 0; i < size; i++)
+      {
+        previous = (int32_t)(((uint32_t)previous << 8) | pFrame[pos + i]);
+      }
+      previous = (int32_t)((uint32_t)previous << (32 - 8 * size)) >> (32 - 8 * size);
+      hasPrevious = TRUE;
+      pos = (uint8_t)(pos + size);
+    }
+  }
+  /* Version 4+: scale 7 is extended by the Scale 2 byte */
+  if (7 == scale && frameLength > pos)
+  {
+    scale = (uint16_t)(8 + pFrame[pos]);
+  }
+  key = METER_STORE_KEY(nodeId, endpoint, pFrame[2] & METER_REPORT_PROPERTIES1_METER_TYPE_MASK_V5, scale,
+                        (pFrame[2] & METER_REPORT_PROPERTIES1_RATE_TYPE_MASK_V5) >> METER_REPORT_PROPERTIES1_RATE_TYPE_SHIFT_V5);
+  pSeries = SeriesGet(pStore, key);
+  if (NULL == pSeries)
+  {
+    return METER_STORE_NO_MEMORY;
+  }
+
+  /* Same reading reported again (poll answered twice, retransmission): all
+   * fields repeat and less than delta time has passed, so the meter cannot
+   * have taken a new reading in between */
+  if (pSeries->hasReport && hasPrevious && value == pSeries->reportValue
+      && deltaTime == pSeries->reportDeltaTime && previous == pSeries->reportPrevious
+      && timestamp - pSeries->reportTimestamp < deltaTime)
+  {
+    return METER_STORE_DUPLICATE;
+  }
+  pSeries->hasReport = hasPrevious;
+  pSeries->reportTimestamp = timestamp;
+  pSeries->reportValue = value;
+  pSeries->reportDeltaTime = deltaTime;
+  pSeries->reportPrevious = previous;
+
+  /* Recover the previous reading if it was never stored */
+  if (hasPrevious && deltaTime < timestamp)
+  {
+    uint32_t previousTimestamp = timestamp - deltaTime;
+    if (!pSeries->hasPoints
+        || (previousTimestamp > pSeries->lastTimestamp && previous != pSeries->lastValue))
+    {
+      E_METER_STORE_STATUS status = MeterStoreAppend(pStore, key, previousTimestamp, previous, precision);
+      if (METER_STORE_OK != status && METER_STORE_OUT_OF_ORDER != status)
+      {
+        return status;
+      }
+    }
+  }
+  return MeterStoreAppend(pStore, key, timestamp, value, precision);
+}
+
+E_METER_STORE_STATUS
+MeterStoreQuery(
+  METER_STORE *pStore,
+  uint64_t key,
+  uint32_t fromTimestamp,
+  uint32_t toTimestamp,
+  METER_STORE_VISIT_FUNC pVisit,
+  void *pUser)
+{
+  const SERIES *pSeries = SeriesFind(pStore, key);
+  uint32_t low;
+  uint32_t high;
+
+  if (NULL == pSeries)
+  {
+    return METER_STORE_OK;
+  }
+  if (pSeries->blockCount)
+  {
+    E_METER_STORE_STATUS status = MapRefresh(pStore);
+    if (METER_STORE_OK != status)
+    {
+      return status;
+    }
+  }
+  /* Blocks of a series are in time order, find the first one ending in range */
+  low = 0;
+  high = pSeries->blockCount;
+  while (low < high)
+  {
+    uint32_t mid = (low + high) / 2;
+    if (pSeries->pBlocks[mid].lastTimestamp < fromTimestamp)
+    {
+      low = mid + 1;
+    }
+    else
+    {
+      high = mid;
+    }
+  }
+  for (; low < pSeries->blockCount; low++)
+  {
+    const uint8_t *pBlock = pStore->pMap + pSeries->pBlocks[low].offset;
+    BLOCK_HEADER header;
+
+    if (pSeries->pBlocks[low].firstTimestamp > toTimestamp)
+    {
+      return METER_STORE_OK;
+    }
+    memcpy(&header, pBlock, sizeof(header));
+    if (!VisitBlock(&header, pBlock + sizeof(BLOCK_HEADER), fromTimestamp, toTimestamp, pVisit, pUser))
+    {
+      return METER_STORE_OK;
+    }
+  }
+  if (pSeries->pOpen && pSeries->pOpen->header.lastTimestamp >= fromTimestamp)
+  {
+    VisitBlock(&pSeries->pOpen->header, pSeries->pOpen->payload, fromTimestamp, toTimestamp, pVisit, pUser);
+  }
+  return METER_STORE_OK;
+}
+
+uint32_t
+MeterStoreSeriesCount(const METER_STORE *pStore)
+{
+  return pStore->seriesCount;
+}
+
+uint64_t
+MeterStoreFileSize(const METER_STORE *pStore)
+{
+  return pStore->fileSize;
+}
@@ -0,0 +1,436 @@
+/****************************************************************************
+ *
+ * Description: Bulk historical data fetch pipeline for Meter Table Monitor.
+ *
+ ****************************************************************************/
+
+/****************************************************************************/
+/*                              INCLUDE FILES                               */
+/****************************************************************************/
+#include <string.h>
+#include <ZW_typedefs.h>
+#include <ZW_classcmd.h>
+#include <ZW_meter_tbl_fetch.h>
+
+/****************************************************************************/
+/*                      PRIVATE TYPES and DEFINITIONS                       */
+/****************************************************************************/
+
+/* End of ready queue, node ID 0 is never used for a job */
+#define NO_JOB                       0
+
+/* Dataset fields are 24 bit */
+#define DATASET_MASK                 0x00FFFFFFUL
+
+/* Historical Data Report layout */
+#define REPORT_HEADER_LENGTH         14
+#define REPORT_GROUP_LENGTH          5
+#define REPORT_GROUP_PRECISION_MASK  0xE0
+#define REPORT_GROUP_PRECISION_SHIFT 5
+#define REPORT_GROUP_SCALE_MASK      0x1F
+
+#define SECONDS_PER_DAY              86400UL
+
+/****************************************************************************/
+/*                           PRIVATE FUNCTIONS                              */
+/****************************************************************************/
+
+/* Days since 1970-01-01 of a proleptic Gregorian date */
+static int32_t
+DaysFromCivil(
+  int32_t year,
+  uint8_t month,
+  uint8_t day)
+{
+  int32_t era;
+  uint32_t yoe;
+  uint32_t doy;
+  uint32_t doe;
+
+  year -= (month <= 2);
+  era = (year >= 0 ? year : year - 399) / 400;
+  yoe = (uint32_t)(year - era * 400);
+  doy = (153u * (month + (month > 2 ? -3 : 9)) + 2u) / 5u + day - 1u;
+  doe = yoe * 365u + yoe / 4u - yoe / 100u + doy;
+  return era * 146097 + (int32_t)doe - 719468;
+}
+
+static void
+CivilFromDays(
+  int32_t days,
+  uint16_t *pYear,
+  uint8_t *pMonth,
+  uint8_t *pDay)
+{
+  int32_t era;
+  uint32_t doe;
+  uint32_t yoe;
+  uint32_t doy;
+  uint32_t mp;
+  int32_t year;
+
+  days += 719468;
+  era = (days >= 0 ? days : days - 146096) / 146097;
+  doe = (uint32_t)(days - era * 146097);
+  yoe = (doe - doe / 1460u + doe / 36524u - doe / 146096u) / 365u;
+  year = (int32_t)yoe + era * 400;
+  doy = doe - (365u * yoe + yoe / 4u - yoe / 100u);
+  mp = (5u * doy + 2u) / 153u;
+  *pDay = (uint8_t)(doy - (153u * mp + 2u) / 5u + 1u);
+  *pMonth = (uint8_t)(mp < 10 ? mp + 3 : mp - 9);
+  *pYear = (uint16_t)(year + (*pMonth <= 2));
+}
+
+/* Write Year(2) Month Day Hour Minute Second */
+static void
+WriteDateTime(
+  uint8_t *pOut,
+  uint32_t seconds)
+{
+  uint32_t secondOfDay = seconds % SECONDS_PER_DAY;
+  uint16_t year;
+  uint8_t month;
+  uint8_t day;
+
+  CivilFromDays((int32_t)(seconds / SECONDS_PER_DAY), &year, &month, &day);
+  pOut[0] = (uint8_t)(year >> 8);
+  pOut[1] = (uint8_t)year;
+  pOut[2] = month;
+  pOut[3] = day;
+  pOut[4] = (uint8_t)(secondOfDay / 3600u);
+  pOut[5] = (uint8_t)((secondOfDay / 60u) % 60u);
+  pOut[6] = (uint8_t)(secondOfDay % 60u);
+}
+
+static uint32_t
+ReadDateTime(const uint8_t *pIn)
+{
+  int32_t days = DaysFromCivil((int32_t)((pIn[0] << 8) | pIn[1]), pIn[2], pIn[3]);
+
+  return (uint32_t)days * SECONDS_PER_DAY + pIn[4] * 3600u + pIn[5] * 60u + pIn[6];
+}
+
+static void
+ReadyPush(
+  METER_TBL_FETCH *pFetch,
+  uint8_t nodeId,
+  BOOL front)
+{
+  METER_TBL_JOB *pJob = &pFetch->jobs[nodeId];
+
+  pJob->state = METER_TBL_JOB_PENDING;
+  if (pJob->queued)
+  {
+    return;
+  }
+  pJob->queued = TRUE;
+  pJob->next = NO_JOB;
+  if (NO_JOB == pFetch->readyHead)
+  {
+    pFetch->readyHead = nodeId;
+    pFetch->readyTail = nodeId;
+  }
+  else if (front)
+  {
+    pJob->next = pFetch->readyHead;
+    pFetch->readyHead = nodeId;
+  }
+  else
+  {
+    pFetch->jobs[pFetch->readyTail].next = nodeId;
+    pFetch->readyTail = nodeId;
+  }
+}
+
+static uint8_t
+ReadyPop(METER_TBL_FETCH *pFetch)
+{
+  uint8_t nodeId = (uint8_t)pFetch->readyHead;
+
+  if (NO_JOB != nodeId)
+  {
+    pFetch->readyHead = pFetch->jobs[nodeId].next;
+    if (NO_JOB == pFetch->readyHead)
+    {
+      pFetch->readyTail = NO_JOB;
+    }
+    pFetch->jobs[nodeId].queued = FALSE;
+  }
+  return nodeId;
+}
+
+static void
+JobFinish(
+  METER_TBL_FETCH *pFetch,
+  uint8_t nodeId,
+  BOOL success)
+{
+  METER_TBL_JOB *pJob = &pFetch->jobs[nodeId];
+
+  pJob->state = success ? METER_TBL_JOB_DONE : METER_TBL_JOB_FAILED;
+  if (pFetch->pDone)
+  {
+    pFetch->pDone(pFetch->pUser, nodeId, success, pJob->rows);
+  }
+}
+
+/* Issue the next request of a job. Returns FALSE if it could not be sent */
+static BOOL
+JobIssue(
+  METER_TBL_FETCH *pFetch,
+  uint8_t nodeId,
+  uint32_t nowMs)
+{
+  METER_TBL_JOB *pJob = &pFetch->jobs[nodeId];
+  uint8_t frame[METER_TBL_FETCH_GET_LENGTH];
+  uint32_t requestStop = pJob->stop;
+
+  if (pJob->intervalSec)
+  {
+    /* Ask for exactly the time span one full request can return */
+    uint64_t span = (uint64_t)pJob->intervalSec * METER_TBL_FETCH_MAX_REPORTS;
+    if ((uint64_t)pJob->cursor + span - 1 < requestStop)
+    {
+      requestStop = (uint32_t)(pJob->cursor + span - 1);
+    }
+  }
+  MeterTblFetchBuildGet(frame, METER_TBL_FETCH_MAX_REPORTS, pJob->datasetMask,
+                        (uint32_t)(pJob->cursor + pJob->utcOffsetSec),
+                        (uint32_t)(requestStop + pJob->utcOffsetSec));
+  if (!pFetch->pSend(pFetch->pUser, nodeId, frame, sizeof(frame)))
+  {
+    return FALSE;
+  }
+  pJob->requestStop = requestStop;
+  pJob->reportsReceived = 0;
+  pJob->lastActivityMs = nowMs;
+  pJob->state = METER_TBL_JOB_IN_FLIGHT;
+  pFetch->inFlight++;
+  return TRUE;
+}
+
+/****************************************************************************/
+/*                           EXPORTED FUNCTIONS                             */
+/****************************************************************************/
+
+void
+MeterTblFetchInit(
+  METER_TBL_FETCH *pFetch,
+  METER_TBL_SINK *pSink,
+  uint8_t maxInFlight,
+  METER_TBL_SEND_FUNC pSend,
+  METER_TBL_DONE_FUNC pDone,
+  void *pUser)
+{
+  memset(pFetch, 0, sizeof(*pFetch));
+  pFetch->pSink = pSink;
+  pFetch->pSend = pSend;
+  pFetch->pDone = pDone;
+  pFetch->pUser = pUser;
+  pFetch->maxInFlight = maxInFlight ? maxInFlight : 1;
+  pFetch->readyHead = NO_JOB;
+  pFetch->readyTail = NO_JOB;
+  pSink->count = 0;
+}
+
+BOOL
+MeterTblFetchStart(
+  METER_TBL_FETCH *pFetch,
+  uint8_t nodeId,
+  uint32_t datasetMask,
+  uint32_t start,
+  uint32_t stop,
+  uint32_t intervalSec,
+  int32_t utcOffsetSec)
+{
+  METER_TBL_JOB *pJob;
+
+  if (0 == nodeId || nodeId > METER_TBL_FETCH_MAX_NODES || 0 == (datasetMask & DATASET_MASK) || stop < start)
+  {
+    return FALSE;
+  }
+  pJob = &pFetch->jobs[nodeId];
+  if (METER_TBL_JOB_PENDING == pJob->state || METER_TBL_JOB_IN_FLIGHT == pJob->state)
+  {
+    return FALSE;
+  }
+  pJob->datasetMask = datasetMask & DATASET_MASK;
+  pJob->cursor = start;
+  pJob->stop = stop;
+  pJob->intervalSec = intervalSec;
+  pJob->utcOffsetSec = utcOffsetSec;
+  pJob->rows = 0;
+  pJob->retries = 0;
+  ReadyPush(pFetch, nodeId, FALSE);
+  return TRUE;
+}
+
+void
+MeterTblFetchPoll(
+  METER_TBL_FETCH *pFetch,
+  uint32_t nowMs)
+{
+  uint16_t nodeId;
+
+  if (pFetch->inFlight)
+  {
+    for (nodeId = 1; nodeId <= METER_TBL_FETCH_MAX_NODES; nodeId++)
+    {
+      METER_TBL_JOB *pJob = &pFetch->jobs[nodeId];
+
+      if (METER_TBL_JOB_IN_FLIGHT != pJob->state
+          || (uint32_t)(nowMs - pJob->lastActivityMs) < METER_TBL_FETCH_TIMEOUT_MS)
+      {
+        continue;
+      }
+      /* Repeat from the cursor; it is moved past the record of every report
+       * accepted, so rows already delivered are not requested again */
+      pFetch->inFlight--;
+      if (pJob->cursor > pJob->stop)
+      {
+        /* Only the last report of the final request was lost */
+        JobFinish(pFetch, (uint8_t)nodeId, TRUE);
+      }
+      else if (++pJob->retries > METER_TBL_FETCH_MAX_RETRIES)
+      {
+        JobFinish(pFetch, (uint8_t)nodeId, FALSE);
+      }
+      else
+      {
+        ReadyPush(pFetch, (uint8_t)nodeId, TRUE);
+      }
+    }
+  }
+  while (pFetch->inFlight < pFetch->maxInFlight && NO_JOB != pFetch->readyHead)
+  {
+    uint8_t next = ReadyPop(pFetch);
+    if (!JobIssue(pFetch, next, nowMs))
+    {
+      ReadyPush(pFetch, next, TRUE);
+      break;
+    }
+  }
+}
+
+BOOL
+MeterTblFetchReport(
+  METER_TBL_FETCH *pFetch,
+  uint8_t nodeId,
+  const uint8_t *pFrame,
+  uint8_t frameLength,
+  uint32_t nowMs)
+{
+  METER_TBL_SINK *pSink = pFetch->pSink;
+  METER_TBL_JOB *pJob;
+  const uint8_t *pGroup;
+  uint32_t dataset;
+  uint32_t timestamp;
+  uint8_t groups;
+  uint8_t bit;
+
+  if (frameLength < REPORT_HEADER_LENGTH || COMMAND_CLASS_METER_TBL_MONITOR_V2 != pFrame[0]
+      || METER_TBL_HISTORICAL_DATA_REPORT_V2 != pFrame[1]
+      || 0 == nodeId || nodeId > METER_TBL_FETCH_MAX_NODES)
+  {
+    return FALSE;
+  }
+  pJob = &pFetch->jobs[nodeId];
+  if (METER_TBL_JOB_IN_FLIGHT != pJob->state)
+  {
+    return FALSE;
+  }
+  dataset = ((uint32_t)pFrame[4] << 16) | ((uint32_t)pFrame[5] << 8) | pFrame[6];
+  groups = (uint8_t)__builtin_popcount(dataset);
+  if (frameLength < REPORT_HEADER_LENGTH + groups * REPORT_GROUP_LENGTH)
+  {
+    return FALSE;
+  }
+  timestamp = (uint32_t)(ReadDateTime(&pFrame[7]) - pJob->utcOffsetSec);
+
+  /* One variant group per dataset bit, in ascending bit order */
+  pGroup = &pFrame[REPORT_HEADER_LENGTH];
+  for (bit = 0; bit < 24; bit++)
+  {
+    uint32_t row;
+
+    if (0 == (dataset & (1UL << bit)))
+    {
+      continue;
+    }
+    if (pJob->datasetMask & (1UL << bit))
+    {
+      if (pSink->count == pSink->capacity)
+      {
+        MeterTblFetchFlush(pFetch);
+      }
+      row = pSink->count++;
+      pSink->pTimestamp[row] = timestamp;
+      pSink->pNodeId[row] = nodeId;
+      pSink->pDataset[row] = bit;
+      pSink->pPrecision[row] = (uint8_t)((pGroup[0] & REPORT_GROUP_PRECISION_MASK) >> REPORT_GROUP_PRECISION_SHIFT);
+      pSink->pScale[row] = pGroup[0] & REPORT_GROUP_SCALE_MASK;
+      pSink->pValue[row] = (int32_t)(((uint32_t)pGroup[1] << 24) | ((uint32_t)pGroup[2] << 16)
+                                     | ((uint32_t)pGroup[3] << 8) | pGroup[4]);
+      pJob->rows++;
+    }
+    pGroup += REPORT_GROUP_LENGTH;
+  }
+  pJob->reportsReceived++;
+  pJob->lastActivityMs = nowMs;
+  pJob->retries = 0;
+  if (timestamp >= pJob->cursor)
+  {
+    /* A repeated request starts after the last record delivered */
+    pJob->cursor = timestamp + 1;
+  }
+
+  if (pFrame[2])
+  {
+    /* Reports to follow */
+    return TRUE;
+  }
+  pFetch->inFlight--;
+  /* A request capped by Maximum Reports continues from the cursor, after the last record */
+  if (pJob->reportsReceived < METER_TBL_FETCH_MAX_REPORTS || timestamp >= pJob->requestStop)
+  {
+    if (pJob->requestStop >= pJob->stop)
+    {
+      JobFinish(pFetch, nodeId, TRUE);
+      return TRUE;
+    }
+    pJob->cursor = pJob->requestStop + 1;
+  }
+  /* Back of the queue so other nodes get their turn */
+  ReadyPush(pFetch, nodeId, FALSE);
+  return TRUE;
+}
+
+void
+MeterTblFetchFlush(METER_TBL_FETCH *pFetch)
+{
+  METER_TBL_SINK *pSink = pFetch->pSink;
+
+  if (pSink->count)
+  {
+    pSink->pFlush(pSink->pUser, pSink);
+    pSink->count = 0;
+  }
+}
+
+void
+MeterTblFetchBuildGet(
+  uint8_t *pFrame,
+  uint8_t maximumReports,
+  uint32_t datasetMask,
+  uint32_t start,
+  uint32_t stop)
+{
+  pFrame[0] = COMMAND_CLASS_METER_TBL_MONITOR_V2;
+  pFrame[1] = METER_TBL_HISTORICAL_DATA_GET_V2;
+  pFrame[2] = maximumReports;
+  pFrame[3] = (uint8_t)(datasetMask >> 16);
+  pFrame[4] = (uint8_t)(datasetMask >> 8);
+  pFrame[5] = (uint8_t)datasetMask;
+  WriteDateTime(&pFrame[6], start);
+  WriteDateTime(&pFrame[13], stop);
+}
@@ -0,0 +1,327 @@
+/****************************************************************************
+ *
+ * Description: Wake-up queue batcher packing queued commands for sleeping
+ *              nodes into Multi Command encapsulation.
+ *
+ ****************************************************************************/
+
+/****************************************************************************/
+/*                              INCLUDE FILES                               */
+/****************************************************************************/
+#include <string.h>
+#include <ZW_typedefs.h>
+#include <ZW_classcmd.h>
+#include <ZW_multi_cmd_batcher.h>
+
+/****************************************************************************/
+/*                      PRIVATE TYPES and DEFINITIONS                       */
+/****************************************************************************/
+
+/* Default link model: 100 kbit/s, 40 byte preamble + SOF + 9 byte header + CRC16 */
+#define DEFAULT_BIT_RATE          100000
+#define DEFAULT_FRAME_OVERHEAD    52
+#define DEFAULT_ACK_LENGTH        52
+#define DEFAULT_TURNAROUND_US     5000
+#define DEFAULT_S0_NONCE_FRAMES   2
+
+/****************************************************************************/
+/*                           PRIVATE FUNCTIONS                              */
+/****************************************************************************/
+
+/* Commands that must not be carried inside Multi Command */
+static BOOL
+IsStandalone(const MULTI_CMD_ENTRY *pEntry)
+{
+  uint8_t cmdClass = pEntry->command[0];
+
+  if (pEntry->flags & MULTI_CMD_FLAG_STANDALONE)
+  {
+    return TRUE;
+  }
+  switch (cmdClass)
+  {
+    case COMMAND_CLASS_MULTI_CMD:
+    case COMMAND_CLASS_SECURITY:
+    case COMMAND_CLASS_SECURITY_2:
+    case COMMAND_CLASS_TRANSPORT_SERVICE_V2:
+    case COMMAND_CLASS_CRC_16_ENCAP:
+      return TRUE;
+    case COMMAND_CLASS_SUPERVISION:
+      return (pEntry->length > 1 && SUPERVISION_GET == pEntry->command[1]) ? TRUE : FALSE;
+    default:
+      return FALSE;
+  }
+}
+
+/* Airtime in microseconds of one frame carrying payloadLength bytes, including its ACK */
+static uint32_t
+FrameAirtimeUs(
+  const BATCHER_LINK_MODEL *pLink,
+  uint16_t payloadLength)
+{
+  uint32_t bits = 8u * ((uint32_t)pLink->frameOverhead + payloadLength + pLink->ackLength);
+  return (uint32_t)(((uint64_t)bits * 1000000u) / pLink->bitRate);
+}
+
+/* Airtime of a frame sent with securityKey, including nonce exchange for S0 */
+static uint32_t
+SecureFrameAirtimeUs(
+  const MULTI_CMD_BATCHER *pBatcher,
+  uint8_t securityKey,
+  uint16_t payloadLength)
+{
+  const BATCHER_LINK_MODEL *pLink = &pBatcher->link;
+  uint32_t airtime = FrameAirtimeUs(pLink, (uint16_t)(payloadLength + pBatcher->overhead[securityKey]));
+
+  if (SECURITY_KEY_S0 == securityKey)
+  {
+    /* Nonce Get (2 bytes) and Nonce Report (10 bytes) */
+    airtime += (uint32_t)pLink->s0NonceFrames * FrameAirtimeUs(pLink, 6);
+  }
+  return airtime;
+}
+
+/* Time the node stays awake for one frame exchange */
+static uint32_t
+FrameAwakeUs(
+  const MULTI_CMD_BATCHER *pBatcher,
+  uint8_t securityKey,
+  uint16_t payloadLength)
+{
+  uint32_t frames = 1;
+
+  if (SECURITY_KEY_S0 == securityKey)
+  {
+    frames += pBatcher->link.s0NonceFrames;
+  }
+  return SecureFrameAirtimeUs(pBatcher, securityKey, payloadLength) + frames * pBatcher->link.turnaroundUs;
+}
+
+static void
+EntryFree(
+  MULTI_CMD_BATCHER *pBatcher,
+  uint16_t index)
+{
+  pBatcher->pEntries[index].next = pBatcher->freeHead;
+  pBatcher->freeHead = index;
+}
+
+/****************************************************************************/
+/*                           EXPORTED FUNCTIONS                             */
+/****************************************************************************/
+
+void
+MultiCmdBatcherInit(
+  MULTI_CMD_BATCHER *pBatcher,
+  MULTI_CMD_ENTRY *pEntries,
+  uint16_t entryCount)
+{
+  uint16_t i;
+
+  memset(pBatcher, 0, sizeof(*pBatcher));
+  if (entryCount >= MULTI_CMD_NO_ENTRY)
+  {
+    entryCount = MULTI_CMD_NO_ENTRY - 1;
+  }
+  pBatcher->pEntries = pEntries;
+  pBatcher->entryCount = entryCount;
+  pBatcher->freeHead = entryCount ? 0 : MULTI_CMD_NO_ENTRY;
+  for (i = 0; i < entryCount; i++)
+  {
+    pEntries[i].next = (uint16_t)((i + 1 < entryCount) ? i + 1 : MULTI_CMD_NO_ENTRY);
+  }
+  for (i = 0; i <= MULTI_CMD_MAX_NODES; i++)
+  {
+    pBatcher->nodes[i].head = MULTI_CMD_NO_ENTRY;
+    pBatcher->nodes[i].tail = MULTI_CMD_NO_ENTRY;
+  }
+  pBatcher->overhead[SECURITY_KEY_S2_UNAUTHENTICATED] = MULTI_CMD_S2_OVERHEAD;
+  pBatcher->overhead[SECURITY_KEY_S2_AUTHENTICATED] = MULTI_CMD_S2_OVERHEAD;
+  pBatcher->overhead[SECURITY_KEY_S2_ACCESS] = MULTI_CMD_S2_OVERHEAD;
+  pBatcher->overhead[SECURITY_KEY_S0] = MULTI_CMD_S0_OVERHEAD;
+  pBatcher->link.bitRate = DEFAULT_BIT_RATE;
+  pBatcher->link.frameOverhead = DEFAULT_FRAME_OVERHEAD;
+  pBatcher->link.ackLength = DEFAULT_ACK_LENGTH;
+  pBatcher->link.turnaroundUs = DEFAULT_TURNAROUND_US;
+  pBatcher->link.s0NonceFrames = DEFAULT_S0_NONCE_FRAMES;
+}
+
+void
+MultiCmdBatcherSetNodeSupport(
+  MULTI_CMD_BATCHER *pBatcher,
+  uint8_t nodeId,
+  uint8_t keyMask)
+{
+  if (nodeId && nodeId <= MULTI_CMD_MAX_NODES)
+  {
+    pBatcher->nodes[nodeId].multiCmdKeys = keyMask;
+  }
+}
+
+BOOL
+MultiCmdBatcherEnqueue(
+  MULTI_CMD_BATCHER *pBatcher,
+  uint8_t nodeId,
+  const uint8_t *pCommand,
+  uint8_t length,
+  enum SECURITY_KEY securityKey,
+  uint8_t flags)
+{
+  BATCHER_NODE *pNode;
+  MULTI_CMD_ENTRY *pEntry;
+  uint16_t index = pBatcher->freeHead;
+
+  if (0 == nodeId || nodeId > MULTI_CMD_MAX_NODES || 0 == length
+      || length > MULTI_CMD_MAX_COMMAND_LENGTH || (unsigned)securityKey >= MULTI_CMD_KEY_COUNT
+      || MULTI_CMD_NO_ENTRY == index)
+  {
+    return FALSE;
+  }
+  pEntry = &pBatcher->pEntries[index];
+  pBatcher->freeHead = pEntry->next;
+  pEntry->next = MULTI_CMD_NO_ENTRY;
+  pEntry->length = length;
+  pEntry->securityKey = (uint8_t)securityKey;
+  pEntry->flags = flags;
+  memcpy(pEntry->command, pCommand, length);
+
+  pNode = &pBatcher->nodes[nodeId];
+  if (MULTI_CMD_NO_ENTRY == pNode->tail)
+  {
+    pNode->head = index;
+  }
+  else
+  {
+    pBatcher->pEntries[pNode->tail].next = index;
+  }
+  pNode->tail = index;
+  pNode->queued++;
+  return TRUE;
+}
+
+uint16_t
+MultiCmdBatcherQueued(
+  const MULTI_CMD_BATCHER *pBatcher,
+  uint8_t nodeId)
+{
+  if (0 == nodeId || nodeId > MULTI_CMD_MAX_NODES)
+  {
+    return 0;
+  }
+  return pBatcher->nodes[nodeId].queued;
+}
+
+uint16_t
+MultiCmdBatcherDrain(
+  MULTI_CMD_BATCHER *pBatcher,
+  uint8_t nodeId,
+  uint8_t maxPayloadSize,
+  MULTI_CMD_SEND_FUNC pSend,
+  void *pUser,
+  BATCHER_REPORT *pReport)
+{
+  BATCHER_NODE *pNode;
+  BATCHER_REPORT report;
+  uint8_t frame[255];
+  uint32_t unbatchedAirtime = 0;
+  uint32_t unbatchedAwake = 0;
+  uint32_t batchedAwake = 0;
+  uint16_t index;
+
+  memset(&report, 0, sizeof(report));
+  if (0 == nodeId || nodeId > MULTI_CMD_MAX_NODES)
+  {
+    if (pReport)
+    {
+      *pReport = report;
+    }
+    return 0;
+  }
+  pNode = &pBatcher->nodes[nodeId];
+  index = pNode->head;
+
+  while (MULTI_CMD_NO_ENTRY != index)
+  {
+    MULTI_CMD_ENTRY *pFirst = &pBatcher->pEntries[index];
+    uint8_t key = pFirst->securityKey;
+    uint8_t limit = (maxPayloadSize > pBatcher->overhead[key])
+                    ? (uint8_t)(maxPayloadSize - pBatcher->overhead[key]) : 0;
+    uint8_t length = 0;
+    uint8_t count = 0;
+
+    if ((pNode->multiCmdKeys & MULTI_CMD_KEY_BIT(key)) && !IsStandalone(pFirst))
+    {
+      /* Pack compatible commands following in queue order */
+      length = MULTI_CMD_HEADER_LENGTH;
+      while (MULTI_CMD_NO_ENTRY != index && count < 0xFF)
+      {
+        MULTI_CMD_ENTRY *pEntry = &pBatcher->pEntries[index];
+        uint16_t next = pEntry->next;
+
+        if (pEntry->securityKey != key || IsStandalone(pEntry)
+            || length + 1 + pEntry->length > limit)
+        {
+          break;
+        }
+        frame[length] = pEntry->length;
+        memcpy(&frame[length + 1], pEntry->command, pEntry->length);
+        length = (uint8_t)(length + 1 + pEntry->length);
+        count++;
+        unbatchedAirtime += SecureFrameAirtimeUs(pBatcher, key, pEntry->length);
+        unbatchedAwake += FrameAwakeUs(pBatcher, key, pEntry->length);
+        EntryFree(pBatcher, index);
+        index = next;
+      }
+    }
+    if (count > 1)
+    {
+      frame[0] = COMMAND_CLASS_MULTI_CMD;
+      frame[1] = MULTI_CMD_ENCAP;
+      frame[2] = count;
+    }
+    else
+    {
+      if (1 == count)
+      {
+        /* Single command, send it without Multi Command overhead */
+        length = frame[MULTI_CMD_HEADER_LENGTH];
+        memmove(frame, &frame[MULTI_CMD_HEADER_LENGTH + 1], length);
+      }
+      else
+      {
+        /* Standalone, unsupported key or command too large to pack */
+        length = pFirst->length;
+        memcpy(frame, pFirst->command, length);
+        unbatchedAirtime += SecureFrameAirtimeUs(pBatcher, key, length);
+        unbatchedAwake += FrameAwakeUs(pBatcher, key, length);
+        index = pFirst->next;
+        EntryFree(pBatcher, (uint16_t)(pFirst - pBatcher->pEntries));
+      }
+      count = 1;
+    }
+    report.commands = (uint16_t)(report.commands + count);
+    report.frames++;
+    report.airtimeUs += SecureFrameAirtimeUs(pBatcher, key, length);
+    batchedAwake += FrameAwakeUs(pBatcher, key, length);
+    pSend(pUser, nodeId, (enum SECURITY_KEY)key, frame, length);
+  }
+  pNode->head = MULTI_CMD_NO_ENTRY;
+  pNode->tail = MULTI_CMD_NO_ENTRY;
+  pNode->queued = 0;
+
+  report.framesSaved = (uint16_t)(report.commands - report.frames);
+  report.airtimeSavedUs = unbatchedAirtime - report.airtimeUs;
+  report.awakeSavedUs = unbatchedAwake - batchedAwake;
+
+  pBatcher->total.commands = (uint16_t)(pBatcher->total.commands + report.commands);
+  pBatcher->total.frames = (uint16_t)(pBatcher->total.frames + report.frames);
+  pBatcher->total.framesSaved = (uint16_t)(pBatcher->total.framesSaved + report.framesSaved);
+  pBatcher->total.airtimeUs += report.airtimeUs;
+  pBatcher->total.airtimeSavedUs += report.airtimeSavedUs;
+  pBatcher->total.awakeSavedUs += report.awakeSavedUs;
+  if (pReport)
+  {
+    *pReport = report;
+  }
+  return report.frames;
+}
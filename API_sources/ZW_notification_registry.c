@@ -0,0 +1,263 @@
+/****************************************************************************
+ *
+ * Description: Compiled Notification type and event registry.
+ *
+ ****************************************************************************/
+
+/****************************************************************************/
+/*                              INCLUDE FILES                               */
+/****************************************************************************/
+#include <string.h>
+#include <ZW_typedefs.h>
+#include <ZW_classcmd.h>
+#include <ZW_notification_registry.h>
+
+/****************************************************************************/
+/*                      PRIVATE TYPES and DEFINITIONS                       */
+/****************************************************************************/
+
+/* Must match tools/gen_notification_registry.py */
+#define NO_NAME                          0xFFFF
+#define NO_TYPE                          0xFF
+
+#define NOTIFICATION_EVENT_FLAG_STATE    0x01
+
+/* Offsets in a Notification Report */
+#define REPORT_STATUS_OFFSET             5
+#define REPORT_TYPE_OFFSET               6
+#define REPORT_EVENT_OFFSET              7
+#define REPORT_PROPERTIES1_OFFSET        8
+#define REPORT_PARAMS_OFFSET             9
+
+typedef struct _NOTIFICATION_TYPE_ENTRY_
+{
+  uint16_t nameOffset;
+  uint16_t firstEvent;           /* Index in notificationEvents of event 0x00 */
+  uint16_t eventCount;
+} NOTIFICATION_TYPE_ENTRY;
+
+typedef struct _NOTIFICATION_EVENT_ENTRY_
+{
+  uint16_t nameOffset;           /* NO_NAME if the event is not assigned */
+  uint16_t stateVariableOffset;  /* NO_NAME for events and the idle state */
+  uint8_t paramIndex;            /* Index in notificationParams */
+  uint8_t requiredVersion;
+  uint8_t flags;
+} NOTIFICATION_EVENT_ENTRY;
+
+typedef struct _NOTIFICATION_PARAM_ENTRY_
+{
+  uint8_t kind;                  /* E_NOTIFICATION_PARAM_KIND */
+  uint8_t commandClass;
+  uint8_t command;
+  uint8_t firstValue;            /* Index in notificationValues */
+  uint8_t valueCount;
+} NOTIFICATION_PARAM_ENTRY;
+
+/* Assigned value range of an enum parameter */
+typedef struct _NOTIFICATION_VALUE_ENTRY_
+{
+  uint8_t low;
+  uint8_t high;
+  uint16_t nameOffset;
+} NOTIFICATION_VALUE_ENTRY;
+
+/****************************************************************************/
+/*                              PRIVATE DATA                                */
+/****************************************************************************/
+
+#include "ZW_notification_registry_table.c"
+
+/****************************************************************************/
+/*                           PRIVATE FUNCTIONS                              */
+/****************************************************************************/
+
+static const NOTIFICATION_EVENT_ENTRY *
+LookupEvent(
+  uint8_t notificationType,
+  uint8_t event)
+{
+  uint8_t index = notificationTypeIndex[notificationType];
+  const NOTIFICATION_TYPE_ENTRY *pType;
+  const NOTIFICATION_EVENT_ENTRY *pEvent;
+
+  if (NO_TYPE == index)
+  {
+    return NULL;
+  }
+  pType = &notificationTypes[index];
+  if (event >= pType->eventCount)
+  {
+    return NULL;
+  }
+  pEvent = &notificationEvents[pType->firstEvent + event];
+  return (NO_NAME == pEvent->nameOffset) ? NULL : pEvent;
+}
+
+static const char *
+Name(uint16_t offset)
+{
+  return (NO_NAME == offset) ? NULL : &notificationNames[offset];
+}
+
+static void
+DecodeParams(
+  const NOTIFICATION_PARAM_ENTRY *pParam,
+  NOTIFICATION_DECODED *pDecoded)
+{
+  const uint8_t *p = pDecoded->pParams;
+  uint8_t length = pDecoded->paramLength;
+  uint8_t i;
+
+  pDecoded->paramKind = (E_NOTIFICATION_PARAM_KIND)pParam->kind;
+  pDecoded->commandClass = pParam->commandClass;
+  pDecoded->command = pParam->command;
+  if (0 == length)
+  {
+    return;
+  }
+  switch (pParam->kind)
+  {
+    case NOTIFICATION_PARAM_IDLE_EVENT:
+      pDecoded->paramValid = TRUE;
+      pDecoded->paramValue = p[0];
+      pDecoded->pParamValueName = NotificationRegistryEventName(pDecoded->notificationType, p[0]);
+      break;
+
+    case NOTIFICATION_PARAM_ENUM:
+      pDecoded->paramValid = TRUE;
+      pDecoded->paramValue = p[0];
+      for (i = 0; i < pParam->valueCount; i++)
+      {
+        const NOTIFICATION_VALUE_ENTRY *pValue = &notificationValues[pParam->firstValue + i];
+        if (p[0] >= pValue->low && p[0] <= pValue->high)
+        {
+          pDecoded->pParamValueName = Name(pValue->nameOffset);
+          break;
+        }
+      }
+      break;
+
+    case NOTIFICATION_PARAM_BITMASK:
+    case NOTIFICATION_PARAM_IDENTIFIER:
+      pDecoded->paramValid = TRUE;
+      pDecoded->paramValue = p[0];
+      break;
+
+    case NOTIFICATION_PARAM_SIGNED:
+      pDecoded->paramValid = TRUE;
+      pDecoded->paramValue = (int8_t)p[0];
+      break;
+
+    case NOTIFICATION_PARAM_USER_ID:
+      if (length >= 2)
+      {
+        pDecoded->paramValid = TRUE;
+        pDecoded->paramValue = (int32_t)(((uint16_t)p[0] << 8) | p[1]);
+      }
+      break;
+
+    case NOTIFICATION_PARAM_DURATION:
+      if (length >= 3)
+      {
+        pDecoded->paramValid = TRUE;
+        pDecoded->paramValue = (int32_t)p[0] * 3600 + (int32_t)p[1] * 60 + p[2];
+      }
+      break;
+
+    case NOTIFICATION_PARAM_COMMAND:
+      pDecoded->paramValid = (BOOL)(length >= 2 && p[0] == pParam->commandClass && p[1] == pParam->command);
+      break;
+
+    default:
+      /* Structured or proprietary parameters are left to the caller */
+      pDecoded->paramValid = TRUE;
+      break;
+  }
+}
+
+/****************************************************************************/
+/*                           EXPORTED FUNCTIONS                             */
+/****************************************************************************/
+
+const char *
+NotificationRegistryTypeName(
+  uint8_t notificationType)
+{
+  uint8_t index = notificationTypeIndex[notificationType];
+
+  return (NO_TYPE == index) ? NULL : Name(notificationTypes[index].nameOffset);
+}
+
+const char *
+NotificationRegistryEventName(
+  uint8_t notificationType,
+  uint8_t event)
+{
+  const NOTIFICATION_EVENT_ENTRY *pEvent;
+
+  if (NOTIFICATION_EVENT_UNKNOWN == event)
+  {
+    return (NO_TYPE == notificationTypeIndex[notificationType]) ? NULL : Name(NOTIFICATION_UNKNOWN_NAME);
+  }
+  pEvent = LookupEvent(notificationType, event);
+  return pEvent ? Name(pEvent->nameOffset) : NULL;
+}
+
+E_NOTIFICATION_DECODE_STATUS
+NotificationRegistryDecode(
+  const uint8_t *pFrame,
+  uint8_t frameLength,
+  NOTIFICATION_DECODED *pDecoded)
+{
+  const NOTIFICATION_EVENT_ENTRY *pEvent;
+  uint8_t properties1;
+  uint8_t paramLength;
+
+  if (frameLength < REPORT_PARAMS_OFFSET || COMMAND_CLASS_NOTIFICATION_V8 != pFrame[0]
+      || NOTIFICATION_REPORT_V8 != pFrame[1])
+  {
+    return NOTIFICATION_DECODE_INVALID;
+  }
+  properties1 = pFrame[REPORT_PROPERTIES1_OFFSET];
+  paramLength = properties1 & NOTIFICATION_REPORT_PROPERTIES1_EVENT_PARAMETERS_LENGTH_MASK_V8;
+  if (frameLength < REPORT_PARAMS_OFFSET + paramLength)
+  {
+    return NOTIFICATION_DECODE_INVALID;
+  }
+
+  memset(pDecoded, 0, sizeof(*pDecoded));
+  pDecoded->notificationStatus = pFrame[REPORT_STATUS_OFFSET];
+  pDecoded->notificationType = pFrame[REPORT_TYPE_OFFSET];
+  pDecoded->event = pFrame[REPORT_EVENT_OFFSET];
+  pDecoded->pParams = &pFrame[REPORT_PARAMS_OFFSET];
+  pDecoded->paramLength = paramLength;
+  if ((properties1 & NOTIFICATION_REPORT_PROPERTIES1_SEQUENCE_BIT_MASK_V8)
+      && frameLength > REPORT_PARAMS_OFFSET + paramLength)
+  {
+    pDecoded->hasSequence = TRUE;
+    pDecoded->sequenceNumber = pFrame[REPORT_PARAMS_OFFSET + paramLength];
+  }
+
+  pDecoded->pTypeName = NotificationRegistryTypeName(pDecoded->notificationType);
+  if (NULL == pDecoded->pTypeName)
+  {
+    return NOTIFICATION_DECODE_UNKNOWN_TYPE;
+  }
+  if (NOTIFICATION_EVENT_UNKNOWN == pDecoded->event)
+  {
+    pDecoded->pEventName = Name(NOTIFICATION_UNKNOWN_NAME);
+    return NOTIFICATION_DECODE_OK;
+  }
+  pEvent = LookupEvent(pDecoded->notificationType, pDecoded->event);
+  if (NULL == pEvent)
+  {
+    return NOTIFICATION_DECODE_UNKNOWN_EVENT;
+  }
+  pDecoded->pEventName = Name(pEvent->nameOffset);
+  pDecoded->pStateVariable = Name(pEvent->stateVariableOffset);
+  pDecoded->isState = (BOOL)(0 != (pEvent->flags & NOTIFICATION_EVENT_FLAG_STATE));
+  pDecoded->requiredVersion = pEvent->requiredVersion;
+  DecodeParams(&notificationParams[pEvent->paramIndex], pDecoded);
+  return NOTIFICATION_DECODE_OK;
+}
@@ -0,0 +1,778 @@
+/****************************************************************************
+ *
+ * Description: Notification type and event tables.
+ *
+ * Generated by tools/gen_notification_registry.py from "Registries/
+ * Notification Command Class, list of assigned Notifications.xlsx".
+ * Do not edit.
+ *
+ ****************************************************************************/
+
+#define NOTIFICATION_TYPE_COUNT      23
+#define NOTIFICATION_UNKNOWN_NAME    0x0000
+
+static const char notificationNames[8625] =
+  "Unknown event/state" "\0"
+  "Smoke Alarm" "\0"
+  "State idle" "\0"
+  "Smoke detected (location provided)" "\0"
+  "Sensor status" "\0"
+  "Smoke detected" "\0"
+  "Smoke alarm test" "\0"
+  "Alarm status" "\0"
+  "Replacement required" "\0"
+  "Maintenance status" "\0"
+  "Replacement required, End-of-life" "\0"
+  "Alarm silenced" "\0"
+  "Maintenance required, planned periodic inspection" "\0"
+  "Periodic inspection status" "\0"
+  "Maintenance required, dust in device" "\0"
+  "Dust in device status" "\0"
+  "CO Alarm" "\0"
+  "Carbon monoxide detected (location provided)" "\0"
+  "Carbon monoxide detected" "\0"
+  "Carbon monoxide test" "\0"
+  "Test status" "\0"
+  "CO2 Alarm" "\0"
+  "Carbon dioxide detected (location provided)" "\0"
+  "Carbon dioxide detected" "\0"
+  "Carbon dioxide test" "\0"
+  "Heat Alarm" "\0"
+  "Overheat detected (location provided)" "\0"
+  "Heat sensor status" "\0"
+  "Overheat detected" "\0"
+  "Rapid temperature rise (location provided)" "\0"
+  "Rapid temperature rise" "\0"
+  "Under heat detected (location provided)" "\0"
+  "Under heat detected" "\0"
+  "Heat alarm test" "\0"
+  "Rapid temperature fall (location provided)" "\0"
+  "Rapid temperature fall" "\0"
+  "Water Alarm" "\0"
+  "Water leak detected (location provided)" "\0"
+  "Water leak detected" "\0"
+  "Water level dropped (location provided)" "\0"
+  "Water level dropped" "\0"
+  "Replace water filter" "\0"
+  "Water flow alarm" "\0"
+  "Water flow alarm status" "\0"
+  "Water pressure alarm" "\0"
+  "Water pressure alarm status" "\0"
+  "Water temperature alarm" "\0"
+  "Water temperature alarm status" "\0"
+  "Water level alarm" "\0"
+  "Water level alarm status" "\0"
+  "Sump pump active" "\0"
+  "Pump status" "\0"
+  "Sump pump failure" "\0"
+  "Access Control" "\0"
+  "Manual lock operation" "\0"
+  "Manual unlock operation" "\0"
+  "RF lock operation" "\0"
+  "RF unlock operation" "\0"
+  "Keypad lock operation" "\0"
+  "Keypad unlock operation" "\0"
+  "Manual not fully locked operation" "\0"
+  "RF not fully locked operation" "\0"
+  "Auto lock locked operation" "\0"
+  "Auto lock not fully locked operation" "\0"
+  "Lock jammed" "\0"
+  "Lock state" "\0"
+  "All user codes deleted" "\0"
+  "Single user code deleted" "\0"
+  "New user code added" "\0"
+  "New user code not added due to duplicate code" "\0"
+  "Keypad temporary disabled" "\0"
+  "Keypad state" "\0"
+  "Keypad busy" "\0"
+  "New program code entered : unique code for lock configuration" "\0"
+  "Manually enter user access code exceeds code limit" "\0"
+  "Unlock by RF with invalid user code" "\0"
+  "Locked by RF with invalid user code" "\0"
+  "Window/door is open" "\0"
+  "Door state" "\0"
+  "Window/door is closed" "\0"
+  "Window/door handle is open" "\0"
+  "Door handle state" "\0"
+  "Window/door handle is closed" "\0"
+  "Messaging User Code entered via keypad" "\0"
+  "Lock operation with User Code" "\0"
+  "Unlock operation with User Code" "\0"
+  "Credential lock/close operation" "\0"
+  "Credential unlock/open operation" "\0"
+  "All users deleted" "\0"
+  "Multiple credentials deleted" "\0"
+  "User added" "\0"
+  "User modified" "\0"
+  "User deleted" "\0"
+  "User unchanged" "\0"
+  "Credential added" "\0"
+  "Credential modified" "\0"
+  "Credential deleted" "\0"
+  "Credential unchanged" "\0"
+  "Valid credential access denied due to User Active State being set to Occupied Disabled" "\0"
+  "Valid credential access denied due to the User's schedule being inactive" "\0"
+  "User access denied due to not enough credentials entered for the User's Credential Rule" "\0"
+  "Invalid credential used to access the node" "\0"
+  "Non-Access credential entered via local interface" "\0"
+  "Barrier operation (open/close) force has been exceeded" "\0"
+  "Barrier motor has exceeded manufacturer's operational time limit" "\0"
+  "Barrier operation has exceeded physical mechanical limits" "\0"
+  "Barrier unable to perform requested operation due to UL requirements" "\0"
+  "Barrier unattended operation has been disabled per UL requirements" "\0"
+  "Barrier UL disabling status" "\0"
+  "Barrier failed to perform requested operation, device malfunction" "\0"
+  "Barrier vacation mode" "\0"
+  "Barrier vacation mode status" "\0"
+  "Barrier safety beam obstacle" "\0"
+  "Barrier Safety bearm obstacle status" "\0"
+  "Barrier sensor not detected / supervisory error" "\0"
+  "Barrier sensor status" "\0"
+  "Barrier sensor low battery warning" "\0"
+  "Barrier Battery status" "\0"
+  "Barrier detected short in wall station wires" "\0"
+  "Barrier short-circuit status" "\0"
+  "Barrier associated with non Z-Wave remote control" "\0"
+  "Barrier control status" "\0"
+  "Home Security" "\0"
+  "Intrusion (location provided)" "\0"
+  "Intrusion" "\0"
+  "Tampering, product cover removed" "\0"
+  "Cover status" "\0"
+  "Tampering, invalid code" "\0"
+  "Glass breakage (location provided)" "\0"
+  "Glass breakage" "\0"
+  "Motion detection (location provided)" "\0"
+  "Motion sensor status" "\0"
+  "Motion detection" "\0"
+  "Tampering, product moved" "\0"
+  "Impact detected" "\0"
+  "Magnetic field interference detected" "\0"
+  "Magnetic interference status" "\0"
+  "RF Jamming detected" "\0"
+  "Power Management" "\0"
+  "Power has been applied" "\0"
+  "Power status" "\0"
+  "AC mains disconnected" "\0"
+  "Mains status" "\0"
+  "AC mains re-connected" "\0"
+  "Surge detected" "\0"
+  "Voltage drop/drift" "\0"
+  "Over-current detected" "\0"
+  "Over-current status" "\0"
+  "Over-voltage detected" "\0"
+  "Over-voltage status" "\0"
+  "Over-load detected" "\0"
+  "Over-load status" "\0"
+  "Load error" "\0"
+  "Load error status" "\0"
+  "Replace battery soon" "\0"
+  "Battery maintenance status" "\0"
+  "Replace battery now" "\0"
+  "Battery is charging" "\0"
+  "Battery load status" "\0"
+  "Battery is fully charged" "\0"
+  "Battery level status" "\0"
+  "Charge battery soon" "\0"
+  "Charge battery now" "\0"
+  "Back-up battery is low" "\0"
+  "Backup battery level status" "\0"
+  "Battery fluid is low" "\0"
+  "Back-up battery disconnected" "\0"
+  "DC Jack Connected" "\0"
+  "DC Jack Status" "\0"
+  "DC Jack Disconnected" "\0"
+  "System" "\0"
+  "System hardware failure" "\0"
+  "HW status" "\0"
+  "System software failure" "\0"
+  "SW status" "\0"
+  "System hardware failure (manufacturer proprietary failure code provided)" "\0"
+  "System software failure (manufacturer proprietary failure code provided)" "\0"
+  "Heartbeat" "\0"
+  "Emergency shutoff" "\0"
+  "Emergency shutoff status" "\0"
+  "Digital input high state" "\0"
+  "Digital input state" "\0"
+  "Digital input low state" "\0"
+  "Digital input open" "\0"
+  "Emergency Alarm" "\0"
+  "Contact police" "\0"
+  "Contact fire service" "\0"
+  "Contact medical service" "\0"
+  "Panic alert" "\0"
+  "Clock" "\0"
+  "Wake up alert" "\0"
+  "Timer ended" "\0"
+  "Time remaining" "\0"
+  "Appliance" "\0"
+  "Program started" "\0"
+  "Program status" "\0"
+  "Program in progress" "\0"
+  "Program completed" "\0"
+  "Replace main filter" "\0"
+  "Failure to set target temperature" "\0"
+  "Target temperature failure status" "\0"
+  "Supplying water" "\0"
+  "Appliance status" "\0"
+  "Water supply failure" "\0"
+  "Water supply failure status" "\0"
+  "Boiling" "\0"
+  "Boiling failure" "\0"
+  "Boiling failure status" "\0"
+  "Washing" "\0"
+  "Washing failure" "\0"
+  "Washing failure status" "\0"
+  "Rinsing" "\0"
+  "Rinsing failure" "\0"
+  "Rinsing failure status" "\0"
+  "Draining" "\0"
+  "Draining failure" "\0"
+  "Draining failure status" "\0"
+  "Spinning" "\0"
+  "Spinning failure" "\0"
+  "Spinning failure status" "\0"
+  "Drying" "\0"
+  "Drying failure" "\0"
+  "Drying failure status" "\0"
+  "Fan failure" "\0"
+  "Fan failure status" "\0"
+  "Compressor failure" "\0"
+  "Compressor failure status" "\0"
+  "Home Health" "\0"
+  "Leaving bed" "\0"
+  "Position status" "\0"
+  "Sitting on bed" "\0"
+  "Lying on bed" "\0"
+  "Posture changed" "\0"
+  "Sitting on bed edge" "\0"
+  "Volatile Organic Compound level" "\0"
+  "Sleep apnea detected" "\0"
+  "Sleep apnea status" "\0"
+  "Sleep stage 0 detected (Dreaming/REM)" "\0"
+  "Sleep stage status" "\0"
+  "Sleep stage 1 detected (Light sleep, non-REM 1)" "\0"
+  "Sleep stage 2 detected (Medium sleep, non-REM 2)" "\0"
+  "Sleep stage 3 detected (Deep sleep, non-REM 3)" "\0"
+  "Fall detected" "\0"
+  "Siren" "\0"
+  "Siren active" "\0"
+  "Siren status" "\0"
+  "Water Valve" "\0"
+  "Valve operation" "\0"
+  "Valve operation status" "\0"
+  "Main valve operation" "\0"
+  "Main valve operation status" "\0"
+  "Valve short circuit" "\0"
+  "Valve short circuit status" "\0"
+  "Main valve short circuit" "\0"
+  "Main valve short circuit status" "\0"
+  "Valve current alarm" "\0"
+  "Valve current alarm status" "\0"
+  "Main valve current alarm" "\0"
+  "Main valve current alarm status" "\0"
+  "Valve jammed" "\0"
+  "Water jammed status" "\0"
+  "Weather Alarm" "\0"
+  "Rain alarm" "\0"
+  "Rain alarm status" "\0"
+  "Moisture alarm" "\0"
+  "Moisture alarm status" "\0"
+  "Freeze alarm" "\0"
+  "Freeze alarm status" "\0"
+  "Irrigation" "\0"
+  "Schedule started" "\0"
+  "Schedule (id) status" "\0"
+  "Schedule finished" "\0"
+  "Valve table run started" "\0"
+  "Valve run status" "\0"
+  "Valve table run finished" "\0"
+  "Device is not configured" "\0"
+  "Device configuration status" "\0"
+  "Gas alarm" "\0"
+  "Combustible gas detected (location provided)" "\0"
+  "Combustible gas status" "\0"
+  "Combustible gas detected" "\0"
+  "Toxic gas detected (location provided)" "\0"
+  "Toxic gas status" "\0"
+  "Toxic gas detected" "\0"
+  "Gas alarm test" "\0"
+  "Pest Control" "\0"
+  "Trap armed (location provided)" "\0"
+  "Trap status" "\0"
+  "Trap armed" "\0"
+  "Trap re-arm required (location provided)" "\0"
+  "Trap re-arm required" "\0"
+  "Pest detected (location provided)" "\0"
+  "Pest detected" "\0"
+  "Pest exterminated (location provided)" "\0"
+  "Pest exterminated" "\0"
+  "Light sensor" "\0"
+  "Light detected" "\0"
+  "Light detection status" "\0"
+  "Light color transition detected" "\0"
+  "Water Quality Monitoring" "\0"
+  "Chlorine alarm" "\0"
+  "Chlorine alarm status" "\0"
+  "Acidity (pH) alarm" "\0"
+  "Acidity (pH) status" "\0"
+  "Water Oxidation alarm" "\0"
+  "Water Oxidation alarm status" "\0"
+  "Chlorine empty" "\0"
+  "Chlorine Sensor status" "\0"
+  "Acidity (pH) empty" "\0"
+  "Acidity (pH) Sensor status" "\0"
+  "Waterflow measuring station shortage detected" "\0"
+  "Waterflow measuring station sensor" "\0"
+  "Waterflow clear water shortage detected" "\0"
+  "Waterflow clear water sensor" "\0"
+  "Disinfection system error detected" "\0"
+  "Disinfection system status" "\0"
+  "Filter cleaning ongoing" "\0"
+  "Filter cleaning status" "\0"
+  "Heating operation ongoing" "\0"
+  "Heating status" "\0"
+  "Filter pump operation ongoing" "\0"
+  "Filter pump status" "\0"
+  "Freshwater operation ongoing" "\0"
+  "Freshwater flow status" "\0"
+  "Dry protection operation active" "\0"
+  "Dry protection status" "\0"
+  "Water tank is empty" "\0"
+  "Water tank level is unknown" "\0"
+  "Water tank is full" "\0"
+  "Collective disorder" "\0"
+  "Collective disorder status" "\0"
+  "Home monitoring" "\0"
+  "Home occupied (location provided)" "\0"
+  "Home occupancy status" "\0"
+  "Home occupied" "\0"
+  "Request pending notification" "\0"
+  "" "\0"
+  "Test OK" "\0"
+  "Test Failed" "\0"
+  "No data" "\0"
+  "Below low threshold" "\0"
+  "Above high threshold" "\0"
+  "Max" "\0"
+  "Door/Window open in regular position" "\0"
+  "Door/Window open in tilt position" "\0"
+  "0..127 seconds" "\0"
+  "1..127 minutes" "\0"
+  "Mode disabled" "\0"
+  "Mode enabled" "\0"
+  "No obstruction" "\0"
+  "Obstruction" "\0"
+  "Sensor not defined" "\0"
+  "Sensor ID" "\0"
+  "Clean" "\0"
+  "Slightly polluted" "\0"
+  "Moderately polluted" "\0"
+  "Highly polluted" "\0"
+  "Low breath" "\0"
+  "No breath at all" "\0"
+  "Off / Closed (valve does not let the water run through)" "\0"
+  "On / Open (valve lets the water run through)" "\0"
+  "Decreasing pH" "\0"
+  "Increasing pH" "\0"
+  "Filter 1..255 cleaning" "\0";
+
+static const uint8_t notificationTypeIndex[256] =
+{
+  0xFF, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E,
+  0x0F, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x16,
+};
+
+static const NOTIFICATION_TYPE_ENTRY notificationTypes[23] =
+{
+  { 0x0014,   0,   9 },  /* 0x01 Smoke Alarm */
+  { 0x016A,   9,   8 },  /* 0x02 CO Alarm */
+  { 0x01DA,  17,   8 },  /* 0x03 CO2 Alarm */
+  { 0x023C,  25,  14 },  /* 0x04 Heat Alarm */
+  { 0x0362,  39,  12 },  /* 0x05 Water Alarm */
+  { 0x04E6,  51,  77 },  /* 0x06 Access Control */
+  { 0x0DB7, 128,  13 },  /* 0x07 Home Security */
+  { 0x0F2F, 141,  21 },  /* 0x08 Power Management */
+  { 0x11B0, 162,  12 },  /* 0x09 System */
+  { 0x131A, 174,   5 },  /* 0x0A Emergency Alarm */
+  { 0x1372, 179,   4 },  /* 0x0B Clock */
+  { 0x13A1, 183,  22 },  /* 0x0C Appliance */
+  { 0x1603, 205,  13 },  /* 0x0D Home Health */
+  { 0x178A, 218,   2 },  /* 0x0E Siren */
+  { 0x17AA, 220,   8 },  /* 0x0F Water Valve */
+  { 0x18FF, 228,   4 },  /* 0x10 Weather Alarm */
+  { 0x1970, 232,   6 },  /* 0x11 Irrigation */
+  { 0x1A2A, 238,   7 },  /* 0x12 Gas alarm */
+  { 0x1AEB, 245,   9 },  /* 0x13 Pest Control */
+  { 0x1BD4, 254,   3 },  /* 0x14 Light sensor */
+  { 0x1C27, 257,  18 },  /* 0x15 Water Quality Monitoring */
+  { 0x1F4C, 275,   3 },  /* 0x16 Home monitoring */
+  { 0x1FA2, 278,   1 },  /* 0xFF Request pending notification */
+};
+
+static const NOTIFICATION_EVENT_ENTRY notificationEvents[279] =
+{
+  { 0x0020, 0xFFFF,  1, 4, 0 },  /* 0x00 */
+  { 0x002B, 0x004E,  2, 2, NOTIFICATION_EVENT_FLAG_STATE },  /* 0x01 */
+  { 0x005C, 0x004E,  0, 2, NOTIFICATION_EVENT_FLAG_STATE },  /* 0x02 */
+  { 0x006B, 0x007C,  0, 3, NOTIFICATION_EVENT_FLAG_STATE },  /* 0x03 */
+  { 0x0089, 0x009E,  0, 5, NOTIFICATION_EVENT_FLAG_STATE },  /* 0x04 */
+  { 0x00B1, 0x009E,  0, 8, NOTIFICATION_EVENT_FLAG_STATE },  /* 0x05 */
+  { 0x00D3, 0x007C,  0, 8, NOTIFICATION_EVENT_FLAG_STATE },  /* 0x06 */
+  { 0x00E2, 0x0114,  0, 8, NOTIFICATION_EVENT_FLAG_STATE },  /* 0x07 */
+  { 0x012F, 0x0154,  0, 8, NOTIFICATION_EVENT_FLAG_STATE },  /* 0x08 */
+  { 0x0020, 0xFFFF,  1, 4, 0 },  /* 0x00 */
+  { 0x0173, 0x004E,  2, 2, NOTIFICATION_EVENT_FLAG_STATE },  /* 0x01 */
+  { 0x01A0, 0x004E,  0, 2, NOTIFICATION_EVENT_FLAG_STATE },  /* 0x02 */
+  { 0x01B9, 0x01CE,  3, 5, NOTIFICATION_EVENT_FLAG_STATE },  /* 0x03 */
+  { 0x0089, 0x009E,  0, 5, NOTIFICATION_EVENT_FLAG_STATE },  /* 0x04 */
+  { 0x00B1, 0x009E,  0, 8, NOTIFICATION_EVENT_FLAG_STATE },  /* 0x05 */
+  { 0x00D3, 0x007C,  0, 8, NOTIFICATION_EVENT_FLAG_STATE },  /* 0x06 */
+  { 0x00E2, 0x0114,  0, 8, NOTIFICATION_EVENT_FLAG_STATE },  /* 0x07 */
+  { 0x0020, 0xFFFF,  1, 4, 0 },  /* 0x00 */
+  { 0x01E4, 0x004E,  2, 2, NOTIFICATION_EVENT_FLAG_STATE },  /* 0x01 */
+  { 0x0210, 0x004E,  0, 2, NOTIFICATION_EVENT_FLAG_STATE },  /* 0x02 */
+  { 0x0228, 0x01CE,  3, 5, NOTIFICATION_EVENT_FLAG_STATE },  /* 0x03 */
+  { 0x0089, 0x009E,  0, 5, NOTIFICATION_EVENT_FLAG_STATE },  /* 0x04 */
+  { 0x00B1, 0x009E,  0, 8, NOTIFICATION_EVENT_FLAG_STATE },  /* 0x05 */
+  { 0x00D3, 0x007C,  0, 8, NOTIFICATION_EVENT_FLAG_STATE },  /* 0x06 */
+  { 0x00E2, 0x0114,  0, 8, NOTIFICATION_EVENT_FLAG_STATE },  /* 0x07 */
+  { 0x0020, 0xFFFF,  1, 4, 0 },  /* 0x00 */
+  { 0x0247, 0x026D,  2, 2, NOTIFICATION_EVENT_FLAG_STATE },  /* 0x01 */
+  { 0x0280, 0x026D,  0, 2, NOTIFICATION_EVENT_FLAG_STATE },  /* 0x02 */
+  { 0x0292, 0xFFFF,  2, 2, 0 },  /* 0x03 */
+  { 0x02BD, 0xFFFF,  0, 2, 0 },  /* 0x04 */
+  { 0x02D4, 0x026D,  2, 2, NOTIFICATION_EVENT_FLAG_STATE },  /* 0x05 */
+  { 0x02FC, 0x026D,  0, 2, NOTIFICATION_EVENT_FLAG_STATE },  /* 0x06 */
+  { 0x0310, 0x007C,  0, 8, NOTIFICATION_EVENT_FLAG_STATE },  /* 0x07 */
+  { 0x00B1, 0x009E,  0, 8, NOTIFICATION_EVENT_FLAG_STATE },  /* 0x08 */
+  { 0x00D3, 0x007C,  0, 8, NOTIFICATION_EVENT_FLAG_STATE },  /* 0x09 */
+  { 0x012F, 0x0154,  0, 8, NOTIFICATION_EVENT_FLAG_STATE },  /* 0x0A */
+  { 0x00E2, 0x0114,  0, 8, NOTIFICATION_EVENT_FLAG_STATE },  /* 0x0B */
+  { 0x0320, 0xFFFF,  2, 8, 0 },  /* 0x0C */
+  { 0x034B, 0xFFFF,  0, 8, 0 },  /* 0x0D */
+  { 0x0020, 0xFFFF,  1, 4, 0 },  /* 0x00 */
+  { 0x036E, 0x004E,  2, 2, NOTIFICATION_EVENT_FLAG_STATE },  /* 0x01 */
+  { 0x0396, 0x004E,  0, 2, NOTIFICATION_EVENT_FLAG_STATE },  /* 0x02 */
+  { 0x03AA, 0xFFFF,  0, 2, 0 },  /* 0x03 */
+  { 0x03D2, 0xFFFF,  0, 2, 0 },  /* 0x04 */
+  { 0x03E6, 0x009E,  0, 4, NOTIFICATION_EVENT_FLAG_STATE },  /* 0x05 */
+  { 0x03FB, 0x040C,  4, 7, NOTIFICATION_EVENT_FLAG_STATE },  /* 0x06 */
+  { 0x0424, 0x0439,  4, 7, NOTIFICATION_EVENT_FLAG_STATE },  /* 0x07 */
+  { 0x0455, 0x046D,  5, 8, NOTIFICATION_EVENT_FLAG_STATE },  /* 0x08 */
+  { 0x048C, 0x049E,  5, 8, NOTIFICATION_EVENT_FLAG_STATE },  /* 0x09 */
+  { 0x04B7, 0x04C8,  0, 8, NOTIFICATION_EVENT_FLAG_STATE },  /* 0x0A */
+  { 0x04D4, 0x04C8,  0, 8, NOTIFICATION_EVENT_FLAG_STATE },  /* 0x0B */
+  { 0x0020, 0xFFFF,  1, 4, 0 },  /* 0x00 */
+  { 0x04F5, 0xFFFF,  0, 2, 0 },  /* 0x01 */
+  { 0x050B, 0xFFFF,  0, 2, 0 },  /* 0x02 */
+  { 0x0523, 0xFFFF,  0, 2, 0 },  /* 0x03 */
+  { 0x0535, 0xFFFF,  0, 2, 0 },  /* 0x04 */
+  { 0x0549, 0xFFFF,  6, 2, 0 },  /* 0x05 */
+  { 0x055F, 0xFFFF,  6, 2, 0 },  /* 0x06 */
+  { 0x0577, 0xFFFF,  0, 3, 0 },  /* 0x07 */
+  { 0x0599, 0xFFFF,  0, 3, 0 },  /* 0x08 */
+  { 0x05B7, 0xFFFF,  0, 3, 0 },  /* 0x09 */
+  { 0x05D2, 0xFFFF,  0, 3, 0 },  /* 0x0A */
+  { 0x05F7, 0x0603,  0, 3, NOTIFICATION_EVENT_FLAG_STATE },  /* 0x0B */
+  { 0x060E, 0xFFFF,  0, 3, 0 },  /* 0x0C */
+  { 0x0625, 0xFFFF,  7, 3, 0 },  /* 0x0D */
+  { 0x063E, 0xFFFF,  7, 3, 0 },  /* 0x0E */
+  { 0x0652, 0xFFFF,  7, 3, 0 },  /* 0x0F */
+  { 0x0680, 0x069A,  0, 3, NOTIFICATION_EVENT_FLAG_STATE },  /* 0x10 */
+  { 0x06A7, 0x069A,  0, 3, NOTIFICATION_EVENT_FLAG_STATE },  /* 0x11 */
+  { 0x06B3, 0xFFFF,  0, 3, 0 },  /* 0x12 */
+  { 0x06F1, 0xFFFF,  0, 3, 0 },  /* 0x13 */
+  { 0x0724, 0xFFFF,  0, 3, 0 },  /* 0x14 */
+  { 0x0748, 0xFFFF,  0, 3, 0 },  /* 0x15 */
+  { 0x076C, 0x0780,  8, 3, NOTIFICATION_EVENT_FLAG_STATE },  /* 0x16 */
+  { 0x078B, 0x0780,  0, 3, NOTIFICATION_EVENT_FLAG_STATE },  /* 0x17 */
+  { 0x07A1, 0x07BC,  0, 8, NOTIFICATION_EVENT_FLAG_STATE },  /* 0x18 */
+  { 0x07CE, 0x07BC,  0, 8, NOTIFICATION_EVENT_FLAG_STATE },  /* 0x19 */
+  { 0xFFFF, 0xFFFF,  0, 0, 0 },
+  { 0xFFFF, 0xFFFF,  0, 0, 0 },
+  { 0xFFFF, 0xFFFF,  0, 0, 0 },
+  { 0xFFFF, 0xFFFF,  0, 0, 0 },
+  { 0xFFFF, 0xFFFF,  0, 0, 0 },
+  { 0xFFFF, 0xFFFF,  0, 0, 0 },
+  { 0x07EB, 0xFFFF,  9, 8, 0 },  /* 0x20 */
+  { 0x0812, 0xFFFF,  9, 8, 0 },  /* 0x21 */
+  { 0x0830, 0xFFFF,  9, 8, 0 },  /* 0x22 */
+  { 0x0850, 0xFFFF, 10, 8, 0 },  /* 0x23 */
+  { 0x0870, 0xFFFF, 10, 8, 0 },  /* 0x24 */
+  { 0x0891, 0xFFFF,  0, 8, 0 },  /* 0x25 */
+  { 0x08A3, 0xFFFF, 10, 8, 0 },  /* 0x26 */
+  { 0x08C0, 0xFFFF, 11, 8, 0 },  /* 0x27 */
+  { 0x08CB, 0xFFFF, 11, 8, 0 },  /* 0x28 */
+  { 0x08D9, 0xFFFF, 11, 8, 0 },  /* 0x29 */
+  { 0x08E6, 0xFFFF, 11, 8, 0 },  /* 0x2A */
+  { 0x08F5, 0xFFFF,  7, 8, 0 },  /* 0x2B */
+  { 0x0906, 0xFFFF,  7, 8, 0 },  /* 0x2C */
+  { 0x091A, 0xFFFF,  7, 8, 0 },  /* 0x2D */
+  { 0x092D, 0xFFFF,  7, 8, 0 },  /* 0x2E */
+  { 0x0942, 0xFFFF, 10, 8, 0 },  /* 0x2F */
+  { 0x0999, 0xFFFF, 10, 8, 0 },  /* 0x30 */
+  { 0x09E2, 0xFFFF, 12, 8, 0 },  /* 0x31 */
+  { 0x0A3A, 0xFFFF,  0, 8, 0 },  /* 0x32 */
+  { 0x0A65, 0xFFFF, 10, 8, 0 },  /* 0x33 */
+  { 0xFFFF, 0xFFFF,  0, 0, 0 },
+  { 0xFFFF, 0xFFFF,  0, 0, 0 },
+  { 0xFFFF, 0xFFFF,  0, 0, 0 },
+  { 0xFFFF, 0xFFFF,  0, 0, 0 },
+  { 0xFFFF, 0xFFFF,  0, 0, 0 },
+  { 0xFFFF, 0xFFFF,  0, 0, 0 },
+  { 0xFFFF, 0xFFFF,  0, 0, 0 },
+  { 0xFFFF, 0xFFFF,  0, 0, 0 },
+  { 0xFFFF, 0xFFFF,  0, 0, 0 },
+  { 0xFFFF, 0xFFFF,  0, 0, 0 },
+  { 0xFFFF, 0xFFFF,  0, 0, 0 },
+  { 0xFFFF, 0xFFFF,  0, 0, 0 },
+  { 0xFFFF, 0xFFFF,  0, 0, 0 },
+  { 0x0A97, 0xFFFF,  0, 4, 0 },  /* 0x41 */
+  { 0x0ACE, 0xFFFF, 13, 4, 0 },  /* 0x42 */
+  { 0x0B0F, 0xFFFF,  0, 4, 0 },  /* 0x43 */
+  { 0x0B49, 0xFFFF,  0, 4, 0 },  /* 0x44 */
+  { 0x0B8E, 0x0BD1,  0, 4, NOTIFICATION_EVENT_FLAG_STATE },  /* 0x45 */
+  { 0x0BED, 0xFFFF,  0, 4, 0 },  /* 0x46 */
+  { 0x0C2F, 0x0C45, 14, 4, NOTIFICATION_EVENT_FLAG_STATE },  /* 0x47 */
+  { 0x0C62, 0x0C7F, 15, 4, NOTIFICATION_EVENT_FLAG_STATE },  /* 0x48 */
+  { 0x0CA4, 0x0CD4, 16, 4, NOTIFICATION_EVENT_FLAG_STATE },  /* 0x49 */
+  { 0x0CEA, 0x0D0D, 16, 4, NOTIFICATION_EVENT_FLAG_STATE },  /* 0x4A */
+  { 0x0D24, 0x0D51,  0, 4, NOTIFICATION_EVENT_FLAG_STATE },  /* 0x4B */
+  { 0x0D6E, 0x0DA0,  0, 4, NOTIFICATION_EVENT_FLAG_STATE },  /* 0x4C */
+  { 0x0020, 0xFFFF,  1, 4, 0 },  /* 0x00 */
+  { 0x0DC5, 0x004E,  2, 2, NOTIFICATION_EVENT_FLAG_STATE },  /* 0x01 */
+  { 0x0DE3, 0x004E,  0, 2, NOTIFICATION_EVENT_FLAG_STATE },  /* 0x02 */
+  { 0x0DED, 0x0E0E,  0, 2, NOTIFICATION_EVENT_FLAG_STATE },  /* 0x03 */
+  { 0x0E1B, 0xFFFF,  0, 2, 0 },  /* 0x04 */
+  { 0x0E33, 0xFFFF,  2, 2, 0 },  /* 0x05 */
+  { 0x0E56, 0xFFFF,  0, 2, 0 },  /* 0x06 */
+  { 0x0E65, 0x0E8A,  2, 2, NOTIFICATION_EVENT_FLAG_STATE },  /* 0x07 */
+  { 0x0E9F, 0x0E8A,  0, 4, NOTIFICATION_EVENT_FLAG_STATE },  /* 0x08 */
+  { 0x0EB0, 0xFFFF,  0, 6, 0 },  /* 0x09 */
+  { 0x0EC9, 0xFFFF,  0, 8, 0 },  /* 0x0A */
+  { 0x0ED9, 0x0EFE,  0, 8, NOTIFICATION_EVENT_FLAG_STATE },  /* 0x0B */
+  { 0x0F1B, 0xFFFF, 17, 8, 0 },  /* 0x0C */
+  { 0x0020, 0xFFFF,  1, 4, 0 },  /* 0x00 */
+  { 0x0F40, 0x0F57,  0, 2, NOTIFICATION_EVENT_FLAG_STATE },  /* 0x01 */
+  { 0x0F64, 0x0F7A,  0, 2, NOTIFICATION_EVENT_FLAG_STATE },  /* 0x02 */
+  { 0x0F87, 0x0F7A,  0, 2, NOTIFICATION_EVENT_FLAG_STATE },  /* 0x03 */
+  { 0x0F9D, 0xFFFF,  0, 2, 0 },  /* 0x04 */
+  { 0x0FAC, 0xFFFF,  0, 2, 0 },  /* 0x05 */
+  { 0x0FBF, 0x0FD5,  0, 3, NOTIFICATION_EVENT_FLAG_STATE },  /* 0x06 */
+  { 0x0FE9, 0x0FFF,  0, 3, NOTIFICATION_EVENT_FLAG_STATE },  /* 0x07 */
+  { 0x1013, 0x1026,  0, 3, NOTIFICATION_EVENT_FLAG_STATE },  /* 0x08 */
+  { 0x1037, 0x1042,  0, 3, NOTIFICATION_EVENT_FLAG_STATE },  /* 0x09 */
+  { 0x1054, 0x1069,  0, 3, NOTIFICATION_EVENT_FLAG_STATE },  /* 0x0A */
+  { 0x1084, 0x1069,  0, 3, NOTIFICATION_EVENT_FLAG_STATE },  /* 0x0B */
+  { 0x1098, 0x10AC,  0, 4, NOTIFICATION_EVENT_FLAG_STATE },  /* 0x0C */
+  { 0x10C0, 0x10D9,  0, 4, NOTIFICATION_EVENT_FLAG_STATE },  /* 0x0D */
+  { 0x10EE, 0x10D9,  0, 4, NOTIFICATION_EVENT_FLAG_STATE },  /* 0x0E */
+  { 0x1102, 0x10D9,  0, 4, NOTIFICATION_EVENT_FLAG_STATE },  /* 0x0F */
+  { 0x1115, 0x112C,  0, 8, NOTIFICATION_EVENT_FLAG_STATE },  /* 0x10 */
+  { 0x1148, 0x1069,  0, 8, NOTIFICATION_EVENT_FLAG_STATE },  /* 0x11 */
+  { 0x115D, 0x112C,  0, 8, NOTIFICATION_EVENT_FLAG_STATE },  /* 0x12 */
+  { 0x117A, 0x118C,  0, 8, NOTIFICATION_EVENT_FLAG_STATE },  /* 0x13 */
+  { 0x119B, 0x118C,  0, 8, NOTIFICATION_EVENT_FLAG_STATE },  /* 0x14 */
+  { 0x0020, 0xFFFF,  1, 4, 0 },  /* 0x00 */
+  { 0x11B7, 0x11CF,  0, 2, NOTIFICATION_EVENT_FLAG_STATE },  /* 0x01 */
+  { 0x11D9, 0x11F1,  0, 2, NOTIFICATION_EVENT_FLAG_STATE },  /* 0x02 */
+  { 0x11FB, 0x11CF, 18, 3, NOTIFICATION_EVENT_FLAG_STATE },  /* 0x03 */
+  { 0x1244, 0x11F1, 18, 3, NOTIFICATION_EVENT_FLAG_STATE },  /* 0x04 */
+  { 0x128D, 0xFFFF,  0, 5, 0 },  /* 0x05 */
+  { 0x0DED, 0x0E0E,  0, 5, NOTIFICATION_EVENT_FLAG_STATE },  /* 0x06 */
+  { 0x1297, 0x12A9,  0, 7, NOTIFICATION_EVENT_FLAG_STATE },  /* 0x07 */
+  { 0xFFFF, 0xFFFF,  0, 0, 0 },
+  { 0x12C2, 0x12DB,  0, 8, NOTIFICATION_EVENT_FLAG_STATE },  /* 0x09 */
+  { 0x12EF, 0x12DB,  0, 8, NOTIFICATION_EVENT_FLAG_STATE },  /* 0x0A */
+  { 0x1307, 0x12DB,  0, 8, NOTIFICATION_EVENT_FLAG_STATE },  /* 0x0B */
+  { 0x0020, 0xFFFF,  1, 4, 0 },  /* 0x00 */
+  { 0x132A, 0xFFFF,  0, 2, 0 },  /* 0x01 */
+  { 0x1339, 0xFFFF,  0, 2, 0 },  /* 0x02 */
+  { 0x134E, 0xFFFF,  0, 2, 0 },  /* 0x03 */
+  { 0x1366, 0xFFFF,  0, 8, 0 },  /* 0x04 */
+  { 0x0020, 0xFFFF,  1, 4, 0 },  /* 0x00 */
+  { 0x1378, 0xFFFF,  0, 2, 0 },  /* 0x01 */
+  { 0x1386, 0xFFFF,  0, 3, 0 },  /* 0x02 */
+  { 0x1392, 0xFFFF, 19, 4, 0 },  /* 0x03 */
+  { 0x0020, 0xFFFF,  1, 4, 0 },  /* 0x00 */
+  { 0x13AB, 0x13BB,  0, 4, NOTIFICATION_EVENT_FLAG_STATE },  /* 0x01 */
+  { 0x13CA, 0x13BB,  0, 4, NOTIFICATION_EVENT_FLAG_STATE },  /* 0x02 */
+  { 0x13DE, 0x13BB,  0, 4, NOTIFICATION_EVENT_FLAG_STATE },  /* 0x03 */
+  { 0x13F0, 0x009E,  0, 4, NOTIFICATION_EVENT_FLAG_STATE },  /* 0x04 */
+  { 0x1404, 0x1426,  0, 4, NOTIFICATION_EVENT_FLAG_STATE },  /* 0x05 */
+  { 0x1448, 0x1458,  0, 4, NOTIFICATION_EVENT_FLAG_STATE },  /* 0x06 */
+  { 0x1469, 0x147E,  0, 4, NOTIFICATION_EVENT_FLAG_STATE },  /* 0x07 */
+  { 0x149A, 0x1458,  0, 4, NOTIFICATION_EVENT_FLAG_STATE },  /* 0x08 */
+  { 0x14A2, 0x14B2,  0, 4, NOTIFICATION_EVENT_FLAG_STATE },  /* 0x09 */
+  { 0x14C9, 0x1458,  0, 4, NOTIFICATION_EVENT_FLAG_STATE },  /* 0x0A */
+  { 0x14D1, 0x14E1,  0, 4, NOTIFICATION_EVENT_FLAG_STATE },  /* 0x0B */
+  { 0x14F8, 0x1458,  0, 4, NOTIFICATION_EVENT_FLAG_STATE },  /* 0x0C */
+  { 0x1500, 0x1510,  0, 4, NOTIFICATION_EVENT_FLAG_STATE },  /* 0x0D */
+  { 0x1527, 0x1458,  0, 4, NOTIFICATION_EVENT_FLAG_STATE },  /* 0x0E */
+  { 0x1530, 0x1541,  0, 4, NOTIFICATION_EVENT_FLAG_STATE },  /* 0x0F */
+  { 0x1559, 0x1458,  0, 4, NOTIFICATION_EVENT_FLAG_STATE },  /* 0x10 */
+  { 0x1562, 0x1573,  0, 4, NOTIFICATION_EVENT_FLAG_STATE },  /* 0x11 */
+  { 0x158B, 0x1458,  0, 4, NOTIFICATION_EVENT_FLAG_STATE },  /* 0x12 */
+  { 0x1592, 0x15A1,  0, 4, NOTIFICATION_EVENT_FLAG_STATE },  /* 0x13 */
+  { 0x15B7, 0x15C3,  0, 4, NOTIFICATION_EVENT_FLAG_STATE },  /* 0x14 */
+  { 0x15D6, 0x15E9,  0, 4, NOTIFICATION_EVENT_FLAG_STATE },  /* 0x15 */
+  { 0x0020, 0xFFFF,  1, 4, 0 },  /* 0x00 */
+  { 0x160F, 0x161B,  0, 4, NOTIFICATION_EVENT_FLAG_STATE },  /* 0x01 */
+  { 0x162B, 0x161B,  0, 4, NOTIFICATION_EVENT_FLAG_STATE },  /* 0x02 */
+  { 0x163A, 0x161B,  0, 4, NOTIFICATION_EVENT_FLAG_STATE },  /* 0x03 */
+  { 0x1647, 0xFFFF,  0, 4, 0 },  /* 0x04 */
+  { 0x1657, 0x161B,  0, 4, NOTIFICATION_EVENT_FLAG_STATE },  /* 0x05 */
+  { 0x166B, 0xFFFF, 20, 4, 0 },  /* 0x06 */
+  { 0x168B, 0x16A0, 21, 8, NOTIFICATION_EVENT_FLAG_STATE },  /* 0x07 */
+  { 0x16B3, 0x16D9,  0, 8, NOTIFICATION_EVENT_FLAG_STATE },  /* 0x08 */
+  { 0x16EC, 0x16D9,  0, 8, NOTIFICATION_EVENT_FLAG_STATE },  /* 0x09 */
+  { 0x171C, 0x16D9,  0, 8, NOTIFICATION_EVENT_FLAG_STATE },  /* 0x0A */
+  { 0x174D, 0x16D9,  0, 8, NOTIFICATION_EVENT_FLAG_STATE },  /* 0x0B */
+  { 0x177C, 0xFFFF,  0, 8, 0 },  /* 0x0C */
+  { 0x0020, 0xFFFF,  1, 6, 0 },  /* 0x00 */
+  { 0x1790, 0x179D,  0, 6, NOTIFICATION_EVENT_FLAG_STATE },  /* 0x01 */
+  { 0x0020, 0xFFFF,  1, 7, 0 },  /* 0x00 */
+  { 0x17B6, 0x17C6, 22, 7, NOTIFICATION_EVENT_FLAG_STATE },  /* 0x01 */
+  { 0x17DD, 0x17F2, 22, 7, NOTIFICATION_EVENT_FLAG_STATE },  /* 0x02 */
+  { 0x180E, 0x1822,  0, 7, NOTIFICATION_EVENT_FLAG_STATE },  /* 0x03 */
+  { 0x183D, 0x1856,  0, 7, NOTIFICATION_EVENT_FLAG_STATE },  /* 0x04 */
+  { 0x1876, 0x188A,  4, 7, NOTIFICATION_EVENT_FLAG_STATE },  /* 0x05 */
+  { 0x18A5, 0x18BE,  4, 7, NOTIFICATION_EVENT_FLAG_STATE },  /* 0x06 */
+  { 0x18DE, 0x18EB,  0, 8, NOTIFICATION_EVENT_FLAG_STATE },  /* 0x07 */
+  { 0x0020, 0xFFFF,  1, 7, 0 },  /* 0x00 */
+  { 0x190D, 0x1918,  0, 7, NOTIFICATION_EVENT_FLAG_STATE },  /* 0x01 */
+  { 0x192A, 0x1939,  0, 7, NOTIFICATION_EVENT_FLAG_STATE },  /* 0x02 */
+  { 0x194F, 0x195C,  0, 8, NOTIFICATION_EVENT_FLAG_STATE },  /* 0x03 */
+  { 0x0020, 0xFFFF,  1, 7, 0 },  /* 0x00 */
+  { 0x197B, 0x198C, 23, 7, NOTIFICATION_EVENT_FLAG_STATE },  /* 0x01 */
+  { 0x19A1, 0x198C, 23, 7, NOTIFICATION_EVENT_FLAG_STATE },  /* 0x02 */
+  { 0x19B3, 0x19CB, 23, 7, NOTIFICATION_EVENT_FLAG_STATE },  /* 0x03 */
+  { 0x19DC, 0x19CB, 23, 7, NOTIFICATION_EVENT_FLAG_STATE },  /* 0x04 */
+  { 0x19F5, 0x1A0E,  0, 7, NOTIFICATION_EVENT_FLAG_STATE },  /* 0x05 */
+  { 0x0020, 0xFFFF,  1, 7, 0 },  /* 0x00 */
+  { 0x1A34, 0x1A61,  2, 7, NOTIFICATION_EVENT_FLAG_STATE },  /* 0x01 */
+  { 0x1A78, 0x1A61,  0, 7, NOTIFICATION_EVENT_FLAG_STATE },  /* 0x02 */
+  { 0x1A91, 0x1AB8,  2, 7, NOTIFICATION_EVENT_FLAG_STATE },  /* 0x03 */
+  { 0x1AC9, 0x1AB8,  0, 7, NOTIFICATION_EVENT_FLAG_STATE },  /* 0x04 */
+  { 0x1ADC, 0x007C,  0, 7, NOTIFICATION_EVENT_FLAG_STATE },  /* 0x05 */
+  { 0x0089, 0x009E,  0, 7, NOTIFICATION_EVENT_FLAG_STATE },  /* 0x06 */
+  { 0x0020, 0xFFFF,  1, 8, 0 },  /* 0x00 */
+  { 0x1AF8, 0x1B17,  2, 8, NOTIFICATION_EVENT_FLAG_STATE },  /* 0x01 */
+  { 0x1B23, 0x1B17,  0, 8, NOTIFICATION_EVENT_FLAG_STATE },  /* 0x02 */
+  { 0x1B2E, 0x1B17,  2, 8, NOTIFICATION_EVENT_FLAG_STATE },  /* 0x03 */
+  { 0x1B57, 0x1B17,  0, 8, NOTIFICATION_EVENT_FLAG_STATE },  /* 0x04 */
+  { 0x1B6C, 0xFFFF,  2, 8, 0 },  /* 0x05 */
+  { 0x1B8E, 0xFFFF,  0, 8, 0 },  /* 0x06 */
+  { 0x1B9C, 0xFFFF,  2, 8, 0 },  /* 0x07 */
+  { 0x1BC2, 0xFFFF,  0, 8, 0 },  /* 0x08 */
+  { 0x0020, 0xFFFF,  1, 8, 0 },  /* 0x00 */
+  { 0x1BE1, 0x1BF0,  0, 8, NOTIFICATION_EVENT_FLAG_STATE },  /* 0x01 */
+  { 0x1C07, 0xFFFF,  0, 8, 0 },  /* 0x02 */
+  { 0x0020, 0xFFFF,  1, 8, 0 },  /* 0x00 */
+  { 0x1C40, 0x1C4F, 24, 8, NOTIFICATION_EVENT_FLAG_STATE },  /* 0x01 */
+  { 0x1C65, 0x1C78, 25, 8, NOTIFICATION_EVENT_FLAG_STATE },  /* 0x02 */
+  { 0x1C8C, 0x1CA2, 24, 8, NOTIFICATION_EVENT_FLAG_STATE },  /* 0x03 */
+  { 0x1CBF, 0x1CCE,  0, 8, NOTIFICATION_EVENT_FLAG_STATE },  /* 0x04 */
+  { 0x1CE5, 0x1CF8,  0, 8, NOTIFICATION_EVENT_FLAG_STATE },  /* 0x05 */
+  { 0x1D13, 0x1D41,  0, 8, NOTIFICATION_EVENT_FLAG_STATE },  /* 0x06 */
+  { 0x1D64, 0x1D8C,  0, 8, NOTIFICATION_EVENT_FLAG_STATE },  /* 0x07 */
+  { 0x1DA9, 0x1DCC, 26, 8, NOTIFICATION_EVENT_FLAG_STATE },  /* 0x08 */
+  { 0x1DE7, 0x1DFF, 27, 8, NOTIFICATION_EVENT_FLAG_STATE },  /* 0x09 */
+  { 0x1E16, 0x1E30,  0, 8, NOTIFICATION_EVENT_FLAG_STATE },  /* 0x0A */
+  { 0x1E3F, 0x1E5D,  0, 8, NOTIFICATION_EVENT_FLAG_STATE },  /* 0x0B */
+  { 0x1E70, 0x1E8D,  0, 8, NOTIFICATION_EVENT_FLAG_STATE },  /* 0x0C */
+  { 0x1EA4, 0x1EC4,  0, 8, NOTIFICATION_EVENT_FLAG_STATE },  /* 0x0D */
+  { 0x1EDA, 0xFFFF,  0, 8, 0 },  /* 0x0E */
+  { 0x1EEE, 0xFFFF,  0, 8, 0 },  /* 0x0F */
+  { 0x1F0A, 0xFFFF,  0, 8, 0 },  /* 0x10 */
+  { 0x1F1D, 0x1F31,  0, 8, NOTIFICATION_EVENT_FLAG_STATE },  /* 0x11 */
+  { 0x0020, 0xFFFF,  1, 8, 0 },  /* 0x00 */
+  { 0x1F5C, 0x1F7E,  2, 8, NOTIFICATION_EVENT_FLAG_STATE },  /* 0x01 */
+  { 0x1F94, 0x1F7E,  0, 8, NOTIFICATION_EVENT_FLAG_STATE },  /* 0x02 */
+  { 0x1FBF, 0xFFFF,  0, 2, 0 },  /* 0x00 */
+};
+
+static const NOTIFICATION_PARAM_ENTRY notificationParams[28] =
+{
+  { NOTIFICATION_PARAM_NONE, 0, 0, 0, 0 },
+  { NOTIFICATION_PARAM_IDLE_EVENT, 0, 0, 0, 0 },
+  { NOTIFICATION_PARAM_COMMAND, COMMAND_CLASS_NODE_NAMING, NODE_NAMING_NODE_LOCATION_REPORT, 0, 0 },
+  { NOTIFICATION_PARAM_ENUM, 0, 0, 0, 2 },
+  { NOTIFICATION_PARAM_ENUM, 0, 0, 2, 4 },
+  { NOTIFICATION_PARAM_ENUM, 0, 0, 6, 3 },
+  { NOTIFICATION_PARAM_COMMAND, COMMAND_CLASS_USER_CODE, USER_CODE_REPORT, 0, 0 },
+  { NOTIFICATION_PARAM_CREDENTIAL_NOTIFICATION, 0, 0, 0, 0 },
+  { NOTIFICATION_PARAM_ENUM, 0, 0, 9, 2 },
+  { NOTIFICATION_PARAM_USER_ID, 0, 0, 0, 0 },
+  { NOTIFICATION_PARAM_CREDENTIAL, 0, 0, 0, 0 },
+  { NOTIFICATION_PARAM_USER_NOTIFICATION, 0, 0, 0, 0 },
+  { NOTIFICATION_PARAM_CREDENTIAL_LIST, 0, 0, 0, 0 },
+  { NOTIFICATION_PARAM_ENUM, 0, 0, 11, 2 },
+  { NOTIFICATION_PARAM_ENUM, 0, 0, 13, 2 },
+  { NOTIFICATION_PARAM_ENUM, 0, 0, 15, 2 },
+  { NOTIFICATION_PARAM_ENUM, 0, 0, 17, 2 },
+  { NOTIFICATION_PARAM_SIGNED, 0, 0, 0, 0 },
+  { NOTIFICATION_PARAM_PROPRIETARY, 0, 0, 0, 0 },
+  { NOTIFICATION_PARAM_DURATION, 0, 0, 0, 0 },
+  { NOTIFICATION_PARAM_ENUM, 0, 0, 19, 4 },
+  { NOTIFICATION_PARAM_ENUM, 0, 0, 23, 2 },
+  { NOTIFICATION_PARAM_ENUM, 0, 0, 25, 2 },
+  { NOTIFICATION_PARAM_IDENTIFIER, 0, 0, 0, 0 },
+  { NOTIFICATION_PARAM_ENUM, 0, 0, 27, 2 },
+  { NOTIFICATION_PARAM_ENUM, 0, 0, 29, 4 },
+  { NOTIFICATION_PARAM_BITMASK, 0, 0, 0, 0 },
+  { NOTIFICATION_PARAM_ENUM, 0, 0, 33, 1 },
+};
+
+static const NOTIFICATION_VALUE_ENTRY notificationValues[34] =
+{
+  { 0x01, 0x01, 0x1FC0 },
+  { 0x02, 0x02, 0x1FC8 },
+  { 0x01, 0x01, 0x1FD4 },
+  { 0x02, 0x02, 0x1FDC },
+  { 0x03, 0x03, 0x1FF0 },
+  { 0x04, 0x04, 0x2005 },
+  { 0x01, 0x01, 0x1FD4 },
+  { 0x02, 0x02, 0x1FDC },
+  { 0x03, 0x03, 0x1FF0 },
+  { 0x00, 0x00, 0x2009 },
+  { 0x01, 0x01, 0x202E },
+  { 0x00, 0x7F, 0x2050 },
+  { 0x80, 0xFE, 0x205F },
+  { 0x00, 0x00, 0x206E },
+  { 0xFF, 0xFF, 0x207C },
+  { 0x00, 0x00, 0x2089 },
+  { 0xFF, 0xFF, 0x2098 },
+  { 0x00, 0x00, 0x20A4 },
+  { 0x01, 0xFF, 0x20B7 },
+  { 0x01, 0x01, 0x20C1 },
+  { 0x02, 0x02, 0x20C7 },
+  { 0x03, 0x03, 0x20D9 },
+  { 0x04, 0x04, 0x20ED },
+  { 0x01, 0x01, 0x20FD },
+  { 0x02, 0x02, 0x2108 },
+  { 0x00, 0x00, 0x2119 },
+  { 0x01, 0x01, 0x2151 },
+  { 0x01, 0x01, 0x1FDC },
+  { 0x02, 0x02, 0x1FF0 },
+  { 0x01, 0x01, 0x1FDC },
+  { 0x02, 0x02, 0x1FF0 },
+  { 0x03, 0x03, 0x217E },
+  { 0x04, 0x04, 0x218C },
+  { 0x01, 0xFF, 0x219A },
+};
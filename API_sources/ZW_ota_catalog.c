@@ -0,0 +1,248 @@
+/****************************************************************************
+ *
+ * Description: Matching of an OTA firmware catalog against a fleet of nodes.
+ *
+ ****************************************************************************/
+
+/****************************************************************************/
+/*                              INCLUDE FILES                               */
+/****************************************************************************/
+#include <ZW_ota_compression_header.h>
+#include <stdlib.h>
+#include <string.h>
+#include <ZW_typedefs.h>
+#include <ZW_firmware_bootloader_defs.h>
+#include <ZW_ota_catalog.h>
+
+/****************************************************************************/
+/*                      PRIVATE TYPES and DEFINITIONS                       */
+/****************************************************************************/
+
+#define MIN_SLOTS             16
+
+/****************************************************************************/
+/*                           PRIVATE FUNCTIONS                              */
+/****************************************************************************/
+
+static uint64_t
+MakeKey(
+  uint16_t manufacturerId,
+  uint16_t firmwareId,
+  uint16_t productTypeId,
+  uint16_t productId)
+{
+  return ((uint64_t)manufacturerId << 48) | ((uint64_t)firmwareId << 32) |
+         ((uint64_t)productTypeId << 16) | productId;
+}
+
+/* 64 bit finalizer, so that every field of the key reaches the low bits */
+static uint32_t
+Hash(uint64_t key)
+{
+  key ^= key >> 33;
+  key *= 0xFF51AFD7ED558CCDULL;
+  key ^= key >> 33;
+  key *= 0xC4CEB9FE1A85EC53ULL;
+  key ^= key >> 33;
+  return (uint32_t)key;
+}
+
+/* Slot of key, or the free slot to insert it */
+static OTA_CATALOG_SLOT *
+FindSlot(
+  const OTA_CATALOG_INDEX *pIndex,
+  uint64_t key)
+{
+  uint32_t i = Hash(key) & pIndex->mask;
+
+  while (pIndex->pSlots[i].used && pIndex->pSlots[i].key != key)
+  {
+    i = (i + 1) & pIndex->mask;
+  }
+  return &pIndex->pSlots[i];
+}
+
+/****************************************************************************/
+/*                           EXPORTED FUNCTIONS                             */
+/****************************************************************************/
+
+E_OTA_LAYOUT_STATUS
+OtaCatalogCheckLayout(const OTA_CATALOG_IMAGE *pImage)
+{
+  const t_firmwareDescriptor *pDescriptor = &pImage->descriptor;
+  const uint32_t bankStart[3] = { FIRMWARE_BANK1_START, FIRMWARE_BANK2_START, FIRMWARE_BANK3_START };
+  const uint16_t bankSize[3] = { pDescriptor->wFirmWareBank1Size, pDescriptor->wFirmWareBank2Size,
+                                 pDescriptor->wFirmWareBank3Size };
+  uint32_t end = pDescriptor->wFirmWareCommonSize;
+  uint8_t i;
+
+  if (0 == pDescriptor->wFirmWareCommonSize)
+  {
+    return OTA_LAYOUT_NO_COMMON;
+  }
+  if (pDescriptor->wFirmWareCommonSize > MCU_BANK_SIZE)
+  {
+    return OTA_LAYOUT_BANK_OVERFLOW;
+  }
+  for (i = 0; i < 3; i++)
+  {
+    if (bankSize[i] > MCU_BANK_SIZE)
+    {
+      return OTA_LAYOUT_BANK_OVERFLOW;
+    }
+    if (bankSize[i])
+    {
+      end = bankStart[i] + bankSize[i];
+    }
+  }
+  if (0 == pImage->imageLength)
+  {
+    return OTA_LAYOUT_OK;
+  }
+  if (pImage->imageLength > FIRMWARE_MCU_SIZE)
+  {
+    return OTA_LAYOUT_IMAGE_OVERFLOW;
+  }
+  if (pImage->imageLength < end)
+  {
+    return OTA_LAYOUT_IMAGE_TRUNCATED;
+  }
+  return OTA_LAYOUT_OK;
+}
+
+BOOL
+OtaCatalogIndexBuild(
+  OTA_CATALOG_INDEX *pIndex,
+  const OTA_CATALOG_IMAGE *pImages,
+  uint32_t imageCount)
+{
+  uint32_t slots = MIN_SLOTS;
+  uint32_t i;
+
+  /* Keep the load at most one half */
+  while (slots < imageCount * 2)
+  {
+    slots <<= 1;
+  }
+  pIndex->pSlots = calloc(slots, sizeof(OTA_CATALOG_SLOT));
+  if (NULL == pIndex->pSlots)
+  {
+    return FALSE;
+  }
+  pIndex->pImages = pImages;
+  pIndex->imageCount = imageCount;
+  pIndex->mask = slots - 1;
+
+  for (i = 0; i < imageCount; i++)
+  {
+    const OTA_CATALOG_IMAGE *pImage = &pImages[i];
+    uint64_t key = MakeKey(pImage->descriptor.manufacturerID, pImage->descriptor.firmwareID,
+                           pImage->productTypeId, pImage->productId);
+    OTA_CATALOG_SLOT *pSlot = FindSlot(pIndex, key);
+
+    if (!pSlot->used)
+    {
+      pSlot->used = TRUE;
+      pSlot->key = key;
+      pSlot->image = OTA_CATALOG_NO_IMAGE;
+      pSlot->badImage = OTA_CATALOG_NO_IMAGE;
+    }
+
+    if (OTA_LAYOUT_OK != OtaCatalogCheckLayout(pImage))
+    {
+      if (OTA_CATALOG_NO_IMAGE == pSlot->badImage ||
+          pImage->applicationVersion > pImages[pSlot->badImage].applicationVersion)
+      {
+        pSlot->badImage = i;
+      }
+    }
+    else if (OTA_CATALOG_NO_IMAGE == pSlot->image ||
+             pImage->applicationVersion > pImages[pSlot->image].applicationVersion)
+    {
+      pSlot->image = i;
+      pSlot->conflict = FALSE;
+    }
+    else if (pImage->applicationVersion == pImages[pSlot->image].applicationVersion &&
+             pImage->descriptor.checksum != pImages[pSlot->image].descriptor.checksum)
+    {
+      pSlot->conflict = TRUE;
+    }
+  }
+  return TRUE;
+}
+
+void
+OtaCatalogIndexFree(OTA_CATALOG_INDEX *pIndex)
+{
+  free(pIndex->pSlots);
+  memset(pIndex, 0, sizeof(OTA_CATALOG_INDEX));
+}
+
+E_OTA_MATCH_STATUS
+OtaCatalogMatch(
+  const OTA_CATALOG_INDEX *pIndex,
+  const t_nvmDescriptor *pNode,
+  OTA_CATALOG_MATCH *pMatch)
+{
+  const OTA_CATALOG_SLOT *pSlot = FindSlot(pIndex, MakeKey(pNode->manufacturerID, pNode->firmwareID,
+                                                           pNode->productTypeID, pNode->productID));
+
+  pMatch->image = OTA_CATALOG_NO_IMAGE;
+  pMatch->badImage = OTA_CATALOG_NO_IMAGE;
+  pMatch->layout = OTA_LAYOUT_OK;
+  if (!pSlot->used)
+  {
+    pMatch->status = OTA_MATCH_NO_IMAGE;
+    return OTA_MATCH_NO_IMAGE;
+  }
+  /* A broken release newer than the image picked */
+  if (OTA_CATALOG_NO_IMAGE != pSlot->badImage
+      && (OTA_CATALOG_NO_IMAGE == pSlot->image
+          || pIndex->pImages[pSlot->badImage].applicationVersion > pIndex->pImages[pSlot->image].applicationVersion))
+  {
+    pMatch->badImage = pSlot->badImage;
+    pMatch->layout = (uint8_t)OtaCatalogCheckLayout(&pIndex->pImages[pSlot->badImage]);
+  }
+  if (OTA_CATALOG_NO_IMAGE == pSlot->image)
+  {
+    pMatch->image = pSlot->badImage;
+    pMatch->status = OTA_MATCH_BAD_LAYOUT;
+  }
+  else
+  {
+    pMatch->image = pSlot->image;
+    if (pSlot->conflict)
+    {
+      pMatch->status = OTA_MATCH_CONFLICT;
+    }
+    else if (pIndex->pImages[pSlot->image].applicationVersion > pNode->applicationVersion)
+    {
+      pMatch->status = OTA_MATCH_UPDATE;
+    }
+    else
+    {
+      pMatch->status = OTA_MATCH_UP_TO_DATE;
+    }
+  }
+  return (E_OTA_MATCH_STATUS)pMatch->status;
+}
+
+uint32_t
+OtaCatalogMatchFleet(
+  const OTA_CATALOG_INDEX *pIndex,
+  const t_nvmDescriptor *pFleet,
+  uint32_t fleetCount,
+  OTA_CATALOG_MATCH *pMatches)
+{
+  uint32_t updates = 0;
+  uint32_t i;
+
+  for (i = 0; i < fleetCount; i++)
+  {
+    if (OTA_MATCH_UPDATE == OtaCatalogMatch(pIndex, &pFleet[i], &pMatches[i]))
+    {
+      updates++;
+    }
+  }
+  return updates;
+}
@@ -0,0 +1,432 @@
+/****************************************************************************
+ *
+ * Description: FastLZ compressor for compressed OTA firmware images.
+ *
+ ****************************************************************************/
+
+/****************************************************************************/
+/*                              INCLUDE FILES                               */
+/****************************************************************************/
+#include <ZW_ota_compression_header.h>
+#include <stdlib.h>
+#include <string.h>
+#include <ZW_typedefs.h>
+#include <ZW_crc.h>
+#include <ZW_ota_compressor.h>
+
+/****************************************************************************/
+/*                      PRIVATE TYPES and DEFINITIONS                       */
+/****************************************************************************/
+
+#define FAST_HASH_BITS        13
+#define HIGH_HASH_BITS        15
+#define HIGH_CHAIN_DEPTH      256
+
+#define NO_POSITION           (-1)
+
+#define COST_INFINITE         0xFFFFFFFFUL
+
+/* Longest match encoded in two bytes */
+#define SHORT_MATCH_MAX       8
+
+/* Output cursor with the pending literal run */
+typedef struct _EMITTER_
+{
+  const uint8_t *pIn;
+  uint8_t *pOut;
+  uint32_t outPos;
+  uint32_t literalStart;     /* Input position of the first pending literal */
+  uint32_t literalCount;
+} EMITTER;
+
+/****************************************************************************/
+/*                           PRIVATE FUNCTIONS                              */
+/****************************************************************************/
+
+static uint32_t
+Hash3(
+  const uint8_t *p,
+  uint8_t bits)
+{
+  uint32_t v = ((uint32_t)p[0] << 16) | ((uint32_t)p[1] << 8) | p[2];
+
+  return (uint32_t)(v * 2654435761UL) >> (32 - bits);
+}
+
+static void
+FlushLiterals(EMITTER *pEmit)
+{
+  while (pEmit->literalCount)
+  {
+    uint32_t run = (pEmit->literalCount > OTA_FASTLZ_MAX_LITERALS) ? OTA_FASTLZ_MAX_LITERALS
+                                                                 : pEmit->literalCount;
+
+    pEmit->pOut[pEmit->outPos++] = (uint8_t)(run - 1);
+    memcpy(&pEmit->pOut[pEmit->outPos], &pEmit->pIn[pEmit->literalStart], run);
+    pEmit->outPos += run;
+    pEmit->literalStart += run;
+    pEmit->literalCount -= run;
+  }
+}
+
+static void
+EmitLiteral(
+  EMITTER *pEmit,
+  uint32_t position)
+{
+  if (0 == pEmit->literalCount)
+  {
+    pEmit->literalStart = position;
+  }
+  pEmit->literalCount++;
+}
+
+/* Emit a match of any length, split into instructions of at most OTA_FASTLZ_MAX_MATCH */
+static void
+EmitMatch(
+  EMITTER *pEmit,
+  uint32_t distance,
+  uint32_t length)
+{
+  uint32_t d = distance - 1;
+
+  FlushLiterals(pEmit);
+  while (length)
+  {
+    uint32_t chunk = length;
+
+    if (chunk > OTA_FASTLZ_MAX_MATCH)
+    {
+      /* Leave at least a minimum match for the next instruction */
+      chunk = (length - OTA_FASTLZ_MAX_MATCH >= OTA_FASTLZ_MIN_MATCH) ? OTA_FASTLZ_MAX_MATCH
+                                                                      : length - OTA_FASTLZ_MIN_MATCH;
+    }
+    if (chunk <= SHORT_MATCH_MAX)
+    {
+      pEmit->pOut[pEmit->outPos++] = (uint8_t)(((chunk - 2) << 5) | (d >> 8));
+    }
+    else
+    {
+      pEmit->pOut[pEmit->outPos++] = (uint8_t)((7 << 5) | (d >> 8));
+      pEmit->pOut[pEmit->outPos++] = (uint8_t)(chunk - 9);
+    }
+    pEmit->pOut[pEmit->outPos++] = (uint8_t)d;
+    length -= chunk;
+  }
+}
+
+static uint32_t
+MatchLength(
+  const uint8_t *pA,
+  const uint8_t *pB,
+  uint32_t maxLength)
+{
+  uint32_t length = 0;
+
+  while (length < maxLength && pA[length] == pB[length])
+  {
+    length++;
+  }
+  return length;
+}
+
+/* Greedy parse, one hash probe per position */
+static E_OTA_COMPRESS_STATUS
+CompressFast(
+  EMITTER *pEmit,
+  uint32_t length)
+{
+  const uint8_t *pIn = pEmit->pIn;
+  int32_t *pTable = malloc(sizeof(int32_t) << FAST_HASH_BITS);
+  uint32_t i = 0;
+
+  if (NULL == pTable)
+  {
+    return OTA_COMPRESS_NO_MEMORY;
+  }
+  memset(pTable, 0xFF, sizeof(int32_t) << FAST_HASH_BITS);
+  while (i + OTA_FASTLZ_MIN_MATCH <= length)
+  {
+    uint32_t h = Hash3(&pIn[i], FAST_HASH_BITS);
+    int32_t candidate = pTable[h];
+    uint32_t matchLength = 0;
+
+    pTable[h] = (int32_t)i;
+    if (NO_POSITION != candidate && i - (uint32_t)candidate <= OTA_FASTLZ_MAX_DISTANCE)
+    {
+      matchLength = MatchLength(&pIn[candidate], &pIn[i], length - i);
+    }
+    if (matchLength < OTA_FASTLZ_MIN_MATCH)
+    {
+      EmitLiteral(pEmit, i++);
+      continue;
+    }
+    EmitMatch(pEmit, i - (uint32_t)candidate, matchLength);
+    i += matchLength;
+    /* Index the end of the match, where the next repeat most likely starts */
+    if (i + OTA_FASTLZ_MIN_MATCH <= length)
+    {
+      pTable[Hash3(&pIn[i - 1], FAST_HASH_BITS)] = (int32_t)(i - 1);
+    }
+  }
+  while (i < length)
+  {
+    EmitLiteral(pEmit, i++);
+  }
+  FlushLiterals(pEmit);
+  free(pTable);
+  return OTA_COMPRESS_OK;
+}
+
+/*
+ * Optimal parse. Every position is reached either by a literal or by a
+ * match ending there; the instruction cost does not depend on the distance,
+ * so the longest match at a position yields every shorter one as well.
+ * Literal cost includes the run header every OTA_FASTLZ_MAX_LITERALS bytes.
+ */
+static E_OTA_COMPRESS_STATUS
+CompressHigh(
+  EMITTER *pEmit,
+  uint32_t length)
+{
+  const uint8_t *pIn = pEmit->pIn;
+  int32_t *pHead = malloc(sizeof(int32_t) << HIGH_HASH_BITS);
+  int32_t *pPrev = malloc(length * sizeof(int32_t));
+  uint32_t *pCost = malloc((length + 1) * sizeof(uint32_t));
+  uint16_t *pStep = malloc((length + 1) * sizeof(uint16_t));
+  uint16_t *pDistance = malloc((length + 1) * sizeof(uint16_t));
+  uint8_t *pRun = malloc(length + 1);
+  uint32_t i;
+  E_OTA_COMPRESS_STATUS status = OTA_COMPRESS_NO_MEMORY;
+
+  if (NULL == pHead || NULL == pPrev || NULL == pCost || NULL == pStep || NULL == pDistance || NULL == pRun)
+  {
+    goto done;
+  }
+  memset(pHead, 0xFF, sizeof(int32_t) << HIGH_HASH_BITS);
+  for (i = 1; i <= length; i++)
+  {
+    pCost[i] = COST_INFINITE;
+  }
+  pCost[0] = 0;
+  pRun[0] = 0;
+
+  for (i = 0; i < length; i++)
+  {
+    uint32_t cost = pCost[i] + 1 + (0 == pRun[i]);
+    uint32_t bestLength = 0;
+    uint32_t bestDistance = 0;
+    uint32_t l;
+
+    /* Literal */
+    if (cost < pCost[i + 1])
+    {
+      pCost[i + 1] = cost;
+      pStep[i + 1] = 0;
+      pRun[i + 1] = (uint8_t)((pRun[i] + 1) & (OTA_FASTLZ_MAX_LITERALS - 1));
+    }
+    if (i + OTA_FASTLZ_MIN_MATCH > length)
+    {
+      continue;
+    }
+
+    /* Longest match within the window */
+    {
+      uint32_t h = Hash3(&pIn[i], HIGH_HASH_BITS);
+      uint32_t maxLength = (length - i < OTA_FASTLZ_MAX_MATCH) ? length - i : OTA_FASTLZ_MAX_MATCH;
+      int32_t candidate = pHead[h];
+      uint32_t depth = HIGH_CHAIN_DEPTH;
+
+      pPrev[i] = candidate;
+      pHead[h] = (int32_t)i;
+      while (NO_POSITION != candidate && i - (uint32_t)candidate <= OTA_FASTLZ_MAX_DISTANCE && depth--)
+      {
+        if (pIn[candidate + bestLength] == pIn[i + bestLength])
+        {
+          uint32_t matchLength = MatchLength(&pIn[candidate], &pIn[i], maxLength);
+          if (matchLength > bestLength)
+          {
+            bestLength = matchLength;
+            bestDistance = i - (uint32_t)candidate;
+            if (matchLength == maxLength)
+            {
+              break;
+            }
+          }
+        }
+        candidate = pPrev[candidate];
+      }
+    }
+
+    for (l = OTA_FASTLZ_MIN_MATCH; l <= bestLength; l++)
+    {
+      cost = pCost[i] + ((l <= SHORT_MATCH_MAX) ? 2 : 3);
+      if (cost < pCost[i + l])
+      {
+        pCost[i + l] = cost;
+        pStep[i + l] = (uint16_t)l;
+        pDistance[i + l] = (uint16_t)(bestDistance - 1);
+        pRun[i + l] = 0;
+      }
+    }
+  }
+
+  /* Walk back the cheapest path, then store each step at its start */
+  i = length;
+  while (i)
+  {
+    uint32_t step = pStep[i];
+
+    if (0 == step)
+    {
+      pPrev[--i] = 0;
+    }
+    else
+    {
+      i -= step;
+      pPrev[i] = (int32_t)(((uint32_t)pDistance[i + step] << 16) | step);
+    }
+  }
+  i = 0;
+  while (i < length)
+  {
+    uint32_t encoded = (uint32_t)pPrev[i];
+
+    if (0 == encoded)
+    {
+      EmitLiteral(pEmit, i++);
+    }
+    else
+    {
+      EmitMatch(pEmit, (encoded >> 16) + 1, encoded & 0xFFFF);
+      i += encoded & 0xFFFF;
+    }
+  }
+  FlushLiterals(pEmit);
+  status = OTA_COMPRESS_OK;
+
+done:
+  free(pHead);
+  free(pPrev);
+  free(pCost);
+  free(pStep);
+  free(pDistance);
+  free(pRun);
+  return status;
+}
+
+static void
+WriteBe16(
+  uint8_t *p,
+  uint16_t value)
+{
+  p[0] = (uint8_t)(value >> 8);
+  p[1] = (uint8_t)value;
+}
+
+/****************************************************************************/
+/*                           EXPORTED FUNCTIONS                             */
+/****************************************************************************/
+
+uint32_t
+OtaCompressBound(uint32_t length)
+{
+  return COMPRESSED_FIRMWARE_HEADER_PACKED_LENGTH + OTA_FASTLZ_BOUND(length);
+}
+
+E_OTA_COMPRESS_STATUS
+OtaFastLzCompress(
+  const uint8_t *pIn,
+  uint32_t length,
+  E_OTA_COMPRESS_MODE mode,
+  uint8_t *pOut,
+  uint32_t *pOutLength)
+{
+  EMITTER emit;
+  E_OTA_COMPRESS_STATUS status;
+
+  memset(&emit, 0, sizeof(emit));
+  emit.pIn = pIn;
+  emit.pOut = pOut;
+  if (0 == length)
+  {
+    *pOutLength = 0;
+    return OTA_COMPRESS_OK;
+  }
+  if (OTA_COMPRESS_HIGH == mode)
+  {
+    status = CompressHigh(&emit, length);
+  }
+  else
+  {
+    status = CompressFast(&emit, length);
+  }
+  *pOutLength = emit.outPos;
+  return status;
+}
+
+E_OTA_COMPRESS_STATUS
+OtaCompressImage(
+  const uint8_t *pImage,
+  uint32_t length,
+  const uint8_t *pScramblingKey,
+  uint16_t firmwareDescriptorChecksum,
+  E_OTA_COMPRESS_MODE mode,
+  uint8_t *pOut,
+  uint32_t outCapacity,
+  uint32_t *pOutLength)
+{
+  uint8_t *pData = pOut + COMPRESSED_FIRMWARE_HEADER_PACKED_LENGTH;
+  uint8_t *pTemp = NULL;
+  uint32_t dataLength;
+  uint16_t crc;
+  E_OTA_COMPRESS_STATUS status;
+
+  if (outCapacity < COMPRESSED_FIRMWARE_HEADER_PACKED_LENGTH)
+  {
+    return OTA_COMPRESS_BUFFER_TOO_SMALL;
+  }
+  if (outCapacity < OtaCompressBound(length))
+  {
+    /* Compress aside, the result may still fit */
+    pTemp = malloc(OTA_FASTLZ_BOUND(length));
+    if (NULL == pTemp)
+    {
+      return OTA_COMPRESS_NO_MEMORY;
+    }
+    pData = pTemp;
+  }
+  status = OtaFastLzCompress(pImage, length, mode, pData, &dataLength);
+  if (OTA_COMPRESS_OK == status && pTemp)
+  {
+    if (dataLength > outCapacity - COMPRESSED_FIRMWARE_HEADER_PACKED_LENGTH)
+    {
+      status = OTA_COMPRESS_BUFFER_TOO_SMALL;
+    }
+    else
+    {
+      memcpy(pOut + COMPRESSED_FIRMWARE_HEADER_PACKED_LENGTH, pTemp, dataLength);
+    }
+  }
+  free(pTemp);
+  if (OTA_COMPRESS_OK != status)
+  {
+    return status;
+  }
+
+  pOut[OTA_HEADER_OFFSET_TYPE] = COMPRESSION_HEADER_TYPE_V1;
+  pOut[OTA_HEADER_OFFSET_COMPRESSED_LENGTH] = (uint8_t)(dataLength >> 24);
+  pOut[OTA_HEADER_OFFSET_COMPRESSED_LENGTH + 1] = (uint8_t)(dataLength >> 16);
+  pOut[OTA_HEADER_OFFSET_COMPRESSED_LENGTH + 2] = (uint8_t)(dataLength >> 8);
+  pOut[OTA_HEADER_OFFSET_COMPRESSED_LENGTH + 3] = (uint8_t)dataLength;
+  WriteBe16(&pOut[OTA_HEADER_OFFSET_COMPRESSED_CRC], 0);
+  WriteBe16(&pOut[OTA_HEADER_OFFSET_UNCOMPRESSED_CRC], ZW_CheckCrc16(CRC_INIT_VALUE, pImage, length));
+  memcpy(&pOut[OTA_HEADER_OFFSET_SCRAMBLING_KEY], pScramblingKey, 16);
+  WriteBe16(&pOut[OTA_HEADER_OFFSET_DESCRIPTOR_CRC], firmwareDescriptorChecksum);
+
+  crc = ZW_CheckCrc16(CRC_INIT_VALUE, pOut, COMPRESSED_FIRMWARE_HEADER_PACKED_LENGTH);
+  crc = ZW_CheckCrc16(crc, pOut + COMPRESSED_FIRMWARE_HEADER_PACKED_LENGTH, dataLength);
+  WriteBe16(&pOut[OTA_HEADER_OFFSET_COMPRESSED_CRC], crc);
+  *pOutLength = COMPRESSED_FIRMWARE_HEADER_PACKED_LENGTH + dataLength;
+  return OTA_COMPRESS_OK;
+}
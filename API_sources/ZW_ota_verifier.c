@@ -0,0 +1,517 @@
+/****************************************************************************
+ *
+ * Description: Streaming decompressor and verifier for compressed OTA
+ *              firmware images.
+ *
+ ****************************************************************************/
+
+/****************************************************************************/
+/*                              INCLUDE FILES                               */
+/****************************************************************************/
+#include <ZW_ota_compression_header.h>
+#include <stddef.h>
+#include <string.h>
+#include <pthread.h>
+#include <unistd.h>
+#include <ZW_typedefs.h>
+#include <ZW_crc.h>
+#include <ZW_ota_verifier.h>
+
+/****************************************************************************/
+/*                      PRIVATE TYPES and DEFINITIONS                       */
+/****************************************************************************/
+
+/* Instruction with a length byte, 111DDDDD llllllll dddddddd */
+#define LONG_MATCH            7
+
+/* Shared by the threads of OtaVerifyCatalog() */
+typedef struct _CATALOG_
+{
+  pthread_mutex_t lock;
+  OTA_VERIFY_JOB *pJobs;
+  uint32_t jobCount;
+  uint32_t nextJob;
+  uint32_t failed;
+} CATALOG;
+
+/****************************************************************************/
+/*                           PRIVATE FUNCTIONS                              */
+/****************************************************************************/
+
+static uint16_t
+ReadBe16(const uint8_t *p)
+{
+  return (uint16_t)((p[0] << 8) | p[1]);
+}
+
+static void
+Fail(
+  OTA_VERIFY *pVerify,
+  E_OTA_VERIFY_STATUS status)
+{
+  if (OTA_VERIFY_IN_PROGRESS == pVerify->status)
+  {
+    pVerify->status = status;
+  }
+}
+
+/* Copy the part of a firmware segment that falls in [fieldOffset, fieldOffset + 2) */
+static void
+CaptureBe16(
+  uint16_t *pField,
+  uint32_t fieldOffset,
+  uint32_t segmentOffset,
+  const uint8_t *pSegment,
+  uint32_t segmentLength)
+{
+  uint8_t i;
+
+  for (i = 0; i < 2; i++)
+  {
+    uint32_t offset = fieldOffset + i;
+
+    if (offset >= segmentOffset && offset - segmentOffset < segmentLength)
+    {
+      uint8_t shift = (0 == i) ? 8 : 0;
+
+      *pField = (uint16_t)((*pField & ~(0xFF << shift)) | (pSegment[offset - segmentOffset] << shift));
+    }
+  }
+}
+
+/**
+ * Pass the firmware written to the window since the last flush to the CRC,
+ * the descriptor capture and the sink.
+ */
+static void
+Flush(OTA_VERIFY *pVerify)
+{
+  uint32_t start = pVerify->flushedLength % OTA_VERIFY_WINDOW;
+  uint32_t length = pVerify->imageLength - pVerify->flushedLength;
+  const uint8_t *pSegment = &pVerify->window[start];
+
+  if (0 == length)
+  {
+    return;
+  }
+  pVerify->imageCrc = ZW_CheckCrc16(pVerify->imageCrc, pSegment, length);
+  if (pVerify->expect.checks & OTA_VERIFY_CHECK_DESCRIPTOR)
+  {
+    if (pVerify->flushedLength < OTA_VERIFY_DESCRIPTOR_POINTER_OFFSET + 2)
+    {
+      CaptureBe16(&pVerify->descriptorOffset, OTA_VERIFY_DESCRIPTOR_POINTER_OFFSET,
+                  pVerify->flushedLength, pSegment, length);
+    }
+    /* The pointer precedes the descriptor, so it is complete by now */
+    if (pVerify->flushedLength + length > OTA_VERIFY_DESCRIPTOR_POINTER_OFFSET + 2)
+    {
+      CaptureBe16(&pVerify->descriptorChecksum,
+                  (uint32_t)pVerify->descriptorOffset + OTA_VERIFY_DESCRIPTOR_CHECKSUM_OFFSET,
+                  pVerify->flushedLength, pSegment, length);
+    }
+  }
+  if (pVerify->pSink && !pVerify->pSink(pVerify->pUser, pVerify->flushedLength, pSegment, length))
+  {
+    Fail(pVerify, OTA_VERIFY_ABORTED);
+  }
+  pVerify->flushedLength = pVerify->imageLength;
+  if (OTA_VERIFY_WINDOW == pVerify->windowPos)
+  {
+    pVerify->windowPos = 0;
+  }
+}
+
+static BOOL
+Reserve(
+  OTA_VERIFY *pVerify,
+  uint32_t length)
+{
+  if (pVerify->expect.maxImageLength &&
+      length > pVerify->expect.maxImageLength - pVerify->imageLength)
+  {
+    Fail(pVerify, OTA_VERIFY_TOO_LARGE);
+    return FALSE;
+  }
+  return TRUE;
+}
+
+static void
+OutputLiterals(
+  OTA_VERIFY *pVerify,
+  const uint8_t *pData,
+  uint32_t length)
+{
+  while (length)
+  {
+    uint32_t chunk = OTA_VERIFY_WINDOW - pVerify->windowPos;
+
+    if (chunk > length)
+    {
+      chunk = length;
+    }
+    memcpy(&pVerify->window[pVerify->windowPos], pData, chunk);
+    pVerify->windowPos += chunk;
+    pVerify->imageLength += chunk;
+    pData += chunk;
+    length -= chunk;
+    if (OTA_VERIFY_WINDOW == pVerify->windowPos)
+    {
+      Flush(pVerify);
+    }
+  }
+}
+
+static void
+OutputMatch(
+  OTA_VERIFY *pVerify,
+  uint32_t distance,
+  uint32_t length)
+{
+  uint8_t *pWindow = pVerify->window;
+
+  if (distance > pVerify->imageLength)
+  {
+    Fail(pVerify, OTA_VERIFY_CORRUPT);
+    return;
+  }
+  if (!Reserve(pVerify, length))
+  {
+    return;
+  }
+  while (length)
+  {
+    uint32_t from = (pVerify->windowPos - distance) & (OTA_VERIFY_WINDOW - 1);
+    uint32_t chunk = OTA_VERIFY_WINDOW - pVerify->windowPos;
+    uint8_t *pTo = &pWindow[pVerify->windowPos];
+    uint32_t i;
+
+    if (chunk > length)
+    {
+      chunk = length;
+    }
+    if (chunk > OTA_VERIFY_WINDOW - from)
+    {
+      chunk = OTA_VERIFY_WINDOW - from;
+    }
+    if (distance >= chunk)
+    {
+      /* At the full window distance source and destination may overlap */
+      memmove(pTo, &pWindow[from], chunk);
+    }
+    else
+    {
+      /* Overlapping copy repeats the last distance bytes */
+      for (i = 0; i < chunk; i++)
+      {
+        pTo[i] = pWindow[from + i];
+      }
+    }
+    pVerify->windowPos += chunk;
+    pVerify->imageLength += chunk;
+    length -= chunk;
+    if (OTA_VERIFY_WINDOW == pVerify->windowPos)
+    {
+      Flush(pVerify);
+    }
+  }
+}
+
+static void
+HeaderComplete(OTA_VERIFY *pVerify)
+{
+  const uint8_t *pHeader = pVerify->header;
+  uint8_t zero[2] = { 0, 0 };
+
+  if (COMPRESSION_HEADER_TYPE_V1 != pHeader[OTA_HEADER_OFFSET_TYPE])
+  {
+    Fail(pVerify, OTA_VERIFY_BAD_HEADER_TYPE);
+    return;
+  }
+  pVerify->compressedLength = ((uint32_t)pHeader[OTA_HEADER_OFFSET_COMPRESSED_LENGTH] << 24) |
+                              ((uint32_t)pHeader[OTA_HEADER_OFFSET_COMPRESSED_LENGTH + 1] << 16) |
+                              ((uint32_t)pHeader[OTA_HEADER_OFFSET_COMPRESSED_LENGTH + 2] << 8) |
+                              pHeader[OTA_HEADER_OFFSET_COMPRESSED_LENGTH + 3];
+  pVerify->compressedCrc = ZW_CheckCrc16(CRC_INIT_VALUE, pHeader, OTA_HEADER_OFFSET_COMPRESSED_CRC);
+  pVerify->compressedCrc = ZW_CheckCrc16(pVerify->compressedCrc, zero, sizeof(zero));
+  pVerify->compressedCrc = ZW_CheckCrc16(pVerify->compressedCrc, &pHeader[OTA_HEADER_OFFSET_COMPRESSED_CRC + 2],
+                                         COMPRESSED_FIRMWARE_HEADER_PACKED_LENGTH - OTA_HEADER_OFFSET_COMPRESSED_CRC - 2);
+}
+
+/* Decompress a chunk of compressed data, all of it within compressedLength */
+static void
+Decompress(
+  OTA_VERIFY *pVerify,
+  const uint8_t *pData,
+  uint32_t length)
+{
+  const uint8_t *pEnd = pData + length;
+
+  while (pData < pEnd && OTA_VERIFY_IN_PROGRESS == pVerify->status)
+  {
+    uint8_t *pInstruction = pVerify->instruction;
+    uint8_t needed;
+
+    if (pVerify->literalsLeft)
+    {
+      uint32_t chunk = (uint32_t)(pEnd - pData);
+
+      if (chunk > pVerify->literalsLeft)
+      {
+        chunk = pVerify->literalsLeft;
+      }
+      OutputLiterals(pVerify, pData, chunk);
+      pVerify->literalsLeft -= (uint8_t)chunk;
+      pData += chunk;
+      continue;
+    }
+
+    pInstruction[pVerify->instructionCount++] = *pData++;
+    if (pVerify->firstInstruction)
+    {
+      /* The top bits of the first instruction carry the level */
+      if (pInstruction[0] >> 5)
+      {
+        Fail(pVerify, OTA_VERIFY_CORRUPT);
+        return;
+      }
+      pVerify->firstInstruction = FALSE;
+    }
+    needed = (pInstruction[0] < 32) ? 1 : ((LONG_MATCH == pInstruction[0] >> 5) ? 3 : 2);
+    if (pVerify->instructionCount < needed)
+    {
+      continue;
+    }
+    pVerify->instructionCount = 0;
+
+    if (1 == needed)
+    {
+      pVerify->literalsLeft = (uint8_t)(pInstruction[0] + 1);
+      if (!Reserve(pVerify, pVerify->literalsLeft))
+      {
+        return;
+      }
+    }
+    else
+    {
+      uint32_t distance = ((uint32_t)(pInstruction[0] & 31) << 8) + pInstruction[needed - 1] + 1;
+      uint32_t matchLength = (3 == needed) ? (uint32_t)pInstruction[1] + 9 : (uint32_t)(pInstruction[0] >> 5) + 2;
+
+      OutputMatch(pVerify, distance, matchLength);
+    }
+  }
+}
+
+static void *
+CatalogWorker(void *pArg)
+{
+  CATALOG *pCatalog = (CATALOG *)pArg;
+
+  for (;;)
+  {
+    OTA_VERIFY_JOB *pJob;
+    uint32_t index;
+
+    pthread_mutex_lock(&pCatalog->lock);
+    index = pCatalog->nextJob;
+    if (index < pCatalog->jobCount)
+    {
+      pCatalog->nextJob++;
+    }
+    pthread_mutex_unlock(&pCatalog->lock);
+    if (index >= pCatalog->jobCount)
+    {
+      return NULL;
+    }
+
+    pJob = &pCatalog->pJobs[index];
+    pJob->status = (uint8_t)OtaVerifyImage(pJob->pImage, pJob->length, &pJob->expect, &pJob->imageLength);
+    if (OTA_VERIFY_OK != pJob->status)
+    {
+      pthread_mutex_lock(&pCatalog->lock);
+      pCatalog->failed++;
+      pthread_mutex_unlock(&pCatalog->lock);
+    }
+  }
+}
+
+/****************************************************************************/
+/*                           EXPORTED FUNCTIONS                             */
+/****************************************************************************/
+
+void
+OtaVerifyInit(
+  OTA_VERIFY *pVerify,
+  const OTA_VERIFY_EXPECT *pExpect,
+  OTA_VERIFY_SINK_FUNC pSink,
+  void *pUser)
+{
+  memset(pVerify, 0, offsetof(OTA_VERIFY, window));
+  pVerify->status = OTA_VERIFY_IN_PROGRESS;
+  pVerify->firstInstruction = TRUE;
+  pVerify->imageCrc = CRC_INIT_VALUE;
+  if (pExpect)
+  {
+    pVerify->expect = *pExpect;
+  }
+  pVerify->pSink = pSink;
+  pVerify->pUser = pUser;
+}
+
+E_OTA_VERIFY_STATUS
+OtaVerifyData(
+  OTA_VERIFY *pVerify,
+  const uint8_t *pData,
+  uint32_t length)
+{
+  uint32_t chunk;
+
+  if (OTA_VERIFY_IN_PROGRESS != pVerify->status)
+  {
+    return (E_OTA_VERIFY_STATUS)pVerify->status;
+  }
+
+  if (pVerify->headerCount < COMPRESSED_FIRMWARE_HEADER_PACKED_LENGTH)
+  {
+    chunk = COMPRESSED_FIRMWARE_HEADER_PACKED_LENGTH - pVerify->headerCount;
+    if (chunk > length)
+    {
+      chunk = length;
+    }
+    memcpy(&pVerify->header[pVerify->headerCount], pData, chunk);
+    pVerify->headerCount += (uint8_t)chunk;
+    pData += chunk;
+    length -= chunk;
+    if (pVerify->headerCount < COMPRESSED_FIRMWARE_HEADER_PACKED_LENGTH)
+    {
+      return OTA_VERIFY_IN_PROGRESS;
+    }
+    HeaderComplete(pVerify);
+  }
+
+  chunk = pVerify->compressedLength - pVerify->dataCount;
+  if (length > chunk)
+  {
+    Fail(pVerify, OTA_VERIFY_TRAILING_DATA);
+    length = chunk;
+  }
+  if (length && OTA_VERIFY_IN_PROGRESS == pVerify->status)
+  {
+    pVerify->compressedCrc = ZW_CheckCrc16(pVerify->compressedCrc, pData, length);
+    pVerify->dataCount += length;
+    Decompress(pVerify, pData, length);
+    Flush(pVerify);
+  }
+  return (E_OTA_VERIFY_STATUS)pVerify->status;
+}
+
+E_OTA_VERIFY_STATUS
+OtaVerifyFinish(OTA_VERIFY *pVerify)
+{
+  const uint8_t *pHeader = pVerify->header;
+
+  if (OTA_VERIFY_IN_PROGRESS != pVerify->status)
+  {
+    return (E_OTA_VERIFY_STATUS)pVerify->status;
+  }
+  if (pVerify->headerCount < COMPRESSED_FIRMWARE_HEADER_PACKED_LENGTH ||
+      pVerify->dataCount < pVerify->compressedLength)
+  {
+    Fail(pVerify, OTA_VERIFY_TRUNCATED);
+  }
+  else if (pVerify->instructionCount || pVerify->literalsLeft)
+  {
+    Fail(pVerify, OTA_VERIFY_CORRUPT);
+  }
+  else if (ReadBe16(&pHeader[OTA_HEADER_OFFSET_COMPRESSED_CRC]) != pVerify->compressedCrc)
+  {
+    Fail(pVerify, OTA_VERIFY_COMPRESSED_CRC_MISMATCH);
+  }
+  else if (ReadBe16(&pHeader[OTA_HEADER_OFFSET_UNCOMPRESSED_CRC]) != pVerify->imageCrc)
+  {
+    Fail(pVerify, OTA_VERIFY_IMAGE_CRC_MISMATCH);
+  }
+  else if ((pVerify->expect.checks & OTA_VERIFY_CHECK_APPLICATION_CRC) &&
+           pVerify->expect.applicationImageCrc != pVerify->imageCrc)
+  {
+    Fail(pVerify, OTA_VERIFY_APPLICATION_CRC_MISMATCH);
+  }
+  else if ((pVerify->expect.checks & OTA_VERIFY_CHECK_DESCRIPTOR) &&
+           (pVerify->imageLength < OTA_VERIFY_DESCRIPTOR_POINTER_OFFSET + 2 ||
+            pVerify->descriptorOffset < OTA_VERIFY_DESCRIPTOR_POINTER_OFFSET + 2 ||
+            pVerify->imageLength < (uint32_t)pVerify->descriptorOffset + sizeof(t_firmwareDescriptor)))
+  {
+    Fail(pVerify, OTA_VERIFY_DESCRIPTOR_MISSING);
+  }
+  else if ((pVerify->expect.checks & OTA_VERIFY_CHECK_DESCRIPTOR) &&
+           ReadBe16(&pHeader[OTA_HEADER_OFFSET_DESCRIPTOR_CRC]) != pVerify->descriptorChecksum)
+  {
+    Fail(pVerify, OTA_VERIFY_DESCRIPTOR_CHECKSUM_MISMATCH);
+  }
+  else
+  {
+    pVerify->status = OTA_VERIFY_OK;
+  }
+  return (E_OTA_VERIFY_STATUS)pVerify->status;
+}
+
+E_OTA_VERIFY_STATUS
+OtaVerifyImage(
+  const uint8_t *pImage,
+  uint32_t length,
+  const OTA_VERIFY_EXPECT *pExpect,
+  uint32_t *pImageLength)
+{
+  OTA_VERIFY verify;
+  E_OTA_VERIFY_STATUS status;
+
+  OtaVerifyInit(&verify, pExpect, NULL, NULL);
+  OtaVerifyData(&verify, pImage, length);
+  status = OtaVerifyFinish(&verify);
+  if (pImageLength)
+  {
+    *pImageLength = verify.imageLength;
+  }
+  return status;
+}
+
+uint32_t
+OtaVerifyCatalog(
+  OTA_VERIFY_JOB *pJobs,
+  uint32_t jobCount,
+  uint8_t threads)
+{
+  CATALOG catalog;
+  pthread_t thread[255];
+  uint32_t started = 0;
+  uint32_t i;
+
+  if (0 == threads)
+  {
+    long cpus = sysconf(_SC_NPROCESSORS_ONLN);
+
+    threads = (cpus < 1) ? 1 : ((cpus > 255) ? 255 : (uint8_t)cpus);
+  }
+  if (threads > jobCount)
+  {
+    threads = (uint8_t)((jobCount < 1) ? 1 : jobCount);
+  }
+
+  catalog.pJobs = pJobs;
+  catalog.jobCount = jobCount;
+  catalog.nextJob = 0;
+  catalog.failed = 0;
+  pthread_mutex_init(&catalog.lock, NULL);
+
+  /* The calling thread is one of the workers */
+  while (started + 1 < threads && 0 == pthread_create(&thread[started], NULL, CatalogWorker, &catalog))
+  {
+    started++;
+  }
+  CatalogWorker(&catalog);
+  for (i = 0; i < started; i++)
+  {
+    pthread_join(thread[i], NULL);
+  }
+  pthread_mutex_destroy(&catalog.lock);
+  return catalog.failed;
+}
@@ -0,0 +1,710 @@
+/****************************************************************************
+ *
+ * Description: SmartStart provisioning list indexed by DSK and home ID.
+ *
+ ****************************************************************************/
+
+/****************************************************************************/
+/*                              INCLUDE FILES                               */
+/****************************************************************************/
+#include <stddef.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <ZW_typedefs.h>
+#include <ZW_classcmd.h>
+#include <ZW_provisioning_store.h>
+
+/****************************************************************************/
+/*                      PRIVATE TYPES and DEFINITIONS                       */
+/****************************************************************************/
+
+#define FILE_MAGIC              0x5053575AUL   /* "ZWSP" */
+#define FILE_VERSION            1
+
+#define MIN_ENTRIES             64
+
+/* Index slot values, otherwise entry number + 1 */
+#define INDEX_EMPTY             0
+#define INDEX_DELETED           0xFFFFFFFFUL
+
+#define NO_SLOT                 0xFFFFFFFFUL
+
+/* Appended to the file name while a rebuilt file is written */
+#define REBUILD_SUFFIX          ".rebuild"
+
+/* Node Provision Set/Delete/Report: cc, cmd, seqNo, properties1, DSK */
+#define PROVISION_HEADER        4
+
+/*
+ * File layout, all in host byte order:
+ *   FILE_HEADER
+ *   ENTRY_SLOT[entryCapacity]
+ *   uint32_t dskIndex[indexCapacity]
+ *   uint32_t homeIdIndex[indexCapacity]
+ * indexCapacity is twice entryCapacity, a power of two.
+ */
+typedef struct _FILE_HEADER_
+{
+  uint32_t magic;
+  uint32_t version;
+  uint32_t entryCapacity;
+  uint32_t entryCount;
+  uint32_t entryHighWater;      /* Slots below were used at some point */
+  uint32_t freeHead;            /* Free slot list, NO_SLOT if empty */
+  uint32_t tombstones;          /* INDEX_DELETED slots in each index */
+  uint32_t reserved[9];
+} FILE_HEADER;
+
+typedef struct _ENTRY_SLOT_
+{
+  PROVISIONING_ENTRY entry;
+  uint16_t used;
+  uint16_t reserved;
+  uint32_t nextFree;
+} ENTRY_SLOT;
+
+struct _PROVISIONING_STORE_
+{
+  char *pPath;
+  int fd;
+  uint8_t *pMap;
+  size_t mapSize;
+  FILE_HEADER *pHeader;
+  ENTRY_SLOT *pSlots;
+  uint32_t *pDskIndex;
+  uint32_t *pHomeIdIndex;
+};
+
+/****************************************************************************/
+/*                           PRIVATE FUNCTIONS                              */
+/****************************************************************************/
+
+static size_t
+FileSize(uint32_t entryCapacity)
+{
+  return sizeof(FILE_HEADER)
+         + (size_t)entryCapacity * sizeof(ENTRY_SLOT)
+         + (size_t)entryCapacity * 2 * 2 * sizeof(uint32_t);
+}
+
+/* FNV-1a */
+static uint32_t
+Hash(
+  const uint8_t *p,
+  uint8_t length)
+{
+  uint32_t hash = 0x811C9DC5UL;
+
+  while (length--)
+  {
+    hash = (hash ^ *p++) * 0x01000193UL;
+  }
+  return hash;
+}
+
+static E_PROVISIONING_STORE_STATUS
+MapFile(
+  PROVISIONING_STORE *pStore,
+  size_t size)
+{
+  void *pMap;
+  uint32_t capacity;
+
+  if (pStore->pMap)
+  {
+    munmap(pStore->pMap, pStore->mapSize);
+    pStore->pMap = NULL;
+  }
+  pMap = mmap(NULL, size, PROT_READ | PROT_WRITE, MAP_SHARED, pStore->fd, 0);
+  if (MAP_FAILED == pMap)
+  {
+    return PROVISIONING_STORE_IO_ERROR;
+  }
+  pStore->pMap = pMap;
+  pStore->mapSize = size;
+  pStore->pHeader = (FILE_HEADER *)pStore->pMap;
+  capacity = pStore->pHeader->entryCapacity;
+  pStore->pSlots = (ENTRY_SLOT *)(pStore->pMap + sizeof(FILE_HEADER));
+  pStore->pDskIndex = (uint32_t *)(pStore->pSlots + capacity);
+  pStore->pHomeIdIndex = pStore->pDskIndex + capacity * 2;
+  return PROVISIONING_STORE_OK;
+}
+
+/* Create or truncate a file to an empty store and map it, pStore->fd is opened */
+static E_PROVISIONING_STORE_STATUS
+FileCreate(
+  PROVISIONING_STORE *pStore,
+  const char *pPath,
+  uint32_t entryCapacity)
+{
+  FILE_HEADER header;
+
+  memset(&header, 0, sizeof(header));
+  header.magic = FILE_MAGIC;
+  header.version = FILE_VERSION;
+  header.entryCapacity = entryCapacity;
+  header.freeHead = NO_SLOT;
+  /* Extending the truncated file makes it read back as zeros */
+  pStore->fd = open(pPath, O_RDWR | O_CREAT | O_TRUNC, 0644);
+  if (pStore->fd < 0
+      || 0 != ftruncate(pStore->fd, (off_t)FileSize(entryCapacity))
+      || pwrite(pStore->fd, &header, sizeof(header), 0) != (ssize_t)sizeof(header))
+  {
+    return PROVISIONING_STORE_IO_ERROR;
+  }
+  return MapFile(pStore, FileSize(entryCapacity));
+}
+
+/* Index position holding an entry with the key, starting after *pPos.
+ * *pPos = NO_SLOT starts a new lookup */
+static ENTRY_SLOT *
+IndexFind(
+  const PROVISIONING_STORE *pStore,
+  const uint32_t *pIndex,
+  uint32_t hash,
+  const uint8_t *pKey,
+  uint8_t keyOffset,
+  uint8_t keyLength,
+  uint32_t *pPos)
+{
+  uint32_t mask = pStore->pHeader->entryCapacity * 2 - 1;
+  uint32_t pos = (NO_SLOT == *pPos) ? (hash & mask) : ((*pPos + 1) & mask);
+  uint32_t probes;
+
+  for (probes = 0; probes <= mask; probes++)
+  {
+    uint32_t value = pIndex[pos];
+
+    if (INDEX_EMPTY == value)
+    {
+      break;
+    }
+    if (INDEX_DELETED != value)
+    {
+      ENTRY_SLOT *pSlot = &pStore->pSlots[value - 1];
+
+      if (0 == memcmp((const uint8_t *)&pSlot->entry + keyOffset, pKey, keyLength))
+      {
+        *pPos = pos;
+        return pSlot;
+      }
+    }
+    pos = (pos + 1) & mask;
+  }
+  return NULL;
+}
+
+static void
+IndexInsert(
+  PROVISIONING_STORE *pStore,
+  uint32_t *pIndex,
+  uint32_t hash,
+  uint32_t slot)
+{
+  uint32_t mask = pStore->pHeader->entryCapacity * 2 - 1;
+  uint32_t pos = hash & mask;
+
+  while (INDEX_EMPTY != pIndex[pos] && INDEX_DELETED != pIndex[pos])
+  {
+    pos = (pos + 1) & mask;
+  }
+  pIndex[pos] = slot + 1;
+}
+
+static void
+IndexRemove(
+  PROVISIONING_STORE *pStore,
+  uint32_t *pIndex,
+  uint32_t hash,
+  uint32_t slot)
+{
+  uint32_t mask = pStore->pHeader->entryCapacity * 2 - 1;
+  uint32_t pos = hash & mask;
+
+  while (INDEX_EMPTY != pIndex[pos])
+  {
+    if (slot + 1 == pIndex[pos])
+    {
+      pIndex[pos] = INDEX_DELETED;
+      return;
+    }
+    pos = (pos + 1) & mask;
+  }
+}
+
+static void
+Insert(
+  PROVISIONING_STORE *pStore,
+  uint32_t slot)
+{
+  const PROVISIONING_ENTRY *pEntry = &pStore->pSlots[slot].entry;
+
+  IndexInsert(pStore, pStore->pDskIndex, Hash(pEntry->dsk, PROVISIONING_DSK_LENGTH), slot);
+  IndexInsert(pStore, pStore->pHomeIdIndex, Hash(pEntry->homeId, 4), slot);
+}
+
+/*
+ * Rewrite the file with a new capacity. Entries are packed to the start of
+ * the table and the indexes rebuilt, which drops the tombstones.
+ *
+ * The new file is written under another name and renamed over the old one,
+ * so a crash or a full disk leaves the old file, and the old mapping stays
+ * in use until the rename succeeded.
+ */
+static E_PROVISIONING_STORE_STATUS
+Rebuild(
+  PROVISIONING_STORE *pStore,
+  uint32_t entryCapacity)
+{
+  PROVISIONING_STORE newStore;
+  uint32_t highWater = pStore->pHeader->entryHighWater;
+  char *pNewPath;
+  uint32_t count = 0;
+  uint32_t i;
+  E_PROVISIONING_STORE_STATUS status;
+
+  pNewPath = malloc(strlen(pStore->pPath) + sizeof(REBUILD_SUFFIX));
+  if (NULL == pNewPath)
+  {
+    return PROVISIONING_STORE_NO_MEMORY;
+  }
+  sprintf(pNewPath, "%s%s", pStore->pPath, REBUILD_SUFFIX);
+  memset(&newStore, 0, sizeof(newStore));
+  status = FileCreate(&newStore, pNewPath, entryCapacity);
+  if (PROVISIONING_STORE_OK == status)
+  {
+    for (i = 0; i < highWater; i++)
+    {
+      if (pStore->pSlots[i].used)
+      {
+        newStore.pSlots[count] = pStore->pSlots[i];
+        Insert(&newStore, count);
+        count++;
+      }
+    }
+    newStore.pHeader->entryCount = count;
+    newStore.pHeader->entryHighWater = count;
+    /* On disk before it replaces the old file */
+    if (0 != msync(newStore.pMap, newStore.mapSize, MS_SYNC)
+        || 0 != rename(pNewPath, pStore->pPath))
+    {
+      status = PROVISIONING_STORE_IO_ERROR;
+    }
+  }
+  if (PROVISIONING_STORE_OK != status)
+  {
+    if (newStore.pMap)
+    {
+      munmap(newStore.pMap, newStore.mapSize);
+    }
+    if (newStore.fd >= 0)
+    {
+      close(newStore.fd);
+      unlink(pNewPath);
+    }
+    free(pNewPath);
+    return status;
+  }
+  free(pNewPath);
+  munmap(pStore->pMap, pStore->mapSize);
+  close(pStore->fd);
+  newStore.pPath = pStore->pPath;
+  *pStore = newStore;
+  return PROVISIONING_STORE_OK;
+}
+
+/*
+ * Check the links of a mapped file against its header, so a damaged body
+ * cannot make lookups or inserts reach outside the mapping.
+ */
+static BOOL
+BodyValid(const PROVISIONING_STORE *pStore)
+{
+  const FILE_HEADER *pHeader = pStore->pHeader;
+  uint32_t highWater = pHeader->entryHighWater;
+  uint32_t slot = pHeader->freeHead;
+  uint32_t steps = 0;
+  uint32_t i;
+
+  for (i = 0; i < highWater; i++)
+  {
+    if (pStore->pSlots[i].used && pStore->pSlots[i].entry.tlvLength > PROVISIONING_STORE_MAX_TLV)
+    {
+      return FALSE;
+    }
+  }
+  /* The free list only holds unused slots below the high water mark, once */
+  while (NO_SLOT != slot)
+  {
+    if (slot >= highWater || pStore->pSlots[slot].used || steps++ == highWater)
+    {
+      return FALSE;
+    }
+    slot = pStore->pSlots[slot].nextFree;
+  }
+  /* Both indexes, they are contiguous */
+  for (i = 0; i < pHeader->entryCapacity * 2 * 2; i++)
+  {
+    uint32_t value = pStore->pDskIndex[i];
+
+    if (INDEX_DELETED != value && value > highWater)
+    {
+      return FALSE;
+    }
+  }
+  return TRUE;
+}
+
+/* Check that TLVs add up */
+static BOOL
+TlvValid(
+  const uint8_t *pTlv,
+  uint16_t length)
+{
+  uint16_t offset = 0;
+
+  while (offset < length)
+  {
+    if (length - offset < 2 || pTlv[offset + 1] > length - offset - 2)
+    {
+      return FALSE;
+    }
+    offset = (uint16_t)(offset + 2 + pTlv[offset + 1]);
+  }
+  return TRUE;
+}
+
+/****************************************************************************/
+/*                           EXPORTED FUNCTIONS                             */
+/****************************************************************************/
+
+E_PROVISIONING_STORE_STATUS
+ProvisioningStoreOpen(
+  const char *pPath,
+  uint32_t capacity,
+  PROVISIONING_STORE **ppStore)
+{
+  PROVISIONING_STORE *pStore = calloc(1, sizeof(PROVISIONING_STORE));
+  FILE_HEADER header;
+  struct stat st;
+  uint32_t entryCapacity = MIN_ENTRIES;
+  E_PROVISIONING_STORE_STATUS status = PROVISIONING_STORE_IO_ERROR;
+
+  if (NULL == pStore)
+  {
+    return PROVISIONING_STORE_NO_MEMORY;
+  }
+  while (entryCapacity < capacity && entryCapacity < 0x1000000UL)
+  {
+    entryCapacity *= 2;
+  }
+  pStore->pPath = strdup(pPath);
+  if (NULL == pStore->pPath)
+  {
+    free(pStore);
+    return PROVISIONING_STORE_NO_MEMORY;
+  }
+  pStore->fd = open(pPath, O_RDWR | O_CREAT, 0644);
+  if (pStore->fd < 0 || 0 != fstat(pStore->fd, &st))
+  {
+    goto fail;
+  }
+  if (0 == st.st_size)
+  {
+    /* New file */
+    close(pStore->fd);
+    status = FileCreate(pStore, pPath, entryCapacity);
+  }
+  else if ((size_t)st.st_size >= sizeof(header)
+           && pread(pStore->fd, &header, sizeof(header), 0) == (ssize_t)sizeof(header)
+           && FILE_MAGIC == header.magic && FILE_VERSION == header.version
+           && header.entryCapacity >= MIN_ENTRIES && header.entryCapacity <= 0x1000000UL
+           && 0 == (header.entryCapacity & (header.entryCapacity - 1))
+           && header.entryCount <= header.entryHighWater && header.entryHighWater <= header.entryCapacity
+           && (size_t)st.st_size == FileSize(header.entryCapacity))
+  {
+    status = MapFile(pStore, (size_t)st.st_size);
+    if (PROVISIONING_STORE_OK == status && !BodyValid(pStore))
+    {
+      status = PROVISIONING_STORE_DAMAGED;
+    }
+  }
+  else
+  {
+    /* Other format version or damaged file. It is the only copy of the
+     * list, so it is left for the application to deal with */
+    status = PROVISIONING_STORE_DAMAGED;
+  }
+  if (PROVISIONING_STORE_OK != status)
+  {
+    goto fail;
+  }
+  *ppStore = pStore;
+  return PROVISIONING_STORE_OK;
+
+fail:
+  if (pStore->pMap)
+  {
+    munmap(pStore->pMap, pStore->mapSize);
+  }
+  if (pStore->fd >= 0)
+  {
+    close(pStore->fd);
+  }
+  free(pStore->pPath);
+  free(pStore);
+  return status;
+}
+
+E_PROVISIONING_STORE_STATUS
+ProvisioningStoreSync(PROVISIONING_STORE *pStore)
+{
+  if (0 != msync(pStore->pMap, pStore->mapSize, MS_SYNC))
+  {
+    return PROVISIONING_STORE_IO_ERROR;
+  }
+  return PROVISIONING_STORE_OK;
+}
+
+E_PROVISIONING_STORE_STATUS
+ProvisioningStoreClose(PROVISIONING_STORE *pStore)
+{
+  E_PROVISIONING_STORE_STATUS status;
+
+  if (NULL == pStore)
+  {
+    return PROVISIONING_STORE_OK;
+  }
+  status = ProvisioningStoreSync(pStore);
+  munmap(pStore->pMap, pStore->mapSize);
+  close(pStore->fd);
+  free(pStore->pPath);
+  free(pStore);
+  return status;
+}
+
+void
+ProvisioningStoreHomeIdFromDsk(
+  const uint8_t *pDsk,
+  uint8_t *pHomeId)
+{
+  memcpy(pHomeId, &pDsk[8], 4);
+  pHomeId[0] |= 0xC0;
+  pHomeId[3] &= 0xFE;
+}
+
+E_PROVISIONING_STORE_STATUS
+ProvisioningStoreSet(
+  PROVISIONING_STORE *pStore,
+  const uint8_t *pDsk,
+  const uint8_t *pTlv,
+  uint16_t tlvLength)
+{
+  FILE_HEADER *pHeader = pStore->pHeader;
+  ENTRY_SLOT *pSlot;
+  uint32_t pos = NO_SLOT;
+  uint32_t slot;
+  E_PROVISIONING_STORE_STATUS status;
+
+  if (tlvLength > PROVISIONING_STORE_MAX_TLV || !TlvValid(pTlv, tlvLength))
+  {
+    return PROVISIONING_STORE_INVALID;
+  }
+  pSlot = IndexFind(pStore, pStore->pDskIndex, Hash(pDsk, PROVISIONING_DSK_LENGTH), pDsk,
+                    (uint8_t)offsetof(PROVISIONING_ENTRY, dsk), PROVISIONING_DSK_LENGTH, &pos);
+  if (NULL == pSlot)
+  {
+    /* Grow when full, or pack when tombstones fill a quarter of the indexes */
+    if (pHeader->entryCount == pHeader->entryCapacity)
+    {
+      status = Rebuild(pStore, pHeader->entryCapacity * 2);
+    }
+    else if (pHeader->entryCount + pHeader->tombstones >= pHeader->entryCapacity * 3 / 2)
+    {
+      status = Rebuild(pStore, pHeader->entryCapacity);
+    }
+    else
+    {
+      status = PROVISIONING_STORE_OK;
+    }
+    if (PROVISIONING_STORE_OK != status)
+    {
+      return status;
+    }
+    pHeader = pStore->pHeader;
+    if (NO_SLOT != pHeader->freeHead)
+    {
+      slot = pHeader->freeHead;
+      pHeader->freeHead = pStore->pSlots[slot].nextFree;
+    }
+    else
+    {
+      slot = pHeader->entryHighWater++;
+    }
+    pSlot = &pStore->pSlots[slot];
+    memset(pSlot, 0, sizeof(ENTRY_SLOT));
+    memcpy(pSlot->entry.dsk, pDsk, PROVISIONING_DSK_LENGTH);
+    ProvisioningStoreHomeIdFromDsk(pDsk, pSlot->entry.homeId);
+    pSlot->used = TRUE;
+    Insert(pStore, slot);
+    pHeader->entryCount++;
+  }
+  memcpy(pSlot->entry.tlv, pTlv, tlvLength);
+  pSlot->entry.tlvLength = tlvLength;
+  return PROVISIONING_STORE_OK;
+}
+
+E_PROVISIONING_STORE_STATUS
+ProvisioningStoreDelete(
+  PROVISIONING_STORE *pStore,
+  const uint8_t *pDsk)
+{
+  FILE_HEADER *pHeader = pStore->pHeader;
+  ENTRY_SLOT *pSlot;
+  uint32_t pos = NO_SLOT;
+  uint32_t slot;
+
+  pSlot = IndexFind(pStore, pStore->pDskIndex, Hash(pDsk, PROVISIONING_DSK_LENGTH), pDsk,
+                    (uint8_t)offsetof(PROVISIONING_ENTRY, dsk), PROVISIONING_DSK_LENGTH, &pos);
+  if (NULL == pSlot)
+  {
+    return PROVISIONING_STORE_NOT_FOUND;
+  }
+  slot = (uint32_t)(pSlot - pStore->pSlots);
+  pStore->pDskIndex[pos] = INDEX_DELETED;
+  IndexRemove(pStore, pStore->pHomeIdIndex, Hash(pSlot->entry.homeId, 4), slot);
+  pHeader->tombstones++;
+  pSlot->used = FALSE;
+  pSlot->nextFree = pHeader->freeHead;
+  pHeader->freeHead = slot;
+  pHeader->entryCount--;
+  return PROVISIONING_STORE_OK;
+}
+
+const PROVISIONING_ENTRY *
+ProvisioningStoreFindDsk(
+  const PROVISIONING_STORE *pStore,
+  const uint8_t *pDsk)
+{
+  uint32_t pos = NO_SLOT;
+  const ENTRY_SLOT *pSlot = IndexFind(pStore, pStore->pDskIndex, Hash(pDsk, PROVISIONING_DSK_LENGTH), pDsk,
+                                      (uint8_t)offsetof(PROVISIONING_ENTRY, dsk), PROVISIONING_DSK_LENGTH, &pos);
+
+  return pSlot ? &pSlot->entry : NULL;
+}
+
+const PROVISIONING_ENTRY *
+ProvisioningStoreFindHomeId(
+  const PROVISIONING_STORE *pStore,
+  const uint8_t *pHomeId,
+  uint32_t *pCursor)
+{
+  /* The cursor is the index position of the last match + 1, 0 to start */
+  uint32_t pos = *pCursor ? *pCursor - 1 : NO_SLOT;
+  const ENTRY_SLOT *pSlot = IndexFind(pStore, pStore->pHomeIdIndex, Hash(pHomeId, 4), pHomeId,
+                                      (uint8_t)offsetof(PROVISIONING_ENTRY, homeId), 4, &pos);
+
+  if (NULL == pSlot)
+  {
+    return NULL;
+  }
+  *pCursor = pos + 1;
+  return &pSlot->entry;
+}
+
+const PROVISIONING_ENTRY *
+ProvisioningStoreNext(
+  const PROVISIONING_STORE *pStore,
+  uint32_t *pCursor)
+{
+  while (*pCursor < pStore->pHeader->entryHighWater)
+  {
+    const ENTRY_SLOT *pSlot = &pStore->pSlots[(*pCursor)++];
+
+    if (pSlot->used)
+    {
+      return &pSlot->entry;
+    }
+  }
+  return NULL;
+}
+
+uint32_t
+ProvisioningStoreCount(const PROVISIONING_STORE *pStore)
+{
+  return pStore->pHeader->entryCount;
+}
+
+const uint8_t *
+ProvisioningEntryFindTlv(
+  const PROVISIONING_ENTRY *pEntry,
+  uint8_t type,
+  uint8_t *pLength)
+{
+  uint16_t offset = 0;
+
+  while (offset + 2 <= pEntry->tlvLength)
+  {
+    if (PROVISIONING_TLV_TYPE(pEntry->tlv[offset]) == type)
+    {
+      *pLength = pEntry->tlv[offset + 1];
+      return &pEntry->tlv[offset + 2];
+    }
+    offset = (uint16_t)(offset + 2 + pEntry->tlv[offset + 1]);
+  }
+  return NULL;
+}
+
+E_PROVISIONING_STORE_STATUS
+ProvisioningStoreHandleCommand(
+  PROVISIONING_STORE *pStore,
+  const uint8_t *pCmd,
+  uint8_t length)
+{
+  uint8_t dskLength;
+
+  if (length < PROVISION_HEADER || COMMAND_CLASS_NODE_PROVISIONING != pCmd[0])
+  {
+    return PROVISIONING_STORE_INVALID;
+  }
+  dskLength = pCmd[3] & NODE_PROVISION_SET_PROPERTIES1_DSK_LENGTH_MASK;
+  if (PROVISIONING_DSK_LENGTH != dskLength || length < PROVISION_HEADER + dskLength)
+  {
+    return PROVISIONING_STORE_INVALID;
+  }
+  if (NODE_PROVISION_SET == pCmd[1])
+  {
+    return ProvisioningStoreSet(pStore, &pCmd[PROVISION_HEADER], &pCmd[PROVISION_HEADER + dskLength],
+                                (uint16_t)(length - PROVISION_HEADER - dskLength));
+  }
+  if (NODE_PROVISION_DELETE == pCmd[1])
+  {
+    return ProvisioningStoreDelete(pStore, &pCmd[PROVISION_HEADER]);
+  }
+  return PROVISIONING_STORE_INVALID;
+}
+
+uint16_t
+ProvisioningStoreBuildReport(
+  const PROVISIONING_ENTRY *pEntry,
+  uint8_t seqNo,
+  uint8_t *pOut)
+{
+  pOut[0] = COMMAND_CLASS_NODE_PROVISIONING;
+  pOut[1] = NODE_PROVISION_REPORT;
+  pOut[2] = seqNo;
+  if (NULL == pEntry)
+  {
+    pOut[3] = 0;
+    return PROVISION_HEADER;
+  }
+  pOut[3] = PROVISIONING_DSK_LENGTH;
+  memcpy(&pOut[PROVISION_HEADER], pEntry->dsk, PROVISIONING_DSK_LENGTH);
+  memcpy(&pOut[PROVISION_HEADER + PROVISIONING_DSK_LENGTH], pEntry->tlv, pEntry->tlvLength);
+  return (uint16_t)(PROVISION_HEADER + PROVISIONING_DSK_LENGTH + pEntry->tlvLength);
+}
@@ -0,0 +1,403 @@
+/****************************************************************************
+ *
+ * Description: Security S0 frame encryption and authentication.
+ *
+ ****************************************************************************/
+
+/****************************************************************************/
+/*                              INCLUDE FILES                               */
+/****************************************************************************/
+#include <string.h>
+#include <ZW_typedefs.h>
+#include <ZW_classcmd.h>
+#include <ZW_aes.h>
+#include <ZW_s0_engine.h>
+
+/****************************************************************************/
+/*                      PRIVATE TYPES and DEFINITIONS                       */
+/****************************************************************************/
+
+/* Key derivation plaintexts */
+#define KEY_PATTERN_ENCRYPTION       0xAA
+#define KEY_PATTERN_AUTHENTICATION   0x55
+
+/* Offset of the encrypted payload in a frame */
+#define PAYLOAD_OFFSET               (2 + S0_NONCE_LENGTH)
+
+/* Authentication data before the encrypted payload: command, source, destination, length */
+#define AUTH_HEADER_LENGTH           4
+
+/* Authentication data of the longest payload, zero padded to whole blocks */
+#define AUTH_DATA_LENGTH             ((AUTH_HEADER_LENGTH + S0_MAX_PAYLOAD + AES_BLOCK_LENGTH - 1) \
+                                      / AES_BLOCK_LENGTH * AES_BLOCK_LENGTH)
+
+/* Frames S0DecryptBatch() steps through together, two AES blocks in flight each */
+#define BATCH_GROUP                  8
+
+/* A frame being decrypted */
+typedef struct _FRAME_WORK_
+{
+  S0_BATCH_FRAME *pJob;
+  uint8_t iv[AES_BLOCK_LENGTH];       /* Sender nonce, receiver nonce */
+  uint8_t mac[AES_BLOCK_LENGTH];      /* CBC-MAC state */
+  uint8_t ofb[AES_BLOCK_LENGTH];      /* OFB state */
+  uint8_t auth[AUTH_DATA_LENGTH];
+  uint8_t macSteps;                   /* IV block plus authentication data blocks */
+  uint8_t ofbSteps;                   /* Payload blocks */
+  uint8_t payloadLength;
+} FRAME_WORK;
+
+/****************************************************************************/
+/*                           PRIVATE FUNCTIONS                              */
+/****************************************************************************/
+
+static void
+XorBlock(
+  uint8_t *pOut,
+  const uint8_t *pA,
+  const uint8_t *pB,
+  uint8_t length)
+{
+  uint8_t i;
+
+  for (i = 0; i < length; i++)
+  {
+    pOut[i] = pA[i] ^ pB[i];
+  }
+}
+
+/* Authentication data, zero padded; returns its number of blocks */
+static uint8_t
+BuildAuthData(
+  uint8_t *pAuth,
+  uint8_t command,
+  uint8_t sourceNode,
+  uint8_t destinationNode,
+  const uint8_t *pCipher,
+  uint8_t length)
+{
+  uint16_t total = (uint16_t)(AUTH_HEADER_LENGTH + length);
+  uint16_t padded = (uint16_t)((total + AES_BLOCK_LENGTH - 1) / AES_BLOCK_LENGTH * AES_BLOCK_LENGTH);
+
+  pAuth[0] = command;
+  pAuth[1] = sourceNode;
+  pAuth[2] = destinationNode;
+  pAuth[3] = length;
+  memcpy(&pAuth[AUTH_HEADER_LENGTH], pCipher, length);
+  memset(&pAuth[total], 0, padded - total);
+  return (uint8_t)(padded / AES_BLOCK_LENGTH);
+}
+
+/* Compare without an early exit, so the time does not tell how much matched */
+static BOOL
+MacEqual(
+  const uint8_t *pA,
+  const uint8_t *pB)
+{
+  uint8_t diff = 0;
+  uint8_t i;
+
+  for (i = 0; i < S0_MAC_LENGTH; i++)
+  {
+    diff |= (uint8_t)(pA[i] ^ pB[i]);
+  }
+  return 0 == diff;
+}
+
+/* Check a frame and prepare its work; FALSE with pJob->status set if it is rejected */
+static BOOL
+WorkStart(
+  FRAME_WORK *pWork,
+  S0_BATCH_FRAME *pJob)
+{
+  const uint8_t *pFrame = pJob->pFrame;
+  uint8_t length;
+
+  pJob->payloadLength = 0;
+  if (pJob->frameLength <= S0_OVERHEAD
+      || COMMAND_CLASS_SECURITY != pFrame[0]
+      || (SECURITY_MESSAGE_ENCAPSULATION != pFrame[1]
+          && SECURITY_MESSAGE_ENCAPSULATION_NONCE_GET != pFrame[1]))
+  {
+    pJob->status = S0_INVALID;
+    return FALSE;
+  }
+  if (S0_RECEIVER_NONCE_ID(pFrame, pJob->frameLength) != pJob->pReceiverNonce[0])
+  {
+    pJob->status = S0_BAD_NONCE;
+    return FALSE;
+  }
+  length = (uint8_t)(pJob->frameLength - S0_OVERHEAD);
+  pWork->pJob = pJob;
+  pWork->payloadLength = length;
+  memcpy(pWork->iv, &pFrame[2], S0_NONCE_LENGTH);
+  memcpy(&pWork->iv[S0_NONCE_LENGTH], pJob->pReceiverNonce, S0_NONCE_LENGTH);
+  pWork->macSteps = (uint8_t)(1 + BuildAuthData(pWork->auth, pFrame[1], pJob->sourceNode,
+                                                pJob->destinationNode, &pFrame[PAYLOAD_OFFSET], length));
+  pWork->ofbSteps = (uint8_t)((length + AES_BLOCK_LENGTH - 1) / AES_BLOCK_LENGTH);
+  return TRUE;
+}
+
+/*
+ * Run the CBC-MAC and OFB of all frames of a group one block at a time, so
+ * every step is one AesEncryptBlocks() call over independent blocks.
+ */
+static uint32_t
+DecryptGroup(
+  FRAME_WORK *pWork,
+  uint8_t count)
+{
+  const AES_KEY_SCHEDULE *schedules[2 * BATCH_GROUP];
+  uint8_t *pState[2 * BATCH_GROUP];
+  uint8_t blocks[2 * BATCH_GROUP * AES_BLOCK_LENGTH];
+  uint32_t verified = 0;
+  uint8_t step;
+  uint8_t lanes;
+  uint8_t i;
+  uint8_t j;
+
+  for (step = 0; ; step++)
+  {
+    lanes = 0;
+    for (i = 0; i < count; i++)
+    {
+      FRAME_WORK *w = &pWork[i];
+      const S0_KEYS *pKeys = w->pJob->pKeys;
+
+      if (step < w->macSteps)
+      {
+        if (0 == step)
+        {
+          memcpy(&blocks[lanes * AES_BLOCK_LENGTH], w->iv, AES_BLOCK_LENGTH);
+        }
+        else
+        {
+          XorBlock(&blocks[lanes * AES_BLOCK_LENGTH], w->mac,
+                   &w->auth[(step - 1) * AES_BLOCK_LENGTH], AES_BLOCK_LENGTH);
+        }
+        schedules[lanes] = &pKeys->authentication;
+        pState[lanes++] = w->mac;
+      }
+      if (step < w->ofbSteps)
+      {
+        memcpy(&blocks[lanes * AES_BLOCK_LENGTH], 0 == step ? w->iv : w->ofb, AES_BLOCK_LENGTH);
+        schedules[lanes] = &pKeys->encryption;
+        pState[lanes++] = w->ofb;
+      }
+    }
+    if (0 == lanes)
+    {
+      break;
+    }
+    AesEncryptBlocks(schedules, blocks, blocks, lanes);
+    for (j = 0; j < lanes; j++)
+    {
+      memcpy(pState[j], &blocks[j * AES_BLOCK_LENGTH], AES_BLOCK_LENGTH);
+    }
+
+    /* Key stream of this step */
+    for (i = 0; i < count; i++)
+    {
+      FRAME_WORK *w = &pWork[i];
+      uint16_t offset = (uint16_t)(step * AES_BLOCK_LENGTH);
+
+      if (step < w->ofbSteps)
+      {
+        uint8_t n = (uint8_t)(w->payloadLength - offset < AES_BLOCK_LENGTH
+                              ? w->payloadLength - offset : AES_BLOCK_LENGTH);
+
+        XorBlock(&w->pJob->pPayload[offset], &w->pJob->pFrame[PAYLOAD_OFFSET + offset], w->ofb, n);
+      }
+    }
+  }
+
+  for (i = 0; i < count; i++)
+  {
+    S0_BATCH_FRAME *pJob = pWork[i].pJob;
+
+    if (MacEqual(pWork[i].mac, &pJob->pFrame[pJob->frameLength - S0_MAC_LENGTH]))
+    {
+      pJob->status = S0_OK;
+      pJob->payloadLength = pWork[i].payloadLength;
+      verified++;
+    }
+    else
+    {
+      /* Never hand out plaintext of a frame that failed authentication */
+      memset(pJob->pPayload, 0, pWork[i].payloadLength);
+      pJob->status = S0_BAD_MAC;
+    }
+  }
+  return verified;
+}
+
+/****************************************************************************/
+/*                           EXPORTED FUNCTIONS                             */
+/****************************************************************************/
+
+void
+S0EngineInit(
+  S0_ENGINE *pEngine)
+{
+  memset(pEngine, 0, sizeof(*pEngine));
+}
+
+void
+S0KeysDerive(
+  const uint8_t *pNetworkKey,
+  S0_KEYS *pKeys)
+{
+  AES_KEY_SCHEDULE network;
+  uint8_t block[AES_BLOCK_LENGTH];
+
+  AesKeyExpand(pNetworkKey, &network);
+  memset(block, KEY_PATTERN_ENCRYPTION, sizeof(block));
+  AesEncryptBlock(&network, block, block);
+  AesKeyExpand(block, &pKeys->encryption);
+  memset(block, KEY_PATTERN_AUTHENTICATION, sizeof(block));
+  AesEncryptBlock(&network, block, block);
+  AesKeyExpand(block, &pKeys->authentication);
+  memcpy(pKeys->networkKey, pNetworkKey, AES_KEY_LENGTH);
+  pKeys->valid = TRUE;
+  memset(block, 0, sizeof(block));
+  memset(&network, 0, sizeof(network));
+}
+
+const S0_KEYS *
+S0EngineKeys(
+  S0_ENGINE *pEngine,
+  const uint8_t *pNetworkKey)
+{
+  S0_KEYS *pVictim = &pEngine->keys[0];
+  uint8_t i;
+
+  pEngine->useCount++;
+  for (i = 0; i < S0_ENGINE_KEY_CACHE; i++)
+  {
+    S0_KEYS *pKeys = &pEngine->keys[i];
+
+    if (pKeys->valid && 0 == memcmp(pKeys->networkKey, pNetworkKey, AES_KEY_LENGTH))
+    {
+      pKeys->lastUse = pEngine->useCount;
+      return pKeys;
+    }
+    if (!pKeys->valid)
+    {
+      pVictim = pKeys;
+    }
+    else if (pVictim->valid && (int32_t)(pKeys->lastUse - pVictim->lastUse) < 0)
+    {
+      pVictim = pKeys;
+    }
+  }
+  S0KeysDerive(pNetworkKey, pVictim);
+  pVictim->lastUse = pEngine->useCount;
+  return pVictim;
+}
+
+uint8_t
+S0Encrypt(
+  const S0_KEYS *pKeys,
+  uint8_t command,
+  uint8_t sourceNode,
+  uint8_t destinationNode,
+  const uint8_t *pSenderNonce,
+  const uint8_t *pReceiverNonce,
+  const uint8_t *pPayload,
+  uint8_t payloadLength,
+  uint8_t *pFrame)
+{
+  uint8_t iv[AES_BLOCK_LENGTH];
+  uint8_t block[AES_BLOCK_LENGTH];
+  uint8_t auth[AUTH_DATA_LENGTH];
+  uint8_t *pCipher = &pFrame[PAYLOAD_OFFSET];
+  uint8_t authBlocks;
+  uint8_t offset;
+  uint8_t i;
+
+  if (0 == payloadLength || payloadLength > S0_MAX_PAYLOAD)
+  {
+    return 0;
+  }
+  memcpy(iv, pSenderNonce, S0_NONCE_LENGTH);
+  memcpy(&iv[S0_NONCE_LENGTH], pReceiverNonce, S0_NONCE_LENGTH);
+
+  /* OFB */
+  memcpy(block, iv, AES_BLOCK_LENGTH);
+  for (offset = 0; offset < payloadLength; offset = (uint8_t)(offset + i))
+  {
+    AesEncryptBlock(&pKeys->encryption, block, block);
+    i = (uint8_t)(payloadLength - offset < AES_BLOCK_LENGTH ? payloadLength - offset : AES_BLOCK_LENGTH);
+    XorBlock(&pCipher[offset], &pPayload[offset], block, i);
+  }
+
+  /* CBC-MAC over the encrypted payload */
+  authBlocks = BuildAuthData(auth, command, sourceNode, destinationNode, pCipher, payloadLength);
+  AesEncryptBlock(&pKeys->authentication, iv, block);
+  for (i = 0; i < authBlocks; i++)
+  {
+    XorBlock(block, block, &auth[i * AES_BLOCK_LENGTH], AES_BLOCK_LENGTH);
+    AesEncryptBlock(&pKeys->authentication, block, block);
+  }
+
+  pFrame[0] = COMMAND_CLASS_SECURITY;
+  pFrame[1] = command;
+  memcpy(&pFrame[2], pSenderNonce, S0_NONCE_LENGTH);
+  pFrame[PAYLOAD_OFFSET + payloadLength] = pReceiverNonce[0];
+  memcpy(&pFrame[PAYLOAD_OFFSET + payloadLength + 1], block, S0_MAC_LENGTH);
+  return (uint8_t)(payloadLength + S0_OVERHEAD);
+}
+
+E_S0_STATUS
+S0Decrypt(
+  const S0_KEYS *pKeys,
+  uint8_t sourceNode,
+  uint8_t destinationNode,
+  const uint8_t *pReceiverNonce,
+  const uint8_t *pFrame,
+  uint8_t frameLength,
+  uint8_t *pPayload,
+  uint8_t *pPayloadLength)
+{
+  S0_BATCH_FRAME job;
+
+  job.pKeys = pKeys;
+  job.pFrame = pFrame;
+  job.pReceiverNonce = pReceiverNonce;
+  job.pPayload = pPayload;
+  job.frameLength = frameLength;
+  job.sourceNode = sourceNode;
+  job.destinationNode = destinationNode;
+  S0DecryptBatch(&job, 1);
+  *pPayloadLength = job.payloadLength;
+  return (E_S0_STATUS)job.status;
+}
+
+uint32_t
+S0DecryptBatch(
+  S0_BATCH_FRAME *pFrames,
+  uint32_t count)
+{
+  FRAME_WORK work[BATCH_GROUP];
+  uint32_t verified = 0;
+  uint8_t pending = 0;
+  uint32_t i;
+
+  for (i = 0; i < count; i++)
+  {
+    if (!WorkStart(&work[pending], &pFrames[i]))
+    {
+      continue;
+    }
+    if (++pending == BATCH_GROUP)
+    {
+      verified += DecryptGroup(work, pending);
+      pending = 0;
+    }
+  }
+  if (pending)
+  {
+    verified += DecryptGroup(work, pending);
+  }
+  return verified;
+}
@@ -0,0 +1,127 @@
+/****************************************************************************
+ *
+ * Description: Batch decoder for Sensor Multilevel Reports.
+ *
+ ****************************************************************************/
+
+/****************************************************************************/
+/*                              INCLUDE FILES                               */
+/****************************************************************************/
+#include <string.h>
+#include <ZW_typedefs.h>
+#include <ZW_classcmd.h>
+#include <ZW_sensor_multilevel_decoder.h>
+
+/****************************************************************************/
+/*                      PRIVATE TYPES and DEFINITIONS                       */
+/****************************************************************************/
+
+/* Offset of the level byte and the value in a report */
+#define REPORT_LEVEL_OFFSET   3
+#define REPORT_VALUE_OFFSET   4
+
+/****************************************************************************/
+/*                              PRIVATE DATA                                */
+/****************************************************************************/
+
+/* Right shift turning the 32 bit word at the value offset into the value, per size field */
+static const uint8_t sizeShift[8] = { 0, 24, 16, 0, 0, 0, 0, 0 };
+
+/* 1 for size fields allowed by the specification */
+static const uint8_t sizeValid[8] = { 0, 1, 1, 0, 1, 0, 0, 0 };
+
+/* 10^-precision */
+static const double precisionFactor[8] =
+{
+  1.0, 1e-1, 1e-2, 1e-3, 1e-4, 1e-5, 1e-6, 1e-7
+};
+
+/****************************************************************************/
+/*                           PRIVATE FUNCTIONS                              */
+/****************************************************************************/
+
+/* Decode one record without data dependent branches. Returns 1 if valid */
+static inline uint32_t
+DecodeRecord(
+  const SENSOR_ML_RECORD *pRecord,
+  uint8_t *pSensorType,
+  uint8_t *pScale,
+  float *pValue)
+{
+  const uint8_t *pFrame = pRecord->frame;
+  uint8_t level = pFrame[REPORT_LEVEL_OFFSET];
+  uint8_t size = level & SENSOR_MULTILEVEL_REPORT_LEVEL_SIZE_MASK_V11;
+  uint8_t precision = (uint8_t)((level & SENSOR_MULTILEVEL_REPORT_LEVEL_PRECISION_MASK_V11)
+                                >> SENSOR_MULTILEVEL_REPORT_LEVEL_PRECISION_SHIFT_V11);
+  uint32_t word = ((uint32_t)pFrame[REPORT_VALUE_OFFSET] << 24)
+                  | ((uint32_t)pFrame[REPORT_VALUE_OFFSET + 1] << 16)
+                  | ((uint32_t)pFrame[REPORT_VALUE_OFFSET + 2] << 8)
+                  | (uint32_t)pFrame[REPORT_VALUE_OFFSET + 3];
+  /* Arithmetic shift sign extends 1 and 2 byte values */
+  int32_t value = (int32_t)word >> sizeShift[size];
+  uint32_t valid = (uint32_t)(pFrame[0] == COMMAND_CLASS_SENSOR_MULTILEVEL_V11)
+                   & (uint32_t)(pFrame[1] == SENSOR_MULTILEVEL_REPORT_V11)
+                   & sizeValid[size]
+                   & (uint32_t)(pRecord->frameLength >= REPORT_VALUE_OFFSET + size);
+
+  *pSensorType = pFrame[2];
+  *pScale = (uint8_t)((level & SENSOR_MULTILEVEL_REPORT_LEVEL_SCALE_MASK_V11)
+                      >> SENSOR_MULTILEVEL_REPORT_LEVEL_SCALE_SHIFT_V11);
+  *pValue = (float)((double)value * precisionFactor[precision]);
+  return valid;
+}
+
+/****************************************************************************/
+/*                           EXPORTED FUNCTIONS                             */
+/****************************************************************************/
+
+void
+SensorMultilevelRecordSet(
+  SENSOR_ML_RECORD *pRecord,
+  uint8_t nodeId,
+  const uint8_t *pFrame,
+  uint8_t frameLength)
+{
+  uint8_t copy = (frameLength < SENSOR_ML_RECORD_FRAME_SIZE) ? frameLength : SENSOR_ML_RECORD_FRAME_SIZE;
+
+  pRecord->nodeId = nodeId;
+  pRecord->frameLength = copy;
+  memset(pRecord->frame, 0, sizeof(pRecord->frame));
+  memcpy(pRecord->frame, pFrame, copy);
+}
+
+uint32_t
+SensorMultilevelDecodeBatch(
+  const SENSOR_ML_RECORD *pRecords,
+  uint32_t recordCount,
+  const SENSOR_ML_COLUMNS *pColumns)
+{
+  uint8_t *pNodeId = pColumns->pNodeId;
+  uint8_t *pSensorType = pColumns->pSensorType;
+  uint8_t *pScale = pColumns->pScale;
+  float *pValue = pColumns->pValue;
+  uint32_t out = 0;
+  uint32_t i;
+
+  for (i = 0; i < recordCount; i++)
+  {
+    /* Always write the row, only keep it if valid */
+    pNodeId[out] = pRecords[i].nodeId;
+    out += DecodeRecord(&pRecords[i], &pSensorType[out], &pScale[out], &pValue[out]);
+  }
+  return out;
+}
+
+BOOL
+SensorMultilevelDecode(
+  const uint8_t *pFrame,
+  uint8_t frameLength,
+  uint8_t *pSensorType,
+  uint8_t *pScale,
+  float *pValue)
+{
+  SENSOR_ML_RECORD record;
+
+  SensorMultilevelRecordSet(&record, 0, pFrame, frameLength);
+  return DecodeRecord(&record, pSensorType, pScale, pValue) ? TRUE : FALSE;
+}
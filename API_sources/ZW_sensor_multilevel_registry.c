@@ -0,0 +1,158 @@
+/****************************************************************************
+ *
+ * Description: Compiled Multilevel Sensor type and scale registry.
+ *
+ ****************************************************************************/
+
+/****************************************************************************/
+/*                              INCLUDE FILES                               */
+/****************************************************************************/
+#include <math.h>
+#include <stddef.h>
+#include <ZW_typedefs.h>
+#include <ZW_sensor_multilevel_registry.h>
+
+/****************************************************************************/
+/*                      PRIVATE TYPES and DEFINITIONS                       */
+/****************************************************************************/
+
+/* Must match tools/gen_sensor_multilevel_registry.py */
+#define NO_NAME                        0xFFFF
+#define SENSOR_TYPE_FLAG_DEPRECATED    0x01
+
+/* Scale coefficient of unassigned type/scale pairs */
+#define SI_INVALID                     NAN
+
+/* Table index of a type/scale pair */
+#define SLOT(sensorType, scale)        (((uint16_t)(sensorType) << 2) | ((scale) & 0x03))
+
+typedef struct _SENSOR_SCALE_ENTRY_
+{
+  uint16_t nameOffset;           /* NO_NAME if not assigned */
+  uint8_t requiredVersion;
+} SENSOR_SCALE_ENTRY;
+
+/****************************************************************************/
+/*                              PRIVATE DATA                                */
+/****************************************************************************/
+
+#include "ZW_sensor_multilevel_registry_table.c"
+
+/* Indexed by E_SENSOR_SI_UNIT */
+static const char * const siSymbols[] =
+{
+  "", "", "K", "lx", "W", "kg/m3", "m/s", "rad", "Pa", "W/m2", "m", "kg", "V", "A",
+  "m3/s", "m3", "Hz", "ohm m", "ohm", "S/m", "s", "mol/m3", "Bq/m3", "J", "m/s2", "N"
+};
+
+/****************************************************************************/
+/*                           PRIVATE FUNCTIONS                              */
+/****************************************************************************/
+
+static const SENSOR_SCALE_ENTRY *
+LookupScale(
+  uint8_t sensorType,
+  uint8_t scale)
+{
+  uint16_t slot = SLOT(sensorType, scale);
+
+  if (scale > 3 || slot >= SENSOR_SCALE_SLOTS || NO_NAME == sensorScales[slot].nameOffset)
+  {
+    return NULL;
+  }
+  return &sensorScales[slot];
+}
+
+/****************************************************************************/
+/*                           EXPORTED FUNCTIONS                             */
+/****************************************************************************/
+
+const char *
+SensorMultilevelTypeName(
+  uint8_t sensorType)
+{
+  uint16_t offset = sensorTypeName[sensorType];
+
+  return (NO_NAME == offset) ? NULL : &sensorNames[offset];
+}
+
+BOOL
+SensorMultilevelTypeDeprecated(
+  uint8_t sensorType)
+{
+  return (sensorTypeFlags[sensorType] & SENSOR_TYPE_FLAG_DEPRECATED) ? TRUE : FALSE;
+}
+
+const char *
+SensorMultilevelScaleName(
+  uint8_t sensorType,
+  uint8_t scale)
+{
+  const SENSOR_SCALE_ENTRY *pEntry = LookupScale(sensorType, scale);
+
+  return pEntry ? &sensorNames[pEntry->nameOffset] : NULL;
+}
+
+uint8_t
+SensorMultilevelScaleVersion(
+  uint8_t sensorType,
+  uint8_t scale)
+{
+  const SENSOR_SCALE_ENTRY *pEntry = LookupScale(sensorType, scale);
+
+  return pEntry ? pEntry->requiredVersion : 0;
+}
+
+const char *
+SensorMultilevelSiSymbol(
+  E_SENSOR_SI_UNIT unit)
+{
+  if ((unsigned)unit >= sizeof(siSymbols) / sizeof(siSymbols[0]))
+  {
+    return "";
+  }
+  return siSymbols[unit];
+}
+
+float
+SensorMultilevelToSi(
+  uint8_t sensorType,
+  uint8_t scale,
+  float value,
+  E_SENSOR_SI_UNIT *pUnit)
+{
+  uint16_t slot = SLOT(sensorType, scale);
+
+  if (pUnit)
+  {
+    *pUnit = (E_SENSOR_SI_UNIT)sensorSiUnit[slot];
+  }
+  return value * sensorSiScale[slot] + sensorSiOffset[slot];
+}
+
+void
+SensorMultilevelNormalizeBatch(
+  const SENSOR_ML_COLUMNS *pColumns,
+  uint32_t rowCount,
+  float *pSiValue,
+  uint8_t *pSiUnit)
+{
+  const uint8_t *pSensorType = pColumns->pSensorType;
+  const uint8_t *pScale = pColumns->pScale;
+  const float *pValue = pColumns->pValue;
+  uint32_t i;
+
+  /* Gather the coefficients and multiply-add; no data dependent branches */
+  for (i = 0; i < rowCount; i++)
+  {
+    uint16_t slot = SLOT(pSensorType[i], pScale[i]);
+    pSiValue[i] = pValue[i] * sensorSiScale[slot] + sensorSiOffset[slot];
+  }
+  if (pSiUnit)
+  {
+    for (i = 0; i < rowCount; i++)
+    {
+      pSiUnit[i] = sensorSiUnit[SLOT(pSensorType[i], pScale[i])];
+    }
+  }
+}
@@ -0,0 +1,1375 @@
+/****************************************************************************
+ *
+ * Description: Multilevel Sensor type and scale tables.
+ *
+ * Generated by tools/gen_sensor_multilevel_registry.py from "Registries/
+ * Multilevel Sensor Command Class, list of assigned Multilevel Sensor
+ * types and scales.xlsx". Do not edit.
+ *
+ ****************************************************************************/
+
+#define SENSOR_ML_TYPE_COUNT  88
+#define SENSOR_SCALE_SLOTS    356
+
+static const char sensorNames[2938] =
+  "Air temperature" "\0"
+  "Celcius (C)" "\0"
+  "Fahrenheit (F)" "\0"
+  "General purpose" "\0"
+  "Percentage value (%)" "\0"
+  "Dimensionless value" "\0"
+  "Illuminance" "\0"
+  "Lux" "\0"
+  "Power" "\0"
+  "Watt (W)" "\0"
+  "Btu/h" "\0"
+  "Humidity" "\0"
+  "Absolute humidity (g/m3)" "\0"
+  "Velocity" "\0"
+  "m/s" "\0"
+  "Mph" "\0"
+  "Direction" "\0"
+  "0 to 360 degrees" "\0"
+  "Atmospheric pressure" "\0"
+  "Kilopascal (kPa)" "\0"
+  "Inches of Mercury" "\0"
+  "Barometric pressure" "\0"
+  "Solar radiation" "\0"
+  "Watt per square meter (W/m2)" "\0"
+  "Dew point" "\0"
+  "Rain rate" "\0"
+  "Millimeter/hour (mm/h)" "\0"
+  "Inches per hour (in/h)" "\0"
+  "Tide level" "\0"
+  "Meter (m)" "\0"
+  "Feet (ft)" "\0"
+  "Weight" "\0"
+  "Kilogram (kg)" "\0"
+  "Pounds (lb)" "\0"
+  "Voltage" "\0"
+  "Volt (V)" "\0"
+  "Millivolt (mV)" "\0"
+  "Current" "\0"
+  "Ampere (A)" "\0"
+  "Milliampere (mA)" "\0"
+  "Carbon dioxide CO2-level" "\0"
+  "Parts/million (ppm)" "\0"
+  "Air flow" "\0"
+  "Cubic meter per hour (m3/h)" "\0"
+  "Cubic feet per minute (cfm)" "\0"
+  "Tank capacity" "\0"
+  "Liter (l)" "\0"
+  "Cubic meter (m3)" "\0"
+  "Gallons" "\0"
+  "Distance" "\0"
+  "Centimeter (cm)" "\0"
+  "Angle position" "\0"
+  "Degrees relative to north pole of standing eye view" "\0"
+  "Rotation" "\0"
+  "Revolutions per minute (rpm)" "\0"
+  "Hertz (Hz)" "\0"
+  "Water temperature" "\0"
+  "Soil temperature" "\0"
+  "Seismic Intensity" "\0"
+  "Mercalli" "\0"
+  "European Macroseismic" "\0"
+  "Liedu" "\0"
+  "Shindo" "\0"
+  "Seismic magnitude" "\0"
+  "Local" "\0"
+  "Moment" "\0"
+  "Surface wave" "\0"
+  "Body wave" "\0"
+  "Ultraviolet" "\0"
+  "UV index" "\0"
+  "Electrical resistivity" "\0"
+  "Ohm meter (\316\251m)" "\0"
+  "Electrical conductivity" "\0"
+  "Siemens per meter (S/m)" "\0"
+  "Loudness" "\0"
+  "Decibel (dB)" "\0"
+  "A-weighted decibels (dBA)" "\0"
+  "Moisture" "\0"
+  "Volume water content (m3/m3)" "\0"
+  "Impedance (k\316\251)" "\0"
+  "Water activity (aw)" "\0"
+  "Frequency" "\0"
+  "kilohertz (kHz)" "\0"
+  "Time" "\0"
+  "Second (s)" "\0"
+  "Target temperature" "\0"
+  "Particulate Matter 2.5" "\0"
+  "Mole per cubic meter (mol/m3)" "\0"
+  "Microgram per cubic meter (\302\265g/m3)" "\0"
+  "Formaldehyde CH2O-level" "\0"
+  "Radon concentration" "\0"
+  "Becquerel per cubic meter (bq/m3)" "\0"
+  "Picocuries per liter (pCi/l)" "\0"
+  "Methane (CH4) density" "\0"
+  "Volatile Organic Compound level" "\0"
+  "Carbon monoxide (CO) level" "\0"
+  "Soil humidity" "\0"
+  "Soil reactivity" "\0"
+  "Acidity (pH)" "\0"
+  "Soil salinity" "\0"
+  "Heart rate" "\0"
+  "Beats per minute (bpm)" "\0"
+  "Blood pressure" "\0"
+  "Systolic (mmHg) (upper #)" "\0"
+  "Diastolic (mmHg) (lower #)" "\0"
+  "Muscle mass" "\0"
+  "Fat mass" "\0"
+  "Bone mass" "\0"
+  "Total body water (TBW)" "\0"
+  "Basis metabolic rate (BMR)" "\0"
+  "Joule (J)" "\0"
+  "Body Mass Index (BMI)" "\0"
+  "BMI Index" "\0"
+  "Acceleration X-axis" "\0"
+  "Meter per square second (m/s2)" "\0"
+  "Acceleration Y-axis" "\0"
+  "Acceleration Z-axis" "\0"
+  "Smoke density" "\0"
+  "Water flow" "\0"
+  "Liter per hour (l/h)" "\0"
+  "Water pressure" "\0"
+  "RF signal strength" "\0"
+  "RSSI (percentage value)" "\0"
+  "dBm" "\0"
+  "Particulate Matter 10" "\0"
+  "Respiratory rate" "\0"
+  "Breaths per minute (bpm)" "\0"
+  "Relative Modulation level" "\0"
+  "Boiler water temperature" "\0"
+  "Domestic Hot Water (DHW) temperature" "\0"
+  "Outside temperature" "\0"
+  "Exhaust temperature" "\0"
+  "Water Chlorine level" "\0"
+  "Milligram per liter (mg/l)" "\0"
+  "Water acidity" "\0"
+  "Water Oxidation reduction potential" "\0"
+  "MilliVolt (mV)" "\0"
+  "Heart Rate LF/HF ratio" "\0"
+  "Unitless" "\0"
+  "Motion Direction" "\0"
+  "Applied force on the sensor" "\0"
+  "Newton (N)" "\0"
+  "Return Air temperature" "\0"
+  "Supply Air temperature" "\0"
+  "Condenser Coil temperature" "\0"
+  "Evaporator Coil temperature" "\0"
+  "Liquid Line temperature" "\0"
+  "Discharge Line temperature" "\0"
+  "Suction (input pump/compressor) Pressure" "\0"
+  "Pound per square inch (psi)" "\0"
+  "Discharge (output pump/compressor) Pressure" "\0"
+  "Defrost temperature (sensor used to decide when to defrost)" "\0"
+  "Ozone (O3)" "\0"
+  "Micro gram per cubic meter (\316\274g/m3)" "\0"
+  "Sulfur dioxide (SO2)" "\0"
+  "Nitrogen dioxide (NO2)" "\0"
+  "Ammonia (NH3)" "\0"
+  "Lead (Pb)" "\0"
+  "Particulate Matter 1" "\0"
+  "Person counter (entering)" "\0"
+  "Person counter (exiting)" "\0";
+
+/* Name offset per sensor type */
+static const uint16_t sensorTypeName[256] =
+{
+  0xFFFF, 0x0000, 0x002B, 0x0064, 0x0074, 0x0089, 0x00AB, 0x00BC,
+  0x00D7, 0x010F, 0x0123, 0x0150, 0x015A, 0x0192, 0x01B1, 0x01D2,
+  0x01F2, 0x0216, 0x0243, 0x0284, 0x02B5, 0x02CE, 0x0311, 0x0342,
+  0x0354, 0x0365, 0x03A3, 0x03D9, 0x03EE, 0x0415, 0x0445, 0x0475,
+  0x04BF, 0x04D9, 0x04E9, 0x04FC, 0x0554, 0x056C, 0x05BF, 0x05D5,
+  0x05F5, 0x0610, 0x061E, 0x063B, 0x0649, 0x066B, 0x06AF, 0x06BB,
+  0x06C4, 0x06CE, 0x06E5, 0x070A, 0x072A, 0x075D, 0x0771, 0x0785,
+  0x0793, 0x07B3, 0x07C2, 0x07F1, 0x0807, 0x0831, 0x084B, 0x0864,
+  0x0889, 0x089D, 0x08B1, 0x08E1, 0x08EF, 0x0922, 0x0942, 0x0953,
+  0x097A, 0x0991, 0x09A8, 0x09C3, 0x09DF, 0x09F7, 0x0A12, 0x0A57,
+  0x0A83, 0x0ABF, 0x0AEE, 0x0B03, 0x0B1A, 0x0B28, 0x0B32, 0x0B47,
+  0x0B61, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+};
+
+/* SENSOR_TYPE_FLAG_DEPRECATED per sensor type */
+static const uint8_t sensorTypeFlags[256] =
+{
+  0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+};
+
+/* Scale name offset and required version per (type << 2) | scale */
+static const SENSOR_SCALE_ENTRY sensorScales[SENSOR_SCALE_SLOTS] =
+{
+  { 0xFFFF,  0 },
+  { 0xFFFF,  0 },
+  { 0xFFFF,  0 },
+  { 0xFFFF,  0 },
+  { 0x0010,  1 },  /* 0x01/0 */
+  { 0x001C,  1 },  /* 0x01/1 */
+  { 0xFFFF,  0 },
+  { 0xFFFF,  0 },
+  { 0x003B,  1 },  /* 0x02/0 */
+  { 0x0050,  1 },  /* 0x02/1 */
+  { 0xFFFF,  0 },
+  { 0xFFFF,  0 },
+  { 0x003B,  1 },  /* 0x03/0 */
+  { 0x0070,  1 },  /* 0x03/1 */
+  { 0xFFFF,  0 },
+  { 0xFFFF,  0 },
+  { 0x007A,  2 },  /* 0x04/0 */
+  { 0x0083,  2 },  /* 0x04/1 */
+  { 0xFFFF,  0 },
+  { 0xFFFF,  0 },
+  { 0x003B,  2 },  /* 0x05/0 */
+  { 0x0092,  5 },  /* 0x05/1 */
+  { 0xFFFF,  0 },
+  { 0xFFFF,  0 },
+  { 0x00B4,  2 },  /* 0x06/0 */
+  { 0x00B8,  2 },  /* 0x06/1 */
+  { 0xFFFF,  0 },
+  { 0xFFFF,  0 },
+  { 0x00C6,  2 },  /* 0x07/0 */
+  { 0xFFFF,  0 },
+  { 0xFFFF,  0 },
+  { 0xFFFF,  0 },
+  { 0x00EC,  2 },  /* 0x08/0 */
+  { 0x00FD,  2 },  /* 0x08/1 */
+  { 0xFFFF,  0 },
+  { 0xFFFF,  0 },
+  { 0x00EC,  2 },  /* 0x09/0 */
+  { 0x00FD,  2 },  /* 0x09/1 */
+  { 0xFFFF,  0 },
+  { 0xFFFF,  0 },
+  { 0x0133,  2 },  /* 0x0A/0 */
+  { 0xFFFF,  0 },
+  { 0xFFFF,  0 },
+  { 0xFFFF,  0 },
+  { 0x0010,  1 },  /* 0x0B/0 */
+  { 0x001C,  1 },  /* 0x0B/1 */
+  { 0xFFFF,  0 },
+  { 0xFFFF,  0 },
+  { 0x0164,  2 },  /* 0x0C/0 */
+  { 0x017B,  2 },  /* 0x0C/1 */
+  { 0xFFFF,  0 },
+  { 0xFFFF,  0 },
+  { 0x019D,  2 },  /* 0x0D/0 */
+  { 0x01A7,  2 },  /* 0x0D/1 */
+  { 0xFFFF,  0 },
+  { 0xFFFF,  0 },
+  { 0x01B8,  3 },  /* 0x0E/0 */
+  { 0x01C6,  3 },  /* 0x0E/1 */
+  { 0xFFFF,  0 },
+  { 0xFFFF,  0 },
+  { 0x01DA,  3 },  /* 0x0F/0 */
+  { 0x01E3,  3 },  /* 0x0F/1 */
+  { 0xFFFF,  0 },
+  { 0xFFFF,  0 },
+  { 0x01FA,  3 },  /* 0x10/0 */
+  { 0x0205,  3 },  /* 0x10/1 */
+  { 0xFFFF,  0 },
+  { 0xFFFF,  0 },
+  { 0x022F,  3 },  /* 0x11/0 */
+  { 0xFFFF,  0 },
+  { 0xFFFF,  0 },
+  { 0xFFFF,  0 },
+  { 0x024C,  3 },  /* 0x12/0 */
+  { 0x0268,  3 },  /* 0x12/1 */
+  { 0xFFFF,  0 },
+  { 0xFFFF,  0 },
+  { 0x0292,  3 },  /* 0x13/0 */
+  { 0x029C,  3 },  /* 0x13/1 */
+  { 0x02AD,  3 },  /* 0x13/2 */
+  { 0xFFFF,  0 },
+  { 0x019D,  3 },  /* 0x14/0 */
+  { 0x02BE,  3 },  /* 0x14/1 */
+  { 0x01A7,  3 },  /* 0x14/2 */
+  { 0xFFFF,  0 },
+  { 0x003B,  4 },  /* 0x15/0 */
+  { 0x02DD,  4 },  /* 0x15/1 */
+  { 0x02DD,  4 },  /* 0x15/2 */
+  { 0xFFFF,  0 },
+  { 0x031A,  5 },  /* 0x16/0 */
+  { 0x0337,  5 },  /* 0x16/1 */
+  { 0xFFFF,  0 },
+  { 0xFFFF,  0 },
+  { 0x0010,  5 },  /* 0x17/0 */
+  { 0x001C,  5 },  /* 0x17/1 */
+  { 0xFFFF,  0 },
+  { 0xFFFF,  0 },
+  { 0x0010,  5 },  /* 0x18/0 */
+  { 0x001C,  5 },  /* 0x18/1 */
+  { 0xFFFF,  0 },
+  { 0xFFFF,  0 },
+  { 0x0377,  5 },  /* 0x19/0 */
+  { 0x0380,  5 },  /* 0x19/1 */
+  { 0x0396,  5 },  /* 0x19/2 */
+  { 0x039C,  5 },  /* 0x19/3 */
+  { 0x03B5,  5 },  /* 0x1A/0 */
+  { 0x03BB,  5 },  /* 0x1A/1 */
+  { 0x03C2,  5 },  /* 0x1A/2 */
+  { 0x03CF,  5 },  /* 0x1A/3 */
+  { 0x03E5,  5 },  /* 0x1B/0 */
+  { 0xFFFF,  0 },
+  { 0xFFFF,  0 },
+  { 0xFFFF,  0 },
+  { 0x0405,  5 },  /* 0x1C/0 */
+  { 0xFFFF,  0 },
+  { 0xFFFF,  0 },
+  { 0xFFFF,  0 },
+  { 0x042D,  5 },  /* 0x1D/0 */
+  { 0xFFFF,  0 },
+  { 0xFFFF,  0 },
+  { 0xFFFF,  0 },
+  { 0x044E,  5 },  /* 0x1E/0 */
+  { 0x045B,  5 },  /* 0x1E/1 */
+  { 0xFFFF,  0 },
+  { 0xFFFF,  0 },
+  { 0x003B,  5 },  /* 0x1F/0 */
+  { 0x047E,  5 },  /* 0x1F/1 */
+  { 0x049B,  5 },  /* 0x1F/2 */
+  { 0x04AB,  5 },  /* 0x1F/3 */
+  { 0x0337,  6 },  /* 0x20/0 */
+  { 0x04C9,  6 },  /* 0x20/1 */
+  { 0xFFFF,  0 },
+  { 0xFFFF,  0 },
+  { 0x04DE,  6 },  /* 0x21/0 */
+  { 0xFFFF,  0 },
+  { 0xFFFF,  0 },
+  { 0xFFFF,  0 },
+  { 0x0010,  6 },  /* 0x22/0 */
+  { 0x001C,  6 },  /* 0x22/1 */
+  { 0xFFFF,  0 },
+  { 0xFFFF,  0 },
+  { 0x0513,  7 },  /* 0x23/0 */
+  { 0x0531,  7 },  /* 0x23/1 */
+  { 0xFFFF,  0 },
+  { 0xFFFF,  0 },
+  { 0x0513,  7 },  /* 0x24/0 */
+  { 0xFFFF,  0 },
+  { 0xFFFF,  0 },
+  { 0xFFFF,  0 },
+  { 0x0580,  7 },  /* 0x25/0 */
+  { 0x05A2,  7 },  /* 0x25/1 */
+  { 0xFFFF,  0 },
+  { 0xFFFF,  0 },
+  { 0x0513,  7 },  /* 0x26/0 */
+  { 0xFFFF,  0 },
+  { 0xFFFF,  0 },
+  { 0xFFFF,  0 },
+  { 0x0513,  7 },  /* 0x27/0 */
+  { 0x022F, 10 },  /* 0x27/1 */
+  { 0xFFFF,  0 },
+  { 0xFFFF,  0 },
+  { 0x0513,  7 },  /* 0x28/0 */
+  { 0x022F, 10 },  /* 0x28/1 */
+  { 0xFFFF,  0 },
+  { 0xFFFF,  0 },
+  { 0x003B,  7 },  /* 0x29/0 */
+  { 0xFFFF,  0 },
+  { 0xFFFF,  0 },
+  { 0xFFFF,  0 },
+  { 0x062E,  7 },  /* 0x2A/0 */
+  { 0xFFFF,  0 },
+  { 0xFFFF,  0 },
+  { 0xFFFF,  0 },
+  { 0x0513,  7 },  /* 0x2B/0 */
+  { 0xFFFF,  0 },
+  { 0xFFFF,  0 },
+  { 0xFFFF,  0 },
+  { 0x0654,  7 },  /* 0x2C/0 */
+  { 0xFFFF,  0 },
+  { 0xFFFF,  0 },
+  { 0xFFFF,  0 },
+  { 0x067A,  7 },  /* 0x2D/0 */
+  { 0x0694,  7 },  /* 0x2D/1 */
+  { 0xFFFF,  0 },
+  { 0xFFFF,  0 },
+  { 0x01B8,  7 },  /* 0x2E/0 */
+  { 0xFFFF,  0 },
+  { 0xFFFF,  0 },
+  { 0xFFFF,  0 },
+  { 0x01B8,  7 },  /* 0x2F/0 */
+  { 0xFFFF,  0 },
+  { 0xFFFF,  0 },
+  { 0xFFFF,  0 },
+  { 0x01B8,  7 },  /* 0x30/0 */
+  { 0xFFFF,  0 },
+  { 0xFFFF,  0 },
+  { 0xFFFF,  0 },
+  { 0x01B8,  7 },  /* 0x31/0 */
+  { 0xFFFF,  0 },
+  { 0xFFFF,  0 },
+  { 0xFFFF,  0 },
+  { 0x0700,  7 },  /* 0x32/0 */
+  { 0xFFFF,  0 },
+  { 0xFFFF,  0 },
+  { 0xFFFF,  0 },
+  { 0x0720,  7 },  /* 0x33/0 */
+  { 0xFFFF,  0 },
+  { 0xFFFF,  0 },
+  { 0xFFFF,  0 },
+  { 0x073E,  8 },  /* 0x34/0 */
+  { 0xFFFF,  0 },
+  { 0xFFFF,  0 },
+  { 0xFFFF,  0 },
+  { 0x073E,  8 },  /* 0x35/0 */
+  { 0xFFFF,  0 },
+  { 0xFFFF,  0 },
+  { 0xFFFF,  0 },
+  { 0x073E,  8 },  /* 0x36/0 */
+  { 0xFFFF,  0 },
+  { 0xFFFF,  0 },
+  { 0xFFFF,  0 },
+  { 0x003B,  8 },  /* 0x37/0 */
+  { 0xFFFF,  0 },
+  { 0xFFFF,  0 },
+  { 0xFFFF,  0 },
+  { 0x079E,  9 },  /* 0x38/0 */
+  { 0xFFFF,  0 },
+  { 0xFFFF,  0 },
+  { 0xFFFF,  0 },
+  { 0x00EC,  9 },  /* 0x39/0 */
+  { 0xFFFF,  0 },
+  { 0xFFFF,  0 },
+  { 0xFFFF,  0 },
+  { 0x07D5,  9 },  /* 0x3A/0 */
+  { 0x07ED,  9 },  /* 0x3A/1 */
+  { 0xFFFF,  0 },
+  { 0xFFFF,  0 },
+  { 0x0513, 10 },  /* 0x3B/0 */
+  { 0x0531, 10 },  /* 0x3B/1 */
+  { 0xFFFF,  0 },
+  { 0xFFFF,  0 },
+  { 0x0818, 10 },  /* 0x3C/0 */
+  { 0xFFFF,  0 },
+  { 0xFFFF,  0 },
+  { 0xFFFF,  0 },
+  { 0x003B, 11 },  /* 0x3D/0 */
+  { 0xFFFF,  0 },
+  { 0xFFFF,  0 },
+  { 0xFFFF,  0 },
+  { 0x0010, 11 },  /* 0x3E/0 */
+  { 0x001C, 11 },  /* 0x3E/1 */
+  { 0xFFFF,  0 },
+  { 0xFFFF,  0 },
+  { 0x0010, 11 },  /* 0x3F/0 */
+  { 0x001C, 11 },  /* 0x3F/1 */
+  { 0xFFFF,  0 },
+  { 0xFFFF,  0 },
+  { 0x0010, 11 },  /* 0x40/0 */
+  { 0x001C, 11 },  /* 0x40/1 */
+  { 0xFFFF,  0 },
+  { 0xFFFF,  0 },
+  { 0x0010, 11 },  /* 0x41/0 */
+  { 0x001C, 11 },  /* 0x41/1 */
+  { 0xFFFF,  0 },
+  { 0xFFFF,  0 },
+  { 0x08C6, 11 },  /* 0x42/0 */
+  { 0xFFFF,  0 },
+  { 0xFFFF,  0 },
+  { 0xFFFF,  0 },
+  { 0x062E, 11 },  /* 0x43/0 */
+  { 0xFFFF,  0 },
+  { 0xFFFF,  0 },
+  { 0xFFFF,  0 },
+  { 0x0913, 11 },  /* 0x44/0 */
+  { 0xFFFF,  0 },
+  { 0xFFFF,  0 },
+  { 0xFFFF,  0 },
+  { 0x0939, 11 },  /* 0x45/0 */
+  { 0xFFFF,  0 },
+  { 0xFFFF,  0 },
+  { 0xFFFF,  0 },
+  { 0x00C6, 11 },  /* 0x46/0 */
+  { 0xFFFF,  0 },
+  { 0xFFFF,  0 },
+  { 0xFFFF,  0 },
+  { 0x096F, 11 },  /* 0x47/0 */
+  { 0xFFFF,  0 },
+  { 0xFFFF,  0 },
+  { 0xFFFF,  0 },
+  { 0x0010, 11 },  /* 0x48/0 */
+  { 0x001C, 11 },  /* 0x48/1 */
+  { 0xFFFF,  0 },
+  { 0xFFFF,  0 },
+  { 0x0010, 11 },  /* 0x49/0 */
+  { 0x001C, 11 },  /* 0x49/1 */
+  { 0xFFFF,  0 },
+  { 0xFFFF,  0 },
+  { 0x0010, 11 },  /* 0x4A/0 */
+  { 0x001C, 11 },  /* 0x4A/1 */
+  { 0xFFFF,  0 },
+  { 0xFFFF,  0 },
+  { 0x0010, 11 },  /* 0x4B/0 */
+  { 0x001C, 11 },  /* 0x4B/1 */
+  { 0xFFFF,  0 },
+  { 0xFFFF,  0 },
+  { 0x0010, 11 },  /* 0x4C/0 */
+  { 0x001C, 11 },  /* 0x4C/1 */
+  { 0xFFFF,  0 },
+  { 0xFFFF,  0 },
+  { 0x0010, 11 },  /* 0x4D/0 */
+  { 0x001C, 11 },  /* 0x4D/1 */
+  { 0xFFFF,  0 },
+  { 0xFFFF,  0 },
+  { 0x00EC, 11 },  /* 0x4E/0 */
+  { 0x0A3B, 11 },  /* 0x4E/1 */
+  { 0xFFFF,  0 },
+  { 0xFFFF,  0 },
+  { 0x00EC, 11 },  /* 0x4F/0 */
+  { 0x0A3B, 11 },  /* 0x4F/1 */
+  { 0xFFFF,  0 },
+  { 0xFFFF,  0 },
+  { 0x0010, 11 },  /* 0x50/0 */
+  { 0x001C, 11 },  /* 0x50/1 */
+  { 0xFFFF,  0 },
+  { 0xFFFF,  0 },
+  { 0x0ACA, 11 },  /* 0x51/0 */
+  { 0xFFFF,  0 },
+  { 0xFFFF,  0 },
+  { 0xFFFF,  0 },
+  { 0x0ACA, 11 },  /* 0x52/0 */
+  { 0xFFFF,  0 },
+  { 0xFFFF,  0 },
+  { 0xFFFF,  0 },
+  { 0x0ACA, 11 },  /* 0x53/0 */
+  { 0xFFFF,  0 },
+  { 0xFFFF,  0 },
+  { 0xFFFF,  0 },
+  { 0x0ACA, 11 },  /* 0x54/0 */
+  { 0xFFFF,  0 },
+  { 0xFFFF,  0 },
+  { 0xFFFF,  0 },
+  { 0x0ACA, 11 },  /* 0x55/0 */
+  { 0xFFFF,  0 },
+  { 0xFFFF,  0 },
+  { 0xFFFF,  0 },
+  { 0x0ACA, 11 },  /* 0x56/0 */
+  { 0xFFFF,  0 },
+  { 0xFFFF,  0 },
+  { 0xFFFF,  0 },
+  { 0x0939, 11 },  /* 0x57/0 */
+  { 0xFFFF,  0 },
+  { 0xFFFF,  0 },
+  { 0xFFFF,  0 },
+  { 0x0939, 11 },  /* 0x58/0 */
+  { 0xFFFF,  0 },
+  { 0xFFFF,  0 },
+  { 0xFFFF,  0 },
+};
+
+/* SI conversion, si = value * scale + offset. NaN scale for unassigned scales */
+static const float sensorSiScale[1024] =
+{
+  SI_INVALID, SI_INVALID, SI_INVALID, SI_INVALID,
+  1.0f, 0.555555556f, SI_INVALID, SI_INVALID,
+  0.01f, 1.0f, SI_INVALID, SI_INVALID,
+  0.01f, 1.0f, SI_INVALID, SI_INVALID,
+  1.0f, 0.29307107f, SI_INVALID, SI_INVALID,
+  0.01f, 0.001f, SI_INVALID, SI_INVALID,
+  1.0f, 0.44704f, SI_INVALID, SI_INVALID,
+  0.0174532925f, SI_INVALID, SI_INVALID, SI_INVALID,
+  1000.0f, 3386.389f, SI_INVALID, SI_INVALID,
+  1000.0f, 3386.389f, SI_INVALID, SI_INVALID,
+  1.0f, SI_INVALID, SI_INVALID, SI_INVALID,
+  1.0f, 0.555555556f, SI_INVALID, SI_INVALID,
+  2.77777778e-07f, 7.05555556e-06f, SI_INVALID, SI_INVALID,
+  1.0f, 0.3048f, SI_INVALID, SI_INVALID,
+  1.0f, 0.45359237f, SI_INVALID, SI_INVALID,
+  1.0f, 0.001f, SI_INVALID, SI_INVALID,
+  1.0f, 0.001f, SI_INVALID, SI_INVALID,
+  1e-06f, SI_INVALID, SI_INVALID, SI_INVALID,
+  0.000277777778f, 0.000471947443f, SI_INVALID, SI_INVALID,
+  0.001f, 1.0f, 0.00378541178f, SI_INVALID,
+  1.0f, 0.01f, 0.3048f, SI_INVALID,
+  0.01f, 0.0174532925f, 0.0174532925f, SI_INVALID,
+  0.0166666667f, 1.0f, SI_INVALID, SI_INVALID,
+  1.0f, 0.555555556f, SI_INVALID, SI_INVALID,
+  1.0f, 0.555555556f, SI_INVALID, SI_INVALID,
+  1.0f, 1.0f, 1.0f, 1.0f,
+  1.0f, 1.0f, 1.0f, 1.0f,
+  1.0f, SI_INVALID, SI_INVALID, SI_INVALID,
+  1.0f, SI_INVALID, SI_INVALID, SI_INVALID,
+  1.0f, SI_INVALID, SI_INVALID, SI_INVALID,
+  1.0f, 1.0f, SI_INVALID, SI_INVALID,
+  0.01f, 1.0f, 1000.0f, 1.0f,
+  1.0f, 1000.0f, SI_INVALID, SI_INVALID,
+  1.0f, SI_INVALID, SI_INVALID, SI_INVALID,
+  1.0f, 0.555555556f, SI_INVALID, SI_INVALID,
+  1.0f, 1e-09f, SI_INVALID, SI_INVALID,
+  1.0f, SI_INVALID, SI_INVALID, SI_INVALID,
+  1.0f, 37.0f, SI_INVALID, SI_INVALID,
+  1.0f, SI_INVALID, SI_INVALID, SI_INVALID,
+  1.0f, 1e-06f, SI_INVALID, SI_INVALID,
+  1.0f, 1e-06f, SI_INVALID, SI_INVALID,
+  0.01f, SI_INVALID, SI_INVALID, SI_INVALID,
+  1.0f, SI_INVALID, SI_INVALID, SI_INVALID,
+  1.0f, SI_INVALID, SI_INVALID, SI_INVALID,
+  0.0166666667f, SI_INVALID, SI_INVALID, SI_INVALID,
+  133.322387f, 133.322387f, SI_INVALID, SI_INVALID,
+  1.0f, SI_INVALID, SI_INVALID, SI_INVALID,
+  1.0f, SI_INVALID, SI_INVALID, SI_INVALID,
+  1.0f, SI_INVALID, SI_INVALID, SI_INVALID,
+  1.0f, SI_INVALID, SI_INVALID, SI_INVALID,
+  1.0f, SI_INVALID, SI_INVALID, SI_INVALID,
+  1.0f, SI_INVALID, SI_INVALID, SI_INVALID,
+  1.0f, SI_INVALID, SI_INVALID, SI_INVALID,
+  1.0f, SI_INVALID, SI_INVALID, SI_INVALID,
+  1.0f, SI_INVALID, SI_INVALID, SI_INVALID,
+  0.01f, SI_INVALID, SI_INVALID, SI_INVALID,
+  2.77777778e-07f, SI_INVALID, SI_INVALID, SI_INVALID,
+  1000.0f, SI_INVALID, SI_INVALID, SI_INVALID,
+  0.01f, 1.0f, SI_INVALID, SI_INVALID,
+  1.0f, 1e-09f, SI_INVALID, SI_INVALID,
+  0.0166666667f, SI_INVALID, SI_INVALID, SI_INVALID,
+  0.01f, SI_INVALID, SI_INVALID, SI_INVALID,
+  1.0f, 0.555555556f, SI_INVALID, SI_INVALID,
+  1.0f, 0.555555556f, SI_INVALID, SI_INVALID,
+  1.0f, 0.555555556f, SI_INVALID, SI_INVALID,
+  1.0f, 0.555555556f, SI_INVALID, SI_INVALID,
+  0.001f, SI_INVALID, SI_INVALID, SI_INVALID,
+  1.0f, SI_INVALID, SI_INVALID, SI_INVALID,
+  0.001f, SI_INVALID, SI_INVALID, SI_INVALID,
+  1.0f, SI_INVALID, SI_INVALID, SI_INVALID,
+  0.0174532925f, SI_INVALID, SI_INVALID, SI_INVALID,
+  1.0f, SI_INVALID, SI_INVALID, SI_INVALID,
+  1.0f, 0.555555556f, SI_INVALID, SI_INVALID,
+  1.0f, 0.555555556f, SI_INVALID, SI_INVALID,
+  1.0f, 0.555555556f, SI_INVALID, SI_INVALID,
+  1.0f, 0.555555556f, SI_INVALID, SI_INVALID,
+  1.0f, 0.555555556f, SI_INVALID, SI_INVALID,
+  1.0f, 0.555555556f, SI_INVALID, SI_INVALID,
+  1000.0f, 6894.75729f, SI_INVALID, SI_INVALID,
+  1000.0f, 6894.75729f, SI_INVALID, SI_INVALID,
+  1.0f, 0.555555556f, SI_INVALID, SI_INVALID,
+  1e-09f, SI_INVALID, SI_INVALID, SI_INVALID,
+  1e-09f, SI_INVALID, SI_INVALID, SI_INVALID,
+  1e-09f, SI_INVALID, SI_INVALID, SI_INVALID,
+  1e-09f, SI_INVALID, SI_INVALID, SI_INVALID,
+  1e-09f, SI_INVALID, SI_INVALID, SI_INVALID,
+  1e-09f, SI_INVALID, SI_INVALID, SI_INVALID,
+  1.0f, SI_INVALID, SI_INVALID, SI_INVALID,
+  1.0f, SI_INVALID, SI_INVALID, SI_INVALID,
+  SI_INVALID, SI_INVALID, SI_INVALID, SI_INVALID,
+  SI_INVALID, SI_INVALID, SI_INVALID, SI_INVALID,
+  SI_INVALID, SI_INVALID, SI_INVALID, SI_INVALID,
+  SI_INVALID, SI_INVALID, SI_INVALID, SI_INVALID,
+  SI_INVALID, SI_INVALID, SI_INVALID, SI_INVALID,
+  SI_INVALID, SI_INVALID, SI_INVALID, SI_INVALID,
+  SI_INVALID, SI_INVALID, SI_INVALID, SI_INVALID,
+  SI_INVALID, SI_INVALID, SI_INVALID, SI_INVALID,
+  SI_INVALID, SI_INVALID, SI_INVALID, SI_INVALID,
+  SI_INVALID, SI_INVALID, SI_INVALID, SI_INVALID,
+  SI_INVALID, SI_INVALID, SI_INVALID, SI_INVALID,
+  SI_INVALID, SI_INVALID, SI_INVALID, SI_INVALID,
+  SI_INVALID, SI_INVALID, SI_INVALID, SI_INVALID,
+  SI_INVALID, SI_INVALID, SI_INVALID, SI_INVALID,
+  SI_INVALID, SI_INVALID, SI_INVALID, SI_INVALID,
+  SI_INVALID, SI_INVALID, SI_INVALID, SI_INVALID,
+  SI_INVALID, SI_INVALID, SI_INVALID, SI_INVALID,
+  SI_INVALID, SI_INVALID, SI_INVALID, SI_INVALID,
+  SI_INVALID, SI_INVALID, SI_INVALID, SI_INVALID,
+  SI_INVALID, SI_INVALID, SI_INVALID, SI_INVALID,
+  SI_INVALID, SI_INVALID, SI_INVALID, SI_INVALID,
+  SI_INVALID, SI_INVALID, SI_INVALID, SI_INVALID,
+  SI_INVALID, SI_INVALID, SI_INVALID, SI_INVALID,
+  SI_INVALID, SI_INVALID, SI_INVALID, SI_INVALID,
+  SI_INVALID, SI_INVALID, SI_INVALID, SI_INVALID,
+  SI_INVALID, SI_INVALID, SI_INVALID, SI_INVALID,
+  SI_INVALID, SI_INVALID, SI_INVALID, SI_INVALID,
+  SI_INVALID, SI_INVALID, SI_INVALID, SI_INVALID,
+  SI_INVALID, SI_INVALID, SI_INVALID, SI_INVALID,
+  SI_INVALID, SI_INVALID, SI_INVALID, SI_INVALID,
+  SI_INVALID, SI_INVALID, SI_INVALID, SI_INVALID,
+  SI_INVALID, SI_INVALID, SI_INVALID, SI_INVALID,
+  SI_INVALID, SI_INVALID, SI_INVALID, SI_INVALID,
+  SI_INVALID, SI_INVALID, SI_INVALID, SI_INVALID,
+  SI_INVALID, SI_INVALID, SI_INVALID, SI_INVALID,
+  SI_INVALID, SI_INVALID, SI_INVALID, SI_INVALID,
+  SI_INVALID, SI_INVALID, SI_INVALID, SI_INVALID,
+  SI_INVALID, SI_INVALID, SI_INVALID, SI_INVALID,
+  SI_INVALID, SI_INVALID, SI_INVALID, SI_INVALID,
+  SI_INVALID, SI_INVALID, SI_INVALID, SI_INVALID,
+  SI_INVALID, SI_INVALID, SI_INVALID, SI_INVALID,
+  SI_INVALID, SI_INVALID, SI_INVALID, SI_INVALID,
+  SI_INVALID, SI_INVALID, SI_INVALID, SI_INVALID,
+  SI_INVALID, SI_INVALID, SI_INVALID, SI_INVALID,
+  SI_INVALID, SI_INVALID, SI_INVALID, SI_INVALID,
+  SI_INVALID, SI_INVALID, SI_INVALID, SI_INVALID,
+  SI_INVALID, SI_INVALID, SI_INVALID, SI_INVALID,
+  SI_INVALID, SI_INVALID, SI_INVALID, SI_INVALID,
+  SI_INVALID, SI_INVALID, SI_INVALID, SI_INVALID,
+  SI_INVALID, SI_INVALID, SI_INVALID, SI_INVALID,
+  SI_INVALID, SI_INVALID, SI_INVALID, SI_INVALID,
+  SI_INVALID, SI_INVALID, SI_INVALID, SI_INVALID,
+  SI_INVALID, SI_INVALID, SI_INVALID, SI_INVALID,
+  SI_INVALID, SI_INVALID, SI_INVALID, SI_INVALID,
+  SI_INVALID, SI_INVALID, SI_INVALID, SI_INVALID,
+  SI_INVALID, SI_INVALID, SI_INVALID, SI_INVALID,
+  SI_INVALID, SI_INVALID, SI_INVALID, SI_INVALID,
+  SI_INVALID, SI_INVALID, SI_INVALID, SI_INVALID,
+  SI_INVALID, SI_INVALID, SI_INVALID, SI_INVALID,
+  SI_INVALID, SI_INVALID, SI_INVALID, SI_INVALID,
+  SI_INVALID, SI_INVALID, SI_INVALID, SI_INVALID,
+  SI_INVALID, SI_INVALID, SI_INVALID, SI_INVALID,
+  SI_INVALID, SI_INVALID, SI_INVALID, SI_INVALID,
+  SI_INVALID, SI_INVALID, SI_INVALID, SI_INVALID,
+  SI_INVALID, SI_INVALID, SI_INVALID, SI_INVALID,
+  SI_INVALID, SI_INVALID, SI_INVALID, SI_INVALID,
+  SI_INVALID, SI_INVALID, SI_INVALID, SI_INVALID,
+  SI_INVALID, SI_INVALID, SI_INVALID, SI_INVALID,
+  SI_INVALID, SI_INVALID, SI_INVALID, SI_INVALID,
+  SI_INVALID, SI_INVALID, SI_INVALID, SI_INVALID,
+  SI_INVALID, SI_INVALID, SI_INVALID, SI_INVALID,
+  SI_INVALID, SI_INVALID, SI_INVALID, SI_INVALID,
+  SI_INVALID, SI_INVALID, SI_INVALID, SI_INVALID,
+  SI_INVALID, SI_INVALID, SI_INVALID, SI_INVALID,
+  SI_INVALID, SI_INVALID, SI_INVALID, SI_INVALID,
+  SI_INVALID, SI_INVALID, SI_INVALID, SI_INVALID,
+  SI_INVALID, SI_INVALID, SI_INVALID, SI_INVALID,
+  SI_INVALID, SI_INVALID, SI_INVALID, SI_INVALID,
+  SI_INVALID, SI_INVALID, SI_INVALID, SI_INVALID,
+  SI_INVALID, SI_INVALID, SI_INVALID, SI_INVALID,
+  SI_INVALID, SI_INVALID, SI_INVALID, SI_INVALID,
+  SI_INVALID, SI_INVALID, SI_INVALID, SI_INVALID,
+  SI_INVALID, SI_INVALID, SI_INVALID, SI_INVALID,
+  SI_INVALID, SI_INVALID, SI_INVALID, SI_INVALID,
+  SI_INVALID, SI_INVALID, SI_INVALID, SI_INVALID,
+  SI_INVALID, SI_INVALID, SI_INVALID, SI_INVALID,
+  SI_INVALID, SI_INVALID, SI_INVALID, SI_INVALID,
+  SI_INVALID, SI_INVALID, SI_INVALID, SI_INVALID,
+  SI_INVALID, SI_INVALID, SI_INVALID, SI_INVALID,
+  SI_INVALID, SI_INVALID, SI_INVALID, SI_INVALID,
+  SI_INVALID, SI_INVALID, SI_INVALID, SI_INVALID,
+  SI_INVALID, SI_INVALID, SI_INVALID, SI_INVALID,
+  SI_INVALID, SI_INVALID, SI_INVALID, SI_INVALID,
+  SI_INVALID, SI_INVALID, SI_INVALID, SI_INVALID,
+  SI_INVALID, SI_INVALID, SI_INVALID, SI_INVALID,
+  SI_INVALID, SI_INVALID, SI_INVALID, SI_INVALID,
+  SI_INVALID, SI_INVALID, SI_INVALID, SI_INVALID,
+  SI_INVALID, SI_INVALID, SI_INVALID, SI_INVALID,
+  SI_INVALID, SI_INVALID, SI_INVALID, SI_INVALID,
+  SI_INVALID, SI_INVALID, SI_INVALID, SI_INVALID,
+  SI_INVALID, SI_INVALID, SI_INVALID, SI_INVALID,
+  SI_INVALID, SI_INVALID, SI_INVALID, SI_INVALID,
+  SI_INVALID, SI_INVALID, SI_INVALID, SI_INVALID,
+  SI_INVALID, SI_INVALID, SI_INVALID, SI_INVALID,
+  SI_INVALID, SI_INVALID, SI_INVALID, SI_INVALID,
+  SI_INVALID, SI_INVALID, SI_INVALID, SI_INVALID,
+  SI_INVALID, SI_INVALID, SI_INVALID, SI_INVALID,
+  SI_INVALID, SI_INVALID, SI_INVALID, SI_INVALID,
+  SI_INVALID, SI_INVALID, SI_INVALID, SI_INVALID,
+  SI_INVALID, SI_INVALID, SI_INVALID, SI_INVALID,
+  SI_INVALID, SI_INVALID, SI_INVALID, SI_INVALID,
+  SI_INVALID, SI_INVALID, SI_INVALID, SI_INVALID,
+  SI_INVALID, SI_INVALID, SI_INVALID, SI_INVALID,
+  SI_INVALID, SI_INVALID, SI_INVALID, SI_INVALID,
+  SI_INVALID, SI_INVALID, SI_INVALID, SI_INVALID,
+  SI_INVALID, SI_INVALID, SI_INVALID, SI_INVALID,
+  SI_INVALID, SI_INVALID, SI_INVALID, SI_INVALID,
+  SI_INVALID, SI_INVALID, SI_INVALID, SI_INVALID,
+  SI_INVALID, SI_INVALID, SI_INVALID, SI_INVALID,
+  SI_INVALID, SI_INVALID, SI_INVALID, SI_INVALID,
+  SI_INVALID, SI_INVALID, SI_INVALID, SI_INVALID,
+  SI_INVALID, SI_INVALID, SI_INVALID, SI_INVALID,
+  SI_INVALID, SI_INVALID, SI_INVALID, SI_INVALID,
+  SI_INVALID, SI_INVALID, SI_INVALID, SI_INVALID,
+  SI_INVALID, SI_INVALID, SI_INVALID, SI_INVALID,
+  SI_INVALID, SI_INVALID, SI_INVALID, SI_INVALID,
+  SI_INVALID, SI_INVALID, SI_INVALID, SI_INVALID,
+  SI_INVALID, SI_INVALID, SI_INVALID, SI_INVALID,
+  SI_INVALID, SI_INVALID, SI_INVALID, SI_INVALID,
+  SI_INVALID, SI_INVALID, SI_INVALID, SI_INVALID,
+  SI_INVALID, SI_INVALID, SI_INVALID, SI_INVALID,
+  SI_INVALID, SI_INVALID, SI_INVALID, SI_INVALID,
+  SI_INVALID, SI_INVALID, SI_INVALID, SI_INVALID,
+  SI_INVALID, SI_INVALID, SI_INVALID, SI_INVALID,
+  SI_INVALID, SI_INVALID, SI_INVALID, SI_INVALID,
+  SI_INVALID, SI_INVALID, SI_INVALID, SI_INVALID,
+  SI_INVALID, SI_INVALID, SI_INVALID, SI_INVALID,
+  SI_INVALID, SI_INVALID, SI_INVALID, SI_INVALID,
+  SI_INVALID, SI_INVALID, SI_INVALID, SI_INVALID,
+  SI_INVALID, SI_INVALID, SI_INVALID, SI_INVALID,
+  SI_INVALID, SI_INVALID, SI_INVALID, SI_INVALID,
+  SI_INVALID, SI_INVALID, SI_INVALID, SI_INVALID,
+  SI_INVALID, SI_INVALID, SI_INVALID, SI_INVALID,
+  SI_INVALID, SI_INVALID, SI_INVALID, SI_INVALID,
+  SI_INVALID, SI_INVALID, SI_INVALID, SI_INVALID,
+  SI_INVALID, SI_INVALID, SI_INVALID, SI_INVALID,
+  SI_INVALID, SI_INVALID, SI_INVALID, SI_INVALID,
+  SI_INVALID, SI_INVALID, SI_INVALID, SI_INVALID,
+  SI_INVALID, SI_INVALID, SI_INVALID, SI_INVALID,
+  SI_INVALID, SI_INVALID, SI_INVALID, SI_INVALID,
+  SI_INVALID, SI_INVALID, SI_INVALID, SI_INVALID,
+  SI_INVALID, SI_INVALID, SI_INVALID, SI_INVALID,
+  SI_INVALID, SI_INVALID, SI_INVALID, SI_INVALID,
+  SI_INVALID, SI_INVALID, SI_INVALID, SI_INVALID,
+  SI_INVALID, SI_INVALID, SI_INVALID, SI_INVALID,
+  SI_INVALID, SI_INVALID, SI_INVALID, SI_INVALID,
+  SI_INVALID, SI_INVALID, SI_INVALID, SI_INVALID,
+  SI_INVALID, SI_INVALID, SI_INVALID, SI_INVALID,
+  SI_INVALID, SI_INVALID, SI_INVALID, SI_INVALID,
+  SI_INVALID, SI_INVALID, SI_INVALID, SI_INVALID,
+  SI_INVALID, SI_INVALID, SI_INVALID, SI_INVALID,
+  SI_INVALID, SI_INVALID, SI_INVALID, SI_INVALID,
+  SI_INVALID, SI_INVALID, SI_INVALID, SI_INVALID,
+  SI_INVALID, SI_INVALID, SI_INVALID, SI_INVALID,
+  SI_INVALID, SI_INVALID, SI_INVALID, SI_INVALID,
+  SI_INVALID, SI_INVALID, SI_INVALID, SI_INVALID,
+  SI_INVALID, SI_INVALID, SI_INVALID, SI_INVALID,
+};
+
+static const float sensorSiOffset[1024] =
+{
+  0.0f, 0.0f, 0.0f, 0.0f,
+  273.15f, 255.372222f, 0.0f, 0.0f,
+  0.0f, 0.0f, 0.0f, 0.0f,
+  0.0f, 0.0f, 0.0f, 0.0f,
+  0.0f, 0.0f, 0.0f, 0.0f,
+  0.0f, 0.0f, 0.0f, 0.0f,
+  0.0f, 0.0f, 0.0f, 0.0f,
+  0.0f, 0.0f, 0.0f, 0.0f,
+  0.0f, 0.0f, 0.0f, 0.0f,
+  0.0f, 0.0f, 0.0f, 0.0f,
+  0.0f, 0.0f, 0.0f, 0.0f,
+  273.15f, 255.372222f, 0.0f, 0.0f,
+  0.0f, 0.0f, 0.0f, 0.0f,
+  0.0f, 0.0f, 0.0f, 0.0f,
+  0.0f, 0.0f, 0.0f, 0.0f,
+  0.0f, 0.0f, 0.0f, 0.0f,
+  0.0f, 0.0f, 0.0f, 0.0f,
+  0.0f, 0.0f, 0.0f, 0.0f,
+  0.0f, 0.0f, 0.0f, 0.0f,
+  0.0f, 0.0f, 0.0f, 0.0f,
+  0.0f, 0.0f, 0.0f, 0.0f,
+  0.0f, 0.0f, 0.0f, 0.0f,
+  0.0f, 0.0f, 0.0f, 0.0f,
+  273.15f, 255.372222f, 0.0f, 0.0f,
+  273.15f, 255.372222f, 0.0f, 0.0f,
+  0.0f, 0.0f, 0.0f, 0.0f,
+  0.0f, 0.0f, 0.0f, 0.0f,
+  0.0f, 0.0f, 0.0f, 0.0f,
+  0.0f, 0.0f, 0.0f, 0.0f,
+  0.0f, 0.0f, 0.0f, 0.0f,
+  0.0f, 0.0f, 0.0f, 0.0f,
+  0.0f, 0.0f, 0.0f, 0.0f,
+  0.0f, 0.0f, 0.0f, 0.0f,
+  0.0f, 0.0f, 0.0f, 0.0f,
+  273.15f, 255.372222f, 0.0f, 0.0f,
+  0.0f, 0.0f, 0.0f, 0.0f,
+  0.0f, 0.0f, 0.0f, 0.0f,
+  0.0f, 0.0f, 0.0f, 0.0f,
+  0.0f, 0.0f, 0.0f, 0.0f,
+  0.0f, 0.0f, 0.0f, 0.0f,
+  0.0f, 0.0f, 0.0f, 0.0f,
+  0.0f, 0.0f, 0.0f, 0.0f,
+  0.0f, 0.0f, 0.0f, 0.0f,
+  0.0f, 0.0f, 0.0f, 0.0f,
+  0.0f, 0.0f, 0.0f, 0.0f,
+  0.0f, 0.0f, 0.0f, 0.0f,
+  0.0f, 0.0f, 0.0f, 0.0f,
+  0.0f, 0.0f, 0.0f, 0.0f,
+  0.0f, 0.0f, 0.0f, 0.0f,
+  0.0f, 0.0f, 0.0f, 0.0f,
+  0.0f, 0.0f, 0.0f, 0.0f,
+  0.0f, 0.0f, 0.0f, 0.0f,
+  0.0f, 0.0f, 0.0f, 0.0f,
+  0.0f, 0.0f, 0.0f, 0.0f,
+  0.0f, 0.0f, 0.0f, 0.0f,
+  0.0f, 0.0f, 0.0f, 0.0f,
+  0.0f, 0.0f, 0.0f, 0.0f,
+  0.0f, 0.0f, 0.0f, 0.0f,
+  0.0f, 0.0f, 0.0f, 0.0f,
+  0.0f, 0.0f, 0.0f, 0.0f,
+  0.0f, 0.0f, 0.0f, 0.0f,
+  0.0f, 0.0f, 0.0f, 0.0f,
+  273.15f, 255.372222f, 0.0f, 0.0f,
+  273.15f, 255.372222f, 0.0f, 0.0f,
+  273.15f, 255.372222f, 0.0f, 0.0f,
+  273.15f, 255.372222f, 0.0f, 0.0f,
+  0.0f, 0.0f, 0.0f, 0.0f,
+  0.0f, 0.0f, 0.0f, 0.0f,
+  0.0f, 0.0f, 0.0f, 0.0f,
+  0.0f, 0.0f, 0.0f, 0.0f,
+  0.0f, 0.0f, 0.0f, 0.0f,
+  0.0f, 0.0f, 0.0f, 0.0f,
+  273.15f, 255.372222f, 0.0f, 0.0f,
+  273.15f, 255.372222f, 0.0f, 0.0f,
+  273.15f, 255.372222f, 0.0f, 0.0f,
+  273.15f, 255.372222f, 0.0f, 0.0f,
+  273.15f, 255.372222f, 0.0f, 0.0f,
+  273.15f, 255.372222f, 0.0f, 0.0f,
+  0.0f, 0.0f, 0.0f, 0.0f,
+  0.0f, 0.0f, 0.0f, 0.0f,
+  273.15f, 255.372222f, 0.0f, 0.0f,
+  0.0f, 0.0f, 0.0f, 0.0f,
+  0.0f, 0.0f, 0.0f, 0.0f,
+  0.0f, 0.0f, 0.0f, 0.0f,
+  0.0f, 0.0f, 0.0f, 0.0f,
+  0.0f, 0.0f, 0.0f, 0.0f,
+  0.0f, 0.0f, 0.0f, 0.0f,
+  0.0f, 0.0f, 0.0f, 0.0f,
+  0.0f, 0.0f, 0.0f, 0.0f,
+  0.0f, 0.0f, 0.0f, 0.0f,
+  0.0f, 0.0f, 0.0f, 0.0f,
+  0.0f, 0.0f, 0.0f, 0.0f,
+  0.0f, 0.0f, 0.0f, 0.0f,
+  0.0f, 0.0f, 0.0f, 0.0f,
+  0.0f, 0.0f, 0.0f, 0.0f,
+  0.0f, 0.0f, 0.0f, 0.0f,
+  0.0f, 0.0f, 0.0f, 0.0f,
+  0.0f, 0.0f, 0.0f, 0.0f,
+  0.0f, 0.0f, 0.0f, 0.0f,
+  0.0f, 0.0f, 0.0f, 0.0f,
+  0.0f, 0.0f, 0.0f, 0.0f,
+  0.0f, 0.0f, 0.0f, 0.0f,
+  0.0f, 0.0f, 0.0f, 0.0f,
+  0.0f, 0.0f, 0.0f, 0.0f,
+  0.0f, 0.0f, 0.0f, 0.0f,
+  0.0f, 0.0f, 0.0f, 0.0f,
+  0.0f, 0.0f, 0.0f, 0.0f,
+  0.0f, 0.0f, 0.0f, 0.0f,
+  0.0f, 0.0f, 0.0f, 0.0f,
+  0.0f, 0.0f, 0.0f, 0.0f,
+  0.0f, 0.0f, 0.0f, 0.0f,
+  0.0f, 0.0f, 0.0f, 0.0f,
+  0.0f, 0.0f, 0.0f, 0.0f,
+  0.0f, 0.0f, 0.0f, 0.0f,
+  0.0f, 0.0f, 0.0f, 0.0f,
+  0.0f, 0.0f, 0.0f, 0.0f,
+  0.0f, 0.0f, 0.0f, 0.0f,
+  0.0f, 0.0f, 0.0f, 0.0f,
+  0.0f, 0.0f, 0.0f, 0.0f,
+  0.0f, 0.0f, 0.0f, 0.0f,
+  0.0f, 0.0f, 0.0f, 0.0f,
+  0.0f, 0.0f, 0.0f, 0.0f,
+  0.0f, 0.0f, 0.0f, 0.0f,
+  0.0f, 0.0f, 0.0f, 0.0f,
+  0.0f, 0.0f, 0.0f, 0.0f,
+  0.0f, 0.0f, 0.0f, 0.0f,
+  0.0f, 0.0f, 0.0f, 0.0f,
+  0.0f, 0.0f, 0.0f, 0.0f,
+  0.0f, 0.0f, 0.0f, 0.0f,
+  0.0f, 0.0f, 0.0f, 0.0f,
+  0.0f, 0.0f, 0.0f, 0.0f,
+  0.0f, 0.0f, 0.0f, 0.0f,
+  0.0f, 0.0f, 0.0f, 0.0f,
+  0.0f, 0.0f, 0.0f, 0.0f,
+  0.0f, 0.0f, 0.0f, 0.0f,
+  0.0f, 0.0f, 0.0f, 0.0f,
+  0.0f, 0.0f, 0.0f, 0.0f,
+  0.0f, 0.0f, 0.0f, 0.0f,
+  0.0f, 0.0f, 0.0f, 0.0f,
+  0.0f, 0.0f, 0.0f, 0.0f,
+  0.0f, 0.0f, 0.0f, 0.0f,
+  0.0f, 0.0f, 0.0f, 0.0f,
+  0.0f, 0.0f, 0.0f, 0.0f,
+  0.0f, 0.0f, 0.0f, 0.0f,
+  0.0f, 0.0f, 0.0f, 0.0f,
+  0.0f, 0.0f, 0.0f, 0.0f,
+  0.0f, 0.0f, 0.0f, 0.0f,
+  0.0f, 0.0f, 0.0f, 0.0f,
+  0.0f, 0.0f, 0.0f, 0.0f,
+  0.0f, 0.0f, 0.0f, 0.0f,
+  0.0f, 0.0f, 0.0f, 0.0f,
+  0.0f, 0.0f, 0.0f, 0.0f,
+  0.0f, 0.0f, 0.0f, 0.0f,
+  0.0f, 0.0f, 0.0f, 0.0f,
+  0.0f, 0.0f, 0.0f, 0.0f,
+  0.0f, 0.0f, 0.0f, 0.0f,
+  0.0f, 0.0f, 0.0f, 0.0f,
+  0.0f, 0.0f, 0.0f, 0.0f,
+  0.0f, 0.0f, 0.0f, 0.0f,
+  0.0f, 0.0f, 0.0f, 0.0f,
+  0.0f, 0.0f, 0.0f, 0.0f,
+  0.0f, 0.0f, 0.0f, 0.0f,
+  0.0f, 0.0f, 0.0f, 0.0f,
+  0.0f, 0.0f, 0.0f, 0.0f,
+  0.0f, 0.0f, 0.0f, 0.0f,
+  0.0f, 0.0f, 0.0f, 0.0f,
+  0.0f, 0.0f, 0.0f, 0.0f,
+  0.0f, 0.0f, 0.0f, 0.0f,
+  0.0f, 0.0f, 0.0f, 0.0f,
+  0.0f, 0.0f, 0.0f, 0.0f,
+  0.0f, 0.0f, 0.0f, 0.0f,
+  0.0f, 0.0f, 0.0f, 0.0f,
+  0.0f, 0.0f, 0.0f, 0.0f,
+  0.0f, 0.0f, 0.0f, 0.0f,
+  0.0f, 0.0f, 0.0f, 0.0f,
+  0.0f, 0.0f, 0.0f, 0.0f,
+  0.0f, 0.0f, 0.0f, 0.0f,
+  0.0f, 0.0f, 0.0f, 0.0f,
+  0.0f, 0.0f, 0.0f, 0.0f,
+  0.0f, 0.0f, 0.0f, 0.0f,
+  0.0f, 0.0f, 0.0f, 0.0f,
+  0.0f, 0.0f, 0.0f, 0.0f,
+  0.0f, 0.0f, 0.0f, 0.0f,
+  0.0f, 0.0f, 0.0f, 0.0f,
+  0.0f, 0.0f, 0.0f, 0.0f,
+  0.0f, 0.0f, 0.0f, 0.0f,
+  0.0f, 0.0f, 0.0f, 0.0f,
+  0.0f, 0.0f, 0.0f, 0.0f,
+  0.0f, 0.0f, 0.0f, 0.0f,
+  0.0f, 0.0f, 0.0f, 0.0f,
+  0.0f, 0.0f, 0.0f, 0.0f,
+  0.0f, 0.0f, 0.0f, 0.0f,
+  0.0f, 0.0f, 0.0f, 0.0f,
+  0.0f, 0.0f, 0.0f, 0.0f,
+  0.0f, 0.0f, 0.0f, 0.0f,
+  0.0f, 0.0f, 0.0f, 0.0f,
+  0.0f, 0.0f, 0.0f, 0.0f,
+  0.0f, 0.0f, 0.0f, 0.0f,
+  0.0f, 0.0f, 0.0f, 0.0f,
+  0.0f, 0.0f, 0.0f, 0.0f,
+  0.0f, 0.0f, 0.0f, 0.0f,
+  0.0f, 0.0f, 0.0f, 0.0f,
+  0.0f, 0.0f, 0.0f, 0.0f,
+  0.0f, 0.0f, 0.0f, 0.0f,
+  0.0f, 0.0f, 0.0f, 0.0f,
+  0.0f, 0.0f, 0.0f, 0.0f,
+  0.0f, 0.0f, 0.0f, 0.0f,
+  0.0f, 0.0f, 0.0f, 0.0f,
+  0.0f, 0.0f, 0.0f, 0.0f,
+  0.0f, 0.0f, 0.0f, 0.0f,
+  0.0f, 0.0f, 0.0f, 0.0f,
+  0.0f, 0.0f, 0.0f, 0.0f,
+  0.0f, 0.0f, 0.0f, 0.0f,
+  0.0f, 0.0f, 0.0f, 0.0f,
+  0.0f, 0.0f, 0.0f, 0.0f,
+  0.0f, 0.0f, 0.0f, 0.0f,
+  0.0f, 0.0f, 0.0f, 0.0f,
+  0.0f, 0.0f, 0.0f, 0.0f,
+  0.0f, 0.0f, 0.0f, 0.0f,
+  0.0f, 0.0f, 0.0f, 0.0f,
+  0.0f, 0.0f, 0.0f, 0.0f,
+  0.0f, 0.0f, 0.0f, 0.0f,
+  0.0f, 0.0f, 0.0f, 0.0f,
+  0.0f, 0.0f, 0.0f, 0.0f,
+  0.0f, 0.0f, 0.0f, 0.0f,
+  0.0f, 0.0f, 0.0f, 0.0f,
+  0.0f, 0.0f, 0.0f, 0.0f,
+  0.0f, 0.0f, 0.0f, 0.0f,
+  0.0f, 0.0f, 0.0f, 0.0f,
+  0.0f, 0.0f, 0.0f, 0.0f,
+  0.0f, 0.0f, 0.0f, 0.0f,
+  0.0f, 0.0f, 0.0f, 0.0f,
+  0.0f, 0.0f, 0.0f, 0.0f,
+  0.0f, 0.0f, 0.0f, 0.0f,
+  0.0f, 0.0f, 0.0f, 0.0f,
+  0.0f, 0.0f, 0.0f, 0.0f,
+  0.0f, 0.0f, 0.0f, 0.0f,
+  0.0f, 0.0f, 0.0f, 0.0f,
+  0.0f, 0.0f, 0.0f, 0.0f,
+  0.0f, 0.0f, 0.0f, 0.0f,
+  0.0f, 0.0f, 0.0f, 0.0f,
+  0.0f, 0.0f, 0.0f, 0.0f,
+  0.0f, 0.0f, 0.0f, 0.0f,
+  0.0f, 0.0f, 0.0f, 0.0f,
+  0.0f, 0.0f, 0.0f, 0.0f,
+  0.0f, 0.0f, 0.0f, 0.0f,
+  0.0f, 0.0f, 0.0f, 0.0f,
+  0.0f, 0.0f, 0.0f, 0.0f,
+  0.0f, 0.0f, 0.0f, 0.0f,
+  0.0f, 0.0f, 0.0f, 0.0f,
+  0.0f, 0.0f, 0.0f, 0.0f,
+  0.0f, 0.0f, 0.0f, 0.0f,
+  0.0f, 0.0f, 0.0f, 0.0f,
+  0.0f, 0.0f, 0.0f, 0.0f,
+  0.0f, 0.0f, 0.0f, 0.0f,
+  0.0f, 0.0f, 0.0f, 0.0f,
+};
+
+static const uint8_t sensorSiUnit[1024] =
+{
+  SENSOR_SI_INVALID, SENSOR_SI_INVALID, SENSOR_SI_INVALID, SENSOR_SI_INVALID,
+  SENSOR_SI_KELVIN, SENSOR_SI_KELVIN, SENSOR_SI_INVALID, SENSOR_SI_INVALID,
+  SENSOR_SI_DIMENSIONLESS, SENSOR_SI_DIMENSIONLESS, SENSOR_SI_INVALID, SENSOR_SI_INVALID,
+  SENSOR_SI_DIMENSIONLESS, SENSOR_SI_LUX, SENSOR_SI_INVALID, SENSOR_SI_INVALID,
+  SENSOR_SI_WATT, SENSOR_SI_WATT, SENSOR_SI_INVALID, SENSOR_SI_INVALID,
+  SENSOR_SI_DIMENSIONLESS, SENSOR_SI_KILOGRAM_PER_CUBIC_METER, SENSOR_SI_INVALID, SENSOR_SI_INVALID,
+  SENSOR_SI_METER_PER_SECOND, SENSOR_SI_METER_PER_SECOND, SENSOR_SI_INVALID, SENSOR_SI_INVALID,
+  SENSOR_SI_RADIAN, SENSOR_SI_INVALID, SENSOR_SI_INVALID, SENSOR_SI_INVALID,
+  SENSOR_SI_PASCAL, SENSOR_SI_PASCAL, SENSOR_SI_INVALID, SENSOR_SI_INVALID,
+  SENSOR_SI_PASCAL, SENSOR_SI_PASCAL, SENSOR_SI_INVALID, SENSOR_SI_INVALID,
+  SENSOR_SI_WATT_PER_SQUARE_METER, SENSOR_SI_INVALID, SENSOR_SI_INVALID, SENSOR_SI_INVALID,
+  SENSOR_SI_KELVIN, SENSOR_SI_KELVIN, SENSOR_SI_INVALID, SENSOR_SI_INVALID,
+  SENSOR_SI_METER_PER_SECOND, SENSOR_SI_METER_PER_SECOND, SENSOR_SI_INVALID, SENSOR_SI_INVALID,
+  SENSOR_SI_METER, SENSOR_SI_METER, SENSOR_SI_INVALID, SENSOR_SI_INVALID,
+  SENSOR_SI_KILOGRAM, SENSOR_SI_KILOGRAM, SENSOR_SI_INVALID, SENSOR_SI_INVALID,
+  SENSOR_SI_VOLT, SENSOR_SI_VOLT, SENSOR_SI_INVALID, SENSOR_SI_INVALID,
+  SENSOR_SI_AMPERE, SENSOR_SI_AMPERE, SENSOR_SI_INVALID, SENSOR_SI_INVALID,
+  SENSOR_SI_DIMENSIONLESS, SENSOR_SI_INVALID, SENSOR_SI_INVALID, SENSOR_SI_INVALID,
+  SENSOR_SI_CUBIC_METER_PER_SECOND, SENSOR_SI_CUBIC_METER_PER_SECOND, SENSOR_SI_INVALID, SENSOR_SI_INVALID,
+  SENSOR_SI_CUBIC_METER, SENSOR_SI_CUBIC_METER, SENSOR_SI_CUBIC_METER, SENSOR_SI_INVALID,
+  SENSOR_SI_METER, SENSOR_SI_METER, SENSOR_SI_METER, SENSOR_SI_INVALID,
+  SENSOR_SI_DIMENSIONLESS, SENSOR_SI_RADIAN, SENSOR_SI_RADIAN, SENSOR_SI_INVALID,
+  SENSOR_SI_HERTZ, SENSOR_SI_HERTZ, SENSOR_SI_INVALID, SENSOR_SI_INVALID,
+  SENSOR_SI_KELVIN, SENSOR_SI_KELVIN, SENSOR_SI_INVALID, SENSOR_SI_INVALID,
+  SENSOR_SI_KELVIN, SENSOR_SI_KELVIN, SENSOR_SI_INVALID, SENSOR_SI_INVALID,
+  SENSOR_SI_NONE, SENSOR_SI_NONE, SENSOR_SI_NONE, SENSOR_SI_NONE,
+  SENSOR_SI_NONE, SENSOR_SI_NONE, SENSOR_SI_NONE, SENSOR_SI_NONE,
+  SENSOR_SI_NONE, SENSOR_SI_INVALID, SENSOR_SI_INVALID, SENSOR_SI_INVALID,
+  SENSOR_SI_OHM_METER, SENSOR_SI_INVALID, SENSOR_SI_INVALID, SENSOR_SI_INVALID,
+  SENSOR_SI_SIEMENS_PER_METER, SENSOR_SI_INVALID, SENSOR_SI_INVALID, SENSOR_SI_INVALID,
+  SENSOR_SI_NONE, SENSOR_SI_NONE, SENSOR_SI_INVALID, SENSOR_SI_INVALID,
+  SENSOR_SI_DIMENSIONLESS, SENSOR_SI_DIMENSIONLESS, SENSOR_SI_OHM, SENSOR_SI_DIMENSIONLESS,
+  SENSOR_SI_HERTZ, SENSOR_SI_HERTZ, SENSOR_SI_INVALID, SENSOR_SI_INVALID,
+  SENSOR_SI_SECOND, SENSOR_SI_INVALID, SENSOR_SI_INVALID, SENSOR_SI_INVALID,
+  SENSOR_SI_KELVIN, SENSOR_SI_KELVIN, SENSOR_SI_INVALID, SENSOR_SI_INVALID,
+  SENSOR_SI_MOLE_PER_CUBIC_METER, SENSOR_SI_KILOGRAM_PER_CUBIC_METER, SENSOR_SI_INVALID, SENSOR_SI_INVALID,
+  SENSOR_SI_MOLE_PER_CUBIC_METER, SENSOR_SI_INVALID, SENSOR_SI_INVALID, SENSOR_SI_INVALID,
+  SENSOR_SI_BECQUEREL_PER_CUBIC_METER, SENSOR_SI_BECQUEREL_PER_CUBIC_METER, SENSOR_SI_INVALID, SENSOR_SI_INVALID,
+  SENSOR_SI_MOLE_PER_CUBIC_METER, SENSOR_SI_INVALID, SENSOR_SI_INVALID, SENSOR_SI_INVALID,
+  SENSOR_SI_MOLE_PER_CUBIC_METER, SENSOR_SI_DIMENSIONLESS, SENSOR_SI_INVALID, SENSOR_SI_INVALID,
+  SENSOR_SI_MOLE_PER_CUBIC_METER, SENSOR_SI_DIMENSIONLESS, SENSOR_SI_INVALID, SENSOR_SI_INVALID,
+  SENSOR_SI_DIMENSIONLESS, SENSOR_SI_INVALID, SENSOR_SI_INVALID, SENSOR_SI_INVALID,
+  SENSOR_SI_NONE, SENSOR_SI_INVALID, SENSOR_SI_INVALID, SENSOR_SI_INVALID,
+  SENSOR_SI_MOLE_PER_CUBIC_METER, SENSOR_SI_INVALID, SENSOR_SI_INVALID, SENSOR_SI_INVALID,
+  SENSOR_SI_HERTZ, SENSOR_SI_INVALID, SENSOR_SI_INVALID, SENSOR_SI_INVALID,
+  SENSOR_SI_PASCAL, SENSOR_SI_PASCAL, SENSOR_SI_INVALID, SENSOR_SI_INVALID,
+  SENSOR_SI_KILOGRAM, SENSOR_SI_INVALID, SENSOR_SI_INVALID, SENSOR_SI_INVALID,
+  SENSOR_SI_KILOGRAM, SENSOR_SI_INVALID, SENSOR_SI_INVALID, SENSOR_SI_INVALID,
+  SENSOR_SI_KILOGRAM, SENSOR_SI_INVALID, SENSOR_SI_INVALID, SENSOR_SI_INVALID,
+  SENSOR_SI_KILOGRAM, SENSOR_SI_INVALID, SENSOR_SI_INVALID, SENSOR_SI_INVALID,
+  SENSOR_SI_JOULE, SENSOR_SI_INVALID, SENSOR_SI_INVALID, SENSOR_SI_INVALID,
+  SENSOR_SI_NONE, SENSOR_SI_INVALID, SENSOR_SI_INVALID, SENSOR_SI_INVALID,
+  SENSOR_SI_METER_PER_SQUARE_SECOND, SENSOR_SI_INVALID, SENSOR_SI_INVALID, SENSOR_SI_INVALID,
+  SENSOR_SI_METER_PER_SQUARE_SECOND, SENSOR_SI_INVALID, SENSOR_SI_INVALID, SENSOR_SI_INVALID,
+  SENSOR_SI_METER_PER_SQUARE_SECOND, SENSOR_SI_INVALID, SENSOR_SI_INVALID, SENSOR_SI_INVALID,
+  SENSOR_SI_DIMENSIONLESS, SENSOR_SI_INVALID, SENSOR_SI_INVALID, SENSOR_SI_INVALID,
+  SENSOR_SI_CUBIC_METER_PER_SECOND, SENSOR_SI_INVALID, SENSOR_SI_INVALID, SENSOR_SI_INVALID,
+  SENSOR_SI_PASCAL, SENSOR_SI_INVALID, SENSOR_SI_INVALID, SENSOR_SI_INVALID,
+  SENSOR_SI_DIMENSIONLESS, SENSOR_SI_NONE, SENSOR_SI_INVALID, SENSOR_SI_INVALID,
+  SENSOR_SI_MOLE_PER_CUBIC_METER, SENSOR_SI_KILOGRAM_PER_CUBIC_METER, SENSOR_SI_INVALID, SENSOR_SI_INVALID,
+  SENSOR_SI_HERTZ, SENSOR_SI_INVALID, SENSOR_SI_INVALID, SENSOR_SI_INVALID,
+  SENSOR_SI_DIMENSIONLESS, SENSOR_SI_INVALID, SENSOR_SI_INVALID, SENSOR_SI_INVALID,
+  SENSOR_SI_KELVIN, SENSOR_SI_KELVIN, SENSOR_SI_INVALID, SENSOR_SI_INVALID,
+  SENSOR_SI_KELVIN, SENSOR_SI_KELVIN, SENSOR_SI_INVALID, SENSOR_SI_INVALID,
+  SENSOR_SI_KELVIN, SENSOR_SI_KELVIN, SENSOR_SI_INVALID, SENSOR_SI_INVALID,
+  SENSOR_SI_KELVIN, SENSOR_SI_KELVIN, SENSOR_SI_INVALID, SENSOR_SI_INVALID,
+  SENSOR_SI_KILOGRAM_PER_CUBIC_METER, SENSOR_SI_INVALID, SENSOR_SI_INVALID, SENSOR_SI_INVALID,
+  SENSOR_SI_NONE, SENSOR_SI_INVALID, SENSOR_SI_INVALID, SENSOR_SI_INVALID,
+  SENSOR_SI_VOLT, SENSOR_SI_INVALID, SENSOR_SI_INVALID, SENSOR_SI_INVALID,
+  SENSOR_SI_DIMENSIONLESS, SENSOR_SI_INVALID, SENSOR_SI_INVALID, SENSOR_SI_INVALID,
+  SENSOR_SI_RADIAN, SENSOR_SI_INVALID, SENSOR_SI_INVALID, SENSOR_SI_INVALID,
+  SENSOR_SI_NEWTON, SENSOR_SI_INVALID, SENSOR_SI_INVALID, SENSOR_SI_INVALID,
+  SENSOR_SI_KELVIN, SENSOR_SI_KELVIN, SENSOR_SI_INVALID, SENSOR_SI_INVALID,
+  SENSOR_SI_KELVIN, SENSOR_SI_KELVIN, SENSOR_SI_INVALID, SENSOR_SI_INVALID,
+  SENSOR_SI_KELVIN, SENSOR_SI_KELVIN, SENSOR_SI_INVALID, SENSOR_SI_INVALID,
+  SENSOR_SI_KELVIN, SENSOR_SI_KELVIN, SENSOR_SI_INVALID, SENSOR_SI_INVALID,
+  SENSOR_SI_KELVIN, SENSOR_SI_KELVIN, SENSOR_SI_INVALID, SENSOR_SI_INVALID,
+  SENSOR_SI_KELVIN, SENSOR_SI_KELVIN, SENSOR_SI_INVALID, SENSOR_SI_INVALID,
+  SENSOR_SI_PASCAL, SENSOR_SI_PASCAL, SENSOR_SI_INVALID, SENSOR_SI_INVALID,
+  SENSOR_SI_PASCAL, SENSOR_SI_PASCAL, SENSOR_SI_INVALID, SENSOR_SI_INVALID,
+  SENSOR_SI_KELVIN, SENSOR_SI_KELVIN, SENSOR_SI_INVALID, SENSOR_SI_INVALID,
+  SENSOR_SI_KILOGRAM_PER_CUBIC_METER, SENSOR_SI_INVALID, SENSOR_SI_INVALID, SENSOR_SI_INVALID,
+  SENSOR_SI_KILOGRAM_PER_CUBIC_METER, SENSOR_SI_INVALID, SENSOR_SI_INVALID, SENSOR_SI_INVALID,
+  SENSOR_SI_KILOGRAM_PER_CUBIC_METER, SENSOR_SI_INVALID, SENSOR_SI_INVALID, SENSOR_SI_INVALID,
+  SENSOR_SI_KILOGRAM_PER_CUBIC_METER, SENSOR_SI_INVALID, SENSOR_SI_INVALID, SENSOR_SI_INVALID,
+  SENSOR_SI_KILOGRAM_PER_CUBIC_METER, SENSOR_SI_INVALID, SENSOR_SI_INVALID, SENSOR_SI_INVALID,
+  SENSOR_SI_KILOGRAM_PER_CUBIC_METER, SENSOR_SI_INVALID, SENSOR_SI_INVALID, SENSOR_SI_INVALID,
+  SENSOR_SI_DIMENSIONLESS, SENSOR_SI_INVALID, SENSOR_SI_INVALID, SENSOR_SI_INVALID,
+  SENSOR_SI_DIMENSIONLESS, SENSOR_SI_INVALID, SENSOR_SI_INVALID, SENSOR_SI_INVALID,
+  SENSOR_SI_INVALID, SENSOR_SI_INVALID, SENSOR_SI_INVALID, SENSOR_SI_INVALID,
+  SENSOR_SI_INVALID, SENSOR_SI_INVALID, SENSOR_SI_INVALID, SENSOR_SI_INVALID,
+  SENSOR_SI_INVALID, SENSOR_SI_INVALID, SENSOR_SI_INVALID, SENSOR_SI_INVALID,
+  SENSOR_SI_INVALID, SENSOR_SI_INVALID, SENSOR_SI_INVALID, SENSOR_SI_INVALID,
+  SENSOR_SI_INVALID, SENSOR_SI_INVALID, SENSOR_SI_INVALID, SENSOR_SI_INVALID,
+  SENSOR_SI_INVALID, SENSOR_SI_INVALID, SENSOR_SI_INVALID, SENSOR_SI_INVALID,
+  SENSOR_SI_INVALID, SENSOR_SI_INVALID, SENSOR_SI_INVALID, SENSOR_SI_INVALID,
+  SENSOR_SI_INVALID, SENSOR_SI_INVALID, SENSOR_SI_INVALID, SENSOR_SI_INVALID,
+  SENSOR_SI_INVALID, SENSOR_SI_INVALID, SENSOR_SI_INVALID, SENSOR_SI_INVALID,
+  SENSOR_SI_INVALID, SENSOR_SI_INVALID, SENSOR_SI_INVALID, SENSOR_SI_INVALID,
+  SENSOR_SI_INVALID, SENSOR_SI_INVALID, SENSOR_SI_INVALID, SENSOR_SI_INVALID,
+  SENSOR_SI_INVALID, SENSOR_SI_INVALID, SENSOR_SI_INVALID, SENSOR_SI_INVALID,
+  SENSOR_SI_INVALID, SENSOR_SI_INVALID, SENSOR_SI_INVALID, SENSOR_SI_INVALID,
+  SENSOR_SI_INVALID, SENSOR_SI_INVALID, SENSOR_SI_INVALID, SENSOR_SI_INVALID,
+  SENSOR_SI_INVALID, SENSOR_SI_INVALID, SENSOR_SI_INVALID, SENSOR_SI_INVALID,
+  SENSOR_SI_INVALID, SENSOR_SI_INVALID, SENSOR_SI_INVALID, SENSOR_SI_INVALID,
+  SENSOR_SI_INVALID, SENSOR_SI_INVALID, SENSOR_SI_INVALID, SENSOR_SI_INVALID,
+  SENSOR_SI_INVALID, SENSOR_SI_INVALID, SENSOR_SI_INVALID, SENSOR_SI_INVALID,
+  SENSOR_SI_INVALID, SENSOR_SI_INVALID, SENSOR_SI_INVALID, SENSOR_SI_INVALID,
+  SENSOR_SI_INVALID, SENSOR_SI_INVALID, SENSOR_SI_INVALID, SENSOR_SI_INVALID,
+  SENSOR_SI_INVALID, SENSOR_SI_INVALID, SENSOR_SI_INVALID, SENSOR_SI_INVALID,
+  SENSOR_SI_INVALID, SENSOR_SI_INVALID, SENSOR_SI_INVALID, SENSOR_SI_INVALID,
+  SENSOR_SI_INVALID, SENSOR_SI_INVALID, SENSOR_SI_INVALID, SENSOR_SI_INVALID,
+  SENSOR_SI_INVALID, SENSOR_SI_INVALID, SENSOR_SI_INVALID, SENSOR_SI_INVALID,
+  SENSOR_SI_INVALID, SENSOR_SI_INVALID, SENSOR_SI_INVALID, SENSOR_SI_INVALID,
+  SENSOR_SI_INVALID, SENSOR_SI_INVALID, SENSOR_SI_INVALID, SENSOR_SI_INVALID,
+  SENSOR_SI_INVALID, SENSOR_SI_INVALID, SENSOR_SI_INVALID, SENSOR_SI_INVALID,
+  SENSOR_SI_INVALID, SENSOR_SI_INVALID, SENSOR_SI_INVALID, SENSOR_SI_INVALID,
+  SENSOR_SI_INVALID, SENSOR_SI_INVALID, SENSOR_SI_INVALID, SENSOR_SI_INVALID,
+  SENSOR_SI_INVALID, SENSOR_SI_INVALID, SENSOR_SI_INVALID, SENSOR_SI_INVALID,
+  SENSOR_SI_INVALID, SENSOR_SI_INVALID, SENSOR_SI_INVALID, SENSOR_SI_INVALID,
+  SENSOR_SI_INVALID, SENSOR_SI_INVALID, SENSOR_SI_INVALID, SENSOR_SI_INVALID,
+  SENSOR_SI_INVALID, SENSOR_SI_INVALID, SENSOR_SI_INVALID, SENSOR_SI_INVALID,
+  SENSOR_SI_INVALID, SENSOR_SI_INVALID, SENSOR_SI_INVALID, SENSOR_SI_INVALID,
+  SENSOR_SI_INVALID, SENSOR_SI_INVALID, SENSOR_SI_INVALID, SENSOR_SI_INVALID,
+  SENSOR_SI_INVALID, SENSOR_SI_INVALID, SENSOR_SI_INVALID, SENSOR_SI_INVALID,
+  SENSOR_SI_INVALID, SENSOR_SI_INVALID, SENSOR_SI_INVALID, SENSOR_SI_INVALID,
+  SENSOR_SI_INVALID, SENSOR_SI_INVALID, SENSOR_SI_INVALID, SENSOR_SI_INVALID,
+  SENSOR_SI_INVALID, SENSOR_SI_INVALID, SENSOR_SI_INVALID, SENSOR_SI_INVALID,
+  SENSOR_SI_INVALID, SENSOR_SI_INVALID, SENSOR_SI_INVALID, SENSOR_SI_INVALID,
+  SENSOR_SI_INVALID, SENSOR_SI_INVALID, SENSOR_SI_INVALID, SENSOR_SI_INVALID,
+  SENSOR_SI_INVALID, SENSOR_SI_INVALID, SENSOR_SI_INVALID, SENSOR_SI_INVALID,
+  SENSOR_SI_INVALID, SENSOR_SI_INVALID, SENSOR_SI_INVALID, SENSOR_SI_INVALID,
+  SENSOR_SI_INVALID, SENSOR_SI_INVALID, SENSOR_SI_INVALID, SENSOR_SI_INVALID,
+  SENSOR_SI_INVALID, SENSOR_SI_INVALID, SENSOR_SI_INVALID, SENSOR_SI_INVALID,
+  SENSOR_SI_INVALID, SENSOR_SI_INVALID, SENSOR_SI_INVALID, SENSOR_SI_INVALID,
+  SENSOR_SI_INVALID, SENSOR_SI_INVALID, SENSOR_SI_INVALID, SENSOR_SI_INVALID,
+  SENSOR_SI_INVALID, SENSOR_SI_INVALID, SENSOR_SI_INVALID, SENSOR_SI_INVALID,
+  SENSOR_SI_INVALID, SENSOR_SI_INVALID, SENSOR_SI_INVALID, SENSOR_SI_INVALID,
+  SENSOR_SI_INVALID, SENSOR_SI_INVALID, SENSOR_SI_INVALID, SENSOR_SI_INVALID,
+  SENSOR_SI_INVALID, SENSOR_SI_INVALID, SENSOR_SI_INVALID, SENSOR_SI_INVALID,
+  SENSOR_SI_INVALID, SENSOR_SI_INVALID, SENSOR_SI_INVALID, SENSOR_SI_INVALID,
+  SENSOR_SI_INVALID, SENSOR_SI_INVALID, SENSOR_SI_INVALID, SENSOR_SI_INVALID,
+  SENSOR_SI_INVALID, SENSOR_SI_INVALID, SENSOR_SI_INVALID, SENSOR_SI_INVALID,
+  SENSOR_SI_INVALID, SENSOR_SI_INVALID, SENSOR_SI_INVALID, SENSOR_SI_INVALID,
+  SENSOR_SI_INVALID, SENSOR_SI_INVALID, SENSOR_SI_INVALID, SENSOR_SI_INVALID,
+  SENSOR_SI_INVALID, SENSOR_SI_INVALID, SENSOR_SI_INVALID, SENSOR_SI_INVALID,
+  SENSOR_SI_INVALID, SENSOR_SI_INVALID, SENSOR_SI_INVALID, SENSOR_SI_INVALID,
+  SENSOR_SI_INVALID, SENSOR_SI_INVALID, SENSOR_SI_INVALID, SENSOR_SI_INVALID,
+  SENSOR_SI_INVALID, SENSOR_SI_INVALID, SENSOR_SI_INVALID, SENSOR_SI_INVALID,
+  SENSOR_SI_INVALID, SENSOR_SI_INVALID, SENSOR_SI_INVALID, SENSOR_SI_INVALID,
+  SENSOR_SI_INVALID, SENSOR_SI_INVALID, SENSOR_SI_INVALID, SENSOR_SI_INVALID,
+  SENSOR_SI_INVALID, SENSOR_SI_INVALID, SENSOR_SI_INVALID, SENSOR_SI_INVALID,
+  SENSOR_SI_INVALID, SENSOR_SI_INVALID, SENSOR_SI_INVALID, SENSOR_SI_INVALID,
+  SENSOR_SI_INVALID, SENSOR_SI_INVALID, SENSOR_SI_INVALID, SENSOR_SI_INVALID,
+  SENSOR_SI_INVALID, SENSOR_SI_INVALID, SENSOR_SI_INVALID, SENSOR_SI_INVALID,
+  SENSOR_SI_INVALID, SENSOR_SI_INVALID, SENSOR_SI_INVALID, SENSOR_SI_INVALID,
+  SENSOR_SI_INVALID, SENSOR_SI_INVALID, SENSOR_SI_INVALID, SENSOR_SI_INVALID,
+  SENSOR_SI_INVALID, SENSOR_SI_INVALID, SENSOR_SI_INVALID, SENSOR_SI_INVALID,
+  SENSOR_SI_INVALID, SENSOR_SI_INVALID, SENSOR_SI_INVALID, SENSOR_SI_INVALID,
+  SENSOR_SI_INVALID, SENSOR_SI_INVALID, SENSOR_SI_INVALID, SENSOR_SI_INVALID,
+  SENSOR_SI_INVALID, SENSOR_SI_INVALID, SENSOR_SI_INVALID, SENSOR_SI_INVALID,
+  SENSOR_SI_INVALID, SENSOR_SI_INVALID, SENSOR_SI_INVALID, SENSOR_SI_INVALID,
+  SENSOR_SI_INVALID, SENSOR_SI_INVALID, SENSOR_SI_INVALID, SENSOR_SI_INVALID,
+  SENSOR_SI_INVALID, SENSOR_SI_INVALID, SENSOR_SI_INVALID, SENSOR_SI_INVALID,
+  SENSOR_SI_INVALID, SENSOR_SI_INVALID, SENSOR_SI_INVALID, SENSOR_SI_INVALID,
+  SENSOR_SI_INVALID, SENSOR_SI_INVALID, SENSOR_SI_INVALID, SENSOR_SI_INVALID,
+  SENSOR_SI_INVALID, SENSOR_SI_INVALID, SENSOR_SI_INVALID, SENSOR_SI_INVALID,
+  SENSOR_SI_INVALID, SENSOR_SI_INVALID, SENSOR_SI_INVALID, SENSOR_SI_INVALID,
+  SENSOR_SI_INVALID, SENSOR_SI_INVALID, SENSOR_SI_INVALID, SENSOR_SI_INVALID,
+  SENSOR_SI_INVALID, SENSOR_SI_INVALID, SENSOR_SI_INVALID, SENSOR_SI_INVALID,
+  SENSOR_SI_INVALID, SENSOR_SI_INVALID, SENSOR_SI_INVALID, SENSOR_SI_INVALID,
+  SENSOR_SI_INVALID, SENSOR_SI_INVALID, SENSOR_SI_INVALID, SENSOR_SI_INVALID,
+  SENSOR_SI_INVALID, SENSOR_SI_INVALID, SENSOR_SI_INVALID, SENSOR_SI_INVALID,
+  SENSOR_SI_INVALID, SENSOR_SI_INVALID, SENSOR_SI_INVALID, SENSOR_SI_INVALID,
+  SENSOR_SI_INVALID, SENSOR_SI_INVALID, SENSOR_SI_INVALID, SENSOR_SI_INVALID,
+  SENSOR_SI_INVALID, SENSOR_SI_INVALID, SENSOR_SI_INVALID, SENSOR_SI_INVALID,
+  SENSOR_SI_INVALID, SENSOR_SI_INVALID, SENSOR_SI_INVALID, SENSOR_SI_INVALID,
+  SENSOR_SI_INVALID, SENSOR_SI_INVALID, SENSOR_SI_INVALID, SENSOR_SI_INVALID,
+  SENSOR_SI_INVALID, SENSOR_SI_INVALID, SENSOR_SI_INVALID, SENSOR_SI_INVALID,
+  SENSOR_SI_INVALID, SENSOR_SI_INVALID, SENSOR_SI_INVALID, SENSOR_SI_INVALID,
+  SENSOR_SI_INVALID, SENSOR_SI_INVALID, SENSOR_SI_INVALID, SENSOR_SI_INVALID,
+  SENSOR_SI_INVALID, SENSOR_SI_INVALID, SENSOR_SI_INVALID, SENSOR_SI_INVALID,
+  SENSOR_SI_INVALID, SENSOR_SI_INVALID, SENSOR_SI_INVALID, SENSOR_SI_INVALID,
+  SENSOR_SI_INVALID, SENSOR_SI_INVALID, SENSOR_SI_INVALID, SENSOR_SI_INVALID,
+  SENSOR_SI_INVALID, SENSOR_SI_INVALID, SENSOR_SI_INVALID, SENSOR_SI_INVALID,
+  SENSOR_SI_INVALID, SENSOR_SI_INVALID, SENSOR_SI_INVALID, SENSOR_SI_INVALID,
+  SENSOR_SI_INVALID, SENSOR_SI_INVALID, SENSOR_SI_INVALID, SENSOR_SI_INVALID,
+  SENSOR_SI_INVALID, SENSOR_SI_INVALID, SENSOR_SI_INVALID, SENSOR_SI_INVALID,
+  SENSOR_SI_INVALID, SENSOR_SI_INVALID, SENSOR_SI_INVALID, SENSOR_SI_INVALID,
+  SENSOR_SI_INVALID, SENSOR_SI_INVALID, SENSOR_SI_INVALID, SENSOR_SI_INVALID,
+  SENSOR_SI_INVALID, SENSOR_SI_INVALID, SENSOR_SI_INVALID, SENSOR_SI_INVALID,
+  SENSOR_SI_INVALID, SENSOR_SI_INVALID, SENSOR_SI_INVALID, SENSOR_SI_INVALID,
+  SENSOR_SI_INVALID, SENSOR_SI_INVALID, SENSOR_SI_INVALID, SENSOR_SI_INVALID,
+  SENSOR_SI_INVALID, SENSOR_SI_INVALID, SENSOR_SI_INVALID, SENSOR_SI_INVALID,
+  SENSOR_SI_INVALID, SENSOR_SI_INVALID, SENSOR_SI_INVALID, SENSOR_SI_INVALID,
+  SENSOR_SI_INVALID, SENSOR_SI_INVALID, SENSOR_SI_INVALID, SENSOR_SI_INVALID,
+  SENSOR_SI_INVALID, SENSOR_SI_INVALID, SENSOR_SI_INVALID, SENSOR_SI_INVALID,
+  SENSOR_SI_INVALID, SENSOR_SI_INVALID, SENSOR_SI_INVALID, SENSOR_SI_INVALID,
+  SENSOR_SI_INVALID, SENSOR_SI_INVALID, SENSOR_SI_INVALID, SENSOR_SI_INVALID,
+  SENSOR_SI_INVALID, SENSOR_SI_INVALID, SENSOR_SI_INVALID, SENSOR_SI_INVALID,
+  SENSOR_SI_INVALID, SENSOR_SI_INVALID, SENSOR_SI_INVALID, SENSOR_SI_INVALID,
+  SENSOR_SI_INVALID, SENSOR_SI_INVALID, SENSOR_SI_INVALID, SENSOR_SI_INVALID,
+  SENSOR_SI_INVALID, SENSOR_SI_INVALID, SENSOR_SI_INVALID, SENSOR_SI_INVALID,
+  SENSOR_SI_INVALID, SENSOR_SI_INVALID, SENSOR_SI_INVALID, SENSOR_SI_INVALID,
+  SENSOR_SI_INVALID, SENSOR_SI_INVALID, SENSOR_SI_INVALID, SENSOR_SI_INVALID,
+  SENSOR_SI_INVALID, SENSOR_SI_INVALID, SENSOR_SI_INVALID, SENSOR_SI_INVALID,
+  SENSOR_SI_INVALID, SENSOR_SI_INVALID, SENSOR_SI_INVALID, SENSOR_SI_INVALID,
+  SENSOR_SI_INVALID, SENSOR_SI_INVALID, SENSOR_SI_INVALID, SENSOR_SI_INVALID,
+  SENSOR_SI_INVALID, SENSOR_SI_INVALID, SENSOR_SI_INVALID, SENSOR_SI_INVALID,
+  SENSOR_SI_INVALID, SENSOR_SI_INVALID, SENSOR_SI_INVALID, SENSOR_SI_INVALID,
+  SENSOR_SI_INVALID, SENSOR_SI_INVALID, SENSOR_SI_INVALID, SENSOR_SI_INVALID,
+  SENSOR_SI_INVALID, SENSOR_SI_INVALID, SENSOR_SI_INVALID, SENSOR_SI_INVALID,
+  SENSOR_SI_INVALID, SENSOR_SI_INVALID, SENSOR_SI_INVALID, SENSOR_SI_INVALID,
+  SENSOR_SI_INVALID, SENSOR_SI_INVALID, SENSOR_SI_INVALID, SENSOR_SI_INVALID,
+  SENSOR_SI_INVALID, SENSOR_SI_INVALID, SENSOR_SI_INVALID, SENSOR_SI_INVALID,
+  SENSOR_SI_INVALID, SENSOR_SI_INVALID, SENSOR_SI_INVALID, SENSOR_SI_INVALID,
+  SENSOR_SI_INVALID, SENSOR_SI_INVALID, SENSOR_SI_INVALID, SENSOR_SI_INVALID,
+  SENSOR_SI_INVALID, SENSOR_SI_INVALID, SENSOR_SI_INVALID, SENSOR_SI_INVALID,
+  SENSOR_SI_INVALID, SENSOR_SI_INVALID, SENSOR_SI_INVALID, SENSOR_SI_INVALID,
+  SENSOR_SI_INVALID, SENSOR_SI_INVALID, SENSOR_SI_INVALID, SENSOR_SI_INVALID,
+  SENSOR_SI_INVALID, SENSOR_SI_INVALID, SENSOR_SI_INVALID, SENSOR_SI_INVALID,
+  SENSOR_SI_INVALID, SENSOR_SI_INVALID, SENSOR_SI_INVALID, SENSOR_SI_INVALID,
+  SENSOR_SI_INVALID, SENSOR_SI_INVALID, SENSOR_SI_INVALID, SENSOR_SI_INVALID,
+  SENSOR_SI_INVALID, SENSOR_SI_INVALID, SENSOR_SI_INVALID, SENSOR_SI_INVALID,
+  SENSOR_SI_INVALID, SENSOR_SI_INVALID, SENSOR_SI_INVALID, SENSOR_SI_INVALID,
+  SENSOR_SI_INVALID, SENSOR_SI_INVALID, SENSOR_SI_INVALID, SENSOR_SI_INVALID,
+  SENSOR_SI_INVALID, SENSOR_SI_INVALID, SENSOR_SI_INVALID, SENSOR_SI_INVALID,
+  SENSOR_SI_INVALID, SENSOR_SI_INVALID, SENSOR_SI_INVALID, SENSOR_SI_INVALID,
+  SENSOR_SI_INVALID, SENSOR_SI_INVALID, SENSOR_SI_INVALID, SENSOR_SI_INVALID,
+  SENSOR_SI_INVALID, SENSOR_SI_INVALID, SENSOR_SI_INVALID, SENSOR_SI_INVALID,
+  SENSOR_SI_INVALID, SENSOR_SI_INVALID, SENSOR_SI_INVALID, SENSOR_SI_INVALID,
+  SENSOR_SI_INVALID, SENSOR_SI_INVALID, SENSOR_SI_INVALID, SENSOR_SI_INVALID,
+  SENSOR_SI_INVALID, SENSOR_SI_INVALID, SENSOR_SI_INVALID, SENSOR_SI_INVALID,
+  SENSOR_SI_INVALID, SENSOR_SI_INVALID, SENSOR_SI_INVALID, SENSOR_SI_INVALID,
+  SENSOR_SI_INVALID, SENSOR_SI_INVALID, SENSOR_SI_INVALID, SENSOR_SI_INVALID,
+  SENSOR_SI_INVALID, SENSOR_SI_INVALID, SENSOR_SI_INVALID, SENSOR_SI_INVALID,
+  SENSOR_SI_INVALID, SENSOR_SI_INVALID, SENSOR_SI_INVALID, SENSOR_SI_INVALID,
+  SENSOR_SI_INVALID, SENSOR_SI_INVALID, SENSOR_SI_INVALID, SENSOR_SI_INVALID,
+  SENSOR_SI_INVALID, SENSOR_SI_INVALID, SENSOR_SI_INVALID, SENSOR_SI_INVALID,
+  SENSOR_SI_INVALID, SENSOR_SI_INVALID, SENSOR_SI_INVALID, SENSOR_SI_INVALID,
+  SENSOR_SI_INVALID, SENSOR_SI_INVALID, SENSOR_SI_INVALID, SENSOR_SI_INVALID,
+  SENSOR_SI_INVALID, SENSOR_SI_INVALID, SENSOR_SI_INVALID, SENSOR_SI_INVALID,
+  SENSOR_SI_INVALID, SENSOR_SI_INVALID, SENSOR_SI_INVALID, SENSOR_SI_INVALID,
+  SENSOR_SI_INVALID, SENSOR_SI_INVALID, SENSOR_SI_INVALID, SENSOR_SI_INVALID,
+  SENSOR_SI_INVALID, SENSOR_SI_INVALID, SENSOR_SI_INVALID, SENSOR_SI_INVALID,
+  SENSOR_SI_INVALID, SENSOR_SI_INVALID, SENSOR_SI_INVALID, SENSOR_SI_INVALID,
+  SENSOR_SI_INVALID, SENSOR_SI_INVALID, SENSOR_SI_INVALID, SENSOR_SI_INVALID,
+  SENSOR_SI_INVALID, SENSOR_SI_INVALID, SENSOR_SI_INVALID, SENSOR_SI_INVALID,
+  SENSOR_SI_INVALID, SENSOR_SI_INVALID, SENSOR_SI_INVALID, SENSOR_SI_INVALID,
+  SENSOR_SI_INVALID, SENSOR_SI_INVALID, SENSOR_SI_INVALID, SENSOR_SI_INVALID,
+  SENSOR_SI_INVALID, SENSOR_SI_INVALID, SENSOR_SI_INVALID, SENSOR_SI_INVALID,
+  SENSOR_SI_INVALID, SENSOR_SI_INVALID, SENSOR_SI_INVALID, SENSOR_SI_INVALID,
+  SENSOR_SI_INVALID, SENSOR_SI_INVALID, SENSOR_SI_INVALID, SENSOR_SI_INVALID,
+  SENSOR_SI_INVALID, SENSOR_SI_INVALID, SENSOR_SI_INVALID, SENSOR_SI_INVALID,
+  SENSOR_SI_INVALID, SENSOR_SI_INVALID, SENSOR_SI_INVALID, SENSOR_SI_INVALID,
+  SENSOR_SI_INVALID, SENSOR_SI_INVALID, SENSOR_SI_INVALID, SENSOR_SI_INVALID,
+};
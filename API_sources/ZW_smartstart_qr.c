@@ -0,0 +1,697 @@
+/****************************************************************************
+ *
+ * Description: SmartStart QR code parser.
+ *
+ ****************************************************************************/
+
+/****************************************************************************/
+/*                              INCLUDE FILES                               */
+/****************************************************************************/
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <pthread.h>
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
+#include <ZW_typedefs.h>
+#include <ZW_smartstart_qr.h>
+
+/****************************************************************************/
+/*                      PRIVATE TYPES and DEFINITIONS                       */
+/****************************************************************************/
+
+/* Field offsets in digits */
+#define QR_OFFSET_VERSION       2
+#define QR_OFFSET_CHECKSUM      4
+#define QR_OFFSET_HASHED        9   /* The checksum covers the rest of the string */
+#define QR_OFFSET_KEYS          9
+#define QR_OFFSET_DSK           12
+
+/* TLV value lengths in digits */
+#define QR_PRODUCT_TYPE_DIGITS  10
+#define QR_PRODUCT_ID_DIGITS    20
+#define QR_INTERVAL_DIGITS      3
+#define QR_UUID16_DIGITS        42
+#define QR_PROTOCOLS_MAX_DIGITS 9
+
+/* Batches are split into about this many chunks per thread */
+#define CHUNKS_PER_THREAD       8
+#define MIN_CHUNK_BYTES         (64 * 1024)
+
+typedef struct _SHA1_CTX_
+{
+  uint32_t state[5];
+  uint8_t  block[64];
+} SHA1_CTX;
+
+/* Lines of the text between start and end */
+typedef struct _CHUNK_
+{
+  const char *pStart;
+  const char *pEnd;
+  uint32_t firstLine;
+  uint32_t lines;
+  uint32_t failed;
+} CHUNK;
+
+typedef struct _BATCH_
+{
+  pthread_mutex_t lock;
+  CHUNK *pChunks;
+  uint32_t chunkCount;
+  uint32_t nextChunk;
+  BOOL counting;            /* First pass: only count lines */
+  uint8_t column;
+  SMARTSTART_QR *pResults;
+  uint32_t maxResults;
+} BATCH;
+
+/****************************************************************************/
+/*                           PRIVATE FUNCTIONS                              */
+/****************************************************************************/
+
+#define ROL32(x, n) (((x) << (n)) | ((x) >> (32 - (n))))
+
+static void
+Sha1Block(
+  uint32_t *pState,
+  const uint8_t *pBlock)
+{
+  uint32_t w[80];
+  uint32_t a = pState[0], b = pState[1], c = pState[2], d = pState[3], e = pState[4];
+  uint8_t i;
+
+  for (i = 0; i < 16; i++)
+  {
+    w[i] = ((uint32_t)pBlock[i * 4] << 24) | ((uint32_t)pBlock[i * 4 + 1] << 16)
+           | ((uint32_t)pBlock[i * 4 + 2] << 8) | pBlock[i * 4 + 3];
+  }
+  for (i = 16; i < 80; i++)
+  {
+    w[i] = ROL32(w[i - 3] ^ w[i - 8] ^ w[i - 14] ^ w[i - 16], 1);
+  }
+  for (i = 0; i < 80; i++)
+  {
+    uint32_t f;
+    uint32_t k;
+    uint32_t t;
+
+    if (i < 20)
+    {
+      f = (b & c) | (~b & d);
+      k = 0x5A827999UL;
+    }
+    else if (i < 40)
+    {
+      f = b ^ c ^ d;
+      k = 0x6ED9EBA1UL;
+    }
+    else if (i < 60)
+    {
+      f = (b & c) | (b & d) | (c & d);
+      k = 0x8F1BBCDCUL;
+    }
+    else
+    {
+      f = b ^ c ^ d;
+      k = 0xCA62C1D6UL;
+    }
+    t = ROL32(a, 5) + f + e + k + w[i];
+    e = d;
+    d = c;
+    c = ROL32(b, 30);
+    b = a;
+    a = t;
+  }
+  pState[0] += a;
+  pState[1] += b;
+  pState[2] += c;
+  pState[3] += d;
+  pState[4] += e;
+}
+
+/* First two bytes of the SHA-1 hash, as a 16 bit value */
+static uint16_t
+Sha1Prefix(
+  const uint8_t *pData,
+  size_t length)
+{
+  SHA1_CTX ctx;
+  size_t remaining = length;
+  uint64_t bits = (uint64_t)length * 8;
+  uint8_t i;
+
+  ctx.state[0] = 0x67452301UL;
+  ctx.state[1] = 0xEFCDAB89UL;
+  ctx.state[2] = 0x98BADCFEUL;
+  ctx.state[3] = 0x10325476UL;
+  ctx.state[4] = 0xC3D2E1F0UL;
+  while (remaining >= 64)
+  {
+    Sha1Block(ctx.state, pData);
+    pData += 64;
+    remaining -= 64;
+  }
+  memset(ctx.block, 0, sizeof(ctx.block));
+  memcpy(ctx.block, pData, remaining);
+  ctx.block[remaining] = 0x80;
+  if (remaining >= 56)
+  {
+    Sha1Block(ctx.state, ctx.block);
+    memset(ctx.block, 0, sizeof(ctx.block));
+  }
+  for (i = 0; i < 8; i++)
+  {
+    ctx.block[63 - i] = (uint8_t)(bits >> (i * 8));
+  }
+  Sha1Block(ctx.state, ctx.block);
+  return (uint16_t)(ctx.state[0] >> 16);
+}
+
+static BOOL
+AllDigits(
+  const char *p,
+  size_t length)
+{
+  size_t i = 0;
+
+#ifdef __SSE2__
+  const __m128i zero = _mm_set1_epi8('0');
+  const __m128i nine = _mm_set1_epi8('9');
+
+  /* Bytes of 0x80 and above compare as negative, below '0' */
+  for (; i + 16 <= length; i += 16)
+  {
+    __m128i v = _mm_loadu_si128((const __m128i *)(p + i));
+    __m128i bad = _mm_or_si128(_mm_cmplt_epi8(v, zero), _mm_cmpgt_epi8(v, nine));
+
+    if (_mm_movemask_epi8(bad))
+    {
+      return FALSE;
+    }
+  }
+#endif
+  for (; i < length; i++)
+  {
+    if ((uint8_t)(p[i] - '0') > 9)
+    {
+      return FALSE;
+    }
+  }
+  return TRUE;
+}
+
+/* Value of a group of digits, already checked to be digits */
+static uint32_t
+Number(
+  const char *p,
+  uint8_t digits)
+{
+  uint32_t value = 0;
+
+  while (digits--)
+  {
+    value = value * 10 + (uint32_t)(*p++ - '0');
+  }
+  return value;
+}
+
+/* 5 digit groups to big endian 16 bit values */
+static BOOL
+Groups16(
+  const char *p,
+  uint8_t groups,
+  uint8_t *pOut)
+{
+  uint8_t i;
+
+  for (i = 0; i < groups; i++)
+  {
+    uint32_t value = Number(p + i * 5, 5);
+
+    if (value > 0xFFFF)
+    {
+      return FALSE;
+    }
+    pOut[i * 2] = (uint8_t)(value >> 8);
+    pOut[i * 2 + 1] = (uint8_t)value;
+  }
+  return TRUE;
+}
+
+static E_SMARTSTART_QR_STATUS
+ParseTlv(
+  uint8_t type,
+  const char *pValue,
+  uint8_t digits,
+  SMARTSTART_QR *pQr)
+{
+  uint8_t values[16];
+
+  switch (type)
+  {
+    case PROVISIONING_TLV_PRODUCT_TYPE:
+      if (QR_PRODUCT_TYPE_DIGITS != digits || !Groups16(pValue, 2, values))
+      {
+        return SMARTSTART_QR_BAD_TLV;
+      }
+      pQr->genericDeviceClass = values[0];
+      pQr->specificDeviceClass = values[1];
+      pQr->installerIconType = (uint16_t)((values[2] << 8) | values[3]);
+      break;
+
+    case PROVISIONING_TLV_PRODUCT_ID:
+      if (QR_PRODUCT_ID_DIGITS != digits || !Groups16(pValue, 4, values))
+      {
+        return SMARTSTART_QR_BAD_TLV;
+      }
+      pQr->manufacturerId = (uint16_t)((values[0] << 8) | values[1]);
+      pQr->productType = (uint16_t)((values[2] << 8) | values[3]);
+      pQr->productId = (uint16_t)((values[4] << 8) | values[5]);
+      pQr->applicationVersion = (uint16_t)((values[6] << 8) | values[7]);
+      break;
+
+    case PROVISIONING_TLV_MAX_INCLUSION_REQUEST_INTERVAL:
+      if (QR_INTERVAL_DIGITS != digits || Number(pValue, digits) > 0xFF)
+      {
+        return SMARTSTART_QR_BAD_TLV;
+      }
+      pQr->maxInclusionRequestInterval = (uint8_t)Number(pValue, digits);
+      break;
+
+    case PROVISIONING_TLV_UUID16:
+      if (QR_UUID16_DIGITS != digits || !Groups16(pValue + 2, 8, pQr->uuid))
+      {
+        return SMARTSTART_QR_BAD_TLV;
+      }
+      pQr->uuidPresentation = (uint8_t)Number(pValue, 2);
+      break;
+
+    case PROVISIONING_TLV_SUPPORTED_PROTOCOLS:
+      if (0 == digits || digits > QR_PROTOCOLS_MAX_DIGITS)
+      {
+        return SMARTSTART_QR_BAD_TLV;
+      }
+      pQr->supportedProtocols = Number(pValue, digits);
+      break;
+
+    default:
+      /* Unknown, the caller checks the critical flag */
+      return SMARTSTART_QR_UNSUPPORTED_CRITICAL;
+  }
+  pQr->tlvPresent |= SMARTSTART_QR_TLV_BIT(type);
+  return SMARTSTART_QR_OK;
+}
+
+static E_SMARTSTART_QR_STATUS
+Parse(
+  const char *pText,
+  size_t length,
+  SMARTSTART_QR *pQr)
+{
+  size_t offset = SMARTSTART_QR_MIN_LENGTH;
+  uint32_t value;
+
+  memset(pQr, 0, sizeof(SMARTSTART_QR));
+  if (0 == length)
+  {
+    return SMARTSTART_QR_EMPTY;
+  }
+  if (!AllDigits(pText, length))
+  {
+    return SMARTSTART_QR_NOT_DIGITS;
+  }
+  if (length < SMARTSTART_QR_MIN_LENGTH)
+  {
+    return SMARTSTART_QR_TOO_SHORT;
+  }
+  if ('9' != pText[0] || '0' != pText[1])
+  {
+    return SMARTSTART_QR_BAD_LEAD_IN;
+  }
+  value = Number(&pText[QR_OFFSET_VERSION], 2);
+  if (value > SMARTSTART_QR_VERSION_SMARTSTART)
+  {
+    return SMARTSTART_QR_BAD_VERSION;
+  }
+  pQr->version = (uint8_t)value;
+  if (Number(&pText[QR_OFFSET_CHECKSUM], 5) != Sha1Prefix((const uint8_t *)&pText[QR_OFFSET_HASHED],
+                                                           length - QR_OFFSET_HASHED))
+  {
+    return SMARTSTART_QR_BAD_CHECKSUM;
+  }
+  value = Number(&pText[QR_OFFSET_KEYS], 3);
+  if (value > 0xFF || !Groups16(&pText[QR_OFFSET_DSK], 8, pQr->dsk))
+  {
+    return SMARTSTART_QR_BAD_VALUE;
+  }
+  pQr->requestedKeys = (uint8_t)value;
+
+  while (offset < length)
+  {
+    uint8_t typeByte;
+    uint8_t digits;
+    E_SMARTSTART_QR_STATUS status;
+
+    if (length - offset < 4)
+    {
+      return SMARTSTART_QR_BAD_TLV;
+    }
+    typeByte = (uint8_t)Number(&pText[offset], 2);
+    digits = (uint8_t)Number(&pText[offset + 2], 2);
+    offset += 4;
+    if (digits > length - offset)
+    {
+      return SMARTSTART_QR_BAD_TLV;
+    }
+    status = ParseTlv(PROVISIONING_TLV_TYPE(typeByte), &pText[offset], digits, pQr);
+    if (SMARTSTART_QR_UNSUPPORTED_CRITICAL == status && !PROVISIONING_TLV_CRITICAL(typeByte))
+    {
+      /* Unknown non-critical TLVs are skipped */
+      status = SMARTSTART_QR_OK;
+    }
+    if (SMARTSTART_QR_OK != status)
+    {
+      return status;
+    }
+    offset += digits;
+  }
+  return SMARTSTART_QR_OK;
+}
+
+/* Find a CSV field of a line and strip quotes and white space */
+static void
+Field(
+  const char *pLine,
+  const char *pEnd,
+  uint8_t column,
+  const char **ppField,
+  size_t *pLength)
+{
+  const char *p = pLine;
+  const char *pFieldEnd;
+
+  while (column && p < pEnd)
+  {
+    BOOL quoted = FALSE;
+
+    for (; p < pEnd && (quoted || ',' != *p); p++)
+    {
+      if ('"' == *p)
+      {
+        quoted = !quoted;
+      }
+    }
+    if (p < pEnd)
+    {
+      p++;
+      column--;
+    }
+  }
+  if (column)
+  {
+    *ppField = p;
+    *pLength = 0;
+    return;
+  }
+  for (pFieldEnd = p; pFieldEnd < pEnd && ',' != *pFieldEnd; pFieldEnd++)
+  {
+  }
+  while (p < pFieldEnd && (' ' == *p || '\t' == *p || '"' == *p))
+  {
+    p++;
+  }
+  while (pFieldEnd > p && (' ' == pFieldEnd[-1] || '\t' == pFieldEnd[-1] || '\r' == pFieldEnd[-1]
+                           || '"' == pFieldEnd[-1]))
+  {
+    pFieldEnd--;
+  }
+  *ppField = p;
+  *pLength = (size_t)(pFieldEnd - p);
+}
+
+static void
+ChunkRun(
+  BATCH *pBatch,
+  CHUNK *pChunk)
+{
+  const char *p = pChunk->pStart;
+  uint32_t line = pChunk->firstLine;
+
+  if (pBatch->counting)
+  {
+    uint32_t lines = 0;
+
+    while (p < pChunk->pEnd)
+    {
+      const char *pNewline = memchr(p, '\n', (size_t)(pChunk->pEnd - p));
+
+      lines++;
+      p = pNewline ? pNewline + 1 : pChunk->pEnd;
+    }
+    pChunk->lines = lines;
+    return;
+  }
+  while (p < pChunk->pEnd)
+  {
+    const char *pNewline = memchr(p, '\n', (size_t)(pChunk->pEnd - p));
+    const char *pLineEnd = pNewline ? pNewline : pChunk->pEnd;
+
+    if (line < pBatch->maxResults)
+    {
+      SMARTSTART_QR *pQr = &pBatch->pResults[line];
+      const char *pField;
+      size_t fieldLength;
+
+      Field(p, pLineEnd, pBatch->column, &pField, &fieldLength);
+      pQr->status = (uint8_t)Parse(pField, fieldLength, pQr);
+      if (SMARTSTART_QR_OK != pQr->status)
+      {
+        pChunk->failed++;
+      }
+    }
+    line++;
+    p = pNewline ? pNewline + 1 : pChunk->pEnd;
+  }
+}
+
+static void *
+BatchWorker(void *pArg)
+{
+  BATCH *pBatch = (BATCH *)pArg;
+
+  for (;;)
+  {
+    uint32_t index;
+
+    pthread_mutex_lock(&pBatch->lock);
+    index = pBatch->nextChunk;
+    if (index < pBatch->chunkCount)
+    {
+      pBatch->nextChunk++;
+    }
+    pthread_mutex_unlock(&pBatch->lock);
+    if (index >= pBatch->chunkCount)
+    {
+      return NULL;
+    }
+    ChunkRun(pBatch, &pBatch->pChunks[index]);
+  }
+}
+
+/* Run all chunks on the calling thread and up to threads - 1 more */
+static void
+BatchRun(
+  BATCH *pBatch,
+  uint8_t threads)
+{
+  pthread_t thread[255];
+  uint32_t started = 0;
+  uint32_t i;
+
+  pBatch->nextChunk = 0;
+  while (started + 1 < threads && 0 == pthread_create(&thread[started], NULL, BatchWorker, pBatch))
+  {
+    started++;
+  }
+  BatchWorker(pBatch);
+  for (i = 0; i < started; i++)
+  {
+    pthread_join(thread[i], NULL);
+  }
+}
+
+static void
+PutTlv(
+  uint8_t *pTlv,
+  uint16_t *pOffset,
+  uint8_t type,
+  const uint8_t *pValue,
+  uint8_t length)
+{
+  pTlv[(*pOffset)++] = (uint8_t)(type << 1);
+  pTlv[(*pOffset)++] = length;
+  memcpy(&pTlv[*pOffset], pValue, length);
+  *pOffset = (uint16_t)(*pOffset + length);
+}
+
+/****************************************************************************/
+/*                           EXPORTED FUNCTIONS                             */
+/****************************************************************************/
+
+E_SMARTSTART_QR_STATUS
+SmartStartQrParse(
+  const char *pText,
+  size_t length,
+  SMARTSTART_QR *pQr)
+{
+  pQr->status = (uint8_t)Parse(pText, length, pQr);
+  return (E_SMARTSTART_QR_STATUS)pQr->status;
+}
+
+uint32_t
+SmartStartQrParseBatch(
+  const char *pText,
+  size_t length,
+  uint8_t column,
+  SMARTSTART_QR *pResults,
+  uint32_t maxResults,
+  uint8_t threads,
+  uint32_t *pFailed)
+{
+  BATCH batch;
+  CHUNK single;
+  const char *pEnd = pText + length;
+  const char *p = pText;
+  uint32_t chunkCount;
+  uint32_t lines = 0;
+  uint32_t failed = 0;
+  uint32_t i;
+
+  if (0 == threads)
+  {
+    long cpus = sysconf(_SC_NPROCESSORS_ONLN);
+
+    threads = (cpus < 1) ? 1 : ((cpus > 255) ? 255 : (uint8_t)cpus);
+  }
+  chunkCount = (uint32_t)threads * CHUNKS_PER_THREAD;
+  if (chunkCount > length / MIN_CHUNK_BYTES)
+  {
+    chunkCount = (uint32_t)(length / MIN_CHUNK_BYTES) + 1;
+  }
+  memset(&batch, 0, sizeof(batch));
+  batch.pChunks = calloc(chunkCount, sizeof(CHUNK));
+  if (NULL == batch.pChunks)
+  {
+    /* Parse on the calling thread as a single chunk */
+    memset(&single, 0, sizeof(single));
+    batch.pChunks = &single;
+    chunkCount = 1;
+    threads = 1;
+  }
+
+  /* Split at line starts */
+  for (i = 0; i < chunkCount && p < pEnd; i++)
+  {
+    const char *pSplit = (i + 1 == chunkCount) ? pEnd : pText + length * (i + 1) / chunkCount;
+
+    if (pSplit < p)
+    {
+      pSplit = p;
+    }
+    if (pSplit < pEnd)
+    {
+      const char *pNewline = memchr(pSplit, '\n', (size_t)(pEnd - pSplit));
+
+      pSplit = pNewline ? pNewline + 1 : pEnd;
+    }
+    batch.pChunks[i].pStart = p;
+    batch.pChunks[i].pEnd = pSplit;
+    p = pSplit;
+  }
+  batch.chunkCount = i;
+  batch.column = column;
+  batch.pResults = pResults;
+  batch.maxResults = maxResults;
+  pthread_mutex_init(&batch.lock, NULL);
+
+  /* Count the lines of every chunk, then parse with known line numbers */
+  batch.counting = TRUE;
+  BatchRun(&batch, threads);
+  for (i = 0; i < batch.chunkCount; i++)
+  {
+    batch.pChunks[i].firstLine = lines;
+    lines += batch.pChunks[i].lines;
+  }
+  batch.counting = FALSE;
+  BatchRun(&batch, threads);
+  for (i = 0; i < batch.chunkCount; i++)
+  {
+    failed += batch.pChunks[i].failed;
+  }
+  pthread_mutex_destroy(&batch.lock);
+  if (&single != batch.pChunks)
+  {
+    free(batch.pChunks);
+  }
+  if (pFailed)
+  {
+    *pFailed = failed;
+  }
+  return lines;
+}
+
+uint16_t
+SmartStartQrToTlv(
+  const SMARTSTART_QR *pQr,
+  uint8_t *pTlv)
+{
+  uint8_t value[17];
+  uint16_t offset = 0;
+
+  if (pQr->tlvPresent & SMARTSTART_QR_TLV_BIT(PROVISIONING_TLV_PRODUCT_TYPE))
+  {
+    value[0] = pQr->genericDeviceClass;
+    value[1] = pQr->specificDeviceClass;
+    value[2] = (uint8_t)(pQr->installerIconType >> 8);
+    value[3] = (uint8_t)pQr->installerIconType;
+    PutTlv(pTlv, &offset, PROVISIONING_TLV_PRODUCT_TYPE, value, 4);
+  }
+  if (pQr->tlvPresent & SMARTSTART_QR_TLV_BIT(PROVISIONING_TLV_PRODUCT_ID))
+  {
+    value[0] = (uint8_t)(pQr->manufacturerId >> 8);
+    value[1] = (uint8_t)pQr->manufacturerId;
+    value[2] = (uint8_t)(pQr->productType >> 8);
+    value[3] = (uint8_t)pQr->productType;
+    value[4] = (uint8_t)(pQr->productId >> 8);
+    value[5] = (uint8_t)pQr->productId;
+    value[6] = (uint8_t)(pQr->applicationVersion >> 8);
+    value[7] = (uint8_t)pQr->applicationVersion;
+    PutTlv(pTlv, &offset, PROVISIONING_TLV_PRODUCT_ID, value, 8);
+  }
+  if (pQr->tlvPresent & SMARTSTART_QR_TLV_BIT(PROVISIONING_TLV_MAX_INCLUSION_REQUEST_INTERVAL))
+  {
+    PutTlv(pTlv, &offset, PROVISIONING_TLV_MAX_INCLUSION_REQUEST_INTERVAL, &pQr->maxInclusionRequestInterval, 1);
+  }
+  if (pQr->tlvPresent & SMARTSTART_QR_TLV_BIT(PROVISIONING_TLV_UUID16))
+  {
+    value[0] = pQr->uuidPresentation;
+    memcpy(&value[1], pQr->uuid, sizeof(pQr->uuid));
+    PutTlv(pTlv, &offset, PROVISIONING_TLV_UUID16, value, 17);
+  }
+  if (pQr->tlvPresent & SMARTSTART_QR_TLV_BIT(PROVISIONING_TLV_SUPPORTED_PROTOCOLS))
+  {
+    /* Bit mask, first byte holds bits 0 to 7 */
+    uint8_t length = 0;
+    uint32_t protocols = pQr->supportedProtocols;
+
+    do
+    {
+      value[length++] = (uint8_t)protocols;
+      protocols >>= 8;
+    } while (protocols);
+    PutTlv(pTlv, &offset, PROVISIONING_TLV_SUPPORTED_PROTOCOLS, value, length);
+  }
+  return offset;
+}
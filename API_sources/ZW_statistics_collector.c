@@ -0,0 +1,393 @@
+/****************************************************************************
+ *
+ * Description: Installation and Maintenance statistics collector.
+ *
+ ****************************************************************************/
+
+/****************************************************************************/
+/*                              INCLUDE FILES                               */
+/****************************************************************************/
+#include <string.h>
+#include <ZW_typedefs.h>
+#include <ZW_classcmd.h>
+#include <ZW_statistics_collector.h>
+
+/****************************************************************************/
+/*                      PRIVATE TYPES and DEFINITIONS                       */
+/****************************************************************************/
+
+/* No Get outstanding, node ID 0 is never polled */
+#define NO_NODE                      0
+
+/* Bytes of a neighbor in the STATISTICS_REPORT_NEIGHBORS_NB_V2 list */
+#define NEIGHBOR_LENGTH              2
+
+/* Fractional bits of STATS_COLLECTOR_NODE.ewma */
+#define EWMA_FRACTION                16
+
+/****************************************************************************/
+/*                           PRIVATE FUNCTIONS                              */
+/****************************************************************************/
+
+/* FALSE while the airtime spent in the current window exceeds the budget */
+static BOOL
+AirtimeAvailable(
+  STATS_COLLECTOR *pColl,
+  uint32_t nowMs)
+{
+  uint32_t txMs;
+
+  if (0 == pColl->airtimeBudgetMs || NULL == pColl->pTxTime)
+  {
+    return TRUE;
+  }
+  txMs = pColl->pTxTime(pColl->pUser);
+  if ((uint32_t)(nowMs - pColl->windowStartMs) >= pColl->airtimeWindowMs)
+  {
+    pColl->windowStartMs = nowMs;
+    pColl->windowStartTxMs = txMs;
+  }
+  return (uint32_t)(txMs - pColl->windowStartTxMs) < pColl->airtimeBudgetMs;
+}
+
+/*
+ * The snapshot of a node is only written between WriteBegin() and
+ * WriteEnd(). A reader retries while the sequence is odd or has changed.
+ */
+static void
+WriteBegin(
+  STATS_COLLECTOR_NODE *pNode)
+{
+  __atomic_store_n(&pNode->sequence, pNode->sequence + 1, __ATOMIC_RELAXED);
+  __atomic_thread_fence(__ATOMIC_RELEASE);
+}
+
+static void
+WriteEnd(
+  STATS_COLLECTOR_NODE *pNode)
+{
+  __atomic_store_n(&pNode->sequence, pNode->sequence + 1, __ATOMIC_RELEASE);
+}
+
+static void
+AddSample(
+  STATS_COLLECTOR_NODE *pNode,
+  uint8_t metric,
+  uint32_t value)
+{
+  STATS_METRIC_SUMMARY *pSummary = &pNode->snapshot.metric[metric];
+  uint32_t *pWindow = pNode->window[metric];
+  uint32_t count;
+  uint32_t i;
+
+  pWindow[pSummary->samples & (STATS_COLLECTOR_WINDOW - 1)] = value;
+  if (0 == pSummary->samples)
+  {
+    pNode->ewma[metric] = (uint64_t)value << EWMA_FRACTION;
+  }
+  else
+  {
+    /* ewma += (value - ewma) / 2^STATS_COLLECTOR_EWMA_SHIFT */
+    pNode->ewma[metric] = pNode->ewma[metric]
+                          - (pNode->ewma[metric] >> STATS_COLLECTOR_EWMA_SHIFT)
+                          + (((uint64_t)value << EWMA_FRACTION) >> STATS_COLLECTOR_EWMA_SHIFT);
+  }
+  pSummary->samples++;
+  pSummary->last = value;
+  pSummary->ewma = (uint32_t)((pNode->ewma[metric] + (1u << (EWMA_FRACTION - 1))) >> EWMA_FRACTION);
+
+  count = pSummary->samples < STATS_COLLECTOR_WINDOW ? pSummary->samples : STATS_COLLECTOR_WINDOW;
+  pSummary->min = pWindow[0];
+  pSummary->max = pWindow[0];
+  for (i = 1; i < count; i++)
+  {
+    if (pWindow[i] < pSummary->min)
+    {
+      pSummary->min = pWindow[i];
+    }
+    if (pWindow[i] > pSummary->max)
+    {
+      pSummary->max = pWindow[i];
+    }
+  }
+}
+
+/* Counters restart from 0 on Statistics Clear, the increase is then the value */
+static void
+AddCounter(
+  STATS_COLLECTOR_NODE *pNode,
+  uint8_t metric,
+  uint32_t value)
+{
+  uint8_t bit = (uint8_t)(1u << metric);
+
+  if (pNode->baseValid & bit)
+  {
+    AddSample(pNode, metric,
+              value >= pNode->counterBase[metric] ? value - pNode->counterBase[metric] : value);
+  }
+  pNode->counterBase[metric] = value;
+  pNode->baseValid |= bit;
+}
+
+/* The Get of the pending node failed or was not answered */
+static void
+PendingTimeout(
+  STATS_COLLECTOR *pColl)
+{
+  STATS_COLLECTOR_NODE *pNode = &pColl->nodes[pColl->pending];
+
+  WriteBegin(pNode);
+  pNode->snapshot.timeouts++;
+  WriteEnd(pNode);
+  pColl->stats.timeouts++;
+  pColl->pending = NO_NODE;
+  pColl->transmitting = FALSE;
+}
+
+/****************************************************************************/
+/*                           EXPORTED FUNCTIONS                             */
+/****************************************************************************/
+
+void
+StatsCollectorInit(
+  STATS_COLLECTOR *pColl,
+  uint32_t pollIntervalMs,
+  uint32_t airtimeBudgetMs,
+  uint32_t airtimeWindowMs,
+  STATS_SEND_FUNC pSend,
+  STATS_TX_TIME_FUNC pTxTime,
+  void *pUser)
+{
+  memset(pColl, 0, sizeof(*pColl));
+  pColl->pSend = pSend;
+  pColl->pTxTime = pTxTime;
+  pColl->pUser = pUser;
+  pColl->pollIntervalMs = pollIntervalMs;
+  pColl->airtimeBudgetMs = airtimeBudgetMs;
+  pColl->airtimeWindowMs = airtimeWindowMs;
+  if (pTxTime)
+  {
+    pColl->windowStartTxMs = pTxTime(pUser);
+  }
+}
+
+BOOL
+StatsCollectorAdd(
+  STATS_COLLECTOR *pColl,
+  uint8_t nodeId)
+{
+  STATS_COLLECTOR_NODE *pNode;
+
+  if (0 == nodeId || nodeId > STATS_COLLECTOR_MAX_NODES)
+  {
+    return FALSE;
+  }
+  pNode = &pColl->nodes[nodeId];
+  WriteBegin(pNode);
+  memset(&pNode->snapshot, 0, sizeof(pNode->snapshot));
+  WriteEnd(pNode);
+  pNode->baseValid = 0;
+  pNode->polled = FALSE;
+  pNode->active = TRUE;
+  return TRUE;
+}
+
+void
+StatsCollectorRemove(
+  STATS_COLLECTOR *pColl,
+  uint8_t nodeId)
+{
+  if (0 == nodeId || nodeId > STATS_COLLECTOR_MAX_NODES)
+  {
+    return;
+  }
+  pColl->nodes[nodeId].active = FALSE;
+  if (nodeId == pColl->pending)
+  {
+    pColl->pending = NO_NODE;
+    pColl->transmitting = FALSE;
+  }
+}
+
+void
+StatsCollectorTxDone(
+  STATS_COLLECTOR *pColl,
+  uint8_t nodeId,
+  BOOL acked,
+  uint32_t nowMs)
+{
+  if (NO_NODE == nodeId || nodeId != pColl->pending || !pColl->transmitting)
+  {
+    return;
+  }
+  if (!acked)
+  {
+    PendingTimeout(pColl);
+    return;
+  }
+  pColl->transmitting = FALSE;
+  pColl->pendingSinceMs = nowMs;
+}
+
+BOOL
+StatsCollectorReport(
+  STATS_COLLECTOR *pColl,
+  const uint8_t *pCmd,
+  uint8_t length,
+  uint32_t nowMs)
+{
+  STATS_COLLECTOR_NODE *pNode;
+  uint8_t nodeId;
+  uint8_t offset;
+
+  if (length < 3
+      || COMMAND_CLASS_NETWORK_MANAGEMENT_INSTALLATION_MAINTENANCE_V2 != pCmd[0]
+      || STATISTICS_REPORT_V2 != pCmd[1])
+  {
+    return FALSE;
+  }
+  nodeId = pCmd[2];
+  if (0 == nodeId || nodeId > STATS_COLLECTOR_MAX_NODES || !pColl->nodes[nodeId].active)
+  {
+    return FALSE;
+  }
+
+  /* Check every TLV before anything is added */
+  for (offset = 3; offset < length; offset = (uint8_t)(offset + 2 + pCmd[offset + 1]))
+  {
+    uint8_t type = pCmd[offset];
+    uint8_t valueLength;
+
+    if ((uint16_t)offset + 2 > length)
+    {
+      pColl->stats.malformed++;
+      return FALSE;
+    }
+    valueLength = pCmd[offset + 1];
+    if ((uint16_t)offset + 2 + valueLength > length
+        || (type < STATS_METRIC_COUNT && STATS_METRIC_NEIGHBORS != type
+            && (0 == valueLength || valueLength > 4)))
+    {
+      pColl->stats.malformed++;
+      return FALSE;
+    }
+  }
+
+  pNode = &pColl->nodes[nodeId];
+  WriteBegin(pNode);
+  for (offset = 3; offset < length; offset = (uint8_t)(offset + 2 + pCmd[offset + 1]))
+  {
+    uint8_t type = pCmd[offset];
+    uint8_t valueLength = pCmd[offset + 1];
+    const uint8_t *pValue = &pCmd[offset + 2];
+    uint32_t value = 0;
+    uint8_t i;
+
+    if (STATS_METRIC_NEIGHBORS == type)
+    {
+      AddSample(pNode, type, valueLength / NEIGHBOR_LENGTH);
+    }
+    else if (type < STATS_METRIC_COUNT)
+    {
+      for (i = 0; i < valueLength; i++)
+      {
+        value = (value << 8) | pValue[i];
+      }
+      AddCounter(pNode, type, value);
+    }
+    /* Statistics added by later versions are skipped */
+  }
+  pNode->snapshot.lastReportMs = nowMs;
+  WriteEnd(pNode);
+
+  pColl->stats.reports++;
+  if (nodeId == pColl->pending)
+  {
+    /* The report may overtake the transmit completion of the Get */
+    pColl->pending = NO_NODE;
+    pColl->transmitting = FALSE;
+  }
+  return TRUE;
+}
+
+void
+StatsCollectorPoll(
+  STATS_COLLECTOR *pColl,
+  uint32_t nowMs)
+{
+  uint8_t frame[STATS_COLLECTOR_GET_LENGTH];
+  uint16_t i;
+
+  if (NO_NODE != pColl->pending)
+  {
+    if (pColl->transmitting
+        || (uint32_t)(nowMs - pColl->pendingSinceMs) < STATS_COLLECTOR_TIMEOUT_MS)
+    {
+      return;
+    }
+    PendingTimeout(pColl);
+  }
+
+  /* Round robin from the node after the last one polled */
+  for (i = 1; i <= STATS_COLLECTOR_MAX_NODES; i++)
+  {
+    uint8_t nodeId = (uint8_t)((pColl->cursor + i - 1) % STATS_COLLECTOR_MAX_NODES + 1);
+    STATS_COLLECTOR_NODE *pNode = &pColl->nodes[nodeId];
+
+    if (!pNode->active
+        || (pNode->polled && (uint32_t)(nowMs - pNode->lastPollMs) < pColl->pollIntervalMs))
+    {
+      continue;
+    }
+    if (!AirtimeAvailable(pColl, nowMs))
+    {
+      pColl->stats.budgetStalls++;
+      return;
+    }
+    frame[0] = COMMAND_CLASS_NETWORK_MANAGEMENT_INSTALLATION_MAINTENANCE_V2;
+    frame[1] = STATISTICS_GET_V2;
+    frame[2] = nodeId;
+    if (!pColl->pSend(pColl->pUser, nodeId, frame, sizeof(frame)))
+    {
+      return;
+    }
+    pColl->pending = nodeId;
+    pColl->transmitting = TRUE;
+    pColl->pendingSinceMs = nowMs;
+    pColl->cursor = nodeId;
+    pNode->lastPollMs = nowMs;
+    pNode->polled = TRUE;
+    WriteBegin(pNode);
+    pNode->snapshot.polls++;
+    WriteEnd(pNode);
+    pColl->stats.gets++;
+    return;
+  }
+}
+
+BOOL
+StatsCollectorSnapshot(
+  const STATS_COLLECTOR *pColl,
+  uint8_t nodeId,
+  STATS_NODE_SNAPSHOT *pSnapshot)
+{
+  const STATS_COLLECTOR_NODE *pNode;
+  uint32_t before;
+  uint32_t after;
+
+  if (0 == nodeId || nodeId > STATS_COLLECTOR_MAX_NODES)
+  {
+    return FALSE;
+  }
+  pNode = &pColl->nodes[nodeId];
+  do
+  {
+    before = __atomic_load_n(&pNode->sequence, __ATOMIC_ACQUIRE);
+    memcpy(pSnapshot, &pNode->snapshot, sizeof(*pSnapshot));
+    __atomic_thread_fence(__ATOMIC_ACQUIRE);
+    after = __atomic_load_n(&pNode->sequence, __ATOMIC_RELAXED);
+  } while ((before & 1) || before != after);
+  /* Add() moves the sequence past 0 */
+  return 0 != before;
+}
@@ -0,0 +1,434 @@
+/****************************************************************************
+ *
+ * Description: Supervision session tracker with timer wheel timeouts.
+ *
+ ****************************************************************************/
+
+/****************************************************************************/
+/*                              INCLUDE FILES                               */
+/****************************************************************************/
+#include <string.h>
+#include <ZW_typedefs.h>
+#include <ZW_classcmd.h>
+#include <ZW_supervision_tracker.h>
+
+/****************************************************************************/
+/*                      PRIVATE TYPES and DEFINITIONS                       */
+/****************************************************************************/
+
+#define WHEEL_MASK            (SUPERVISION_WHEEL_SLOTS - 1)
+#define WHEEL_SPAN(level)     ((uint32_t)1 << (SUPERVISION_WHEEL_BITS * ((level) + 1)))
+#define INDEX_OF(node, id)    ((uint16_t)((node) * SUPERVISION_SESSION_ID_COUNT + (id)))
+
+/****************************************************************************/
+/*                           PRIVATE FUNCTIONS                              */
+/****************************************************************************/
+
+/* Convert a Supervision Report duration to milliseconds */
+static uint32_t
+DurationToMs(uint8_t duration)
+{
+  if (duration <= 0x7F)
+  {
+    return (uint32_t)duration * 1000u;
+  }
+  if (duration <= 0xFD)
+  {
+    return (uint32_t)(duration - 0x7F) * 60000u;
+  }
+  /* Unknown duration, fall back to the grace period alone */
+  return 0;
+}
+
+static void
+TimerUnlink(
+  SUPERVISION_TRACKER *pTracker,
+  uint16_t index)
+{
+  SUPERVISION_SESSION *pSession = &pTracker->pSessions[index];
+
+  if (SUPERVISION_NO_SESSION == pSession->slot)
+  {
+    return;
+  }
+  if (SUPERVISION_NO_SESSION != pSession->prev)
+  {
+    pTracker->pSessions[pSession->prev].next = pSession->next;
+  }
+  else
+  {
+    pTracker->wheel[pSession->slot] = pSession->next;
+  }
+  if (SUPERVISION_NO_SESSION != pSession->next)
+  {
+    pTracker->pSessions[pSession->next].prev = pSession->prev;
+  }
+  pSession->slot = SUPERVISION_NO_SESSION;
+  pSession->next = SUPERVISION_NO_SESSION;
+  pSession->prev = SUPERVISION_NO_SESSION;
+}
+
+/* Place a session in the wheel level matching its distance from now */
+static void
+TimerLink(
+  SUPERVISION_TRACKER *pTracker,
+  uint16_t index)
+{
+  SUPERVISION_SESSION *pSession = &pTracker->pSessions[index];
+  uint32_t delta = pSession->expiresTick - pTracker->currentTick;
+  uint8_t level = 0;
+  uint16_t slot;
+
+  if ((int32_t)delta < 0)
+  {
+    /* Overdue after a cascade, fire in the tick being processed */
+    pSession->expiresTick = pTracker->currentTick;
+    delta = 0;
+  }
+  while (level < SUPERVISION_WHEEL_LEVELS - 1 && delta >= WHEEL_SPAN(level))
+  {
+    level++;
+  }
+  if (delta >= WHEEL_SPAN(level))
+  {
+    /* Beyond the wheel range, park in the last slot reachable and re-cascade */
+    pSession->expiresTick = pTracker->currentTick + WHEEL_SPAN(level) - 1;
+  }
+  slot = (uint16_t)(level * SUPERVISION_WHEEL_SLOTS
+                    + ((pSession->expiresTick >> (SUPERVISION_WHEEL_BITS * level)) & WHEEL_MASK));
+  pSession->slot = slot;
+  pSession->prev = SUPERVISION_NO_SESSION;
+  pSession->next = pTracker->wheel[slot];
+  if (SUPERVISION_NO_SESSION != pSession->next)
+  {
+    pTracker->pSessions[pSession->next].prev = index;
+  }
+  pTracker->wheel[slot] = index;
+}
+
+static void
+TimerArm(
+  SUPERVISION_TRACKER *pTracker,
+  uint16_t index,
+  uint32_t nowMs,
+  uint32_t timeoutMs)
+{
+  uint32_t expiresMs = (nowMs - pTracker->baseMs) + timeoutMs;
+  uint32_t expiresTick = (expiresMs + SUPERVISION_TICK_MS - 1) / SUPERVISION_TICK_MS;
+
+  TimerUnlink(pTracker, index);
+  /* The slot of the current tick has already been processed */
+  if ((int32_t)(expiresTick - pTracker->currentTick) <= 0)
+  {
+    expiresTick = pTracker->currentTick + 1;
+  }
+  pTracker->pSessions[index].expiresTick = expiresTick;
+  TimerLink(pTracker, index);
+}
+
+static void
+SessionFree(
+  SUPERVISION_TRACKER *pTracker,
+  uint16_t index)
+{
+  SUPERVISION_SESSION *pSession = &pTracker->pSessions[index];
+
+  TimerUnlink(pTracker, index);
+  pTracker->index[INDEX_OF(pSession->nodeId, pSession->sessionId)] = SUPERVISION_NO_SESSION;
+  pSession->nodeId = 0;
+  pSession->next = pTracker->freeHead;
+  pTracker->freeHead = index;
+  pTracker->activeCount--;
+}
+
+/* Append an event, delivering the buffer first if it is full. Callers pass
+ * a copy of the session and hold no session index across the call, as the
+ * batch callback may open or cancel sessions */
+static void
+QueueEvent(
+  SUPERVISION_TRACKER *pTracker,
+  const SUPERVISION_SESSION *pSession,
+  uint8_t status,
+  uint8_t duration,
+  BOOL final)
+{
+  SUPERVISION_EVENT event;
+
+  event.pContext = pSession->pContext;
+  event.nodeId = pSession->nodeId;
+  event.sessionId = pSession->sessionId;
+  event.status = status;
+  event.duration = duration;
+  event.final = final;
+  if (pTracker->eventCount == pTracker->eventCapacity)
+  {
+    SupervisionTrackerFlush(pTracker);
+  }
+  pTracker->pEvents[pTracker->eventCount++] = event;
+}
+
+/* Move all timers of a higher level slot down to where they belong now */
+static void
+Cascade(
+  SUPERVISION_TRACKER *pTracker,
+  uint8_t level)
+{
+  uint16_t slot = (uint16_t)(level * SUPERVISION_WHEEL_SLOTS
+                             + ((pTracker->currentTick >> (SUPERVISION_WHEEL_BITS * level)) & WHEEL_MASK));
+  uint16_t index = pTracker->wheel[slot];
+
+  pTracker->wheel[slot] = SUPERVISION_NO_SESSION;
+  while (SUPERVISION_NO_SESSION != index)
+  {
+    uint16_t next = pTracker->pSessions[index].next;
+    pTracker->pSessions[index].slot = SUPERVISION_NO_SESSION;
+    TimerLink(pTracker, index);
+    index = next;
+  }
+}
+
+/****************************************************************************/
+/*                           EXPORTED FUNCTIONS                             */
+/****************************************************************************/
+
+void
+SupervisionTrackerInit(
+  SUPERVISION_TRACKER *pTracker,
+  SUPERVISION_SESSION *pSessions,
+  uint16_t sessionCount,
+  SUPERVISION_EVENT *pEvents,
+  uint16_t eventCapacity,
+  SUPERVISION_BATCH_FUNC pBatch,
+  void *pUser,
+  uint32_t nowMs)
+{
+  uint32_t i;
+
+  memset(pTracker, 0, sizeof(*pTracker));
+  if (sessionCount >= SUPERVISION_NO_SESSION)
+  {
+    sessionCount = SUPERVISION_NO_SESSION - 1;
+  }
+  pTracker->pSessions = pSessions;
+  pTracker->sessionCount = sessionCount;
+  pTracker->freeHead = sessionCount ? 0 : SUPERVISION_NO_SESSION;
+  pTracker->baseMs = nowMs;
+  pTracker->pEvents = pEvents;
+  pTracker->eventCapacity = eventCapacity;
+  if (0 == eventCapacity)
+  {
+    /* No buffer, deliver every event on its own */
+    pTracker->pEvents = &pTracker->singleEvent;
+    pTracker->eventCapacity = 1;
+  }
+  pTracker->pBatch = pBatch;
+  pTracker->pUser = pUser;
+  for (i = 0; i < sessionCount; i++)
+  {
+    pSessions[i].nodeId = 0;
+    pSessions[i].slot = SUPERVISION_NO_SESSION;
+    pSessions[i].prev = SUPERVISION_NO_SESSION;
+    pSessions[i].next = (uint16_t)((i + 1 < sessionCount) ? i + 1 : SUPERVISION_NO_SESSION);
+  }
+  for (i = 0; i < sizeof(pTracker->wheel) / sizeof(pTracker->wheel[0]); i++)
+  {
+    pTracker->wheel[i] = SUPERVISION_NO_SESSION;
+  }
+  for (i = 0; i < sizeof(pTracker->index) / sizeof(pTracker->index[0]); i++)
+  {
+    pTracker->index[i] = SUPERVISION_NO_SESSION;
+  }
+}
+
+BOOL
+SupervisionTrackerOpen(
+  SUPERVISION_TRACKER *pTracker,
+  uint8_t nodeId,
+  uint32_t timeoutMs,
+  void *pContext,
+  uint8_t *pSessionId,
+  uint32_t nowMs)
+{
+  SUPERVISION_SESSION *pSession;
+  uint16_t index = pTracker->freeHead;
+  uint8_t sessionId;
+  uint8_t tries;
+
+  if (0 == nodeId || nodeId > SUPERVISION_MAX_NODES || SUPERVISION_NO_SESSION == index)
+  {
+    return FALSE;
+  }
+  /* Rotate session IDs so a late report cannot match a new session */
+  sessionId = pTracker->nextSessionId[nodeId];
+  for (tries = 0; tries < SUPERVISION_SESSION_ID_COUNT; tries++)
+  {
+    if (SUPERVISION_NO_SESSION == pTracker->index[INDEX_OF(nodeId, sessionId)])
+    {
+      break;
+    }
+    sessionId = (uint8_t)((sessionId + 1) & SUPERVISION_GET_PROPERTIES1_SESSION_ID_MASK);
+  }
+  if (SUPERVISION_SESSION_ID_COUNT == tries)
+  {
+    return FALSE;
+  }
+  pTracker->nextSessionId[nodeId] = (uint8_t)((sessionId + 1) & SUPERVISION_GET_PROPERTIES1_SESSION_ID_MASK);
+
+  pSession = &pTracker->pSessions[index];
+  pTracker->freeHead = pSession->next;
+  pTracker->activeCount++;
+  pSession->pContext = pContext;
+  pSession->nodeId = nodeId;
+  pSession->sessionId = sessionId;
+  pSession->slot = SUPERVISION_NO_SESSION;
+  pSession->next = SUPERVISION_NO_SESSION;
+  pSession->prev = SUPERVISION_NO_SESSION;
+  pTracker->index[INDEX_OF(nodeId, sessionId)] = index;
+  TimerArm(pTracker, index, nowMs, timeoutMs);
+  *pSessionId = sessionId;
+  return TRUE;
+}
+
+uint8_t
+SupervisionTrackerBuildGet(
+  uint8_t *pFrame,
+  uint8_t sessionId,
+  BOOL statusUpdates,
+  const uint8_t *pCommand,
+  uint8_t commandLength)
+{
+  pFrame[0] = COMMAND_CLASS_SUPERVISION;
+  pFrame[1] = SUPERVISION_GET;
+  pFrame[2] = (uint8_t)((sessionId & SUPERVISION_GET_PROPERTIES1_SESSION_ID_MASK)
+                        | (statusUpdates ? SUPERVISION_GET_PROPERTIES1_STATUS_UPDATES_BIT_MASK : 0));
+  pFrame[3] = commandLength;
+  memcpy(&pFrame[4], pCommand, commandLength);
+  return (uint8_t)(commandLength + 4);
+}
+
+E_SUPERVISION_MATCH
+SupervisionTrackerReport(
+  SUPERVISION_TRACKER *pTracker,
+  uint8_t nodeId,
+  const uint8_t *pFrame,
+  uint8_t frameLength,
+  uint32_t nowMs)
+{
+  SUPERVISION_SESSION session;
+  uint16_t index;
+  uint8_t sessionId;
+  uint8_t status;
+  uint8_t duration;
+
+  if (frameLength < 4 || COMMAND_CLASS_SUPERVISION != pFrame[0] || SUPERVISION_REPORT != pFrame[1])
+  {
+    return SUPERVISION_MATCH_INVALID;
+  }
+  if (0 == nodeId || nodeId > SUPERVISION_MAX_NODES)
+  {
+    return SUPERVISION_MATCH_UNKNOWN;
+  }
+  sessionId = pFrame[2] & SUPERVISION_REPORT_PROPERTIES1_SESSION_ID_MASK;
+  index = pTracker->index[INDEX_OF(nodeId, sessionId)];
+  if (SUPERVISION_NO_SESSION == index)
+  {
+    return SUPERVISION_MATCH_UNKNOWN;
+  }
+  status = pFrame[3];
+  duration = (frameLength > 4) ? pFrame[4] : 0;
+
+  if (SUPERVISION_REPORT_WORKING == status)
+  {
+    TimerArm(pTracker, index, nowMs, DurationToMs(duration) + SUPERVISION_WORKING_GRACE_MS);
+    session = pTracker->pSessions[index];
+    QueueEvent(pTracker, &session, status, duration, FALSE);
+    return SUPERVISION_MATCH_WORKING;
+  }
+  session = pTracker->pSessions[index];
+  SessionFree(pTracker, index);
+  QueueEvent(pTracker, &session, status, duration, TRUE);
+  return SUPERVISION_MATCH_FINAL;
+}
+
+void
+SupervisionTrackerCancel(
+  SUPERVISION_TRACKER *pTracker,
+  uint8_t nodeId,
+  uint8_t sessionId)
+{
+  uint16_t index;
+
+  if (0 == nodeId || nodeId > SUPERVISION_MAX_NODES || sessionId >= SUPERVISION_SESSION_ID_COUNT)
+  {
+    return;
+  }
+  index = pTracker->index[INDEX_OF(nodeId, sessionId)];
+  if (SUPERVISION_NO_SESSION != index)
+  {
+    SessionFree(pTracker, index);
+  }
+}
+
+void
+SupervisionTrackerAdvance(
+  SUPERVISION_TRACKER *pTracker,
+  uint32_t nowMs)
+{
+  uint32_t targetTick = (nowMs - pTracker->baseMs) / SUPERVISION_TICK_MS;
+
+  if (0 == pTracker->activeCount)
+  {
+    /* Nothing armed, no need to walk the ticks */
+    if ((int32_t)(targetTick - pTracker->currentTick) > 0)
+    {
+      pTracker->currentTick = targetTick;
+    }
+    return;
+  }
+  while ((int32_t)(targetTick - pTracker->currentTick) > 0)
+  {
+    uint16_t slot;
+    uint16_t index;
+    uint8_t level;
+
+    pTracker->currentTick++;
+    for (level = 1; level < SUPERVISION_WHEEL_LEVELS; level++)
+    {
+      /* Cascade a level each time all lower levels wrap */
+      if (pTracker->currentTick & (WHEEL_SPAN(level - 1) - 1))
+      {
+        break;
+      }
+      Cascade(pTracker, level);
+    }
+    /* A level 0 slot only holds the SUPERVISION_WHEEL_SLOTS ticks ahead, so every session in the
+     * slot of the current tick expires now. The head is re-read after each
+     * event as the batch callback may have opened or cancelled sessions */
+    slot = (uint16_t)(pTracker->currentTick & WHEEL_MASK);
+    index = pTracker->wheel[slot];
+    while (SUPERVISION_NO_SESSION != index)
+    {
+      SUPERVISION_SESSION session = pTracker->pSessions[index];
+      SessionFree(pTracker, index);
+      QueueEvent(pTracker, &session, SUPERVISION_STATUS_TIMEOUT, 0, TRUE);
+      index = pTracker->wheel[slot];
+    }
+    if (0 == pTracker->activeCount)
+    {
+      pTracker->currentTick = targetTick;
+    }
+  }
+}
+
+void
+SupervisionTrackerFlush(
+  SUPERVISION_TRACKER *pTracker)
+{
+  uint16_t count = pTracker->eventCount;
+
+  if (count)
+  {
+    pTracker->eventCount = 0;
+    pTracker->pBatch(pTracker->pUser, pTracker->pEvents, count);
+  }
+}
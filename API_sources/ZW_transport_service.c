@@ -0,0 +1,596 @@
+/****************************************************************************
+ *
+ * Description: Transport Service V2 segmentation and reassembly engine.
+ *
+ ****************************************************************************/
+
+/****************************************************************************/
+/*                              INCLUDE FILES                               */
+/****************************************************************************/
+#include <string.h>
+#include <ZW_typedefs.h>
+#include <ZW_classcmd.h>
+#include <ZW_crc.h>
+#include <ZW_transport_service.h>
+
+/****************************************************************************/
+/*                      PRIVATE TYPES and DEFINITIONS                       */
+/****************************************************************************/
+
+#define TS_COMPLETED_VALID   0x80
+
+/* Fields common to First and Subsequent Segment */
+typedef struct _TS_SEGMENT_
+{
+  const uint8_t *pPayload;
+  uint16_t datagramSize;
+  uint16_t offset;
+  uint8_t  payloadLength;
+  uint8_t  sessionId;
+} TS_SEGMENT;
+
+/****************************************************************************/
+/*                           PRIVATE FUNCTIONS                              */
+/****************************************************************************/
+
+static uint8_t
+PopCount64(uint64_t v)
+{
+  return (uint8_t)__builtin_popcountll(v);
+}
+
+/* Mark bytes [offset, offset + length) as received. Returns newly set bits */
+static uint16_t
+MarkReceived(
+  uint64_t *pMap,
+  uint16_t offset,
+  uint16_t length)
+{
+  uint16_t added = 0;
+  uint16_t end = (uint16_t)(offset + length);
+
+  while (offset < end)
+  {
+    uint16_t word = (uint16_t)(offset >> 6);
+    uint8_t  bit = (uint8_t)(offset & 63);
+    uint16_t span = (uint16_t)(64 - bit);
+    uint64_t mask;
+
+    if (span > (uint16_t)(end - offset))
+    {
+      span = (uint16_t)(end - offset);
+    }
+    mask = (span == 64) ? ~(uint64_t)0 : (((uint64_t)1 << span) - 1) << bit;
+    added = (uint16_t)(added + PopCount64(mask & ~pMap[word]));
+    pMap[word] |= mask;
+    offset = (uint16_t)(offset + span);
+  }
+  return added;
+}
+
+/* First byte offset not yet received, datagramSize if none */
+static uint16_t
+FirstHole(const TS_RX_SESSION *pSession)
+{
+  uint16_t word;
+  uint16_t words = (uint16_t)((pSession->datagramSize + 63) >> 6);
+
+  for (word = 0; word < words; word++)
+  {
+    uint64_t missing = ~pSession->receivedMap[word];
+    if (missing)
+    {
+      uint16_t hole = (uint16_t)((word << 6) + __builtin_ctzll(missing));
+      return (hole < pSession->datagramSize) ? hole : pSession->datagramSize;
+    }
+  }
+  return pSession->datagramSize;
+}
+
+static void
+SendSegmentRequest(
+  TS_RX_CONTEXT *pCtx,
+  TS_RX_SESSION *pSession,
+  uint16_t offset,
+  uint32_t nowMs)
+{
+  uint8_t frame[4];
+
+  frame[0] = COMMAND_CLASS_TRANSPORT_SERVICE_V2;
+  frame[1] = COMMAND_SEGMENT_REQUEST_V2;
+  frame[2] = (uint8_t)((pSession->sessionId << COMMAND_SEGMENT_REQUEST_PROPERTIES2_SESSION_ID_SHIFT_V2)
+                       | ((offset >> 8) & COMMAND_SEGMENT_REQUEST_PROPERTIES2_DATAGRAM_OFFSET_1_MASK_V2));
+  frame[3] = (uint8_t)offset;
+  pSession->requestedOffset = offset;
+  pSession->requestPending = 1;
+  pSession->requestCount++;
+  pSession->lastActivityMs = nowMs;
+  pCtx->stats.segmentRequests++;
+  pCtx->pCallbacks->pSend(pCtx->pUser, pSession->sourceNode, frame, sizeof(frame));
+}
+
+static void
+SendSegmentComplete(
+  TS_RX_CONTEXT *pCtx,
+  uint8_t destNode,
+  uint8_t sessionId)
+{
+  uint8_t frame[3];
+
+  frame[0] = COMMAND_CLASS_TRANSPORT_SERVICE_V2;
+  frame[1] = COMMAND_SEGMENT_COMPLETE_V2;
+  frame[2] = (uint8_t)(sessionId << COMMAND_SEGMENT_COMPLETE_PROPERTIES2_SESSION_ID_SHIFT_V2);
+  pCtx->pCallbacks->pSend(pCtx->pUser, destNode, frame, sizeof(frame));
+}
+
+static void
+SendSegmentWait(
+  TS_RX_CONTEXT *pCtx,
+  uint8_t destNode)
+{
+  uint8_t frame[3];
+  uint16_t i;
+  uint16_t pending = 0xFF;
+
+  /* Tell the sender how many segments the closest-to-complete session still needs */
+  for (i = 0; i < pCtx->sessionCount; i++)
+  {
+    const TS_RX_SESSION *pSession = &pCtx->pSessions[i];
+    if (pSession->sourceNode && pSession->segmentPayload)
+    {
+      uint16_t remaining = (uint16_t)(pSession->datagramSize - pSession->bytesReceived);
+      uint16_t segments = (uint16_t)((remaining + pSession->segmentPayload - 1) / pSession->segmentPayload);
+      if (segments < pending)
+      {
+        pending = segments;
+      }
+    }
+  }
+  frame[0] = COMMAND_CLASS_TRANSPORT_SERVICE_V2;
+  frame[1] = COMMAND_SEGMENT_WAIT_V2;
+  frame[2] = (uint8_t)pending;
+  pCtx->stats.segmentWaits++;
+  pCtx->pCallbacks->pSend(pCtx->pUser, destNode, frame, sizeof(frame));
+}
+
+static void
+SessionFree(
+  TS_RX_CONTEXT *pCtx,
+  uint16_t slot)
+{
+  TS_RX_SESSION *pSession = &pCtx->pSessions[slot];
+
+  pCtx->nodeSession[pSession->sourceNode] = TS_NO_SESSION;
+  pSession->sourceNode = 0;
+  pSession->nextFree = pCtx->freeHead;
+  pCtx->freeHead = slot;
+  pCtx->activeCount--;
+}
+
+static uint16_t
+SessionAlloc(
+  TS_RX_CONTEXT *pCtx,
+  uint8_t sourceNode,
+  const TS_SEGMENT *pSegment,
+  uint32_t nowMs)
+{
+  uint16_t slot = pCtx->freeHead;
+  TS_RX_SESSION *pSession;
+
+  if (TS_NO_SESSION == slot)
+  {
+    return TS_NO_SESSION;
+  }
+  pSession = &pCtx->pSessions[slot];
+  pCtx->freeHead = pSession->nextFree;
+  pCtx->activeCount++;
+  pCtx->nodeSession[sourceNode] = slot;
+
+  /* Only the words covering the datagram are ever inspected */
+  memset(pSession->receivedMap, 0, ((pSegment->datagramSize + 63) >> 6) * sizeof(uint64_t));
+  pSession->lastActivityMs = nowMs;
+  pSession->datagramSize = pSegment->datagramSize;
+  pSession->bytesReceived = 0;
+  pSession->requestedOffset = 0;
+  pSession->nextFree = TS_NO_SESSION;
+  pSession->sourceNode = sourceNode;
+  pSession->sessionId = pSegment->sessionId;
+  pSession->lastSeen = 0;
+  pSession->requestPending = 0;
+  pSession->requestCount = 0;
+  pSession->segmentPayload = 0;
+  return slot;
+}
+
+/* Parse and checksum a First or Subsequent Segment */
+static E_TS_RX_STATUS
+ParseSegment(
+  const uint8_t *pFrame,
+  uint8_t frameLength,
+  TS_SEGMENT *pSegment)
+{
+  uint8_t cmd;
+  uint8_t header;
+  uint8_t properties2;
+
+  if (frameLength < 4 || COMMAND_CLASS_TRANSPORT_SERVICE_V2 != pFrame[0])
+  {
+    return TS_RX_INVALID_FRAME;
+  }
+  cmd = pFrame[1] & COMMAND_FIRST_SEGMENT_MASK_V2;
+  if (COMMAND_FIRST_SEGMENT_V2 == cmd)
+  {
+    header = 4;
+  }
+  else if (COMMAND_SUBSEQUENT_SEGMENT_V2 == cmd)
+  {
+    header = 5;
+  }
+  else
+  {
+    return TS_RX_INVALID_FRAME;
+  }
+  if (frameLength < header + 2)
+  {
+    return TS_RX_INVALID_FRAME;
+  }
+  if (0 != ZW_CheckCrc16(CRC_INIT_VALUE, pFrame, frameLength))
+  {
+    return TS_RX_CHECKSUM_ERROR;
+  }
+
+  properties2 = pFrame[3];
+  pSegment->datagramSize = (uint16_t)(((pFrame[1] & COMMAND_FIRST_SEGMENT_DATAGRAM_SIZE_1_MASK_V2) << 8) | pFrame[2]);
+  pSegment->sessionId = (uint8_t)((properties2 & COMMAND_FIRST_SEGMENT_PROPERTIES2_SESSION_ID_MASK_V2)
+                                  >> COMMAND_FIRST_SEGMENT_PROPERTIES2_SESSION_ID_SHIFT_V2);
+  pSegment->offset = 0;
+  if (COMMAND_SUBSEQUENT_SEGMENT_V2 == cmd)
+  {
+    pSegment->offset = (uint16_t)(((properties2 & COMMAND_SUBSEQUENT_SEGMENT_PROPERTIES2_DATAGRAM_OFFSET_1_MASK_V2) << 8)
+                                  | pFrame[4]);
+  }
+  if (properties2 & COMMAND_FIRST_SEGMENT_PROPERTIES2_EXT_BIT_MASK_V2)
+  {
+    /* Header extensions are not interpreted, just skipped */
+    if (frameLength < header + 3)
+    {
+      return TS_RX_INVALID_FRAME;
+    }
+    header = (uint8_t)(header + 1 + pFrame[header]);
+    if (frameLength < header + 2)
+    {
+      return TS_RX_INVALID_FRAME;
+    }
+  }
+  pSegment->pPayload = &pFrame[header];
+  pSegment->payloadLength = (uint8_t)(frameLength - header - 2);
+  if (0 == pSegment->payloadLength || 0 == pSegment->datagramSize
+      || (uint32_t)pSegment->offset + pSegment->payloadLength > pSegment->datagramSize)
+  {
+    return TS_RX_INVALID_FRAME;
+  }
+  return TS_RX_SEGMENT_STORED;
+}
+
+/* Deliver and release a complete session */
+static void
+SessionDeliver(
+  TS_RX_CONTEXT *pCtx,
+  uint16_t slot)
+{
+  TS_RX_SESSION *pSession = &pCtx->pSessions[slot];
+  uint8_t sourceNode = pSession->sourceNode;
+  uint8_t sessionId = pSession->sessionId;
+
+  pCtx->stats.datagramsDelivered++;
+  pCtx->stats.bytesDelivered += pSession->datagramSize;
+  pCtx->completedSession[sourceNode] = (uint8_t)(TS_COMPLETED_VALID | sessionId);
+  SendSegmentComplete(pCtx, sourceNode, sessionId);
+  pCtx->pCallbacks->pDeliver(pCtx->pUser, sourceNode, pSession->datagram, pSession->datagramSize);
+  SessionFree(pCtx, slot);
+}
+
+/****************************************************************************/
+/*                           EXPORTED FUNCTIONS                             */
+/****************************************************************************/
+
+void
+TransportServiceRxInit(
+  TS_RX_CONTEXT *pCtx,
+  TS_RX_SESSION *pSessions,
+  uint16_t sessionCount,
+  const TS_RX_CALLBACKS *pCallbacks,
+  void *pUser)
+{
+  uint16_t i;
+
+  memset(pCtx, 0, sizeof(*pCtx));
+  if (sessionCount >= TS_NO_SESSION)
+  {
+    sessionCount = TS_NO_SESSION - 1;
+  }
+  pCtx->pSessions = pSessions;
+  pCtx->sessionCount = sessionCount;
+  pCtx->pCallbacks = pCallbacks;
+  pCtx->pUser = pUser;
+  for (i = 0; i <= TS_MAX_NODES; i++)
+  {
+    pCtx->nodeSession[i] = TS_NO_SESSION;
+  }
+  pCtx->freeHead = sessionCount ? 0 : TS_NO_SESSION;
+  for (i = 0; i < sessionCount; i++)
+  {
+    pSessions[i].sourceNode = 0;
+    pSessions[i].nextFree = (uint16_t)((i + 1 < sessionCount) ? i + 1 : TS_NO_SESSION);
+  }
+}
+
+E_TS_RX_STATUS
+TransportServiceRxFrame(
+  TS_RX_CONTEXT *pCtx,
+  uint8_t sourceNode,
+  const uint8_t *pFrame,
+  uint8_t frameLength,
+  uint32_t nowMs)
+{
+  TS_SEGMENT segment;
+  TS_RX_SESSION *pSession;
+  E_TS_RX_STATUS status;
+  uint16_t slot;
+  uint16_t added;
+  uint16_t hole;
+
+  if (0 == sourceNode || sourceNode > TS_MAX_NODES)
+  {
+    return TS_RX_INVALID_FRAME;
+  }
+  status = ParseSegment(pFrame, frameLength, &segment);
+  if (TS_RX_CHECKSUM_ERROR == status)
+  {
+    pCtx->stats.checksumErrors++;
+    return status;
+  }
+  if (TS_RX_SEGMENT_STORED != status)
+  {
+    return status;
+  }
+  pCtx->stats.segmentsReceived++;
+
+  slot = pCtx->nodeSession[sourceNode];
+  if (TS_NO_SESSION != slot)
+  {
+    pSession = &pCtx->pSessions[slot];
+    if (pSession->sessionId != segment.sessionId || pSession->datagramSize != segment.datagramSize)
+    {
+      /* The sender gave up on the previous datagram and started a new one */
+      pCtx->stats.datagramsAborted++;
+      SessionFree(pCtx, slot);
+      slot = TS_NO_SESSION;
+    }
+  }
+  if (TS_NO_SESSION == slot)
+  {
+    if (pCtx->completedSession[sourceNode] == (TS_COMPLETED_VALID | segment.sessionId))
+    {
+      /* Retransmission after our Segment Complete got lost */
+      pCtx->stats.duplicateBytes += segment.payloadLength;
+      SendSegmentComplete(pCtx, sourceNode, segment.sessionId);
+      return TS_RX_DUPLICATE;
+    }
+    /* A session may start from a Subsequent Segment if the First Segment was lost;
+     * the missing head is requested like any other hole. */
+    slot = SessionAlloc(pCtx, sourceNode, &segment, nowMs);
+    if (TS_NO_SESSION == slot)
+    {
+      SendSegmentWait(pCtx, sourceNode);
+      return TS_RX_NO_RESOURCES;
+    }
+    pCtx->completedSession[sourceNode] = 0;
+  }
+  pSession = &pCtx->pSessions[slot];
+
+  added = MarkReceived(pSession->receivedMap, segment.offset, segment.payloadLength);
+  if (added)
+  {
+    memcpy(&pSession->datagram[segment.offset], segment.pPayload, segment.payloadLength);
+    pSession->bytesReceived = (uint16_t)(pSession->bytesReceived + added);
+    pSession->requestCount = 0;
+  }
+  pCtx->stats.payloadBytes += added;
+  pCtx->stats.duplicateBytes += (uint32_t)(segment.payloadLength - added);
+  pSession->lastActivityMs = nowMs;
+  if (segment.payloadLength > pSession->segmentPayload)
+  {
+    pSession->segmentPayload = segment.payloadLength;
+  }
+  if (segment.offset + segment.payloadLength == segment.datagramSize)
+  {
+    pSession->lastSeen = 1;
+  }
+  if (pSession->requestPending && segment.offset <= pSession->requestedOffset
+      && pSession->requestedOffset < segment.offset + segment.payloadLength)
+  {
+    pSession->requestPending = 0;
+  }
+
+  if (pSession->bytesReceived == pSession->datagramSize)
+  {
+    SessionDeliver(pCtx, slot);
+    return TS_RX_DATAGRAM_COMPLETE;
+  }
+
+  /* The sender has finished its pass. Ask for the next hole right away rather
+   * than waiting for the timeout; one request is outstanding at a time. */
+  if (pSession->lastSeen && !pSession->requestPending)
+  {
+    hole = FirstHole(pSession);
+    SendSegmentRequest(pCtx, pSession, hole, nowMs);
+  }
+  return TS_RX_SEGMENT_STORED;
+}
+
+void
+TransportServiceRxPoll(
+  TS_RX_CONTEXT *pCtx,
+  uint32_t nowMs)
+{
+  uint16_t slot;
+
+  if (0 == pCtx->activeCount)
+  {
+    return;
+  }
+  for (slot = 0; slot < pCtx->sessionCount; slot++)
+  {
+    TS_RX_SESSION *pSession = &pCtx->pSessions[slot];
+
+    if (0 == pSession->sourceNode
+        || (uint32_t)(nowMs - pSession->lastActivityMs) < TS_RX_REQUEST_TIMEOUT_MS)
+    {
+      continue;
+    }
+    if (pSession->requestCount >= TS_RX_MAX_REQUESTS)
+    {
+      pCtx->stats.datagramsAborted++;
+      SessionFree(pCtx, slot);
+      continue;
+    }
+    SendSegmentRequest(pCtx, pSession, FirstHole(pSession), nowMs);
+  }
+}
+
+uint16_t
+TransportServiceRxFirstHole(
+  const TS_RX_CONTEXT *pCtx,
+  uint8_t sourceNode)
+{
+  uint16_t slot;
+
+  if (0 == sourceNode || sourceNode > TS_MAX_NODES)
+  {
+    return TS_NO_SESSION;
+  }
+  slot = pCtx->nodeSession[sourceNode];
+  if (TS_NO_SESSION == slot)
+  {
+    return TS_NO_SESSION;
+  }
+  return FirstHole(&pCtx->pSessions[slot]);
+}
+
+uint8_t
+TransportServiceTxInit(
+  TS_TX_SESSION *pTx,
+  const uint8_t *pDatagram,
+  uint16_t datagramSize,
+  uint8_t sessionId,
+  uint8_t maxPayloadSize)
+{
+  if (0 == datagramSize || datagramSize > TS_MAX_DATAGRAM_SIZE || sessionId >= TS_SESSION_ID_COUNT
+      || maxPayloadSize <= TS_SUBSEQUENT_SEGMENT_OVERHEAD)
+  {
+    return 0;
+  }
+  pTx->pDatagram = pDatagram;
+  pTx->datagramSize = datagramSize;
+  pTx->nextOffset = 0;
+  pTx->sessionId = sessionId;
+  /* Use the same payload size for all segments so requested offsets line up */
+  pTx->segmentPayload = (uint8_t)(maxPayloadSize - TS_SUBSEQUENT_SEGMENT_OVERHEAD);
+  pTx->complete = 0;
+  pTx->waitSegments = 0;
+  return 1;
+}
+
+uint8_t
+TransportServiceTxSegment(
+  const TS_TX_SESSION *pTx,
+  uint16_t offset,
+  uint8_t *pFrame)
+{
+  uint8_t header;
+  uint8_t length;
+  uint16_t crc;
+
+  if (offset >= pTx->datagramSize)
+  {
+    return 0;
+  }
+  length = pTx->segmentPayload;
+  if (pTx->datagramSize - offset < length)
+  {
+    length = (uint8_t)(pTx->datagramSize - offset);
+  }
+  pFrame[0] = COMMAND_CLASS_TRANSPORT_SERVICE_V2;
+  pFrame[2] = (uint8_t)pTx->datagramSize;
+  if (0 == offset)
+  {
+    pFrame[1] = (uint8_t)(COMMAND_FIRST_SEGMENT_V2 | ((pTx->datagramSize >> 8) & COMMAND_FIRST_SEGMENT_DATAGRAM_SIZE_1_MASK_V2));
+    pFrame[3] = (uint8_t)(pTx->sessionId << COMMAND_FIRST_SEGMENT_PROPERTIES2_SESSION_ID_SHIFT_V2);
+    header = 4;
+  }
+  else
+  {
+    pFrame[1] = (uint8_t)(COMMAND_SUBSEQUENT_SEGMENT_V2 | ((pTx->datagramSize >> 8) & COMMAND_SUBSEQUENT_SEGMENT_DATAGRAM_SIZE_1_MASK_V2));
+    pFrame[3] = (uint8_t)((pTx->sessionId << COMMAND_SUBSEQUENT_SEGMENT_PROPERTIES2_SESSION_ID_SHIFT_V2)
+                          | ((offset >> 8) & COMMAND_SUBSEQUENT_SEGMENT_PROPERTIES2_DATAGRAM_OFFSET_1_MASK_V2));
+    pFrame[4] = (uint8_t)offset;
+    header = 5;
+  }
+  memcpy(&pFrame[header], &pTx->pDatagram[offset], length);
+  crc = ZW_CheckCrc16(CRC_INIT_VALUE, pFrame, (uint32_t)(header + length));
+  pFrame[header + length] = (uint8_t)(crc >> 8);
+  pFrame[header + length + 1] = (uint8_t)crc;
+  return (uint8_t)(header + length + 2);
+}
+
+uint8_t
+TransportServiceTxNext(
+  TS_TX_SESSION *pTx,
+  uint8_t *pFrame)
+{
+  uint8_t length = TransportServiceTxSegment(pTx, pTx->nextOffset, pFrame);
+
+  if (length)
+  {
+    pTx->nextOffset = (uint16_t)(pTx->nextOffset + pTx->segmentPayload);
+  }
+  return length;
+}
+
+E_TS_TX_EVENT
+TransportServiceTxControl(
+  TS_TX_SESSION *pTx,
+  const uint8_t *pFrame,
+  uint8_t frameLength,
+  uint16_t *pOffset)
+{
+  uint8_t cmd;
+
+  if (frameLength < 3 || COMMAND_CLASS_TRANSPORT_SERVICE_V2 != pFrame[0])
+  {
+    return TS_TX_EVENT_NONE;
+  }
+  cmd = pFrame[1] & COMMAND_SEGMENT_REQUEST_MASK_V2;
+  if (COMMAND_SEGMENT_WAIT_V2 == cmd)
+  {
+    pTx->waitSegments = pFrame[2];
+    return TS_TX_EVENT_WAIT;
+  }
+  if (((pFrame[2] & COMMAND_SEGMENT_REQUEST_PROPERTIES2_SESSION_ID_MASK_V2)
+       >> COMMAND_SEGMENT_REQUEST_PROPERTIES2_SESSION_ID_SHIFT_V2) != pTx->sessionId)
+  {
+    return TS_TX_EVENT_NONE;
+  }
+  if (COMMAND_SEGMENT_COMPLETE_V2 == cmd)
+  {
+    pTx->complete = 1;
+    return TS_TX_EVENT_COMPLETE;
+  }
+  if (COMMAND_SEGMENT_REQUEST_V2 == cmd && frameLength >= 4)
+  {
+    *pOffset = (uint16_t)(((pFrame[2] & COMMAND_SEGMENT_REQUEST_PROPERTIES2_DATAGRAM_OFFSET_1_MASK_V2) << 8) | pFrame[3]);
+    return (*pOffset < pTx->datagramSize) ? TS_TX_EVENT_REQUEST : TS_TX_EVENT_NONE;
+  }
+  return TS_TX_EVENT_NONE;
+}
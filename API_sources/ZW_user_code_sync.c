@@ -0,0 +1,434 @@
+/****************************************************************************
+ *
+ * Description: User Code Command Class slot synchronization.
+ *
+ ****************************************************************************/
+
+/****************************************************************************/
+/*                              INCLUDE FILES                               */
+/****************************************************************************/
+#include <string.h>
+#include <ZW_typedefs.h>
+#include <ZW_classcmd.h>
+#include <ZW_user_code_sync.h>
+
+/****************************************************************************/
+/*                      PRIVATE TYPES and DEFINITIONS                       */
+/****************************************************************************/
+
+#define FNV_OFFSET_BASIS           0x811C9DC5UL
+#define FNV_PRIME                  0x01000193UL
+
+/* Header lengths: command class, command, user identifier (and status) */
+#define GET_LENGTH                 3
+#define SET_HEADER_LENGTH          4
+#define REPORT_HEADER_LENGTH       4
+
+/* Max commands in one Multi Command frame, the count field is one byte */
+#define MULTI_CMD_MAX_COMMANDS     255
+
+/* Commands collected for the next frame */
+typedef struct _BATCH_
+{
+  USER_CODE_SYNC_LOCK *pLock;
+  USER_CODE_SYNC_SEND_FUNC pSend;
+  void *pUser;
+  USER_CODE_SYNC_STATS *pStats;
+  uint8_t  room;                 /* Max frame length */
+  uint8_t  commands;
+  uint8_t  length;               /* Bytes in frame, Multi Command header included */
+  uint8_t  verify;               /* Written slots wait for a report */
+  uint8_t  slots;
+  uint8_t  slot[MULTI_CMD_MAX_COMMANDS]; /* Slots written by the frame, marked once it is sent */
+  uint8_t  frame[USER_CODE_SYNC_MAX_FRAME_LENGTH];
+} BATCH;
+
+/****************************************************************************/
+/*                           PRIVATE FUNCTIONS                              */
+/****************************************************************************/
+
+/* Codes only count for slots holding one */
+static BOOL
+HasCode(uint8_t status)
+{
+  return USER_CODE_SET_OCCUPIED == status || USER_CODE_SET_RESERVED_BY_ADMINISTRATOR == status;
+}
+
+static uint32_t
+SlotHash(
+  uint8_t status,
+  const uint8_t *pCode,
+  uint8_t codeLength)
+{
+  uint32_t hash = (FNV_OFFSET_BASIS ^ status) * FNV_PRIME;
+  uint8_t i;
+
+  if (HasCode(status))
+  {
+    for (i = 0; i < codeLength; i++)
+    {
+      hash = (hash ^ pCode[i]) * FNV_PRIME;
+    }
+  }
+  return hash;
+}
+
+static BOOL
+NeedsWrite(const USER_CODE_SYNC_SLOT *pSlot)
+{
+  if ((pSlot->flags & (USER_CODE_SLOT_FLAG_DESIRED | USER_CODE_SLOT_FLAG_REJECTED | USER_CODE_SLOT_FLAG_UNSUPPORTED))
+      != USER_CODE_SLOT_FLAG_DESIRED)
+  {
+    return FALSE;
+  }
+  if (pSlot->flags & USER_CODE_SLOT_FLAG_PENDING)
+  {
+    return FALSE;
+  }
+  return (0 == (pSlot->flags & USER_CODE_SLOT_FLAG_CACHED)) || pSlot->lockHash != pSlot->desiredHash;
+}
+
+static BOOL
+NeedsRead(const USER_CODE_SYNC_SLOT *pSlot)
+{
+  if (pSlot->flags & USER_CODE_SLOT_FLAG_UNSUPPORTED)
+  {
+    return FALSE;
+  }
+  return (pSlot->flags & USER_CODE_SLOT_FLAG_PENDING) || 0 == (pSlot->flags & USER_CODE_SLOT_FLAG_CACHED);
+}
+
+static void
+BatchInit(
+  BATCH *pBatch,
+  USER_CODE_SYNC_LOCK *pLock,
+  USER_CODE_SYNC_SEND_FUNC pSend,
+  void *pUser,
+  USER_CODE_SYNC_STATS *pStats,
+  BOOL verify)
+{
+  pBatch->pLock = pLock;
+  pBatch->pSend = pSend;
+  pBatch->pUser = pUser;
+  pBatch->pStats = pStats;
+  pBatch->room = (pLock->maxPayload > USER_CODE_SYNC_MAX_FRAME_LENGTH) ? USER_CODE_SYNC_MAX_FRAME_LENGTH
+                                                                      : pLock->maxPayload;
+  pBatch->commands = 0;
+  pBatch->length = USER_CODE_SYNC_MULTI_CMD_HEADER;
+  pBatch->verify = (uint8_t)verify;
+  pBatch->slots = 0;
+}
+
+/**
+ * Send the collected commands. A single command is sent without the Multi
+ * Command header. The slots written by the frame are marked only when it
+ * was sent, so a failed frame leaves them to the next push.
+ */
+static BOOL
+BatchFlush(BATCH *pBatch)
+{
+  const uint8_t *pFrame = pBatch->frame;
+  uint8_t length = pBatch->length;
+  uint8_t i;
+
+  if (0 == pBatch->commands)
+  {
+    return TRUE;
+  }
+  if (1 == pBatch->commands)
+  {
+    pFrame += USER_CODE_SYNC_MULTI_CMD_HEADER + 1;
+    length -= USER_CODE_SYNC_MULTI_CMD_HEADER + 1;
+  }
+  else
+  {
+    pBatch->frame[0] = COMMAND_CLASS_MULTI_CMD;
+    pBatch->frame[1] = MULTI_CMD_ENCAP;
+    pBatch->frame[2] = pBatch->commands;
+    pBatch->pStats->multiCmdFrames++;
+  }
+  if (!pBatch->pSend(pBatch->pUser, pBatch->pLock->nodeId, pFrame, length))
+  {
+    return FALSE;
+  }
+  pBatch->pStats->frames++;
+  pBatch->pStats->bytes += length;
+  for (i = 0; i < pBatch->slots; i++)
+  {
+    USER_CODE_SYNC_SLOT *pSlot = &pBatch->pLock->pSlots[pBatch->slot[i]];
+
+    if (pBatch->verify)
+    {
+      pSlot->flags |= USER_CODE_SLOT_FLAG_PENDING;
+    }
+    else
+    {
+      pSlot->lockHash = pSlot->desiredHash;
+      pSlot->flags |= USER_CODE_SLOT_FLAG_CACHED;
+    }
+  }
+  pBatch->slots = 0;
+  pBatch->commands = 0;
+  pBatch->length = USER_CODE_SYNC_MULTI_CMD_HEADER;
+  return TRUE;
+}
+
+/**
+ * Add a command to the batch, sending the batch first if the command does
+ * not fit. \a together commands are kept in the same frame as the following
+ * one when possible.
+ */
+static BOOL
+BatchAdd(
+  BATCH *pBatch,
+  const uint8_t *pCommand,
+  uint8_t length,
+  uint8_t together)
+{
+  if (pBatch->commands &&
+      (!pBatch->pLock->multiCmd || MULTI_CMD_MAX_COMMANDS == pBatch->commands ||
+       pBatch->length + 1 + length + together > pBatch->room))
+  {
+    if (!BatchFlush(pBatch))
+    {
+      return FALSE;
+    }
+  }
+  pBatch->frame[pBatch->length++] = length;
+  memcpy(&pBatch->frame[pBatch->length], pCommand, length);
+  pBatch->length += length;
+  pBatch->commands++;
+  return TRUE;
+}
+
+/****************************************************************************/
+/*                           EXPORTED FUNCTIONS                             */
+/****************************************************************************/
+
+void
+UserCodeSyncLockInit(
+  USER_CODE_SYNC_LOCK *pLock,
+  uint8_t nodeId,
+  uint8_t maxPayload,
+  BOOL multiCmd,
+  USER_CODE_SYNC_SLOT *pSlots,
+  uint8_t slotCount)
+{
+  pLock->nodeId = nodeId;
+  pLock->maxPayload = maxPayload;
+  pLock->multiCmd = multiCmd;
+  pLock->pSlots = pSlots;
+  pLock->slotCount = slotCount;
+  memset(pSlots, 0, slotCount * sizeof(USER_CODE_SYNC_SLOT));
+}
+
+BOOL
+UserCodeSyncSetDesired(
+  USER_CODE_SYNC_LOCK *pLock,
+  uint8_t userId,
+  uint8_t status,
+  const uint8_t *pCode,
+  uint8_t codeLength)
+{
+  USER_CODE_SYNC_SLOT *pSlot;
+
+  if (0 == userId || userId > pLock->slotCount)
+  {
+    return FALSE;
+  }
+  if (!HasCode(status))
+  {
+    codeLength = 0;
+  }
+  else if (codeLength < USER_CODE_SYNC_MIN_CODE_LENGTH || codeLength > USER_CODE_SYNC_MAX_CODE_LENGTH)
+  {
+    return FALSE;
+  }
+  pSlot = &pLock->pSlots[userId - 1];
+  pSlot->status = status;
+  pSlot->codeLength = codeLength;
+  memcpy(pSlot->userCode, pCode, codeLength);
+  pSlot->desiredHash = SlotHash(status, pCode, codeLength);
+  pSlot->flags = (uint8_t)((pSlot->flags | USER_CODE_SLOT_FLAG_DESIRED) & ~USER_CODE_SLOT_FLAG_REJECTED);
+  return TRUE;
+}
+
+BOOL
+UserCodeSyncPush(
+  USER_CODE_SYNC_LOCK *pLock,
+  BOOL verify,
+  USER_CODE_SYNC_SEND_FUNC pSend,
+  void *pUser,
+  USER_CODE_SYNC_STATS *pStats)
+{
+  USER_CODE_SYNC_STATS stats;
+  BATCH batch;
+  uint8_t command[SET_HEADER_LENGTH + USER_CODE_SYNC_MAX_CODE_LENGTH];
+  uint16_t i;
+  BOOL ok = TRUE;
+
+  memset(&stats, 0, sizeof(stats));
+  BatchInit(&batch, pLock, pSend, pUser, &stats, verify);
+  for (i = 0; i < pLock->slotCount && ok; i++)
+  {
+    USER_CODE_SYNC_SLOT *pSlot = &pLock->pSlots[i];
+    uint8_t length;
+
+    if (!NeedsWrite(pSlot))
+    {
+      stats.slotsSkipped++;
+      continue;
+    }
+    command[0] = COMMAND_CLASS_USER_CODE;
+    command[1] = USER_CODE_SET;
+    command[2] = (uint8_t)(i + 1);
+    command[3] = pSlot->status;
+    if (pSlot->codeLength)
+    {
+      memcpy(&command[SET_HEADER_LENGTH], pSlot->userCode, pSlot->codeLength);
+      length = (uint8_t)(SET_HEADER_LENGTH + pSlot->codeLength);
+    }
+    else
+    {
+      /* Clearing a slot sends a code of 0x00000000 */
+      memset(&command[SET_HEADER_LENGTH], 0, USER_CODE_SYNC_MIN_CODE_LENGTH);
+      length = SET_HEADER_LENGTH + USER_CODE_SYNC_MIN_CODE_LENGTH;
+    }
+    ok = BatchAdd(&batch, command, length, verify ? 1 + GET_LENGTH : 0);
+    if (ok && verify)
+    {
+      command[1] = USER_CODE_GET;
+      ok = BatchAdd(&batch, command, GET_LENGTH, 0);
+    }
+    if (!ok)
+    {
+      break;
+    }
+    /* Recorded with the frame holding the last command of the slot */
+    batch.slot[batch.slots++] = (uint8_t)i;
+    stats.sets++;
+    if (verify)
+    {
+      stats.gets++;
+    }
+  }
+  if (ok)
+  {
+    ok = BatchFlush(&batch);
+  }
+  if (pStats)
+  {
+    *pStats = stats;
+  }
+  return ok;
+}
+
+BOOL
+UserCodeSyncVerify(
+  USER_CODE_SYNC_LOCK *pLock,
+  USER_CODE_SYNC_SEND_FUNC pSend,
+  void *pUser,
+  USER_CODE_SYNC_STATS *pStats)
+{
+  USER_CODE_SYNC_STATS stats;
+  BATCH batch;
+  uint8_t command[GET_LENGTH];
+  uint16_t i;
+  BOOL ok = TRUE;
+
+  memset(&stats, 0, sizeof(stats));
+  BatchInit(&batch, pLock, pSend, pUser, &stats, FALSE);
+  for (i = 0; i < pLock->slotCount && ok; i++)
+  {
+    if (!NeedsRead(&pLock->pSlots[i]))
+    {
+      stats.slotsSkipped++;
+      continue;
+    }
+    command[0] = COMMAND_CLASS_USER_CODE;
+    command[1] = USER_CODE_GET;
+    command[2] = (uint8_t)(i + 1);
+    ok = BatchAdd(&batch, command, GET_LENGTH, 0);
+    if (ok)
+    {
+      stats.gets++;
+    }
+  }
+  if (ok)
+  {
+    ok = BatchFlush(&batch);
+  }
+  if (pStats)
+  {
+    *pStats = stats;
+  }
+  return ok;
+}
+
+BOOL
+UserCodeSyncReport(
+  USER_CODE_SYNC_LOCK *pLock,
+  const uint8_t *pFrame,
+  uint8_t frameLength)
+{
+  USER_CODE_SYNC_SLOT *pSlot;
+  uint8_t userId;
+  uint8_t status;
+  uint8_t codeLength;
+
+  if (frameLength < 3 || COMMAND_CLASS_USER_CODE != pFrame[0])
+  {
+    return FALSE;
+  }
+  if (USERS_NUMBER_REPORT == pFrame[1])
+  {
+    /* The slot table cannot grow */
+    if (pFrame[2] < pLock->slotCount)
+    {
+      pLock->slotCount = pFrame[2];
+    }
+    return TRUE;
+  }
+  if (USER_CODE_REPORT != pFrame[1] || frameLength < REPORT_HEADER_LENGTH)
+  {
+    return FALSE;
+  }
+  userId = pFrame[2];
+  status = pFrame[3];
+  codeLength = (uint8_t)(frameLength - REPORT_HEADER_LENGTH);
+  if (codeLength > USER_CODE_SYNC_MAX_CODE_LENGTH)
+  {
+    codeLength = USER_CODE_SYNC_MAX_CODE_LENGTH;
+  }
+  if (0 == userId || userId > pLock->slotCount)
+  {
+    return TRUE;
+  }
+
+  pSlot = &pLock->pSlots[userId - 1];
+  if (USER_CODE_REPORT_STATUS_NOT_AVAILABLE == status)
+  {
+    pSlot->flags = (uint8_t)((pSlot->flags | USER_CODE_SLOT_FLAG_UNSUPPORTED) & ~USER_CODE_SLOT_FLAG_PENDING);
+    return TRUE;
+  }
+  pSlot->lockHash = SlotHash(status, &pFrame[REPORT_HEADER_LENGTH], codeLength);
+  if ((pSlot->flags & USER_CODE_SLOT_FLAG_PENDING) && pSlot->lockHash != pSlot->desiredHash)
+  {
+    /* Not resent until the desired content changes */
+    pSlot->flags |= USER_CODE_SLOT_FLAG_REJECTED;
+  }
+  pSlot->flags = (uint8_t)((pSlot->flags | USER_CODE_SLOT_FLAG_CACHED) & ~USER_CODE_SLOT_FLAG_PENDING);
+  return TRUE;
+}
+
+void
+UserCodeSyncInvalidate(
+  USER_CODE_SYNC_LOCK *pLock)
+{
+  uint16_t i;
+
+  for (i = 0; i < pLock->slotCount; i++)
+  {
+    pLock->pSlots[i].flags &= (uint8_t)~(USER_CODE_SLOT_FLAG_CACHED | USER_CODE_SLOT_FLAG_PENDING);
+  }
+}
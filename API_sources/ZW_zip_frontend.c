@@ -0,0 +1,576 @@
+/****************************************************************************
+ *
+ * Description: Batched UDP front-end for Z/IP packets.
+ *
+ ****************************************************************************/
+
+/****************************************************************************/
+/*                              INCLUDE FILES                               */
+/****************************************************************************/
+#ifndef _GNU_SOURCE
+#define _GNU_SOURCE             /* recvmmsg(), sendmmsg() and struct mmsghdr */
+#endif
+#include <string.h>
+#include <unistd.h>
+#include <ZW_typedefs.h>
+#include <ZW_classcmd.h>
+#include <ZW_zip_frontend.h>
+
+/****************************************************************************/
+/*                      PRIVATE TYPES and DEFINITIONS                       */
+/****************************************************************************/
+
+#define FNV_OFFSET_BASIS           0x811C9DC5UL
+#define FNV_PRIME                  0x01000193UL
+
+/* Option value lengths */
+#define EXPECTED_DELAY_LENGTH      3
+#define ENCAPSULATION_LENGTH       2
+
+/* Index 0 of ZIP_FRONTEND.pending is never used, callback ID 0 means none */
+#define NO_PENDING                 0
+
+/****************************************************************************/
+/*                           PRIVATE FUNCTIONS                              */
+/****************************************************************************/
+
+static BOOL
+SameClient(
+  const ZIP_CLIENT *pA,
+  const ZIP_CLIENT *pB)
+{
+  if (pA->address.ss_family != pB->address.ss_family)
+  {
+    return FALSE;
+  }
+  if (AF_INET == pA->address.ss_family)
+  {
+    const struct sockaddr_in *pA4 = (const struct sockaddr_in *)&pA->address;
+    const struct sockaddr_in *pB4 = (const struct sockaddr_in *)&pB->address;
+
+    return pA4->sin_port == pB4->sin_port && pA4->sin_addr.s_addr == pB4->sin_addr.s_addr;
+  }
+  if (AF_INET6 == pA->address.ss_family)
+  {
+    const struct sockaddr_in6 *pA6 = (const struct sockaddr_in6 *)&pA->address;
+    const struct sockaddr_in6 *pB6 = (const struct sockaddr_in6 *)&pB->address;
+
+    return pA6->sin6_port == pB6->sin6_port
+           && 0 == memcmp(&pA6->sin6_addr, &pB6->sin6_addr, sizeof(pA6->sin6_addr));
+  }
+  return pA->addressLength == pB->addressLength && 0 == memcmp(&pA->address, &pB->address, pA->addressLength);
+}
+
+static uint32_t
+HashBytes(
+  uint32_t hash,
+  const void *pData,
+  uint32_t length)
+{
+  const uint8_t *p = (const uint8_t *)pData;
+
+  while (length--)
+  {
+    hash = (hash ^ *p++) * FNV_PRIME;
+  }
+  return hash;
+}
+
+static uint8_t
+Bucket(
+  const ZIP_CLIENT *pClient,
+  uint8_t seqNo)
+{
+  uint32_t hash = (FNV_OFFSET_BASIS ^ seqNo) * FNV_PRIME;
+
+  if (AF_INET == pClient->address.ss_family)
+  {
+    const struct sockaddr_in *p4 = (const struct sockaddr_in *)&pClient->address;
+
+    hash = HashBytes(hash, &p4->sin_port, sizeof(p4->sin_port));
+    hash = HashBytes(hash, &p4->sin_addr, sizeof(p4->sin_addr));
+  }
+  else if (AF_INET6 == pClient->address.ss_family)
+  {
+    const struct sockaddr_in6 *p6 = (const struct sockaddr_in6 *)&pClient->address;
+
+    hash = HashBytes(hash, &p6->sin6_port, sizeof(p6->sin6_port));
+    hash = HashBytes(hash, &p6->sin6_addr, sizeof(p6->sin6_addr));
+  }
+  return (uint8_t)(hash ^ (hash >> 8) ^ (hash >> 16) ^ (hash >> 24));
+}
+
+static uint8_t
+PendingFind(
+  const ZIP_FRONTEND *pFrontend,
+  const ZIP_CLIENT *pClient,
+  uint8_t seqNo)
+{
+  uint8_t id = pFrontend->buckets[Bucket(pClient, seqNo)];
+
+  while (NO_PENDING != id)
+  {
+    const ZIP_PENDING *pPending = &pFrontend->pending[id];
+
+    if (pPending->seqNo == seqNo && SameClient(&pPending->client, pClient))
+    {
+      return id;
+    }
+    id = pPending->next;
+  }
+  return NO_PENDING;
+}
+
+static void
+PendingRemove(
+  ZIP_FRONTEND *pFrontend,
+  uint8_t callbackId)
+{
+  ZIP_PENDING *pPending = &pFrontend->pending[callbackId];
+  uint8_t *pLink = &pFrontend->buckets[Bucket(&pPending->client, pPending->seqNo)];
+
+  while (NO_PENDING != *pLink && callbackId != *pLink)
+  {
+    pLink = &pFrontend->pending[*pLink].next;
+  }
+  if (callbackId == *pLink)
+  {
+    *pLink = pPending->next;
+  }
+  pPending->used = FALSE;
+  pFrontend->pendingCount--;
+}
+
+static E_ZIP_PARSE_STATUS
+ParseExtension(
+  const uint8_t *pOption,
+  uint8_t length,
+  ZIP_PACKET *pPacket)
+{
+  const uint8_t *pEnd = pOption + length;
+
+  while (pOption < pEnd)
+  {
+    uint8_t type;
+    uint8_t optionLength;
+    const uint8_t *pValue;
+
+    if (pEnd - pOption < 2 || pOption[1] > pEnd - pOption - 2)
+    {
+      return ZIP_PARSE_BAD_EXTENSION;
+    }
+    type = pOption[0] & ZIP_OPTION_TYPE_MASK;
+    optionLength = pOption[1];
+    pValue = &pOption[2];
+
+    switch (type)
+    {
+      case ZIP_OPTION_EXPECTED_DELAY:
+        if (EXPECTED_DELAY_LENGTH != optionLength)
+        {
+          return ZIP_PARSE_BAD_EXTENSION;
+        }
+        pPacket->expectedDelay = ((uint32_t)pValue[0] << 16) | ((uint32_t)pValue[1] << 8) | pValue[2];
+        break;
+
+      case ZIP_OPTION_IME_GET:
+        break;
+
+      case ZIP_OPTION_IME_REPORT:
+        pPacket->pImeReport = pValue;
+        pPacket->imeReportLength = optionLength;
+        break;
+
+      case ZIP_OPTION_ENCAPSULATION_FORMAT:
+        if (ENCAPSULATION_LENGTH != optionLength)
+        {
+          return ZIP_PARSE_BAD_EXTENSION;
+        }
+        pPacket->securityClass = pValue[0];
+        pPacket->encapsulationFlags = pValue[1];
+        break;
+
+      case ZIP_OPTION_MULTICAST:
+        pPacket->pMulticast = pValue;
+        pPacket->multicastLength = optionLength;
+        break;
+
+      default:
+        if (pOption[0] & ZIP_OPTION_CRITICAL)
+        {
+          return ZIP_PARSE_UNSUPPORTED_OPTION;
+        }
+        /* Unknown elective options are skipped */
+        type = 0;
+        break;
+    }
+    if (type)
+    {
+      pPacket->options |= (uint8_t)ZIP_OPTION_BIT(type);
+    }
+    pOption = pValue + optionLength;
+  }
+  return ZIP_PARSE_OK;
+}
+
+/****************************************************************************/
+/*                           EXPORTED FUNCTIONS                             */
+/****************************************************************************/
+
+E_ZIP_PARSE_STATUS
+ZipPacketParse(
+  const uint8_t *pData,
+  uint16_t length,
+  ZIP_PACKET *pPacket)
+{
+  uint16_t offset = ZIP_PACKET_HEADER_LENGTH;
+  E_ZIP_PARSE_STATUS status;
+
+  memset(pPacket, 0, sizeof(ZIP_PACKET));
+  if (length < 2 || COMMAND_CLASS_ZIP_V3 != pData[0] || COMMAND_ZIP_PACKET_V3 != pData[1])
+  {
+    return ZIP_PARSE_NOT_ZIP;
+  }
+  if (length < ZIP_PACKET_HEADER_LENGTH)
+  {
+    return ZIP_PARSE_TRUNCATED;
+  }
+  pPacket->flags1 = pData[2];
+  pPacket->flags2 = pData[3];
+  pPacket->seqNo = pData[4];
+  pPacket->sourceEndpoint = pData[5] & COMMAND_ZIP_PACKET_PROPERTIES3_SOURCE_END_POINT_MASK_V3;
+  pPacket->destinationEndpoint = pData[6];
+
+  if (pPacket->flags2 & COMMAND_ZIP_PACKET_PROPERTIES2_HEADER_EXT_INCLUDED_BIT_MASK_V3)
+  {
+    /* The extension length counts itself */
+    uint8_t extensionLength = (length > offset) ? pData[offset] : 0;
+
+    if (0 == extensionLength || offset + extensionLength > length)
+    {
+      return ZIP_PARSE_TRUNCATED;
+    }
+    status = ParseExtension(&pData[offset + 1], (uint8_t)(extensionLength - 1), pPacket);
+    if (ZIP_PARSE_OK != status)
+    {
+      return status;
+    }
+    offset += extensionLength;
+  }
+  if ((pPacket->flags2 & COMMAND_ZIP_PACKET_PROPERTIES2_Z_WAVE_CMD_INCLUDED_BIT_MASK_V3) && offset < length)
+  {
+    pPacket->pCommand = &pData[offset];
+    pPacket->commandLength = (uint16_t)(length - offset);
+  }
+  return ZIP_PARSE_OK;
+}
+
+uint16_t
+ZipPacketBuild(
+  uint8_t flags1,
+  uint8_t flags2,
+  uint8_t seqNo,
+  uint8_t sourceEndpoint,
+  uint8_t destinationEndpoint,
+  const uint8_t *pCommand,
+  uint16_t commandLength,
+  uint8_t *pOut)
+{
+  pOut[0] = COMMAND_CLASS_ZIP_V3;
+  pOut[1] = COMMAND_ZIP_PACKET_V3;
+  pOut[2] = flags1;
+  pOut[3] = (uint8_t)(flags2 & ~(COMMAND_ZIP_PACKET_PROPERTIES2_HEADER_EXT_INCLUDED_BIT_MASK_V3 |
+                                 COMMAND_ZIP_PACKET_PROPERTIES2_Z_WAVE_CMD_INCLUDED_BIT_MASK_V3));
+  pOut[4] = seqNo;
+  pOut[5] = sourceEndpoint & COMMAND_ZIP_PACKET_PROPERTIES3_SOURCE_END_POINT_MASK_V3;
+  pOut[6] = destinationEndpoint;
+  if (pCommand && commandLength)
+  {
+    pOut[3] |= COMMAND_ZIP_PACKET_PROPERTIES2_Z_WAVE_CMD_INCLUDED_BIT_MASK_V3;
+    memcpy(&pOut[ZIP_PACKET_HEADER_LENGTH], pCommand, commandLength);
+  }
+  else
+  {
+    commandLength = 0;
+  }
+  return (uint16_t)(ZIP_PACKET_HEADER_LENGTH + commandLength);
+}
+
+BOOL
+ZipFrontendOpen(
+  ZIP_FRONTEND *pFrontend,
+  const struct sockaddr *pAddress,
+  socklen_t addressLength,
+  ZIP_PACKET_HANDLER pHandler,
+  void *pUser)
+{
+  uint8_t i;
+
+  memset(pFrontend, 0, sizeof(ZIP_FRONTEND));
+  pFrontend->fd = socket(pAddress->sa_family, SOCK_DGRAM | SOCK_NONBLOCK | SOCK_CLOEXEC, 0);
+  if (pFrontend->fd < 0)
+  {
+    return FALSE;
+  }
+  if (bind(pFrontend->fd, pAddress, addressLength) < 0)
+  {
+    close(pFrontend->fd);
+    pFrontend->fd = -1;
+    return FALSE;
+  }
+  pFrontend->pHandler = pHandler;
+  pFrontend->pUser = pUser;
+  pFrontend->nextCallbackId = 1;
+  for (i = 0; i < ZIP_FRONTEND_BATCH; i++)
+  {
+    pFrontend->rxIov[i].iov_base = pFrontend->rxBuffer[i];
+    pFrontend->rxIov[i].iov_len = ZIP_FRONTEND_MAX_DATAGRAM;
+    pFrontend->txIov[i].iov_base = pFrontend->txBuffer[i];
+  }
+  return TRUE;
+}
+
+void
+ZipFrontendClose(ZIP_FRONTEND *pFrontend)
+{
+  if (pFrontend->fd >= 0)
+  {
+    close(pFrontend->fd);
+  }
+  pFrontend->fd = -1;
+  pFrontend->txCount = 0;
+}
+
+uint32_t
+ZipFrontendPoll(ZIP_FRONTEND *pFrontend)
+{
+  uint32_t total = 0;
+  int received;
+
+  do
+  {
+    int i;
+
+    /* recvmmsg() overwrites the lengths, so every header is set up again */
+    for (i = 0; i < ZIP_FRONTEND_BATCH; i++)
+    {
+      struct msghdr *pHdr = &pFrontend->rxMsg[i].msg_hdr;
+
+      memset(pHdr, 0, sizeof(struct msghdr));
+      pHdr->msg_name = &pFrontend->rxAddress[i];
+      pHdr->msg_namelen = sizeof(struct sockaddr_storage);
+      pHdr->msg_iov = &pFrontend->rxIov[i];
+      pHdr->msg_iovlen = 1;
+    }
+    received = recvmmsg(pFrontend->fd, pFrontend->rxMsg, ZIP_FRONTEND_BATCH, MSG_DONTWAIT, NULL);
+    if (received <= 0)
+    {
+      break;
+    }
+    pFrontend->stats.recvCalls++;
+    pFrontend->stats.received += (uint32_t)received;
+    total += (uint32_t)received;
+
+    for (i = 0; i < received; i++)
+    {
+      const struct msghdr *pHdr = &pFrontend->rxMsg[i].msg_hdr;
+      ZIP_CLIENT client;
+      ZIP_PACKET packet;
+      E_ZIP_PARSE_STATUS status;
+
+      memcpy(&client.address, pHdr->msg_name, pHdr->msg_namelen);
+      client.addressLength = pHdr->msg_namelen;
+      if (pHdr->msg_flags & MSG_TRUNC)
+      {
+        pFrontend->stats.dropped++;
+        continue;
+      }
+      status = ZipPacketParse(pFrontend->rxBuffer[i], (uint16_t)pFrontend->rxMsg[i].msg_len, &packet);
+      if (ZIP_PARSE_UNSUPPORTED_OPTION == status
+          && (packet.flags1 & COMMAND_ZIP_PACKET_PROPERTIES1_ACK_REQUEST_BIT_MASK_V3))
+      {
+        ZipFrontendReply(pFrontend, &client, packet.seqNo, packet.sourceEndpoint, packet.destinationEndpoint,
+                         COMMAND_ZIP_PACKET_PROPERTIES1_NACK_RESPONSE_BIT_MASK_V3 |
+                         COMMAND_ZIP_PACKET_PROPERTIES1_NACK_OPTION_ERROR_BIT_MASK_V3);
+      }
+      if (ZIP_PARSE_OK != status)
+      {
+        pFrontend->stats.dropped++;
+        continue;
+      }
+      if ((packet.flags1 & COMMAND_ZIP_PACKET_PROPERTIES1_ACK_REQUEST_BIT_MASK_V3)
+          && NO_PENDING != PendingFind(pFrontend, &client, packet.seqNo))
+      {
+        pFrontend->stats.duplicates++;
+        ZipFrontendReply(pFrontend, &client, packet.seqNo, packet.sourceEndpoint, packet.destinationEndpoint,
+                         COMMAND_ZIP_PACKET_PROPERTIES1_NACK_RESPONSE_BIT_MASK_V3 |
+                         COMMAND_ZIP_PACKET_PROPERTIES1_NACK_WAITING_BIT_MASK_V3);
+        continue;
+      }
+      pFrontend->pHandler(pFrontend->pUser, pFrontend, &client, &packet);
+    }
+  } while (ZIP_FRONTEND_BATCH == received);
+
+  ZipFrontendFlush(pFrontend);
+  return total;
+}
+
+BOOL
+ZipFrontendQueue(
+  ZIP_FRONTEND *pFrontend,
+  const ZIP_CLIENT *pClient,
+  const uint8_t *pData,
+  uint16_t length)
+{
+  uint8_t i;
+
+  if (length > ZIP_FRONTEND_MAX_DATAGRAM)
+  {
+    return FALSE;
+  }
+  if (ZIP_FRONTEND_BATCH == pFrontend->txCount)
+  {
+    ZipFrontendFlush(pFrontend);
+  }
+  i = pFrontend->txCount++;
+  memcpy(pFrontend->txBuffer[i], pData, length);
+  memcpy(&pFrontend->txAddress[i], &pClient->address, pClient->addressLength);
+  pFrontend->txLength[i] = length;
+  pFrontend->txMsg[i].msg_hdr.msg_namelen = pClient->addressLength;
+  return TRUE;
+}
+
+BOOL
+ZipFrontendReply(
+  ZIP_FRONTEND *pFrontend,
+  const ZIP_CLIENT *pClient,
+  uint8_t seqNo,
+  uint8_t requestSourceEndpoint,
+  uint8_t requestDestinationEndpoint,
+  uint8_t flags1)
+{
+  uint8_t reply[ZIP_PACKET_HEADER_LENGTH];
+  uint16_t length;
+
+  /* The reply goes back from the addressed endpoint to the sender's */
+  length = ZipPacketBuild(flags1, 0, seqNo,
+                          requestDestinationEndpoint & COMMAND_ZIP_PACKET_PROPERTIES4_DESTINATION_END_POINT_MASK_V3,
+                          requestSourceEndpoint, NULL, 0, reply);
+  return ZipFrontendQueue(pFrontend, pClient, reply, length);
+}
+
+void
+ZipFrontendFlush(ZIP_FRONTEND *pFrontend)
+{
+  uint8_t done = 0;
+  uint8_t i;
+
+  for (i = 0; i < pFrontend->txCount; i++)
+  {
+    struct msghdr *pHdr = &pFrontend->txMsg[i].msg_hdr;
+    socklen_t nameLength = pHdr->msg_namelen;
+
+    memset(pHdr, 0, sizeof(struct msghdr));
+    pHdr->msg_name = &pFrontend->txAddress[i];
+    pHdr->msg_namelen = nameLength;
+    pHdr->msg_iov = &pFrontend->txIov[i];
+    pHdr->msg_iovlen = 1;
+    pFrontend->txIov[i].iov_len = pFrontend->txLength[i];
+  }
+  while (done < pFrontend->txCount)
+  {
+    int sent = sendmmsg(pFrontend->fd, &pFrontend->txMsg[done], pFrontend->txCount - done, MSG_DONTWAIT);
+
+    pFrontend->stats.sendCalls++;
+    if (sent <= 0)
+    {
+      /* Skip the datagram that failed, the client retransmits */
+      pFrontend->stats.sendErrors++;
+      done++;
+      continue;
+    }
+    pFrontend->stats.sent += (uint32_t)sent;
+    done = (uint8_t)(done + sent);
+  }
+  pFrontend->txCount = 0;
+}
+
+uint8_t
+ZipFrontendPendingAdd(
+  ZIP_FRONTEND *pFrontend,
+  const ZIP_CLIENT *pClient,
+  const ZIP_PACKET *pPacket,
+  uint32_t nowMs)
+{
+  ZIP_PENDING *pPending;
+  uint8_t bucket;
+  uint8_t id;
+
+  if (pFrontend->pendingCount >= ZIP_FRONTEND_MAX_PENDING)
+  {
+    return NO_PENDING;
+  }
+  /* Callback IDs are handed out round robin, skipping those in use */
+  do
+  {
+    id = pFrontend->nextCallbackId;
+    pFrontend->nextCallbackId = (uint8_t)((id == ZIP_FRONTEND_MAX_PENDING) ? 1 : id + 1);
+  } while (pFrontend->pending[id].used);
+
+  pPending = &pFrontend->pending[id];
+  pPending->client = *pClient;
+  pPending->startMs = nowMs;
+  pPending->used = TRUE;
+  pPending->ackRequested = (pPacket->flags1 & COMMAND_ZIP_PACKET_PROPERTIES1_ACK_REQUEST_BIT_MASK_V3) ? TRUE : FALSE;
+  pPending->seqNo = pPacket->seqNo;
+  pPending->sourceEndpoint = pPacket->sourceEndpoint;
+  pPending->destinationEndpoint = pPacket->destinationEndpoint;
+  bucket = Bucket(pClient, pPacket->seqNo);
+  pPending->next = pFrontend->buckets[bucket];
+  pFrontend->buckets[bucket] = id;
+  pFrontend->pendingCount++;
+  return id;
+}
+
+BOOL
+ZipFrontendPendingComplete(
+  ZIP_FRONTEND *pFrontend,
+  uint8_t callbackId,
+  BOOL success)
+{
+  ZIP_PENDING *pPending = &pFrontend->pending[callbackId];
+
+  if (NO_PENDING == callbackId || !pPending->used)
+  {
+    return FALSE;
+  }
+  if (pPending->ackRequested)
+  {
+    ZipFrontendReply(pFrontend, &pPending->client, pPending->seqNo, pPending->sourceEndpoint,
+                     pPending->destinationEndpoint,
+                     success ? COMMAND_ZIP_PACKET_PROPERTIES1_ACK_RESPONSE_BIT_MASK_V3
+                             : COMMAND_ZIP_PACKET_PROPERTIES1_NACK_RESPONSE_BIT_MASK_V3);
+  }
+  PendingRemove(pFrontend, callbackId);
+  return TRUE;
+}
+
+uint16_t
+ZipFrontendPendingExpire(
+  ZIP_FRONTEND *pFrontend,
+  uint32_t nowMs,
+  uint32_t timeoutMs)
+{
+  uint16_t dropped = 0;
+  uint16_t id;
+
+  for (id = 1; id <= ZIP_FRONTEND_MAX_PENDING; id++)
+  {
+    if (pFrontend->pending[id].used && (uint32_t)(nowMs - pFrontend->pending[id].startMs) >= timeoutMs)
+    {
+      PendingRemove(pFrontend, (uint8_t)id);
+      dropped++;
+    }
+  }
+  return dropped;
+}
@@ -0,0 +1,126 @@
+#!/usr/bin/env python3
+"""Compile the Z-Wave Manufacturer ID List into a perfect hash table.
+
+Usage: tools/gen_manufacturer_registry.py [workbook] [output.c]
+
+Writes API_sources/ZW_manufacturer_registry_table.c, included by
+ZW_manufacturer_registry.c. Rerun whenever the workbook is updated.
+
+The table is a two level hash and displace table: the top bits of a
+multiplicative hash select a bucket, the bucket's displacement is XORed
+into the hash to select the slot. Displacements are chosen here so that no
+two IDs share a slot, so a lookup is one probe and one compare.
+"""
+
+import os
+import sys
+
+from xlsx_reader import StringPool, clean, read_workbook
+
+ROOT = os.path.join(os.path.dirname(os.path.abspath(__file__)), os.pardir)
+WORKBOOK = os.path.join(ROOT, 'Registries', 'Z-Wave Manufacturer ID List.xlsx')
+OUTPUT = os.path.join(ROOT, 'API_sources', 'ZW_manufacturer_registry_table.c')
+SHEET = 'Manufacturer ID'
+
+# Must match ZW_manufacturer_registry.c
+HASH_MULTIPLIER = 0x9E3779B1
+BUCKET_BITS = 8
+NO_NAME = 0xFFFF
+
+
+def load(path):
+    manufacturers = {}
+    for row in read_workbook(path)[SHEET][1:]:
+        try:
+            manufacturerId = int(clean(row.get('B')), 16)
+        except ValueError:
+            continue
+        name = clean(row.get('A'))
+        if not name:
+            continue
+        # First assignment wins; later rows only repeat reserved IDs
+        manufacturers.setdefault(manufacturerId, (name, clean(row.get('C'))))
+    return manufacturers
+
+
+def hash_id(manufacturerId):
+    return (manufacturerId * HASH_MULTIPLIER) & 0xFFFFFFFF
+
+
+def build(keys):
+    slotBits = max(keys and len(keys) - 1 or 1, 1).bit_length()
+    while True:
+        slots = 1 << slotBits
+        result = try_build(keys, slots)
+        if result:
+            return slots, result
+        slotBits += 1
+
+
+def try_build(keys, slots):
+    buckets = [[] for _ in range(1 << BUCKET_BITS)]
+    for key in keys:
+        buckets[hash_id(key) >> (32 - BUCKET_BITS)].append(key)
+    displacement = [0] * len(buckets)
+    used = [None] * slots
+    order = sorted(range(len(buckets)), key=lambda b: -len(buckets[b]))
+    for bucket in order:
+        members = buckets[bucket]
+        if not members:
+            break
+        for candidate in range(slots):
+            positions = [(hash_id(k) ^ candidate) & (slots - 1) for k in members]
+            if len(set(positions)) == len(positions) and all(used[p] is None for p in positions):
+                for key, position in zip(members, positions):
+                    used[position] = key
+                displacement[bucket] = candidate
+                break
+        else:
+            return None
+    return displacement, used
+
+
+def generate(workbook, output):
+    manufacturers = load(workbook)
+    slots, (displacement, used) = build(sorted(manufacturers))
+    pool = StringPool()
+    entries = []
+    for key in used:
+        if key is None:
+            entries.append('  { 0x0000, 0x%04X, 0x%04X },' % (NO_NAME, NO_NAME))
+            continue
+        name, former = manufacturers[key]
+        nameOffset = pool.add(name)
+        formerOffset = pool.add(former) if former else NO_NAME
+        entries.append('  { 0x%04X, 0x%04X, 0x%04X },' % (key, nameOffset, formerOffset))
+    if pool.size >= NO_NAME:
+        raise SystemExit('string pool exceeds 16 bit offsets')
+
+    lines = [
+        '/****************************************************************************',
+        ' *',
+        ' * Description: Manufacturer ID perfect hash table.',
+        ' *',
+        ' * Generated by tools/gen_manufacturer_registry.py from',
+        ' * "Registries/Z-Wave Manufacturer ID List.xlsx". Do not edit.',
+        ' *',
+        ' ****************************************************************************/',
+        '',
+        '#define MANUFACTURER_TABLE_SLOTS  %d' % slots,
+        '#define MANUFACTURER_TABLE_COUNT  %d' % len(manufacturers),
+        '',
+    ]
+    lines += pool.emit('manufacturerNames')
+    lines += ['', 'static const uint16_t manufacturerDisplacement[%d] =' % len(displacement), '{']
+    for i in range(0, len(displacement), 8):
+        lines.append('  ' + ', '.join('0x%03X' % d for d in displacement[i:i + 8]) + ',')
+    lines += ['};', '', 'static const MANUFACTURER_SLOT manufacturerSlots[MANUFACTURER_TABLE_SLOTS] =', '{']
+    lines += entries
+    lines += ['};', '']
+    with open(output, 'w', newline='\n') as f:
+        f.write('\n'.join(lines))
+
+
+if __name__ == '__main__':
+    generate(sys.argv[1] if len(sys.argv) > 1 else WORKBOOK,
+             sys.argv[2] if len(sys.argv) > 2 else OUTPUT)
@@ -0,0 +1,172 @@
+#!/usr/bin/env python3
+"""Compile the assigned Notifications list into dense lookup tables.
+
+Usage: tools/gen_notification_registry.py [workbook] [output.c]
+
+Writes API_sources/ZW_notification_registry_table.c, included by
+ZW_notification_registry.c. Rerun whenever the workbook is updated.
+
+Notification types index a 256 entry byte table; every type owns a dense
+run of event entries from event 0x00 to its highest assigned event, so a
+(type, event) pair resolves with two array reads. The free text of the
+"Event/State parameters" column is classified into parameter descriptors
+by PARAMETER_RULES below; unknown text stops the generator so a new kind
+of parameter is never silently decoded as something else.
+"""
+
+import os
+import re
+import sys
+
+from xlsx_reader import StringPool, clean, read_workbook
+
+ROOT = os.path.join(os.path.dirname(os.path.abspath(__file__)), os.pardir)
+WORKBOOK = os.path.join(ROOT, 'Registries',
+                        'Notification Command Class, list of assigned Notifications.xlsx')
+OUTPUT = os.path.join(ROOT, 'API_sources', 'ZW_notification_registry_table.c')
+SHEET = 'Notifications'
+
+NO_NAME = 0xFFFF
+NO_TYPE = 0xFF
+UNKNOWN_EVENT = 0xFE
+
+# (match, kind, commandClass, command). The first rule whose regular
+# expression matches the cleaned cell text (case insensitive) applies.
+PARAMETER_RULES = [
+    (r'^$', 'NONE', 0, 0),
+    (r'^Notification value for the state variable going to idle', 'IDLE_EVENT', 0, 0),
+    (r'^Node Location Report', 'COMMAND', 'COMMAND_CLASS_NODE_NAMING', 'NODE_NAMING_NODE_LOCATION_REPORT'),
+    (r'^User Code Report', 'COMMAND', 'COMMAND_CLASS_USER_CODE', 'USER_CODE_REPORT'),
+    (r'^User Notification Report', 'USER_NOTIFICATION', 0, 0),
+    (r'^Credential Notification Report', 'CREDENTIAL_NOTIFICATION', 0, 0),
+    (r'^User Unique Identifier, Credential Type, Credential Slot', 'CREDENTIAL', 0, 0),
+    (r'^Number of Credential Blocks', 'CREDENTIAL_LIST', 0, 0),
+    (r'User Code User Identifier', 'USER_ID', 0, 0),
+    (r'RSSI.*signed', 'SIGNED', 0, 0),
+    (r'^Manufacturer proprietary', 'PROPRIETARY', 0, 0),
+    (r'Byte 1 .* Byte 2 .* Byte 3', 'DURATION', 0, 0),
+    (r'bitmask', 'BITMASK', 0, 0),
+    (r'<[^>]+ID>', 'IDENTIFIER', 0, 0),
+    (r'0x[0-9A-F]{2}\s*(\.\.\s*0x[0-9A-F]{2}\s*)?[:=]', 'ENUM', 0, 0),
+]
+
+_VALUE = re.compile(r'0x([0-9A-F]{2})(?:\s*\.\.\s*0x([0-9A-F]{2}))?\s*[:=]\s*(.*?)'
+                    r'(?=\s*-?\s*0x[0-9A-F]{2}(?:\s*\.\.\s*0x[0-9A-F]{2})?\s*[:=]|$)', re.I)
+
+
+def classify(text):
+    for pattern, kind, commandClass, command in PARAMETER_RULES:
+        if re.search(pattern, text, re.I):
+            values = []
+            if kind == 'ENUM':
+                for low, high, name in _VALUE.findall(text):
+                    name = name.strip(' -')
+                    if name.lower() != 'reserved':
+                        values.append((int(low, 16), int(high or low, 16), name))
+            return kind, commandClass, command, tuple(values)
+    raise SystemExit('unclassified event/state parameters: %r' % text)
+
+
+def load(path):
+    types = []
+    current = None
+    for row in read_workbook(path)[SHEET][2:]:
+        if clean(row.get('B')):
+            current = {'value': int(clean(row['B']), 16), 'name': clean(row.get('A')), 'events': {}}
+            types.append(current)
+        value = clean(row.get('G'))
+        if current is None or not value:
+            continue
+        event = int(value, 16)
+        if event == UNKNOWN_EVENT or event in current['events']:
+            continue
+        kind = clean(row.get('C')).lower()
+        stateVariable = clean(row.get('D'))
+        version = re.match(r'V(\d+)', clean(row.get('H')), re.I)
+        current['events'][event] = {
+            'name': clean(row.get('F')),
+            'state': kind == 'state' and event != 0,
+            'stateVariable': stateVariable if kind == 'state' and not stateVariable.startswith('(') else '',
+            'version': int(version.group(1)) if version else 0,
+            'parameter': classify(clean(row.get('I'))),
+        }
+    return types
+
+
+def generate(workbook, output):
+    types = load(workbook)
+    pool = StringPool()
+    unknownName = pool.add('Unknown event/state')
+    parameters = [classify('')]
+    parameterIndex = {parameters[0]: 0}
+    values = []
+    typeIndex = [NO_TYPE] * 256
+    typeLines = []
+    eventLines = []
+
+    for index, notificationType in enumerate(types):
+        typeIndex[notificationType['value']] = index
+        events = notificationType['events']
+        count = max(events) + 1 if events else 0
+        typeLines.append('  { 0x%04X, %3d, %3d },  /* 0x%02X %s */' % (
+            pool.add(notificationType['name']), len(eventLines), count,
+            notificationType['value'], notificationType['name']))
+        for event in range(count):
+            info = events.get(event)
+            if info is None:
+                eventLines.append('  { 0x%04X, 0x%04X, %2d, 0, 0 },' % (NO_NAME, NO_NAME, 0))
+                continue
+            parameter = info['parameter']
+            if parameter not in parameterIndex:
+                parameterIndex[parameter] = len(parameters)
+                parameters.append(parameter)
+            flags = 'NOTIFICATION_EVENT_FLAG_STATE' if info['state'] else '0'
+            eventLines.append('  { 0x%04X, 0x%04X, %2d, %d, %s },  /* 0x%02X */' % (
+                pool.add(info['name']),
+                pool.add(info['stateVariable']) if info['stateVariable'] else NO_NAME,
+                parameterIndex[parameter], info['version'], flags, event))
+
+    parameterLines = []
+    for kind, commandClass, command, enumValues in parameters:
+        parameterLines.append('  { NOTIFICATION_PARAM_%s, %s, %s, %d, %d },' % (
+            kind, commandClass, command, len(values) if enumValues else 0, len(enumValues)))
+        for low, high, name in enumValues:
+            values.append('  { 0x%02X, 0x%02X, 0x%04X },' % (low, high, pool.add(name)))
+    if pool.size >= NO_NAME:
+        raise SystemExit('string pool exceeds 16 bit offsets')
+
+    lines = [
+        '/****************************************************************************',
+        ' *',
+        ' * Description: Notification type and event tables.',
+        ' *',
+        ' * Generated by tools/gen_notification_registry.py from "Registries/',
+        ' * Notification Command Class, list of assigned Notifications.xlsx".',
+        ' * Do not edit.',
+        ' *',
+        ' ****************************************************************************/',
+        '',
+        '#define NOTIFICATION_TYPE_COUNT      %d' % len(types),
+        '#define NOTIFICATION_UNKNOWN_NAME    0x%04X' % unknownName,
+        '',
+    ]
+    lines += pool.emit('notificationNames')
+    lines += ['', 'static const uint8_t notificationTypeIndex[256] =', '{']
+    for i in range(0, 256, 16):
+        lines.append('  ' + ', '.join('0x%02X' % t for t in typeIndex[i:i + 16]) + ',')
+    lines += ['};', '', 'static const NOTIFICATION_TYPE_ENTRY notificationTypes[%d] =' % len(types), '{']
+    lines += typeLines
+    lines += ['};', '', 'static const NOTIFICATION_EVENT_ENTRY notificationEvents[%d] =' % len(eventLines), '{']
+    lines += eventLines
+    lines += ['};', '', 'static const NOTIFICATION_PARAM_ENTRY notificationParams[%d] =' % len(parameters), '{']
+    lines += parameterLines
+    lines += ['};', '', 'static const NOTIFICATION_VALUE_ENTRY notificationValues[%d] =' % max(len(values), 1), '{']
+    lines += values or ['  { 0, 0, 0 }']
+    lines += ['};', '']
+    with open(output, 'w', newline='\n') as f:
+        f.write('\n'.join(lines))
+
+
+if __name__ == '__main__':
+    generate(sys.argv[1] if len(sys.argv) > 1 else WORKBOOK,
+             sys.argv[2] if len(sys.argv) > 2 else OUTPUT)
@@ -0,0 +1,196 @@
+#!/usr/bin/env python3
+"""Compile the Multilevel Sensor types and scales into conversion tables.
+
+Usage: tools/gen_sensor_multilevel_registry.py [workbook] [output.c]
+
+Writes API_sources/ZW_sensor_multilevel_registry_table.c, included by
+ZW_sensor_multilevel_registry.c. Rerun whenever the workbook is updated.
+
+Every (sensor type, scale) pair owns one slot of 256 x 4 entry tables,
+indexed by (type << 2) | scale. Besides the names, each slot holds the
+coefficients converting a reported value to SI units, si = value * scale +
+offset, chosen by matching the scale label against UNIT_RULES below. A
+label no rule matches stops the generator.
+"""
+
+import os
+import re
+import sys
+
+from xlsx_reader import StringPool, clean, read_workbook
+
+ROOT = os.path.join(os.path.dirname(os.path.abspath(__file__)), os.pardir)
+WORKBOOK = os.path.join(ROOT, 'Registries', 'Multilevel Sensor Command Class, '
+                        'list of assigned Multilevel Sensor types and scales.xlsx')
+OUTPUT = os.path.join(ROOT, 'API_sources', 'ZW_sensor_multilevel_registry_table.c')
+SHEET = 'Multilevel Sensor'
+
+NO_NAME = 0xFFFF
+
+# (label pattern, SI unit, scale, offset). Matched case insensitive against
+# the first line of the scale label, first match wins. Units without an SI
+# equivalent (logarithmic or empirical scales) map to NONE and are passed
+# through unchanged.
+UNIT_RULES = [
+    (r'^Cel[cs]ius', 'KELVIN', 1.0, 273.15),
+    (r'^Fahrenheit', 'KELVIN', 5.0 / 9.0, 273.15 - 32.0 * 5.0 / 9.0),
+    (r'^Percentage value|^RSSI \(percentage', 'DIMENSIONLESS', 0.01, 0.0),
+    (r'^Dimensionless|^Unitless|\(m3/m3\)|\(aw\)', 'DIMENSIONLESS', 1.0, 0.0),
+    (r'^Parts/million', 'DIMENSIONLESS', 1e-6, 0.0),
+    (r'^Lux', 'LUX', 1.0, 0.0),
+    (r'^Watt \(W\)', 'WATT', 1.0, 0.0),
+    (r'^Btu/h', 'WATT', 0.29307107017222, 0.0),
+    (r'\(g/m3\)', 'KILOGRAM_PER_CUBIC_METER', 1e-3, 0.0),
+    (r'\(mg/l\)', 'KILOGRAM_PER_CUBIC_METER', 1e-3, 0.0),
+    (r'\([µμ]g/m3\)', 'KILOGRAM_PER_CUBIC_METER', 1e-9, 0.0),
+    (r'^m/s$', 'METER_PER_SECOND', 1.0, 0.0),
+    (r'^Mph', 'METER_PER_SECOND', 0.44704, 0.0),
+    (r'\(mm/h\)', 'METER_PER_SECOND', 1e-3 / 3600.0, 0.0),
+    (r'\(in/h\)', 'METER_PER_SECOND', 0.0254 / 3600.0, 0.0),
+    (r'degrees', 'RADIAN', 3.14159265358979 / 180.0, 0.0),
+    (r'\(kPa\)', 'PASCAL', 1e3, 0.0),
+    (r'^Inches of Mercury', 'PASCAL', 3386.389, 0.0),
+    (r'\(psi\)', 'PASCAL', 6894.757293168, 0.0),
+    (r'\(mmHg\)', 'PASCAL', 133.322387415, 0.0),
+    (r'\(W/m2\)', 'WATT_PER_SQUARE_METER', 1.0, 0.0),
+    (r'^Meter \(m\)', 'METER', 1.0, 0.0),
+    (r'\(cm\)', 'METER', 1e-2, 0.0),
+    (r'\(ft\)', 'METER', 0.3048, 0.0),
+    (r'\(kg\)', 'KILOGRAM', 1.0, 0.0),
+    (r'\(lb\)', 'KILOGRAM', 0.45359237, 0.0),
+    (r'^Volt \(V\)', 'VOLT', 1.0, 0.0),
+    (r'\(mV\)', 'VOLT', 1e-3, 0.0),
+    (r'\(A\)', 'AMPERE', 1.0, 0.0),
+    (r'\(mA\)', 'AMPERE', 1e-3, 0.0),
+    (r'\(m3/h\)', 'CUBIC_METER_PER_SECOND', 1.0 / 3600.0, 0.0),
+    (r'\(cfm\)', 'CUBIC_METER_PER_SECOND', 0.028316846592 / 60.0, 0.0),
+    (r'\(l/h\)', 'CUBIC_METER_PER_SECOND', 1e-3 / 3600.0, 0.0),
+    (r'\(l\)', 'CUBIC_METER', 1e-3, 0.0),
+    (r'\(m3\)', 'CUBIC_METER', 1.0, 0.0),
+    (r'^Gallons', 'CUBIC_METER', 0.003785411784, 0.0),
+    (r'\(rpm\)|\(bpm\)', 'HERTZ', 1.0 / 60.0, 0.0),
+    (r'\(Hz\)', 'HERTZ', 1.0, 0.0),
+    (r'\(kHz\)', 'HERTZ', 1e3, 0.0),
+    (r'\(Ωm\)', 'OHM_METER', 1.0, 0.0),
+    (r'\(kΩ\)', 'OHM', 1e3, 0.0),
+    (r'\(S/m\)', 'SIEMENS_PER_METER', 1.0, 0.0),
+    (r'\(s\)', 'SECOND', 1.0, 0.0),
+    (r'\(mol/m3\)', 'MOLE_PER_CUBIC_METER', 1.0, 0.0),
+    (r'\(bq/m3\)', 'BECQUEREL_PER_CUBIC_METER', 1.0, 0.0),
+    (r'\(pCi/l\)', 'BECQUEREL_PER_CUBIC_METER', 37.0, 0.0),
+    (r'\(J\)', 'JOULE', 1.0, 0.0),
+    (r'\(m/s2\)', 'METER_PER_SQUARE_SECOND', 1.0, 0.0),
+    (r'\(N\)', 'NEWTON', 1.0, 0.0),
+    (r'^(Mercalli|European Macroseismic|Liedu|Shindo|Local|Moment|Surface wave|Body wave)$',
+     'NONE', 1.0, 0.0),
+    (r'^UV index|^BMI Index|\(pH\)|\(dBA?\)|^dBm$', 'NONE', 1.0, 0.0),
+]
+
+
+def convert(label):
+    for pattern, unit, scale, offset in UNIT_RULES:
+        if re.search(pattern, label, re.I):
+            return unit, scale, offset
+    raise SystemExit('no SI conversion for scale %r' % label)
+
+
+def load(path):
+    sensors = []
+    current = None
+    for row in read_workbook(path)[SHEET][3:]:
+        name = clean(row.get('A'))
+        value = clean(row.get('B'))
+        if name:
+            # Deprecated types carry their value on the following row
+            current = {'name': re.sub(r'\s*\[DEPRECATED[^]]*\]', '', name),
+                       'deprecated': 'DEPRECATED' in name, 'value': None, 'scales': {}}
+            sensors.append(current)
+        if current is None:
+            continue
+        if re.match(r'^0x[0-9A-F]{2}$', value, re.I):
+            current['value'] = int(value, 16)
+        scale = clean(row.get('F'))
+        label = (row.get('E') or '').replace('\xa0', ' ').split('\n')[0].strip()
+        if not re.match(r'^0x0[0-3]$', scale, re.I) or clean(label).lower() == 'reserved':
+            continue
+        version = re.match(r'V(\d+)', clean(row.get('G')), re.I)
+        current['scales'][int(scale, 16)] = (clean(label), int(version.group(1)) if version else 0)
+    return [s for s in sensors if s['value'] and s['scales']]
+
+
+def c_float(value):
+    text = '%.9g' % value
+    if 'e' not in text and '.' not in text:
+        text += '.0'
+    return text + 'f'
+
+
+def generate(workbook, output):
+    sensors = load(workbook)
+    pool = StringPool()
+    typeNames = [NO_NAME] * 256
+    flags = [0] * 256
+    slots = [None] * 1024
+    for sensor in sensors:
+        typeNames[sensor['value']] = pool.add(sensor['name'])
+        flags[sensor['value']] = 1 if sensor['deprecated'] else 0
+        for scale, (label, version) in sensor['scales'].items():
+            unit, factor, offset = convert(label)
+            slots[(sensor['value'] << 2) | scale] = (pool.add(label), unit, factor, offset, version)
+    if pool.size >= NO_NAME:
+        raise SystemExit('string pool exceeds 16 bit offsets')
+    scaleSlots = (max(s['value'] for s in sensors) + 1) << 2
+
+    lines = [
+        '/****************************************************************************',
+        ' *',
+        ' * Description: Multilevel Sensor type and scale tables.',
+        ' *',
+        ' * Generated by tools/gen_sensor_multilevel_registry.py from "Registries/',
+        ' * Multilevel Sensor Command Class, list of assigned Multilevel Sensor',
+        ' * types and scales.xlsx". Do not edit.',
+        ' *',
+        ' ****************************************************************************/',
+        '',
+        '#define SENSOR_ML_TYPE_COUNT  %d' % len(sensors),
+        '#define SENSOR_SCALE_SLOTS    %d' % scaleSlots,
+        '',
+    ]
+    lines += pool.emit('sensorNames')
+    lines += ['', '/* Name offset per sensor type */', 'static const uint16_t sensorTypeName[256] =', '{']
+    for i in range(0, 256, 8):
+        lines.append('  ' + ', '.join('0x%04X' % n for n in typeNames[i:i + 8]) + ',')
+    lines += ['};', '', '/* SENSOR_TYPE_FLAG_DEPRECATED per sensor type */',
+              'static const uint8_t sensorTypeFlags[256] =', '{']
+    for i in range(0, 256, 16):
+        lines.append('  ' + ', '.join('%d' % f for f in flags[i:i + 16]) + ',')
+    lines += ['};', '', '/* Scale name offset and required version per (type << 2) | scale */',
+              'static const SENSOR_SCALE_ENTRY sensorScales[SENSOR_SCALE_SLOTS] =', '{']
+    for index, slot in enumerate(slots[:scaleSlots]):
+        if slot:
+            lines.append('  { 0x%04X, %2d },  /* 0x%02X/%d */' % (slot[0], slot[4], index >> 2, index & 3))
+        else:
+            lines.append('  { 0x%04X,  0 },' % NO_NAME)
+    lines += ['};', '', '/* SI conversion, si = value * scale + offset. NaN scale for unassigned scales */',
+              'static const float sensorSiScale[1024] =', '{']
+    body = []
+    for slot in slots:
+        body.append(c_float(slot[2]) if slot else 'SI_INVALID')
+    for i in range(0, 1024, 4):
+        lines.append('  ' + ', '.join(body[i:i + 4]) + ',')
+    lines += ['};', '', 'static const float sensorSiOffset[1024] =', '{']
+    body = [c_float(slot[3]) if slot else '0.0f' for slot in slots]
+    for i in range(0, 1024, 4):
+        lines.append('  ' + ', '.join(body[i:i + 4]) + ',')
+    lines += ['};', '', 'static const uint8_t sensorSiUnit[1024] =', '{']
+    body = ['SENSOR_SI_%s' % slot[1] if slot else 'SENSOR_SI_INVALID' for slot in slots]
+    for i in range(0, 1024, 4):
+        lines.append('  ' + ', '.join(body[i:i + 4]) + ',')
+    lines += ['};', '']
+    with open(output, 'w', newline='\n') as f:
+        f.write('\n'.join(lines))
+
+
+if __name__ == '__main__':
+    generate(sys.argv[1] if len(sys.argv) > 1 else WORKBOOK,
+             sys.argv[2] if len(sys.argv) > 2 else OUTPUT)
@@ -0,0 +1,104 @@
+"""Minimal reader for the registry workbooks in Registries/.
+
+Only the standard library is used so the generators run anywhere Python 3
+is available. Cells are returned as strings keyed by column letter; numeric
+cells keep their stored text.
+"""
+
+import re
+import zipfile
+import xml.etree.ElementTree as ET
+
+_NS = {'m': 'http://schemas.openxmlformats.org/spreadsheetml/2006/main',
+       'r': 'http://schemas.openxmlformats.org/officeDocument/2006/relationships'}
+_T = '{%s}t' % _NS['m']
+
+
+def _text(node):
+    return ''.join(t.text or '' for t in node.iter(_T))
+
+
+def read_workbook(path):
+    """Return {sheet name: [row dict]} for every worksheet of the workbook."""
+    with zipfile.ZipFile(path) as z:
+        names = z.namelist()
+        strings = []
+        if 'xl/sharedStrings.xml' in names:
+            root = ET.fromstring(z.read('xl/sharedStrings.xml'))
+            strings = [_text(si) for si in root.findall('m:si', _NS)]
+
+        rels = {}
+        if 'xl/_rels/workbook.xml.rels' in names:
+            for rel in ET.fromstring(z.read('xl/_rels/workbook.xml.rels')):
+                rels[rel.get('Id')] = rel.get('Target').lstrip('/')
+
+        sheets = {}
+        workbook = ET.fromstring(z.read('xl/workbook.xml'))
+        for index, sheet in enumerate(workbook.find('m:sheets', _NS)):
+            target = rels.get(sheet.get('{%s}id' % _NS['r']),
+                              'worksheets/sheet%d.xml' % (index + 1))
+            if not target.startswith('xl/'):
+                target = 'xl/' + target
+            if target not in names:
+                continue
+            rows = []
+            for row in ET.fromstring(z.read(target)).iter('{%s}row' % _NS['m']):
+                cells = {}
+                for cell in row.findall('m:c', _NS):
+                    column = re.match('[A-Z]+', cell.get('r')).group()
+                    kind = cell.get('t')
+                    value = cell.find('m:v', _NS)
+                    if kind == 's' and value is not None:
+                        cells[column] = strings[int(value.text)]
+                    elif kind == 'inlineStr':
+                        cells[column] = _text(cell)
+                    elif value is not None:
+                        cells[column] = value.text
+                rows.append(cells)
+            sheets[sheet.get('name')] = rows
+        return sheets
+
+
+def clean(value):
+    """Collapse whitespace, including non-breaking spaces, of a cell."""
+    if value is None:
+        return ''
+    return ' '.join(value.replace('\xa0', ' ').split())
+
+
+def c_string(value):
+    """Quote a string as a C literal, non-ASCII bytes as octal escapes."""
+    out = []
+    for byte in value.encode('utf-8'):
+        if byte in (0x22, 0x5C):
+            out.append('\\' + chr(byte))
+        elif 0x20 <= byte < 0x7F:
+            out.append(chr(byte))
+        else:
+            out.append('\\%03o' % byte)
+    return '"' + ''.join(out) + '"'
+
+
+class StringPool(object):
+    """Interned, NUL separated string pool addressed by byte offset."""
+
+    def __init__(self):
+        self.offsets = {}
+        self.strings = []
+        self.size = 0
+
+    def add(self, value):
+        if value not in self.offsets:
+            self.offsets[value] = self.size
+            self.strings.append(value)
+            self.size += len(value.encode('utf-8')) + 1
+        return self.offsets[value]
+
+    def emit(self, name, indent='  '):
+        lines = ['static const char %s[%d] =' % (name, max(self.size, 1))]
+        if not self.strings:
+            lines.append('%s""' % indent)
+        for value in self.strings:
+            lines.append('%s%s "\\0"' % (indent, c_string(value)))
+        lines[-1] += ';'
+        return lines